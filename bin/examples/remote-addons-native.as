@@ -1,9 +1,9 @@
-/* Contains C++ code for printing hello world */
-import from "@avgpythonenjoyer/hello";
-
-[#console::main]
-int main()
-{
-    print_hello_world();
-    return 0;
+/* Contains C++ code for printing hello world */
+import from "@avgpythonenjoyer/hello";
+
+[#console::main]
+int main()
+{
+    print_hello_world();
+    return 0;
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+/*
+    This is a simple test that will load all cores
+    with allocations of short-lived script objects.
+    Run it with default allocator and then with
+    --allocator=threaded (or --allocator=huge) to
+    compare against system malloc, add --allocator-stats
+    to see per size class statistics on exit.
+*/
+import from { "console", "os" };
+
+class test_node
+{
+    test_node@ next = null;
+    string name;
+    int32 value = 0;
+}
+
+class test_worker
+{
+    int32[]@ hashes = null;
+    int32 value = 0;
+
+    void execute(usize begin, usize end)
+    {
+        for (usize i = begin; i < end; i++)
+        {
+            int32 hash = 0;
+            for (int32 j = 0; j < value; j++)
+            {
+                test_node@ head = test_node();
+                head.value = j;
+                head.name = to_string(j);
+                @head.next = test_node();
+                head.next.value = hash;
+                hash = (hash * 31 + head.value + head.next.value + int32(head.name.size())) % (2 << 29);
+            }
+            hashes[i] = hash;
+        }
+    }
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    output.capture_time();
+    if (args.empty())
+    {
+        output.write_line("provide test sequence index");
+        output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+        return 1;
+    }
+
+    int32 index = to_int32(args[args.size() - 1]);
+    if (index <= 0)
+    {
+        output.write_line("invalid test sequence index");
+        output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+        return 2;
+    }
+
+    usize jobs_count = usize(os::cpu::get_quantity_info().logical);
+    test_worker@ worker = test_worker();
+    @worker.hashes = array<int32>();
+    worker.hashes.resize(jobs_count);
+    worker.value = index;
+
+    parallel::for_range(0, jobs_count, parallel::range_event(worker.execute), 1);
+    for (usize i = 0; i < jobs_count; i++)
+        output.write_line("worker result #" + to_string(i + 1) + ": " + to_string(worker.hashes[i]));
+
+    output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*
+    This is a simple test that will measure await
+    throughput of a single context. First pass awaits
+    promises that are already settled, second pass awaits
+    promises that are settled later by the scheduler which
+    forces a suspend and a round trip through event loop.
+*/
+import from { "console", "promise", "schedule", "timestamp" };
+
+class deferred_task
+{
+    promise<int32>@ data = promise<int32>();
+    int32 value = 0;
+
+    void settle()
+    {
+        data.wrap(value);
+    }
+}
+
+promise<int32>@ settled(int32 value)
+{
+    promise<int32>@ result = promise<int32>();
+    result.wrap(value);
+    return result;
+}
+promise<int32>@ deferred(int32 value)
+{
+    deferred_task@ task = deferred_task();
+    task.value = value;
+
+    schedule@ queue = schedule::get();
+    queue.set_timeout(0, task_async(task.settle));
+    return task.data;
+}
+void report(console@ output, const string&in name, int32 count, int64 time)
+{
+    string rate = time > 0 ? to_string(int64(count) * 1000 / time) : string("inf");
+    output.write_line(name + ": " + to_string(count) + " awaits in " + to_string(time) + "ms (" + rate + " awaits/s)");
+}
+
+[#console::main]
+[#schedule::main(threads = 1, stop = true)]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    if (args.empty())
+    {
+        output.write_line("provide test sequence index");
+        return 1;
+    }
+
+    int32 count = to_int32(args[args.size() - 1]);
+    if (count <= 0)
+    {
+        output.write_line("invalid test sequence index");
+        return 2;
+    }
+
+    int32 hash = 0;
+    int64 start = timestamp().milliseconds();
+    for (int32 i = 0; i < count; i++)
+        hash ^= co_await settled(i);
+    report(output, "settled", count, timestamp().milliseconds() - start);
+
+    start = timestamp().milliseconds();
+    for (int32 i = 0; i < count; i++)
+        hash ^= co_await deferred(i);
+    report(output, "deferred", count, timestamp().milliseconds() - start);
+
+    output.write_line("result: " + to_string(hash));
+    return 0;
+}
\ No newline at end of file
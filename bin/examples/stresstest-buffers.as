@@ -0,0 +1,73 @@
+/*
+    This is a simple test that will measure throughput
+    of bulk numeric operations. First pass smooths and
+    aggregates a signal with element by element loops,
+    second pass does the same with buffer kernels over
+    the same contiguous arrays.
+*/
+import from { "console", "timestamp" };
+
+double[]@ create_signal(usize size)
+{
+    double[]@ result = array<double>();
+    result.reserve(size);
+    for (usize i = 0; i < size; i++)
+        result.push(double(i % 1000) * 0.001);
+    return result;
+}
+bool is_close(double a, double b)
+{
+    double difference = a > b ? a - b : b - a;
+    double scale = a > 0.0 ? a : -a;
+    return difference <= scale * 0.000001 + 0.000001;
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    int32 count = args.empty() ? 4000000 : to_int32(args[args.size() - 1]);
+    if (count <= 0)
+    {
+        output.write_line("invalid signal size");
+        return 1;
+    }
+
+    usize size = usize(count);
+    double[]@ signal = create_signal(size);
+    double[]@ weights = create_signal(size);
+
+    double[]@ values = create_signal(size);
+    int64 start = timestamp().milliseconds();
+    for (usize i = 0; i < size; i++)
+        values[i] = values[i] * 0.5 + 0.25;
+    for (usize i = 0; i < size; i++)
+        values[i] += signal[i] * 0.1;
+    double sum = 0.0, dot = 0.0, minimum = values[0], maximum = values[0];
+    for (usize i = 0; i < size; i++)
+    {
+        sum += values[i];
+        dot += values[i] * weights[i];
+        if (values[i] < minimum)
+            minimum = values[i];
+        if (values[i] > maximum)
+            maximum = values[i];
+    }
+    int64 loop_time = timestamp().milliseconds() - start;
+
+    double[]@ bulk = create_signal(size);
+    start = timestamp().milliseconds();
+    buffer::mul(bulk, 0.5);
+    buffer::add(bulk, 0.25);
+    buffer::fma(bulk, signal, 0.1);
+    double bulk_sum = buffer::sum(bulk), bulk_dot = buffer::dot(bulk, weights);
+    double bulk_minimum = buffer::min(bulk), bulk_maximum = buffer::max(bulk);
+    int64 bulk_time = timestamp().milliseconds() - start;
+
+    int32[] wide = { 2147483647, 2147483647, 1, 1 };
+    bool widened = buffer::sum(wide) == int64(2147483647) * 2 + 2 && buffer::dot(wide, wide) == int64(2147483647) * 2147483647 * 2 + 2;
+    bool matches = is_close(sum, bulk_sum) && is_close(dot, bulk_dot) && minimum == bulk_minimum && maximum == bulk_maximum && widened;
+    output.write_line("loops: " + to_string(loop_time) + "ms, buffer: " + to_string(bulk_time) + "ms");
+    output.write_line("result: " + string(matches ? "OK" : "FAIL") + " (sum: " + to_string(bulk_sum) + ", mean: " + to_string(buffer::mean(bulk)) + ")");
+    return matches ? 0 : 2;
+}
\ No newline at end of file
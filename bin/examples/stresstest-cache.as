@@ -0,0 +1,58 @@
+/*
+    This is a simple test that will measure throughput
+    of shared cache that is accessed from all cores at
+    once. Most of the operations are lookups of hot keys,
+    misses are filled with fresh values, part of values
+    expire and part of them are evicted by size budget.
+*/
+import from { "console", "os", "timestamp" };
+
+class cache_worker
+{
+    usize keys = 0;
+
+    void execute(usize begin, usize end)
+    {
+        string value;
+        for (usize i = begin; i < end; i++)
+        {
+            string key = "key:" + to_string((i * 7919) % keys);
+            if (!cache::get(key, value))
+                cache::set(key, "value of " + key, i % 4 == 0 ? 50 : 0);
+        }
+    }
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    int32 count = args.empty() ? 4000000 : to_int32(args[args.size() - 1]);
+    if (count <= 0)
+    {
+        output.write_line("invalid operations count");
+        return 1;
+    }
+
+    cache_worker@ worker = cache_worker();
+    worker.keys = usize(count) / 100 + 1;
+    cache::set_budget(4 * 1024 * 1024);
+    cache::set_policy(cache::policy::lfu);
+
+    int64 start = timestamp().milliseconds();
+    parallel::for_range(0, usize(count), parallel::range_event(worker.execute));
+    int64 time = timestamp().milliseconds() - start;
+
+    uint64 hits = cache::get_hits(), misses = cache::get_misses();
+    output.write_line("threads: " + to_string(os::cpu::get_quantity_info().logical));
+    output.write_line("operations: " + to_string(count) + " in " + to_string(time) + "ms (" + to_string(double(count) / double(time > 0 ? time : 1)) + " per ms)");
+    output.write_line("hit rate: " + to_string(double(hits) * 100.0 / double(hits + misses > 0 ? hits + misses : 1)) + "%");
+    output.write_line("entries: " + to_string(cache::size()) + ", " + to_string(cache::get_bytes()) + " bytes");
+    output.write_line("evictions: " + to_string(cache::get_evictions()) + ", expirations: " + to_string(cache::get_expirations()));
+
+    string oversized;
+    oversized.resize(cache::get_entry_limit() + 1);
+    bool rejected = !cache::set("oversized", oversized) && cache::get_rejections() == 1 && !cache::has("oversized");
+    output.write_line("oversized entry: " + string(rejected ? "rejected" : "FAIL"));
+    return rejected ? 0 : 2;
+}
\ No newline at end of file
@@ -0,0 +1,90 @@
+/*
+    This is a simple test that will measure throughput
+    of a producer/consumer pipeline. Producers and a
+    consumer are pooled jobs that pass messages through
+    bounded channel, consumer sums received values into
+    an atomic counter. Requires at least two cores.
+*/
+import from { "console", "os", "promise" };
+
+class producer
+{
+    channel<int64>@ queue = null;
+    int32 count = 0;
+
+    void execute()
+    {
+        for (int32 i = 1; i <= count; i++)
+            queue.send(int64(i));
+    }
+}
+
+class consumer
+{
+    channel<int64>@ queue = null;
+    atomic@ sum = null;
+
+    void execute()
+    {
+        int64 value = 0;
+        while (queue.receive(value))
+            sum.fetch_add(value, memory_order::relaxed);
+    }
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    output.capture_time();
+
+    int32 count = 100000;
+    if (!args.empty())
+    {
+        int32 value = to_int32(args[args.size() - 1]);
+        if (value > 0)
+            count = value;
+    }
+
+    usize producers_count = usize(os::cpu::get_quantity_info().logical) / 2;
+    if (producers_count < 1)
+        producers_count = 1;
+
+    channel<int64>@ queue = channel<int64>(1024);
+    atomic@ sum = atomic(0);
+    consumer@ reader = consumer();
+    @reader.queue = queue;
+    @reader.sum = sum;
+
+    parallel::job@ reader_job = parallel::spawn(parallel::job_event(reader.execute));
+    parallel::job@[] jobs = array<parallel::job@>();
+    for (usize i = 0; i < producers_count; i++)
+    {
+        producer@ writer = producer();
+        @writer.queue = queue;
+        writer.count = count;
+        jobs.push(parallel::spawn(parallel::job_event(writer.execute)));
+    }
+
+    /* wait for producers, then let consumer drain the channel */
+    for (usize i = 0; i < jobs.size(); i++)
+        jobs[i].join();
+    queue.close();
+    reader_job.join();
+
+    int64 expected = int64(count) * int64(count + 1) / 2 * int64(producers_count);
+    int64 result = sum.load();
+    output.write_line("producers: " + to_string(producers_count) + ", messages: " + to_string(int64(count) * int64(producers_count)));
+    output.write_line("sum result: " + string(result == expected ? "OK" : "FAIL") + " (" + to_string(result) + ")");
+    start_async_test(output);
+    output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+    return 0;
+}void start_async_test(console@ output)
+{
+    /* receivers may await instead of blocking the thread */
+    channel<string>@ queue = channel<string>(4);
+    promise<string>@ pending = queue.receive_async();
+    queue.send("async");
+    string value = co_await pending;
+    output.write_line("async result: " + string(value == "async" ? "OK" : "FAIL"));
+}
@@ -0,0 +1,44 @@
+/*
+    This is a simple test that will measure string
+    concatenation throughput. First pass builds output
+    with "a + b + c" chains that allocate a temporary
+    for each "+", second pass appends the same pieces
+    into one pre-sized string builder buffer.
+*/
+import from { "console", "timestamp" };
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    int32 count = args.empty() ? 1000000 : to_int32(args[args.size() - 1]);
+    if (count <= 0)
+    {
+        output.write_line("invalid lines count");
+        return 1;
+    }
+
+    string value = "0123456789";
+    int64 start = timestamp().milliseconds();
+    string chained;
+    for (int32 i = 0; i < count; i++)
+        chained += "worker result #" + to_string(i + 1) + ": " + value + "\n";
+    int64 chained_time = timestamp().milliseconds() - start;
+
+    start = timestamp().milliseconds();
+    string_builder@ builder = string_builder(chained.size());
+    for (int32 i = 0; i < count; i++)
+    {
+        builder.append("worker result #");
+        builder.append_int(i + 1);
+        builder.append(": ");
+        builder.append(value);
+        builder.append_line();
+    }
+    string built = builder.take();
+    int64 built_time = timestamp().milliseconds() - start;
+
+    output.write_line("chained: " + to_string(chained_time) + "ms, builder: " + to_string(built_time) + "ms");
+    output.write_line("result: " + string(chained == built ? "OK" : "FAIL") + " (" + to_string(built.size() / 1024) + "KB)");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+    This is a simple test that will measure garbage
+    collector pauses on a synthetic server heap. A large
+    long-lived object graph is created first, then each
+    tick creates many short-lived cyclic objects and
+    yields back to event loop where collection happens.
+    Compare default mode with --incremental-gc.
+*/
+import from { "console", "promise", "schedule", "timestamp" };
+
+class graph_node
+{
+    graph_node@ parent = null;
+    graph_node@[] children;
+    int32 value = 0;
+}
+
+graph_node@[] cache = array<graph_node@>();
+
+void create_cache(int32 count)
+{
+    graph_node@ root = graph_node();
+    cache.reserve(usize(count));
+    cache.push(root);
+    for (int32 i = 1; i < count; i++)
+    {
+        graph_node@ next = graph_node();
+        @next.parent = cache[usize(i / 8)];
+        next.value = i;
+        next.parent.children.push(next);
+        cache.push(next);
+    }
+}
+int32 create_garbage(int32 count)
+{
+    int32 result = 0;
+    for (int32 i = 0; i < count; i++)
+    {
+        graph_node@ a = graph_node(), b = graph_node();
+        @a.parent = b;
+        @b.parent = a;
+        a.value = i;
+        result += a.value;
+    }
+    return result;
+}
+class timeout_task
+{
+    promise<void>@ data = promise<void>();
+
+    void settle()
+    {
+        data.wrap();
+    }
+}
+
+promise<void>@ sleep(uint64 timeout_ms)
+{
+    timeout_task@ task = timeout_task();
+    schedule@ queue = schedule::get();
+    queue.set_timeout(timeout_ms, task_async(task.settle));
+    return task.data;
+}
+
+[#console::main]
+[#schedule::main(threads = 1, stop = true)]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    int32 ticks = args.empty() ? 200 : to_int32(args[args.size() - 1]);
+    if (ticks <= 0)
+    {
+        output.write_line("invalid ticks count");
+        return 1;
+    }
+
+    int64 start = timestamp().milliseconds();
+    create_cache(200000);
+    output.write_line("long-lived objects: " + to_string(cache.size()) + " in " + to_string(timestamp().milliseconds() - start) + "ms");
+
+    int64 worst = 0, total = 0;
+    for (int32 i = 0; i < ticks; i++)
+    {
+        create_garbage(10000);
+        int64 before = timestamp().milliseconds();
+        co_await sleep(1);
+
+        int64 pause = timestamp().milliseconds() - before - 1;
+        if (pause < 0)
+            pause = 0;
+        if (pause > worst)
+            worst = pause;
+        total += pause;
+    }
+
+    output.write_line("ticks: " + to_string(ticks) + ", short-lived objects: " + to_string(int64(ticks) * 20000));
+    output.write_line("pause avg: " + to_string(total / int64(ticks)) + "ms, max: " + to_string(worst) + "ms");
+    output.write_line("time: " + to_string(timestamp().milliseconds() - start) + "ms");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+/*
+    This is a simple test that will generate a synthetic
+    project of many small files that include each other
+    as a binary tree. Half of the files are leaves without
+    directives. Run generated entry file with startup
+    tracing to measure time-to-compile of the project:
+        asx --trace-startup includes/main.as
+    Add --verbatim-includes to insert leaves as is, then
+    second run will reuse cached preprocessor verdicts.
+*/
+import from { "console", "os" };
+
+string generate_unit(int32 index, int32 count)
+{
+    int32 left = index * 2 + 1, right = index * 2 + 2;
+    string data;
+    if (left < count)
+        data += "#include \"unit_" + to_string(left) + ".as\"\n";
+    if (right < count)
+        data += "#include \"unit_" + to_string(right) + ".as\"\n";
+
+    data += "\nint unit_" + to_string(index) + "(int value)\n{\n";
+    data += "    int result = value * " + to_string(index + 1) + ";\n";
+    if (left < count)
+        data += "    result += unit_" + to_string(left) + "(value + 1);\n";
+    if (right < count)
+        data += "    result -= unit_" + to_string(right) + "(value + 2);\n";
+    data += "    for (int i = 0; i < 4; i++)\n        result = (result << 1) ^ i;\n";
+    data += "    return result;\n}\n";
+    return data;
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    output.capture_time();
+    int32 count = args.empty() ? 500 : to_int32(args[args.size() - 1]);
+    if (count <= 0)
+    {
+        output.write_line("invalid files count");
+        return 1;
+    }
+
+    string directory = "includes/";
+    if (!os::directory::patch(directory))
+    {
+        output.write_line("cannot create directory " + directory);
+        return 2;
+    }
+
+    for (int32 i = 0; i < count; i++)
+    {
+        if (!os::file::write(directory + "unit_" + to_string(i) + ".as", generate_unit(i, count)))
+        {
+            output.write_line("cannot write unit #" + to_string(i));
+            return 3;
+        }
+    }
+
+    string main = "import from \"console\";\n#include \"unit_0.as\"\n\n[#console::main]\nint main()\n{\n    console::get().write_line(\"result: \" + to_string(unit_0(1)));\n    return 0;\n}\n";
+    if (!os::file::write(directory + "main.as", main))
+    {
+        output.write_line("cannot write entry file");
+        return 3;
+    }
+
+    output.write_line("generated " + to_string(count) + " files in " + directory);
+    output.write_line("run: asx --trace-startup [--verbatim-includes] " + directory + "main.as");
+    output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+    return 0;
+}
\ No newline at end of file
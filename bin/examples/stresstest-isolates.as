@@ -0,0 +1,75 @@
+/*
+    This is a simple test that will load all cores
+    just like stresstest-mt.as does. However, here
+    each worker is an isolate that has it's own virtual
+    machine, so no globals or objects are shared between
+    workers. Inputs and results are sent through channels
+    that only carry strings (serialized values).
+*/
+import from { "console", "os" };
+
+int32 compute(int32 index, int32 value)
+{
+    int32 hash = index, max = 2 << 29;
+    while (value > 0)
+        hash = ((hash << 5) - hash + value--) % max;
+    return hash;
+}
+int worker()
+{
+    string index, value;
+    if (!this_isolate::receive(index) || !this_isolate::receive(value))
+        return 1;
+
+    this_isolate::send(to_string(compute(to_int32(index), to_int32(value))));
+    return 0;
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    if (this_isolate::is_active())
+        return worker();
+
+    console@ output = console::get();
+    output.capture_time();
+    if (args.empty())
+    {
+        output.write_line("provide test sequence index");
+        output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+        return 1;
+    }
+
+    int32 index = to_int32(args[args.size() - 1]);
+    if (index <= 0)
+    {
+        output.write_line("invalid test sequence index");
+        output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+        return 2;
+    }
+
+    usize workers_count = usize(os::cpu::get_quantity_info().logical);
+    isolate@[] workers = array<isolate@>();
+    workers.reserve(workers_count);
+
+    /* spawn isolates and send their inputs */
+    for (usize i = 0; i < workers_count; i++)
+    {
+        isolate@ next = isolate("stresstest-isolates.as");
+        next.send(to_string(i * 4));
+        next.send(to_string(index));
+        workers.push(next);
+    }
+
+    /* receive results and wait for isolates to finish */
+    for (usize i = 0; i < workers_count; i++)
+    {
+        string value;
+        workers[i].receive(value);
+        workers[i].join();
+        output.write_line("worker result #" + to_string(i + 1) + ": " + value);
+    }
+
+    output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+    return 0;
+}
\ No newline at end of file
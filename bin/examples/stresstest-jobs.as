@@ -0,0 +1,96 @@
+/*
+    This is a simple test that will measure spawn and
+    join latency of many tiny jobs. First half creates
+    native threads for each job, second half reuses
+    pooled native threads through parallel::spawn.
+    Jobs are executed in batches to limit the amount of
+    simultaneously existing native threads.
+*/
+import from { "console", "os", "thread" };
+
+int32[]@ hashes = null;
+
+void execute_job(usize index)
+{
+    int32 hash = int32(index), max = 2 << 29, next = 16;
+    while (next > 0)
+        hash = ((hash << 5) - hash + next--) % max;
+    hashes[index] = hash;
+}
+
+class thread_job
+{
+    usize index = 0;
+
+    void execute(thread@)
+    {
+        execute_job(index);
+    }
+}
+
+class pooled_job
+{
+    usize index = 0;
+
+    void execute()
+    {
+        execute_job(index);
+    }
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    usize jobs_count = 10000;
+    if (!args.empty())
+    {
+        int32 value = to_int32(args[args.size() - 1]);
+        if (value > 0)
+            jobs_count = usize(value);
+    }
+
+    usize batch_size = usize(os::cpu::get_quantity_info().logical) * 4;
+    @hashes = array<int32>();
+    hashes.resize(jobs_count);
+
+    /* one native thread per job */
+    output.capture_time();
+    for (usize offset = 0; offset < jobs_count; offset += batch_size)
+    {
+        thread@[] threads = array<thread@>();
+        for (usize i = offset; i < offset + batch_size && i < jobs_count; i++)
+        {
+            thread_job@ job = thread_job();
+            job.index = i;
+
+            thread@ next = thread(thread_parallel(job.execute));
+            next.invoke();
+            threads.push(@next);
+        }
+        for (usize i = 0; i < threads.size(); i++)
+            threads[i].join();
+    }
+    double threads_time = output.get_captured_time();
+
+    /* pooled native threads */
+    output.capture_time();
+    for (usize offset = 0; offset < jobs_count; offset += batch_size)
+    {
+        parallel::job@[] jobs = array<parallel::job@>();
+        for (usize i = offset; i < offset + batch_size && i < jobs_count; i++)
+        {
+            pooled_job@ job = pooled_job();
+            job.index = i;
+            jobs.push(parallel::spawn(parallel::job_event(job.execute)));
+        }
+        for (usize i = 0; i < jobs.size(); i++)
+            jobs[i].join();
+    }
+    double pooled_time = output.get_captured_time();
+
+    output.write_line("jobs: " + to_string(jobs_count));
+    output.write_line("threads: " + to_string(threads_time) + "ms (" + to_string(threads_time * 1000.0 / double(jobs_count)) + "us per job)");
+    output.write_line("pooled: " + to_string(pooled_time) + "ms (" + to_string(pooled_time * 1000.0 / double(jobs_count)) + "us per job)");
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,129 @@
+/*
+    This is a simple test that will measure throughput
+    of json processing. First pass parses a large document
+    into a schema tree and serializes it back, second pass
+    streams the same document through a pull reader and
+    a writer without building any intermediate tree. Both
+    outputs must describe the same document.
+*/
+import from { "console", "schema", "timestamp" };
+
+string create_document(usize count)
+{
+    json_writer@ writer = json_writer();
+    writer.begin_array();
+    for (usize i = 0; i < count; i++)
+    {
+        writer.begin_object();
+        writer.key("id");
+        writer.write_integer(int64(i));
+        writer.key("name");
+        writer.write_string("item \"" + to_string(i) + "\"");
+        writer.key("price");
+        writer.write_number(double(i % 1000) * 0.25);
+        writer.key("active");
+        writer.write_boolean(i % 2 == 0);
+        writer.key("tags");
+        writer.begin_array();
+        writer.write_string("alpha");
+        writer.write_null();
+        writer.end_array();
+        writer.end_object();
+    }
+    writer.end_array();
+    string result = writer.flush();
+    return result;
+}
+usize events = 0;
+
+bool transcode(json_reader@ reader, json_writer@ writer)
+{
+    while (true)
+    {
+        json_event next = reader.next();
+        switch (next)
+        {
+            case json_event::begin_object:
+                writer.begin_object();
+                break;
+            case json_event::end_object:
+                writer.end_object();
+                break;
+            case json_event::begin_array:
+                writer.begin_array();
+                break;
+            case json_event::end_array:
+                writer.end_array();
+                break;
+            case json_event::key:
+                writer.key(reader.get_string());
+                break;
+            case json_event::string_value:
+                writer.write_string(reader.get_string());
+                break;
+            case json_event::number_value:
+                writer.write_raw(reader.get_raw());
+                break;
+            case json_event::boolean_value:
+                writer.write_boolean(reader.get_boolean());
+                break;
+            case json_event::null_value:
+                writer.write_null();
+                break;
+            case json_event::need:
+            case json_event::end:
+                return true;
+            default:
+                return false;
+        }
+        ++events;
+    }
+    return false;
+}
+string get_throughput(usize size, int64 time)
+{
+    return to_string(double(size) / 1048576.0 / (double(time > 0 ? time : 1) / 1000.0)) + "mb/s";
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    int32 count = args.empty() ? 200000 : to_int32(args[args.size() - 1]);
+    if (count <= 0)
+    {
+        output.write_line("invalid items count");
+        return 1;
+    }
+
+    string document = create_document(usize(count));
+    int64 start = timestamp().milliseconds();
+    schema@ tree = schema::from_json(document);
+    string tree_result = (tree is null ? "" : tree.to_json());
+    int64 tree_time = timestamp().milliseconds() - start;
+
+    usize chunk_size = 64 * 1024;
+    json_reader@ reader = json_reader();
+    json_writer@ writer = json_writer();
+    string stream_result;
+    bool success = true;
+    start = timestamp().milliseconds();
+    for (usize offset = 0; success && offset < document.size(); offset += chunk_size)
+    {
+        reader.feed(document.substr(offset, chunk_size));
+        success = transcode(reader, writer);
+        stream_result += writer.flush();
+    }
+    reader.finish();
+    success = success && transcode(reader, writer);
+    stream_result += writer.flush();
+    int64 stream_time = timestamp().milliseconds() - start;
+
+    output.write_line("document: " + to_string(document.size()) + " bytes, " + to_string(events) + " events");
+    output.write_line("tree: " + to_string(tree_time) + "ms (" + get_throughput(document.size(), tree_time) + ")");
+    output.write_line("stream: " + to_string(stream_time) + "ms (" + get_throughput(document.size(), stream_time) + ")");
+    schema@ stream_tree = schema::from_json(stream_result);
+    success = success && stream_result == document && stream_tree !is null && stream_tree.to_json() == tree_result;
+    output.write_line("result: " + (success ? "OK" : "FAIL"));
+    return success ? 0 : 2;
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+/*
+    This is a simple test that will measure throughput
+    and size of binary serialization formats. A schema
+    tree is encoded and decoded as json, msgpack and cbor,
+    then an array of script objects is packed directly
+    without building any intermediate schema tree.
+*/
+import from { "console", "schema", "timestamp" };
+
+class item
+{
+    int64 id = 0;
+    string name;
+    double price = 0.0;
+    bool active = false;
+    int32[] tags;
+}
+
+string create_document(usize count)
+{
+    uptr@ writer = json_writer::create();
+    json_writer::begin_array(writer);
+    for (usize i = 0; i < count; i++)
+    {
+        json_writer::begin_object(writer);
+        json_writer::key(writer, "id");
+        json_writer::write_integer(writer, int64(i));
+        json_writer::key(writer, "name");
+        json_writer::write_string(writer, "item #" + to_string(i));
+        json_writer::key(writer, "price");
+        json_writer::write_number(writer, double(i % 1000) * 0.25);
+        json_writer::key(writer, "active");
+        json_writer::write_boolean(writer, i % 2 == 0);
+        json_writer::key(writer, "tags");
+        json_writer::begin_array(writer);
+        json_writer::write_integer(writer, int64(i % 7));
+        json_writer::write_integer(writer, int64(i % 13));
+        json_writer::end_array(writer);
+        json_writer::end_object(writer);
+    }
+    json_writer::end_array(writer);
+    string result = json_writer::flush(writer);
+    json_writer::destroy(writer);
+    return result;
+}
+item@[]@ create_items(usize count)
+{
+    item@[]@ result = array<item@>();
+    result.reserve(count);
+    for (usize i = 0; i < count; i++)
+    {
+        item@ next = item();
+        next.id = int64(i);
+        next.name = "item #" + to_string(i);
+        next.price = double(i % 1000) * 0.25;
+        next.active = i % 2 == 0;
+        next.tags.push(int32(i % 7));
+        next.tags.push(int32(i % 13));
+        result.push(next);
+    }
+    return result;
+}
+void print_result(console@ output, const string&in name, usize size, int64 encode_time, int64 decode_time, bool success)
+{
+    output.write_line(name + ": " + to_string(size) + " bytes, encode " + to_string(encode_time) + "ms, decode " + to_string(decode_time) + "ms" + (success ? "" : " (FAIL)"));
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    int32 count = args.empty() ? 100000 : to_int32(args[args.size() - 1]);
+    if (count <= 0)
+    {
+        output.write_line("invalid items count");
+        return 1;
+    }
+
+    schema@ tree = schema::from_json(create_document(usize(count)));
+    if (tree is null)
+    {
+        output.write_line("cannot create test document");
+        return 2;
+    }
+
+    int64 start = timestamp().milliseconds();
+    string json = tree.to_json();
+    int64 encode_time = timestamp().milliseconds() - start;
+    start = timestamp().milliseconds();
+    schema@ json_tree = schema::from_json(json);
+    print_result(output, "json", json.size(), encode_time, timestamp().milliseconds() - start, json_tree !is null);
+
+    start = timestamp().milliseconds();
+    string msgpack_data = msgpack::encode(tree);
+    encode_time = timestamp().milliseconds() - start;
+    start = timestamp().milliseconds();
+    schema@ msgpack_tree = msgpack::decode(msgpack_data);
+    print_result(output, "msgpack", msgpack_data.size(), encode_time, timestamp().milliseconds() - start, msgpack_tree !is null && msgpack_tree.to_json() == json);
+
+    start = timestamp().milliseconds();
+    string cbor_data = cbor::encode(tree);
+    encode_time = timestamp().milliseconds() - start;
+    start = timestamp().milliseconds();
+    schema@ cbor_tree = cbor::decode(cbor_data);
+    print_result(output, "cbor", cbor_data.size(), encode_time, timestamp().milliseconds() - start, cbor_tree !is null && cbor_tree.to_json() == json);
+
+    item@[]@ items = create_items(usize(count));
+    start = timestamp().milliseconds();
+    string packed_data = msgpack::pack(items);
+    encode_time = timestamp().milliseconds() - start;
+    start = timestamp().milliseconds();
+    schema@ packed_tree = msgpack::decode(packed_data);
+    print_result(output, "msgpack (schema-less)", packed_data.size(), encode_time, timestamp().milliseconds() - start, packed_tree !is null && packed_tree.size() == items.size());
+
+    string_builder@ builder = string_builder(msgpack_data.size() * 2);
+    msgpack::encode_into(builder, tree);
+    msgpack::pack_into(builder, items);
+    string stream = builder.take();
+
+    usize offset = 0, messages = 0;
+    pack_status status = pack_status::success;
+    schema@ next = msgpack::decode_next(stream, offset, offset, status);
+    while (next !is null)
+    {
+        ++messages;
+        @next = msgpack::decode_next(stream, offset, offset, status);
+    }
+    output.write_line("stream: " + to_string(messages) + " messages, " + to_string(offset) + "/" + to_string(stream.size()) + " bytes");
+
+    pack_status truncated = pack_status::success, corrupted = pack_status::success;
+    msgpack::decode_next(msgpack_data.substr(0, msgpack_data.size() / 2), 0, offset, truncated);
+    msgpack::decode_next("\xc1", 0, offset, corrupted);
+    bool statuses = status == pack_status::incomplete && truncated == pack_status::incomplete && corrupted == pack_status::invalid;
+    output.write_line("status: " + string(statuses ? "OK" : "FAIL"));
+    return messages == 2 && statuses ? 0 : 3;
+}
\ No newline at end of file
@@ -0,0 +1,105 @@
+/*
+    This is a simple test that will load all cores
+    just like stresstest-mt.as does. However, here
+    no threads are created manually, the workload is
+    split into ranges that are executed by a pool
+    of workers and sorting, mapping and reduction
+    is done by all cores too.
+*/
+import from { "console", "os" };
+
+class test_worker
+{
+    int32[]@ hashes = null;
+    int32 value = 0;
+
+    void execute(usize begin, usize end)
+    {
+        for (usize i = begin; i < end; i++)
+        {
+            int32 hash = hashes[i], max = 2 << 29, next = value;
+            while (next > 0)
+                hash = ((hash << 5) - hash + next--) % max;
+            hashes[i] = hash;
+        }
+    }
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    output.capture_time();
+    if (args.empty())
+    {
+        output.write_line("provide test sequence index");
+        output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+        return 1;
+    }
+
+    int32 index = to_int32(args[args.size() - 1]);
+    if (index <= 0)
+    {
+        output.write_line("invalid test sequence index");
+        output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+        return 2;
+    }
+
+    usize jobs_count = usize(os::cpu::get_quantity_info().logical);
+    test_worker@ worker = test_worker();
+    @worker.hashes = array<int32>();
+    worker.hashes.reserve(jobs_count);
+    worker.value = index;
+    for (usize i = 0; i < jobs_count; i++)
+        worker.hashes.push(int32(i * 4));
+
+    /* one range per job, each job only writes to it's own slot */
+    parallel::for_range(0, jobs_count, parallel::range_event(worker.execute), 1);
+    for (usize i = 0; i < jobs_count; i++)
+        output.write_line("worker result #" + to_string(i + 1) + ": " + to_string(worker.hashes[i]));
+
+    start_sort_test(output, index);
+    start_map_reduce_test(output, index);
+    output.write_line("time: " + to_string(output.get_captured_time()) + "ms");
+    return 0;
+}
+void start_sort_test(console@ output, int32 count)
+{
+    int32[]@ values = array<int32>();
+    values.reserve(usize(count));
+    for (int32 i = 0; i < count; i++)
+        values.push((i * 7919) % (count + 1));
+
+    parallel::sort(values);
+    for (usize i = 1; i < values.size(); i++)
+    {
+        if (values[i - 1] > values[i])
+        {
+            output.write_line("sort result: FAIL");
+            return;
+        }
+    }
+    output.write_line("sort result: OK (" + to_string(values.size()) + " values)");
+}int64 square(int64 value)
+{
+    return value * value;
+}
+int64 sum(int64 left, int64 right)
+{
+    return left + right;
+}
+void start_map_reduce_test(console@ output, int32 count)
+{
+    int64[]@ values = array<int64>();
+    values.reserve(usize(count));
+    for (int32 i = 0; i < count; i++)
+        values.push(int64(i));
+
+    int64 expected = 0;
+    for (int32 i = 0; i < count; i++)
+        expected += int64(i) * int64(i);
+
+    int64[]@ squares = parallel::map(values, parallel::map_int64_event(square));
+    int64 result = parallel::reduce(squares, parallel::reduce_int64_event(sum));
+    output.write_line("map/reduce result: " + (result == expected ? "OK" : "FAIL") + " (" + to_string(result) + ")");
+}
@@ -0,0 +1,114 @@
+/*
+    This is a simple test that will measure throughput
+    of string kernels. Each kernel is executed with
+    vectorized implementation and then with current
+    scalar implementation on the same log-like input.
+    Optional argument sets amount of log lines. Both
+    implementations are cross-checked on edge cases
+    before measurement.
+*/
+import from { "console", "timestamp" };
+
+string create_input(int32 lines)
+{
+    string result;
+    for (int32 i = 0; i < lines; i++)
+        result += "  2024-01-01T00:00:" + to_string(i % 60) + " INFO Request GET /api/v1/items/" + to_string(i) + " completed with STATUS 200 in " + to_string(i % 97) + "ms  \n";
+    return result;
+}
+int64 measure(bool accelerated, const string&in input, int32 kernel)
+{
+    text::set_accelerated(accelerated);
+    int64 start = timestamp().milliseconds();
+    usize checksum = 0;
+    for (int32 i = 0; i < 10; i++)
+    {
+        switch (kernel)
+        {
+            case 0:
+                checksum += text::find(input, "STATUS 500") == text::npos ? 1 : 0;
+                break;
+            case 1:
+                checksum += text::find_any_of(input, "#$%") == text::npos ? 1 : 0;
+                break;
+            case 2:
+                checksum += text::split(input, "\n").size();
+                break;
+            case 3:
+                checksum += text::replace_all(input, "INFO", "WARNING").size();
+                break;
+            case 4:
+                checksum += text::trim(input).size();
+                break;
+            case 5:
+                checksum += text::to_upper(input).size();
+                break;
+            case 6:
+                checksum += text::is_utf8(input) ? 1 : 0;
+                break;
+            case 7:
+                checksum += text::hex_decode(text::hex_encode(input)).size();
+                break;
+            case 8:
+                checksum += text::base64_decode(text::base64_encode(input)).size();
+                break;
+        }
+    }
+    return checksum > 0 ? timestamp().milliseconds() - start : 0;
+}
+
+string describe(bool accelerated, const string&in sample)
+{
+    text::set_accelerated(accelerated);
+    string result = to_string(text::find(sample, "ab")) + ":" + to_string(text::find_any_of(sample, "=\n")) + ":";
+    result += to_string(text::split(sample, "=").size()) + ":" + text::replace_all(sample, "ab", "x") + ":";
+    result += text::hex_decode(sample) + ":" + text::base64_decode(sample);
+    return result;
+}
+bool verify(console@ output)
+{
+    string[] samples = { "", "ab", "abc", "0a0B", "0a0", "zz", "YWJj", "YWI=", "YWI", "Y Q = =", "YQ==\n", "Y=Q=", "YQ===", "=YWJj", "Y", "YWJj\r\nZGVm" };
+    bool success = true;
+    for (usize i = 0; i < samples.size(); i++)
+    {
+        string fast = describe(true, samples[i]);
+        string slow = describe(false, samples[i]);
+        if (fast != slow)
+        {
+            output.write_line("mismatch on sample " + to_string(i) + ": " + fast + " vs " + slow);
+            success = false;
+        }
+    }
+
+    text::set_accelerated(true);
+    return success;
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    int32 lines = args.empty() ? 200000 : to_int32(args[args.size() - 1]);
+    if (lines <= 0)
+    {
+        output.write_line("invalid lines count");
+        return 1;
+    }
+
+    if (!verify(output))
+        return 2;
+
+    string input = create_input(lines);
+    string[] names = { "find", "find_any_of", "split", "replace_all", "trim", "to_upper", "is_utf8", "hex", "base64" };
+    text::set_accelerated(true);
+    output.write_line("input: " + to_string(input.size() / 1024) + "KB, acceleration: " + text::get_acceleration());
+    for (usize i = 0; i < names.size(); i++)
+    {
+        int64 fast = measure(true, input, int32(i));
+        int64 slow = measure(false, input, int32(i));
+        output.write_line(names[i] + ": " + to_string(fast) + "ms (vectorized) vs " + to_string(slow) + "ms (scalar)");
+    }
+
+    text::set_accelerated(true);
+    return 0;
+}
\ No newline at end of file
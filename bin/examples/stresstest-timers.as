@@ -0,0 +1,65 @@
+/*
+    This is a simple test that will measure timer wheel
+    throughput. First pass inserts timers that will never
+    fire, second pass cancels all of them and third pass
+    inserts timers with short timeouts and waits until
+    every single one of them has fired. Memory per timer
+    is reported after the first pass.
+*/
+import from { "console", "promise", "timestamp" };
+
+class timer_group
+{
+    promise<void>@ data = promise<void>();
+    int32 pending = 0;
+
+    void fire()
+    {
+        if (--pending == 0)
+            data.wrap();
+    }
+    void ignore()
+    {
+    }
+}
+
+void report(console@ output, const string&in name, int32 count, int64 time)
+{
+    string rate = time > 0 ? to_string(int64(count) * 1000 / time) : string("inf");
+    output.write_line(name + ": " + to_string(count) + " timers in " + to_string(time) + "ms (" + rate + " timers/s)");
+}
+
+[#console::main]
+int main(string[]@ args)
+{
+    console@ output = console::get();
+    int32 count = args.empty() ? 1000000 : to_int32(args[args.size() - 1]);
+    if (count <= 0)
+    {
+        output.write_line("invalid timers count");
+        return 1;
+    }
+
+    timer_group@ group = timer_group();
+    uint64[] ids = array<uint64>();
+    ids.reserve(usize(count));
+
+    int64 start = timestamp().milliseconds();
+    for (int32 i = 0; i < count; i++)
+        ids.push(timers::set_timeout(3600000, timers::timeout_event(group.ignore)));
+    report(output, "insert", count, timestamp().milliseconds() - start);
+    output.write_line("memory: " + to_string(timers::get_memory_usage() / usize(count)) + " bytes per timer");
+
+    start = timestamp().milliseconds();
+    for (int32 i = 0; i < count; i++)
+        timers::clear_timeout(ids[i]);
+    report(output, "cancel", count, timestamp().milliseconds() - start);
+
+    group.pending = count;
+    start = timestamp().milliseconds();
+    for (int32 i = 0; i < count; i++)
+        timers::set_timeout(uint64(i % 100), timers::timeout_event(group.fire));
+    co_await group.data;
+    report(output, "fire", count, timestamp().milliseconds() - start);
+    return 0;
+}
\ No newline at end of file
@@ -1,7 +1,7 @@
-import from "console";
-
-void print_hello_world()
-{
-    console@ log = console::get();
-    log.write_line("Hello, World");
+import from "console";
+
+void print_hello_world()
+{
+    console@ log = console::get();
+    log.write_line("Hello, World");
 }
\ No newline at end of file
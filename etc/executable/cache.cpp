@@ -0,0 +1,294 @@
+#include "cache.h"
+
+namespace ASX
+{
+	SharedCache::SharedCache(size_t MaxBytes) : Budget(MaxBytes), Bytes(0), Count(0), Hits(0), Misses(0), Evictions(0), Expirations(0), Rejections(0), Policy(CachePolicy::LRU)
+	{
+	}
+	bool SharedCache::Set(const String& Key, const String& Value, uint64_t Timeout)
+	{
+		size_t Size = GetEntrySize(Key, Value);
+		size_t Limit = GetEntryLimit();
+		if (Limit > 0 && Size > Limit)
+		{
+			Rejections.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		int64_t Time = GetTime();
+		Stripe& Target = GetStripe(Key);
+		std::unique_lock<std::shared_mutex> Unique(Target.Mutex);
+		auto It = Target.Entries.find(Key);
+		if (It != Target.Entries.end())
+		{
+			size_t Previous = GetEntrySize(Key, It->second.Value);
+			Target.Bytes -= Previous;
+			Bytes -= Previous;
+		}
+		else
+		{
+			It = Target.Entries.try_emplace(Key).first;
+			++Count;
+		}
+
+		CacheEntry& Entry = It->second;
+		Entry.Value = Value;
+		Entry.Expires = Timeout > 0 ? Time + (int64_t)Timeout : 0;
+		Entry.Access.store(Time, std::memory_order_relaxed);
+		Entry.Frequency.store(1, std::memory_order_relaxed);
+		Target.Bytes += Size;
+		Bytes += Size;
+		if (Limit > 0 && Target.Bytes > Limit)
+			Evict(Target, Limit, Time, &It->first);
+		return true;
+	}
+	bool SharedCache::Get(const String& Key, String& Value)
+	{
+		int64_t Time = GetTime();
+		Stripe& Target = GetStripe(Key);
+		std::shared_lock<std::shared_mutex> Shared(Target.Mutex);
+		auto It = Target.Entries.find(Key);
+		if (It == Target.Entries.end())
+		{
+			Misses.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		else if (It->second.Expires > 0 && It->second.Expires <= Time)
+		{
+			Shared.unlock();
+			Misses.fetch_add(1, std::memory_order_relaxed);
+			std::unique_lock<std::shared_mutex> Unique(Target.Mutex);
+			It = Target.Entries.find(Key);
+			if (It != Target.Entries.end() && It->second.Expires > 0 && It->second.Expires <= Time)
+			{
+				Remove(Target, It);
+				++Expirations;
+			}
+			return false;
+		}
+
+		CacheEntry& Entry = It->second;
+		Entry.Access.store(Time, std::memory_order_relaxed);
+		if (Entry.Frequency.load(std::memory_order_relaxed) < std::numeric_limits<uint32_t>::max())
+			Entry.Frequency.fetch_add(1, std::memory_order_relaxed);
+		Hits.fetch_add(1, std::memory_order_relaxed);
+		Value = Entry.Value;
+		return true;
+	}
+	bool SharedCache::Has(const String& Key)
+	{
+		int64_t Time = GetTime();
+		Stripe& Target = GetStripe(Key);
+		std::shared_lock<std::shared_mutex> Shared(Target.Mutex);
+		auto It = Target.Entries.find(Key);
+		return It != Target.Entries.end() && (It->second.Expires <= 0 || It->second.Expires > Time);
+	}
+	bool SharedCache::Erase(const String& Key)
+	{
+		Stripe& Target = GetStripe(Key);
+		std::unique_lock<std::shared_mutex> Unique(Target.Mutex);
+		auto It = Target.Entries.find(Key);
+		if (It == Target.Entries.end())
+			return false;
+
+		Remove(Target, It);
+		return true;
+	}
+	void SharedCache::Clear()
+	{
+		for (auto& Target : Stripes)
+		{
+			std::unique_lock<std::shared_mutex> Unique(Target.Mutex);
+			Count -= Target.Entries.size();
+			Bytes -= Target.Bytes;
+			Target.Entries.clear();
+			Target.Bytes = 0;
+		}
+	}
+	void SharedCache::SetBudget(size_t MaxBytes)
+	{
+		Budget = MaxBytes;
+		size_t Limit = GetEntryLimit();
+		if (!Limit)
+			return;
+
+		int64_t Time = GetTime();
+		for (auto& Target : Stripes)
+		{
+			std::unique_lock<std::shared_mutex> Unique(Target.Mutex);
+			Evict(Target, Limit, Time, nullptr);
+		}
+	}
+	void SharedCache::SetPolicy(CachePolicy NewPolicy)
+	{
+		Policy = NewPolicy;
+	}
+	size_t SharedCache::GetEntryLimit() const
+	{
+		return Budget / CACHE_STRIPES;
+	}
+	void SharedCache::BindSyntax(VirtualMachine* VM)
+	{
+		VM->ImportSystemAddon("ctypes");
+		VM->ImportSystemAddon("string");
+		VM->BeginNamespace("cache");
+		auto VPolicy = VM->SetEnum("policy");
+		VPolicy->SetValue("lru", (int)CachePolicy::LRU);
+		VPolicy->SetValue("lfu", (int)CachePolicy::LFU);
+		VM->SetFunction("bool set(const string&in, const string&in, uint64 = 0)", &SharedCache::ScriptSet);
+		VM->SetFunction("bool get(const string&in, string&out)", &SharedCache::ScriptGet);
+		VM->SetFunction("bool has(const string&in)", &SharedCache::ScriptHas);
+		VM->SetFunction("bool erase(const string&in)", &SharedCache::ScriptErase);
+		VM->SetFunction("void clear()", &SharedCache::ScriptClear);
+		VM->SetFunction("void set_budget(usize)", &SharedCache::ScriptSetBudget);
+		VM->SetFunction("void set_policy(policy)", &SharedCache::ScriptSetPolicy);
+		VM->SetFunction("usize size()", &SharedCache::ScriptGetSize);
+		VM->SetFunction("usize get_bytes()", &SharedCache::ScriptGetBytes);
+		VM->SetFunction("uint64 get_hits()", &SharedCache::ScriptGetHits);
+		VM->SetFunction("uint64 get_misses()", &SharedCache::ScriptGetMisses);
+		VM->SetFunction("uint64 get_evictions()", &SharedCache::ScriptGetEvictions);
+		VM->SetFunction("uint64 get_expirations()", &SharedCache::ScriptGetExpirations);
+		VM->SetFunction("uint64 get_rejections()", &SharedCache::ScriptGetRejections);
+		VM->SetFunction("usize get_entry_limit()", &SharedCache::ScriptGetEntryLimit);
+		VM->EndNamespace();
+		Get();
+	}
+	void SharedCache::Cleanup()
+	{
+		Memory::Delete(Instance);
+	}
+	SharedCache* SharedCache::Get()
+	{
+		static std::mutex Initialization;
+		UMutex<std::mutex> Unique(Initialization);
+		if (!Instance)
+			Instance = Memory::New<SharedCache>(64 * 1024 * 1024);
+		return Instance;
+	}
+	SharedCache::Stripe& SharedCache::GetStripe(const String& Key)
+	{
+		size_t Hash = std::hash<String>()(Key);
+		return Stripes[(Hash ^ (Hash >> 17)) % CACHE_STRIPES];
+	}
+	void SharedCache::Evict(Stripe& Target, size_t Limit, int64_t Time, const String* Keep)
+	{
+		CachePolicy Type = Policy;
+		while (Target.Bytes > Limit && !Target.Entries.empty())
+		{
+			size_t Buckets = Target.Entries.bucket_count();
+			size_t Bucket = (size_t)Time * 2654435761u % Buckets;
+			auto Victim = Target.Entries.end();
+			size_t Samples = 0;
+			for (size_t i = 0; i < Buckets && Samples < CACHE_SAMPLES; i++)
+			{
+				size_t Index = (Bucket + i) % Buckets;
+				for (auto Next = Target.Entries.begin(Index); Next != Target.Entries.end(Index) && Samples < CACHE_SAMPLES; ++Next, ++Samples)
+				{
+					if (Keep != nullptr && Next->first == *Keep)
+						continue;
+
+					auto It = Target.Entries.find(Next->first);
+					if (It->second.Expires > 0 && It->second.Expires <= Time)
+					{
+						Victim = It;
+						Samples = CACHE_SAMPLES;
+						break;
+					}
+					else if (Victim == Target.Entries.end())
+						Victim = It;
+					else if (Type == CachePolicy::LFU && It->second.Frequency < Victim->second.Frequency)
+						Victim = It;
+					else if ((Type == CachePolicy::LRU || It->second.Frequency == Victim->second.Frequency) && It->second.Access < Victim->second.Access)
+						Victim = It;
+				}
+			}
+
+			if (Victim == Target.Entries.end())
+				break;
+
+			if (Victim->second.Expires > 0 && Victim->second.Expires <= Time)
+				++Expirations;
+			else
+				++Evictions;
+			Remove(Target, Victim);
+			++Time;
+		}
+	}
+	void SharedCache::Remove(Stripe& Target, UnorderedMap<String, CacheEntry>::iterator It)
+	{
+		size_t Size = GetEntrySize(It->first, It->second.Value);
+		Target.Bytes -= Size;
+		Bytes -= Size;
+		--Count;
+		Target.Entries.erase(It);
+	}
+	int64_t SharedCache::GetTime()
+	{
+		return std::chrono::duration_cast<std::chrono::milliseconds>(Schedule::GetClock()).count();
+	}
+	size_t SharedCache::GetEntrySize(const String& Key, const String& Value)
+	{
+		return Key.size() + Value.size() + sizeof(CacheEntry);
+	}
+	bool SharedCache::ScriptSet(const String& Key, const String& Value, uint64_t Timeout)
+	{
+		return Instance->Set(Key, Value, Timeout);
+	}
+	bool SharedCache::ScriptGet(const String& Key, String& Value)
+	{
+		return Instance->Get(Key, Value);
+	}
+	bool SharedCache::ScriptHas(const String& Key)
+	{
+		return Instance->Has(Key);
+	}
+	bool SharedCache::ScriptErase(const String& Key)
+	{
+		return Instance->Erase(Key);
+	}
+	void SharedCache::ScriptClear()
+	{
+		Instance->Clear();
+	}
+	void SharedCache::ScriptSetBudget(size_t MaxBytes)
+	{
+		Instance->SetBudget(MaxBytes);
+	}
+	void SharedCache::ScriptSetPolicy(CachePolicy NewPolicy)
+	{
+		Instance->SetPolicy(NewPolicy);
+	}
+	size_t SharedCache::ScriptGetSize()
+	{
+		return Instance->Count;
+	}
+	size_t SharedCache::ScriptGetBytes()
+	{
+		return Instance->Bytes;
+	}
+	uint64_t SharedCache::ScriptGetHits()
+	{
+		return Instance->Hits;
+	}
+	uint64_t SharedCache::ScriptGetMisses()
+	{
+		return Instance->Misses;
+	}
+	uint64_t SharedCache::ScriptGetEvictions()
+	{
+		return Instance->Evictions;
+	}
+	uint64_t SharedCache::ScriptGetExpirations()
+	{
+		return Instance->Expirations;
+	}
+	uint64_t SharedCache::ScriptGetRejections()
+	{
+		return Instance->Rejections;
+	}
+	size_t SharedCache::ScriptGetEntryLimit()
+	{
+		return Instance->GetEntryLimit();
+	}
+	SharedCache* SharedCache::Instance = nullptr;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#ifndef CACHE_H
+#define CACHE_H
+#include "runtime.hpp"
+#include <vengeance/vengeance.h>
+#include <shared_mutex>
+#define CACHE_STRIPES 64
+#define CACHE_SAMPLES 5
+
+namespace ASX
+{
+	enum class CachePolicy
+	{
+		LRU,
+		LFU
+	};
+
+	struct CacheEntry
+	{
+		String Value;
+		int64_t Expires = 0;
+		std::atomic<int64_t> Access = 0;
+		std::atomic<uint32_t> Frequency = 0;
+	};
+
+	class SharedCache
+	{
+	private:
+		struct Stripe
+		{
+			UnorderedMap<String, CacheEntry> Entries;
+			std::shared_mutex Mutex;
+			size_t Bytes = 0;
+		};
+
+	private:
+		static SharedCache* Instance;
+
+	private:
+		Stripe Stripes[CACHE_STRIPES];
+		std::atomic<size_t> Budget;
+		std::atomic<size_t> Bytes;
+		std::atomic<size_t> Count;
+		std::atomic<uint64_t> Hits;
+		std::atomic<uint64_t> Misses;
+		std::atomic<uint64_t> Evictions;
+		std::atomic<uint64_t> Expirations;
+		std::atomic<uint64_t> Rejections;
+		std::atomic<CachePolicy> Policy;
+
+	public:
+		SharedCache(size_t MaxBytes);
+		bool Set(const String& Key, const String& Value, uint64_t Timeout);
+		bool Get(const String& Key, String& Value);
+		bool Has(const String& Key);
+		bool Erase(const String& Key);
+		void Clear();
+		void SetBudget(size_t MaxBytes);
+		void SetPolicy(CachePolicy NewPolicy);
+		size_t GetEntryLimit() const;
+
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+		static void Cleanup();
+		static SharedCache* Get();
+
+	private:
+		Stripe& GetStripe(const String& Key);
+		void Evict(Stripe& Target, size_t Limit, int64_t Time, const String* Keep);
+		void Remove(Stripe& Target, UnorderedMap<String, CacheEntry>::iterator It);
+		static int64_t GetTime();
+		static size_t GetEntrySize(const String& Key, const String& Value);
+		static bool ScriptSet(const String& Key, const String& Value, uint64_t Timeout);
+		static bool ScriptGet(const String& Key, String& Value);
+		static bool ScriptHas(const String& Key);
+		static bool ScriptErase(const String& Key);
+		static void ScriptClear();
+		static void ScriptSetBudget(size_t MaxBytes);
+		static void ScriptSetPolicy(CachePolicy NewPolicy);
+		static size_t ScriptGetSize();
+		static size_t ScriptGetBytes();
+		static uint64_t ScriptGetHits();
+		static uint64_t ScriptGetMisses();
+		static uint64_t ScriptGetEvictions();
+		static uint64_t ScriptGetExpirations();
+		static uint64_t ScriptGetRejections();
+		static size_t ScriptGetEntryLimit();
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,354 @@
+#include "isolate.h"
+
+namespace ASX
+{
+	Channel::Channel() : Closed(false)
+	{
+	}
+	bool Channel::Push(String&& Message)
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		if (Closed)
+			return false;
+
+		Queue.push(std::move(Message));
+		Condition.notify_one();
+		return true;
+	}
+	bool Channel::Pop(String& Message)
+	{
+		std::unique_lock<std::mutex> Unique(Mutex);
+		Condition.wait(Unique, [this]() { return !Queue.empty() || Closed; });
+		if (Queue.empty())
+			return false;
+
+		Message = std::move(Queue.front());
+		Queue.pop();
+		return true;
+	}
+	void Channel::Close()
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		Closed = true;
+		Condition.notify_all();
+	}
+
+	IsolateWorker::IsolateWorker() : Context(nullptr), Loop(nullptr), Aborted(false), ExitCode((int)ExitStatus::InputError)
+	{
+	}
+	bool IsolateWorker::Attach(ImmediateContext* NewContext, EventLoop* NewLoop)
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		Context = NewContext;
+		Loop = NewLoop;
+		return !Aborted;
+	}
+	void IsolateWorker::Abort()
+	{
+		Inbox.Close();
+		UMutex<std::mutex> Unique(Mutex);
+		Aborted = true;
+		if (Context != nullptr)
+			Context->Abort();
+		if (Loop != nullptr)
+			Loop->Wakeup();
+	}
+
+	Isolate::Isolate(const String& NewPath) : Worker(new IsolateWorker())
+	{
+		auto* VM = VirtualMachine::Get();
+		String Directory = VM != nullptr ? String(VM->GetModuleDirectory()) : String();
+		auto Target = OS::Path::Resolve(NewPath, Directory.empty() ? *OS::Directory::GetWorking() : Directory, true);
+		if (!Target || !OS::File::IsExists(Target->c_str()))
+		{
+			auto* Context = ImmediateContext::Get();
+			if (Context != nullptr)
+				Context->SetException(Stringify::Text("isolate module <%s> does not exist", NewPath.c_str()).c_str());
+			Worker->Inbox.Close();
+			Worker->Outbox.Close();
+			return;
+		}
+
+		IsolateWorker* Base = Worker;
+		Base->Path = *Target;
+		Base->AddRef();
+		Thread = std::thread([Base]()
+		{
+			Current = Base;
+			Base->ExitCode = Execute(Base);
+			Base->Outbox.Close();
+			Current = nullptr;
+			Base->Release();
+			VirtualMachine::CleanupThisThread();
+		});
+	}
+	Isolate::~Isolate()
+	{
+		if (Thread.joinable())
+		{
+			Worker->Abort();
+			Thread.detach();
+		}
+		Worker->Release();
+	}
+	bool Isolate::Send(const String& Message)
+	{
+		return Worker->Inbox.Push(String(Message));
+	}
+	bool Isolate::Receive(String& Message)
+	{
+		return Worker->Outbox.Pop(Message);
+	}
+	int Isolate::Join()
+	{
+		Worker->Inbox.Close();
+		if (Thread.joinable())
+			Thread.join();
+		return Worker->ExitCode;
+	}
+	bool Isolate::IsActive() const
+	{
+		return Thread.joinable();
+	}
+	void Isolate::BindSyntax(VirtualMachine* VM)
+	{
+		VM->ImportSystemAddon("string");
+		auto VIsolate = VM->SetClass<Isolate>("isolate", false);
+		VIsolate->SetConstructor<Isolate, const String&>("isolate@ f(const string&in)");
+		VIsolate->SetMethod("bool send(const string&in)", &Isolate::Send);
+		VIsolate->SetMethod("bool receive(string&out)", &Isolate::Receive);
+		VIsolate->SetMethod("int join()", &Isolate::Join);
+		VIsolate->SetMethod("bool is_active() const", &Isolate::IsActive);
+		VM->BeginNamespace("this_isolate");
+		VM->SetFunction("bool send(const string&in)", &Isolate::SendParent);
+		VM->SetFunction("bool receive(string&out)", &Isolate::ReceiveParent);
+		VM->SetFunction("bool is_active()", &Isolate::IsChild);
+		VM->EndNamespace();
+	}
+	int Isolate::Execute(IsolateWorker* Base)
+	{
+		const String& Path = Base->Path;
+		UPtr<VirtualMachine> VM = new VirtualMachine();
+		Bindings::HeavyRegistry().BindAddons(*VM);
+		Bindings::Tags::BindSyntax(*VM, true, [](VirtualMachine*, Bindings::Tags::TagInfo&&) { });
+		VM->SetModuleDirectory(OS::Path::GetDirectory(Path.c_str()));
+		Modules::BindSyntax(*VM);
+
+		EnvironmentConfig Env;
+		String Module = String(OS::Path::GetFilename(Path));
+		Env.Module = Module.c_str();
+		Env.Path = Path;
+
+		if (!OS::File::GetState(Path, &Env.File))
+		{
+			VI_ERR("cannot read <%s> isolate module", Env.Module);
+			return (int)ExitStatus::InputError;
+		}
+
+		auto Program = OS::File::ReadAsString(Path);
+		if (!Program)
+		{
+			VI_ERR("cannot read <%s> isolate module", Env.Module);
+			return (int)ExitStatus::InputError;
+		}
+
+		SourceCache Sources;
+		Env.Program = std::move(*Program);
+		UPtr<Compiler> Unit = VM->CreateCompiler();
+		Unit->GetProcessor()->AddDefaultDefinitions();
+		Unit->SetIncludeCallback([&Sources](Preprocessor*, const IncludeResult& File, String& Output) -> ExpectsPreprocessor<IncludeType>
+		{
+			if (!File.IsFile || File.Module.empty() || File.Module.front() == '@')
+				return IncludeType::Unchanged;
+
+			return Sources.Resolve(File.Module, Output);
+		});
+
+		auto Status = Unit->Prepare(Env.Module);
+		if (!Status)
+		{
+			VI_ERR("cannot prepare <%s> isolate module scope\n  %s", Env.Module, Status.Error().what());
+			return (int)ExitStatus::PrepareError;
+		}
+
+		bool Owner = false;
+		if (!LoadImage(*Unit, Env, Owner))
+		{
+			int Compiled = Compile(*Unit, Env);
+			if (Owner)
+				SaveImage(Compiled == (int)ExitStatus::OK ? *Unit : nullptr, Env, Sources);
+			if (Compiled != (int)ExitStatus::OK)
+				return Compiled;
+		}
+
+		ProgramEntrypoint Entrypoint;
+		Function Main = Runtime::GetEntrypoint(Env, Entrypoint, *Unit);
+		if (!Main.IsValid())
+			return (int)ExitStatus::EntrypointError;
+
+		int Result = 0;
+		UPtr<ImmediateContext> Context = VM->RequestContext();
+		UPtr<EventLoop> Loop = new EventLoop();
+		EventLoop* Queue = *Loop;
+		Loop->Listen(*Context);
+		Main.AddRef();
+		Loop->Enqueue(FunctionDelegate(Main, *Context), [](ImmediateContext*) { }, [&Result, &Main, Queue](ImmediateContext* Context)
+		{
+			Result = Main.GetReturnTypeId() == (int)TypeId::VOIDF ? 0 : (int)Context->GetReturnDWord();
+			Queue->Wakeup();
+		});
+
+		SystemConfig Config;
+		Config.MemoryLimit = Runtime::GetMemoryLimit();
+		if (Base->Attach(*Context, Queue))
+			Runtime::AwaitLoop(Config, Queue, *VM, *Context);
+		else
+			Result = (int)ExitStatus::Kill;
+
+		Base->Attach(nullptr, nullptr);
+		EventLoop::Set(nullptr);
+		Context->Reset();
+		VM->PerformFullGarbageCollection();
+		return Result;
+	}
+	int Isolate::Compile(Compiler* Unit, EnvironmentConfig& Env)
+	{
+		auto Status = Unit->LoadCode(Env.Path, Env.Program);
+		if (!Status)
+		{
+			VI_ERR("cannot load <%s> isolate module script code\n  %s", Env.Module, Status.Error().what());
+			return (int)ExitStatus::LoadingError;
+		}
+
+		Status = Unit->Compile().Get();
+		if (!Status)
+		{
+			VI_ERR("cannot compile <%s> isolate module\n  %s", Env.Module, Status.Error().what());
+			return (int)ExitStatus::CompilerError;
+		}
+
+		return (int)ExitStatus::OK;
+	}
+	bool Isolate::LoadImage(Compiler* Unit, EnvironmentConfig& Env, bool& Owner)
+	{
+		ByteCodeInfo Info;
+		Vector<String> Addons;
+		{
+			std::unique_lock<std::mutex> Unique(ImagesMutex);
+			if (!Images)
+				Images = Memory::New<UnorderedMap<String, ModuleImage>>();
+
+			while (true)
+			{
+				auto It = Images->find(Env.Path);
+				if (It != Images->end() && It->second.Compiling)
+				{
+					ImagesCondition.wait(Unique);
+					continue;
+				}
+				else if (It == Images->end() || !IsImageCurrent(It->second, Env))
+				{
+					ModuleImage& Image = (*Images)[Env.Path];
+					Image = ModuleImage();
+					Image.Compiling = true;
+					Owner = true;
+					return false;
+				}
+
+				Info = It->second.Info;
+				Addons = It->second.Addons;
+				break;
+			}
+		}
+
+		auto* VM = Unit->GetVM();
+		UnorderedSet<String> Exposed;
+		for (auto& Item : VM->GetSystemAddons())
+		{
+			if (Item.second.Exposed)
+				Exposed.insert(Item.first);
+		}
+
+		for (auto& Name : Addons)
+		{
+			if (Exposed.count(Name) > 0 || VM->ImportSystemAddon(Name))
+				continue;
+
+			VI_WARN("cannot import <%s> system addon for <%s> isolate module image: recompiling", Name.c_str(), Env.Path.c_str());
+			return false;
+		}
+
+		if (Unit->LoadByteCode(&Info).Get())
+			return true;
+
+		VI_WARN("cannot load <%s> isolate module image: recompiling", Env.Path.c_str());
+		Unit->Prepare(Env.Module);
+		return false;
+	}
+	void Isolate::SaveImage(Compiler* Unit, EnvironmentConfig& Env, const SourceCache& Sources)
+	{
+		ModuleImage Image;
+		Image.Info.Debug = true;
+		bool Success = Unit != nullptr && Unit->SaveByteCode(&Image.Info);
+		if (Success)
+		{
+			Image.Dependencies = Sources.GetDependencies();
+			Image.Dependencies[Env.Path] = SourceCache::GetHash(Env.Program);
+			for (auto& Item : Unit->GetVM()->GetSystemAddons())
+			{
+				if (Item.second.Exposed)
+					Image.Addons.push_back(Item.first);
+			}
+		}
+
+		UMutex<std::mutex> Unique(ImagesMutex);
+		auto It = Images->find(Env.Path);
+		if (It != Images->end() && It->second.Compiling)
+		{
+			if (Success)
+				It->second = std::move(Image);
+			else
+				Images->erase(It);
+		}
+		ImagesCondition.notify_all();
+	}
+	bool Isolate::IsImageCurrent(const ModuleImage& Image, EnvironmentConfig& Env)
+	{
+		for (auto& Next : Image.Dependencies)
+		{
+			if (Next.first == Env.Path)
+			{
+				if (SourceCache::GetHash(Env.Program) != Next.second)
+					return false;
+				continue;
+			}
+
+			auto Source = OS::File::ReadAsString(Next.first);
+			if (!Source || SourceCache::GetHash(*Source) != Next.second)
+				return false;
+		}
+
+		return !Image.Dependencies.empty();
+	}
+	void Isolate::Cleanup()
+	{
+		UMutex<std::mutex> Unique(ImagesMutex);
+		Memory::Delete(Images);
+	}
+	bool Isolate::SendParent(const String& Message)
+	{
+		return Current != nullptr && Current->Outbox.Push(String(Message));
+	}
+	bool Isolate::ReceiveParent(String& Message)
+	{
+		return Current != nullptr && Current->Inbox.Pop(Message);
+	}
+	bool Isolate::IsChild()
+	{
+		return Current != nullptr;
+	}
+	UnorderedMap<String, ModuleImage>* Isolate::Images = nullptr;
+	std::condition_variable Isolate::ImagesCondition;
+	std::mutex Isolate::ImagesMutex;
+	thread_local IsolateWorker* Isolate::Current = nullptr;
+}
\ No newline at end of file
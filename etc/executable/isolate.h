@@ -0,0 +1,87 @@
+#ifndef ISOLATE_H
+#define ISOLATE_H
+#include "runtime.hpp"
+#include "sources.h"
+#include <vengeance/vengeance.h>
+
+namespace ASX
+{
+	class Channel
+	{
+	private:
+		SingleQueue<String> Queue;
+		std::condition_variable Condition;
+		std::mutex Mutex;
+		bool Closed;
+
+	public:
+		Channel();
+		bool Push(String&& Message);
+		bool Pop(String& Message);
+		void Close();
+	};
+
+	struct ModuleImage
+	{
+		ByteCodeInfo Info;
+		UnorderedMap<String, uint64_t> Dependencies;
+		Vector<String> Addons;
+		bool Compiling = false;
+	};
+
+	class IsolateWorker : public Reference<IsolateWorker>
+	{
+	private:
+		ImmediateContext* Context;
+		EventLoop* Loop;
+		std::mutex Mutex;
+		bool Aborted;
+
+	public:
+		Channel Inbox;
+		Channel Outbox;
+		String Path;
+		std::atomic<int> ExitCode;
+
+	public:
+		IsolateWorker();
+		bool Attach(ImmediateContext* NewContext, EventLoop* NewLoop);
+		void Abort();
+	};
+
+	class Isolate : public Reference<Isolate>
+	{
+	private:
+		static UnorderedMap<String, ModuleImage>* Images;
+		static std::condition_variable ImagesCondition;
+		static std::mutex ImagesMutex;
+		static thread_local IsolateWorker* Current;
+
+	private:
+		IsolateWorker* Worker;
+		std::thread Thread;
+
+	public:
+		Isolate(const String& NewPath);
+		~Isolate();
+		bool Send(const String& Message);
+		bool Receive(String& Message);
+		int Join();
+		bool IsActive() const;
+
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+		static void Cleanup();
+
+	private:
+		static int Execute(IsolateWorker* Base);
+		static int Compile(Compiler* Unit, EnvironmentConfig& Env);
+		static bool LoadImage(Compiler* Unit, EnvironmentConfig& Env, bool& Owner);
+		static void SaveImage(Compiler* Unit, EnvironmentConfig& Env, const SourceCache& Sources);
+		static bool IsImageCurrent(const ModuleImage& Image, EnvironmentConfig& Env);
+		static bool SendParent(const String& Message);
+		static bool ReceiveParent(String& Message);
+		static bool IsChild();
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,539 @@
+#include "json.h"
+#include <charconv>
+
+namespace ASX
+{
+	static inline bool IsJsonWhitespace(char Value)
+	{
+		return Value == ' ' || Value == '\t' || Value == '\n' || Value == '\r';
+	}
+	static inline bool IsJsonNumeric(char Value)
+	{
+		return (Value >= '0' && Value <= '9') || Value == '-' || Value == '+' || Value == '.' || Value == 'e' || Value == 'E';
+	}
+	static inline int GetJsonHex(char Value)
+	{
+		if (Value >= '0' && Value <= '9')
+			return Value - '0';
+		else if (Value >= 'a' && Value <= 'f')
+			return Value - 'a' + 10;
+		else if (Value >= 'A' && Value <= 'F')
+			return Value - 'A' + 10;
+		return -1;
+	}
+	static void AppendUTF8(String& Output, uint32_t Code)
+	{
+		if (Code < 0x80)
+			Output.push_back((char)Code);
+		else if (Code < 0x800)
+		{
+			Output.push_back((char)(0xC0 | (Code >> 6)));
+			Output.push_back((char)(0x80 | (Code & 0x3F)));
+		}
+		else if (Code < 0x10000)
+		{
+			Output.push_back((char)(0xE0 | (Code >> 12)));
+			Output.push_back((char)(0x80 | ((Code >> 6) & 0x3F)));
+			Output.push_back((char)(0x80 | (Code & 0x3F)));
+		}
+		else
+		{
+			Output.push_back((char)(0xF0 | (Code >> 18)));
+			Output.push_back((char)(0x80 | ((Code >> 12) & 0x3F)));
+			Output.push_back((char)(0x80 | ((Code >> 6) & 0x3F)));
+			Output.push_back((char)(0x80 | (Code & 0x3F)));
+		}
+	}
+
+	JsonReader::JsonReader() : State(Expectation::Value), Offset(0), Number(0.0), Boolean(false), Finished(false), Failed(false), Empty(true)
+	{
+	}
+	void JsonReader::Feed(const String& Data)
+	{
+		if (Offset > 0)
+		{
+			Buffer.erase(0, Offset);
+			Offset = 0;
+		}
+		Buffer.append(Data);
+		Value = std::string_view();
+		Source = std::string_view();
+	}
+	void JsonReader::Finish()
+	{
+		Finished = true;
+	}
+	JsonEvent JsonReader::Next()
+	{
+		if (Failed)
+			return JsonEvent::Error;
+
+		while (true)
+		{
+			while (Offset < Buffer.size() && IsJsonWhitespace(Buffer[Offset]))
+				++Offset;
+
+			if (Offset >= Buffer.size())
+			{
+				if (!Finished)
+					return JsonEvent::Need;
+				else if (Scopes.empty() && !Empty && (State == Expectation::Done || State == Expectation::Value))
+					return JsonEvent::End;
+				return Fail();
+			}
+
+			char Next = Buffer[Offset];
+			switch (State)
+			{
+				case Expectation::Done:
+					State = Expectation::Value;
+					continue;
+				case Expectation::ValueOrEnd:
+					if (Next == ']')
+					{
+						++Offset;
+						return CloseScope('[');
+					}
+					return ReadValue();
+				case Expectation::Value:
+					return ReadValue();
+				case Expectation::KeyOrEnd:
+					if (Next == '}')
+					{
+						++Offset;
+						return CloseScope('{');
+					}
+					return Next == '"' ? ReadString(JsonEvent::Key) : Fail();
+				case Expectation::Key:
+					return Next == '"' ? ReadString(JsonEvent::Key) : Fail();
+				case Expectation::Colon:
+					if (Next != ':')
+						return Fail();
+					++Offset;
+					State = Expectation::Value;
+					continue;
+				case Expectation::CommaOrEnd:
+					if (Next == ',')
+					{
+						++Offset;
+						State = Scopes.back() == '{' ? Expectation::Key : Expectation::Value;
+						continue;
+					}
+					else if (Next == '}' || Next == ']')
+					{
+						++Offset;
+						return CloseScope(Next == '}' ? '{' : '[');
+					}
+					return Fail();
+				default:
+					return Fail();
+			}
+		}
+	}
+	const std::string_view& JsonReader::GetValue() const
+	{
+		return Value;
+	}
+	const std::string_view& JsonReader::GetSource() const
+	{
+		return Source;
+	}
+	String JsonReader::GetString() const
+	{
+		return String(Value);
+	}
+	String JsonReader::GetRaw() const
+	{
+		return String(Source);
+	}
+	double JsonReader::GetNumber() const
+	{
+		return Number;
+	}
+	bool JsonReader::GetBoolean() const
+	{
+		return Boolean;
+	}
+	size_t JsonReader::GetDepth() const
+	{
+		return Scopes.size();
+	}
+	void JsonReader::BindSyntax(VirtualMachine* VM)
+	{
+		VM->ImportSystemAddon("ctypes");
+		VM->ImportSystemAddon("string");
+		auto VEvent = VM->SetEnum("json_event");
+		VEvent->SetValue("need", (int)JsonEvent::Need);
+		VEvent->SetValue("begin_object", (int)JsonEvent::BeginObject);
+		VEvent->SetValue("end_object", (int)JsonEvent::EndObject);
+		VEvent->SetValue("begin_array", (int)JsonEvent::BeginArray);
+		VEvent->SetValue("end_array", (int)JsonEvent::EndArray);
+		VEvent->SetValue("key", (int)JsonEvent::Key);
+		VEvent->SetValue("string_value", (int)JsonEvent::String);
+		VEvent->SetValue("number_value", (int)JsonEvent::Number);
+		VEvent->SetValue("boolean_value", (int)JsonEvent::Boolean);
+		VEvent->SetValue("null_value", (int)JsonEvent::Null);
+		VEvent->SetValue("end", (int)JsonEvent::End);
+		VEvent->SetValue("error", (int)JsonEvent::Error);
+
+		auto VReader = VM->SetClass<JsonReader>("json_reader", false);
+		VReader->SetConstructor<JsonReader>("json_reader@ f()");
+		VReader->SetMethod("void feed(const string&in)", &JsonReader::Feed);
+		VReader->SetMethod("void finish()", &JsonReader::Finish);
+		VReader->SetMethod("json_event next()", &JsonReader::Next);
+		VReader->SetMethod("string get_string() const", &JsonReader::GetString);
+		VReader->SetMethod("string get_raw() const", &JsonReader::GetRaw);
+		VReader->SetMethod("double get_number() const", &JsonReader::GetNumber);
+		VReader->SetMethod("bool get_boolean() const", &JsonReader::GetBoolean);
+		VReader->SetMethod("usize get_depth() const", &JsonReader::GetDepth);
+	}
+	JsonEvent JsonReader::ReadValue()
+	{
+		char Next = Buffer[Offset];
+		switch (Next)
+		{
+			case '{':
+				++Offset;
+				Scopes.push_back('{');
+				State = Expectation::KeyOrEnd;
+				return JsonEvent::BeginObject;
+			case '[':
+				++Offset;
+				Scopes.push_back('[');
+				State = Expectation::ValueOrEnd;
+				return JsonEvent::BeginArray;
+			case '"':
+				return ReadString(JsonEvent::String);
+			case 't':
+				Boolean = true;
+				return ReadLiteral("true", JsonEvent::Boolean);
+			case 'f':
+				Boolean = false;
+				return ReadLiteral("false", JsonEvent::Boolean);
+			case 'n':
+				return ReadLiteral("null", JsonEvent::Null);
+			default:
+				if (Next == '-' || (Next >= '0' && Next <= '9'))
+					return ReadNumber();
+				return Fail();
+		}
+	}
+	JsonEvent JsonReader::ReadString(JsonEvent Event)
+	{
+		size_t Index = Offset + 1;
+		bool Escaped = false;
+		while (Index < Buffer.size())
+		{
+			char Next = Buffer[Index];
+			if (Next == '\\')
+			{
+				Escaped = true;
+				Index += 2;
+				continue;
+			}
+			else if (Next == '"')
+				break;
+			++Index;
+		}
+
+		if (Index >= Buffer.size())
+			return Finished ? Fail() : JsonEvent::Need;
+
+		Source = std::string_view(Buffer).substr(Offset, Index - Offset + 1);
+		std::string_view Data = Source.substr(1, Source.size() - 2);
+		if (Escaped)
+		{
+			if (!Unescape(Data))
+				return Fail();
+			Value = Unescaped;
+		}
+		else
+			Value = Data;
+
+		Offset = Index + 1;
+		if (Event != JsonEvent::Key)
+			return AfterValue(Event);
+
+		State = Expectation::Colon;
+		return Event;
+	}
+	JsonEvent JsonReader::ReadNumber()
+	{
+		size_t Index = Offset;
+		while (Index < Buffer.size() && IsJsonNumeric(Buffer[Index]))
+			++Index;
+
+		if (Index >= Buffer.size() && !Finished)
+			return JsonEvent::Need;
+
+		auto Result = FromString<double>(std::string_view(Buffer).substr(Offset, Index - Offset));
+		if (!Result)
+			return Fail();
+
+		Number = *Result;
+		Value = std::string_view(Buffer).substr(Offset, Index - Offset);
+		Source = Value;
+		Offset = Index;
+		return AfterValue(JsonEvent::Number);
+	}
+	JsonEvent JsonReader::ReadLiteral(const std::string_view& Literal, JsonEvent Event)
+	{
+		size_t Size = std::min(Literal.size(), Buffer.size() - Offset);
+		if (std::string_view(Buffer).substr(Offset, Size) != Literal.substr(0, Size))
+			return Fail();
+		else if (Size < Literal.size())
+			return Finished ? Fail() : JsonEvent::Need;
+
+		Value = std::string_view(Buffer).substr(Offset, Size);
+		Source = Value;
+		Offset += Size;
+		return AfterValue(Event);
+	}
+	JsonEvent JsonReader::CloseScope(char Scope)
+	{
+		if (Scopes.empty() || Scopes.back() != Scope)
+			return Fail();
+
+		Scopes.pop_back();
+		return AfterValue(Scope == '{' ? JsonEvent::EndObject : JsonEvent::EndArray);
+	}
+	JsonEvent JsonReader::AfterValue(JsonEvent Event)
+	{
+		Empty = Empty && !Scopes.empty();
+		State = Scopes.empty() ? Expectation::Done : Expectation::CommaOrEnd;
+		return Event;
+	}
+	JsonEvent JsonReader::Fail()
+	{
+		Failed = true;
+		return JsonEvent::Error;
+	}
+	bool JsonReader::Unescape(const std::string_view& Data)
+	{
+		Unescaped.clear();
+		Unescaped.reserve(Data.size());
+		for (size_t i = 0; i < Data.size(); i++)
+		{
+			char Next = Data[i];
+			if (Next != '\\')
+			{
+				Unescaped.push_back(Next);
+				continue;
+			}
+			else if (++i >= Data.size())
+				return false;
+
+			switch (Data[i])
+			{
+				case '"':
+				case '\\':
+				case '/':
+					Unescaped.push_back(Data[i]);
+					break;
+				case 'b':
+					Unescaped.push_back('\b');
+					break;
+				case 'f':
+					Unescaped.push_back('\f');
+					break;
+				case 'n':
+					Unescaped.push_back('\n');
+					break;
+				case 'r':
+					Unescaped.push_back('\r');
+					break;
+				case 't':
+					Unescaped.push_back('\t');
+					break;
+				case 'u':
+				{
+					uint32_t Code = 0;
+					for (size_t j = 0; j < 4; j++)
+					{
+						int Digit = i + 1 + j < Data.size() ? GetJsonHex(Data[i + 1 + j]) : -1;
+						if (Digit < 0)
+							return false;
+						Code = (Code << 4) | (uint32_t)Digit;
+					}
+
+					i += 4;
+					if (Code >= 0xD800 && Code <= 0xDBFF && i + 6 < Data.size() && Data[i + 1] == '\\' && Data[i + 2] == 'u')
+					{
+						uint32_t Low = 0;
+						for (size_t j = 0; j < 4; j++)
+						{
+							int Digit = GetJsonHex(Data[i + 3 + j]);
+							if (Digit < 0)
+								return false;
+							Low = (Low << 4) | (uint32_t)Digit;
+						}
+
+						if (Low >= 0xDC00 && Low <= 0xDFFF)
+						{
+							Code = 0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00);
+							i += 6;
+						}
+					}
+					AppendUTF8(Unescaped, Code);
+					break;
+				}
+				default:
+					return false;
+			}
+		}
+		return true;
+	}
+
+	JsonWriter::JsonWriter() : Pending(false)
+	{
+	}
+	void JsonWriter::BeginObject()
+	{
+		Separate();
+		Buffer.push_back('{');
+		Scopes.push_back(true);
+	}
+	void JsonWriter::EndObject()
+	{
+		Buffer.push_back('}');
+		if (!Scopes.empty())
+			Scopes.pop_back();
+	}
+	void JsonWriter::BeginArray()
+	{
+		Separate();
+		Buffer.push_back('[');
+		Scopes.push_back(true);
+	}
+	void JsonWriter::EndArray()
+	{
+		Buffer.push_back(']');
+		if (!Scopes.empty())
+			Scopes.pop_back();
+	}
+	void JsonWriter::Key(const String& Name)
+	{
+		Separate();
+		Escape(Name);
+		Buffer.push_back(':');
+		Pending = true;
+	}
+	void JsonWriter::WriteString(const String& Data)
+	{
+		Separate();
+		Escape(Data);
+	}
+	void JsonWriter::WriteNumber(double Data)
+	{
+		Separate();
+		if (std::isfinite(Data))
+			Buffer.append(Vitex::Core::ToString(Data));
+		else
+			Buffer.append("null");
+	}
+	void JsonWriter::WriteInteger(int64_t Data)
+	{
+		char Number[32];
+		auto Result = std::to_chars(Number, Number + sizeof(Number), Data);
+		Separate();
+		Buffer.append(Number, Result.ptr - Number);
+	}
+	void JsonWriter::WriteBoolean(bool Data)
+	{
+		Separate();
+		Buffer.append(Data ? "true" : "false");
+	}
+	void JsonWriter::WriteNull()
+	{
+		Separate();
+		Buffer.append("null");
+	}
+	void JsonWriter::WriteRaw(const String& Data)
+	{
+		Separate();
+		Buffer.append(Data);
+	}
+	String JsonWriter::Flush()
+	{
+		String Result = std::move(Buffer);
+		Buffer.clear();
+		return Result;
+	}
+	size_t JsonWriter::GetSize() const
+	{
+		return Buffer.size();
+	}
+	void JsonWriter::BindSyntax(VirtualMachine* VM)
+	{
+		VM->ImportSystemAddon("ctypes");
+		VM->ImportSystemAddon("string");
+		auto VWriter = VM->SetClass<JsonWriter>("json_writer", false);
+		VWriter->SetConstructor<JsonWriter>("json_writer@ f()");
+		VWriter->SetMethod("void begin_object()", &JsonWriter::BeginObject);
+		VWriter->SetMethod("void end_object()", &JsonWriter::EndObject);
+		VWriter->SetMethod("void begin_array()", &JsonWriter::BeginArray);
+		VWriter->SetMethod("void end_array()", &JsonWriter::EndArray);
+		VWriter->SetMethod("void key(const string&in)", &JsonWriter::Key);
+		VWriter->SetMethod("void write_string(const string&in)", &JsonWriter::WriteString);
+		VWriter->SetMethod("void write_number(double)", &JsonWriter::WriteNumber);
+		VWriter->SetMethod("void write_integer(int64)", &JsonWriter::WriteInteger);
+		VWriter->SetMethod("void write_boolean(bool)", &JsonWriter::WriteBoolean);
+		VWriter->SetMethod("void write_null()", &JsonWriter::WriteNull);
+		VWriter->SetMethod("void write_raw(const string&in)", &JsonWriter::WriteRaw);
+		VWriter->SetMethod("string flush()", &JsonWriter::Flush);
+		VWriter->SetMethod("usize size() const", &JsonWriter::GetSize);
+	}
+	void JsonWriter::Separate()
+	{
+		if (Pending)
+		{
+			Pending = false;
+			return;
+		}
+
+		if (Scopes.empty())
+			return;
+
+		if (!Scopes.back())
+			Buffer.push_back(',');
+		Scopes.back() = false;
+	}
+	void JsonWriter::Escape(const std::string_view& Data)
+	{
+		static const char Alphabet[] = "0123456789abcdef";
+		Buffer.reserve(Buffer.size() + Data.size() + 2);
+		Buffer.push_back('"');
+		for (char Next : Data)
+		{
+			switch (Next)
+			{
+				case '"':
+					Buffer.append("\\\"");
+					break;
+				case '\\':
+					Buffer.append("\\\\");
+					break;
+				case '\n':
+					Buffer.append("\\n");
+					break;
+				case '\r':
+					Buffer.append("\\r");
+					break;
+				case '\t':
+					Buffer.append("\\t");
+					break;
+				default:
+					if ((uint8_t)Next < 0x20)
+					{
+						Buffer.append("\\u00");
+						Buffer.push_back(Alphabet[(uint8_t)Next >> 4]);
+						Buffer.push_back(Alphabet[(uint8_t)Next & 0x0F]);
+					}
+					else
+						Buffer.push_back(Next);
+					break;
+			}
+		}
+		Buffer.push_back('"');
+	}
+}
\ No newline at end of file
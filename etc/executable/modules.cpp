@@ -0,0 +1,45 @@
+#include "allocator.h"
+#include "buffers.h"
+#include "cache.h"
+#include "isolate.h"
+#include "json.h"
+#include "pack.h"
+#include "parallel.h"
+#include "sync.h"
+#include "text.h"
+#include "timers.h"
+
+namespace ASX
+{
+	void Modules::BindSyntax(VirtualMachine* VM)
+	{
+		Isolate::BindSyntax(VM);
+		Parallel::BindSyntax(VM);
+		Sync::BindSyntax(VM);
+		ThreadAllocator::BindSyntax(VM);
+		Text::BindSyntax(VM);
+		StringBuffer::BindSyntax(VM);
+		Buffers::BindSyntax(VM);
+		JsonReader::BindSyntax(VM);
+		JsonWriter::BindSyntax(VM);
+		Pack::BindSyntax(VM);
+		SharedCache::BindSyntax(VM);
+		TimerWheel::BindSyntax(VM);
+	}
+	void Modules::Cleanup()
+	{
+		Isolate::Cleanup();
+		Parallel::Cleanup();
+		SharedCache::Cleanup();
+		TimerWheel::Cleanup();
+	}
+	uint64_t Modules::Update(uint64_t Timeout)
+	{
+		return TimerWheel::HasInstance() ? TimerWheel::Get()->Update(Timeout) : Timeout;
+	}
+	void Modules::Cancel(EventLoop* Loop)
+	{
+		if (TimerWheel::HasInstance())
+			TimerWheel::Get()->Cancel(Loop);
+	}
+}
\ No newline at end of file
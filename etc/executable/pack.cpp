@@ -0,0 +1,728 @@
+#include "pack.h"
+#define PACK_MAX_DEPTH 128
+
+namespace ASX
+{
+	static inline double GetHalfFloat(uint16_t Value)
+	{
+		int Exponent = (Value >> 10) & 0x1F;
+		double Mantissa = (double)(Value & 0x3FF);
+		double Result = Exponent == 0 ? std::ldexp(Mantissa, -24) : (Exponent != 31 ? std::ldexp(Mantissa + 1024.0, Exponent - 25) : (Mantissa == 0.0 ? INFINITY : NAN));
+		return Value & 0x8000 ? -Result : Result;
+	}
+	template <typename T>
+	static void WriteNumbers(PackEncoder& Encoder, Bindings::Array* Source, bool IsFloat)
+	{
+		T* Buffer = (T*)Source->GetBuffer();
+		size_t Size = Source->Size();
+		Encoder.BeginArray(Size);
+		for (size_t i = 0; i < Size; i++)
+		{
+			if (IsFloat)
+				Encoder.WriteNumber((double)Buffer[i]);
+			else if (std::is_signed<T>::value)
+				Encoder.WriteInteger((int64_t)Buffer[i]);
+			else
+				Encoder.WriteUnsigned((uint64_t)Buffer[i]);
+		}
+	}
+
+	PackEncoder::PackEncoder(String& NewOutput, PackFormat NewFormat) : Output(NewOutput), Format(NewFormat), Overflow(false)
+	{
+	}
+	void PackEncoder::WriteNull()
+	{
+		Output.push_back(Format == PackFormat::MessagePack ? (char)0xC0 : (char)0xF6);
+	}
+	void PackEncoder::WriteBoolean(bool Value)
+	{
+		if (Format == PackFormat::MessagePack)
+			Output.push_back(Value ? (char)0xC3 : (char)0xC2);
+		else
+			Output.push_back(Value ? (char)0xF5 : (char)0xF4);
+	}
+	void PackEncoder::WriteInteger(int64_t Value)
+	{
+		if (Value >= 0)
+			return WriteUnsigned((uint64_t)Value);
+
+		if (Format == PackFormat::CBOR)
+			return WriteHead(1, (uint64_t)(-(Value + 1)));
+
+		if (Value >= -32)
+			Output.push_back((char)(int8_t)Value);
+		else if (Value >= INT8_MIN)
+		{
+			Output.push_back((char)0xD0);
+			WriteBigEndian((uint8_t)(int8_t)Value, 1);
+		}
+		else if (Value >= INT16_MIN)
+		{
+			Output.push_back((char)0xD1);
+			WriteBigEndian((uint16_t)(int16_t)Value, 2);
+		}
+		else if (Value >= INT32_MIN)
+		{
+			Output.push_back((char)0xD2);
+			WriteBigEndian((uint32_t)(int32_t)Value, 4);
+		}
+		else
+		{
+			Output.push_back((char)0xD3);
+			WriteBigEndian((uint64_t)Value, 8);
+		}
+	}
+	void PackEncoder::WriteUnsigned(uint64_t Value)
+	{
+		if (Format == PackFormat::CBOR)
+			return WriteHead(0, Value);
+
+		if (Value < 128)
+			Output.push_back((char)Value);
+		else if (Value <= UINT8_MAX)
+		{
+			Output.push_back((char)0xCC);
+			WriteBigEndian(Value, 1);
+		}
+		else if (Value <= UINT16_MAX)
+		{
+			Output.push_back((char)0xCD);
+			WriteBigEndian(Value, 2);
+		}
+		else if (Value <= UINT32_MAX)
+		{
+			Output.push_back((char)0xCE);
+			WriteBigEndian(Value, 4);
+		}
+		else
+		{
+			Output.push_back((char)0xCF);
+			WriteBigEndian(Value, 8);
+		}
+	}
+	void PackEncoder::WriteNumber(double Value)
+	{
+		uint64_t Bits;
+		memcpy(&Bits, &Value, sizeof(Bits));
+		Output.push_back(Format == PackFormat::MessagePack ? (char)0xCB : (char)0xFB);
+		WriteBigEndian(Bits, 8);
+	}
+	void PackEncoder::WriteString(const std::string_view& Value)
+	{
+		if (Format == PackFormat::MessagePack)
+			WriteSized(0xA0, 32, 0xD9, true, Value.size());
+		else
+			WriteHead(3, Value.size());
+		Output.append(Value);
+	}
+	void PackEncoder::WriteBinary(const std::string_view& Value)
+	{
+		if (Format == PackFormat::MessagePack)
+			WriteSized(0, 0, 0xC4, true, Value.size());
+		else
+			WriteHead(2, Value.size());
+		Output.append(Value);
+	}
+	void PackEncoder::BeginArray(size_t Size)
+	{
+		if (Format == PackFormat::MessagePack)
+			WriteSized(0x90, 16, 0xDC, false, Size);
+		else
+			WriteHead(4, Size);
+	}
+	void PackEncoder::BeginMap(size_t Size)
+	{
+		if (Format == PackFormat::MessagePack)
+			WriteSized(0x80, 16, 0xDE, false, Size);
+		else
+			WriteHead(5, Size);
+	}
+	void PackEncoder::WriteSchema(Schema* Value, size_t Depth)
+	{
+		if (Depth > PACK_MAX_DEPTH)
+			Overflow = true;
+
+		if (!Value || Overflow)
+			return WriteNull();
+
+		switch (Value->Value.GetType())
+		{
+			case VarType::Object:
+			{
+				auto& Nodes = Value->GetChilds();
+				BeginMap(Nodes.size());
+				for (auto* Node : Nodes)
+				{
+					WriteString(Node->Key);
+					WriteSchema(Node, Depth + 1);
+				}
+				break;
+			}
+			case VarType::Array:
+			{
+				auto& Nodes = Value->GetChilds();
+				BeginArray(Nodes.size());
+				for (auto* Node : Nodes)
+					WriteSchema(Node, Depth + 1);
+				break;
+			}
+			case VarType::String:
+				WriteString(Value->Value.GetString());
+				break;
+			case VarType::Binary:
+				WriteBinary(Value->Value.GetString());
+				break;
+			case VarType::Integer:
+				WriteInteger(Value->Value.GetInteger());
+				break;
+			case VarType::Number:
+				WriteNumber(Value->Value.GetNumber());
+				break;
+			case VarType::Decimal:
+				WriteString(Value->Value.GetBlob());
+				break;
+			case VarType::Boolean:
+				WriteBoolean(Value->Value.GetBoolean());
+				break;
+			default:
+				WriteNull();
+				break;
+		}
+	}
+	void PackEncoder::WriteAny(void* Ref, int Type, size_t Depth)
+	{
+		if (Type & (int)TypeId::OBJHANDLE)
+			Ref = Ref ? *(void**)Ref : nullptr;
+
+		if (Depth > PACK_MAX_DEPTH)
+			Overflow = true;
+
+		if (!Ref || Overflow)
+			return WriteNull();
+
+		switch ((TypeId)Type)
+		{
+			case TypeId::BOOL:
+				return WriteBoolean(*(bool*)Ref);
+			case TypeId::INT8:
+				return WriteInteger(*(int8_t*)Ref);
+			case TypeId::INT16:
+				return WriteInteger(*(int16_t*)Ref);
+			case TypeId::INT32:
+				return WriteInteger(*(int32_t*)Ref);
+			case TypeId::INT64:
+				return WriteInteger(*(int64_t*)Ref);
+			case TypeId::UINT8:
+				return WriteUnsigned(*(uint8_t*)Ref);
+			case TypeId::UINT16:
+				return WriteUnsigned(*(uint16_t*)Ref);
+			case TypeId::UINT32:
+				return WriteUnsigned(*(uint32_t*)Ref);
+			case TypeId::UINT64:
+				return WriteUnsigned(*(uint64_t*)Ref);
+			case TypeId::FLOAT:
+				return WriteNumber(*(float*)Ref);
+			case TypeId::DOUBLE:
+				return WriteNumber(*(double*)Ref);
+			default:
+				break;
+		}
+
+		if (!(Type & (int)TypeId::MASK_OBJECT))
+			return WriteInteger(*(int32_t*)Ref);
+
+		if (Type & (int)TypeId::SCRIPTOBJECT)
+		{
+			ScriptObject Object = ScriptObject((asIScriptObject*)Ref);
+			size_t Count = Object.GetPropertiesCount();
+			BeginMap(Count);
+			for (size_t i = 0; i < Count; i++)
+			{
+				WriteString(Object.GetPropertyName(i));
+				WriteAny(Object.GetAddressOfProperty(i), Object.GetPropertyTypeId(i), Depth + 1);
+			}
+			return;
+		}
+
+		auto* VM = VirtualMachine::Get();
+		TypeInfo Info = VM ? VM->GetTypeInfoById(Type) : TypeInfo(nullptr);
+		std::string_view Name = Info.IsValid() ? Info.GetName() : std::string_view();
+		if (Name == "string")
+			return WriteString(*(String*)Ref);
+		else if (Name == "schema")
+			return WriteSchema((Schema*)Ref, Depth);
+		else if (Name != "array")
+			return WriteNull();
+
+		auto* Source = (Bindings::Array*)Ref;
+		int ElementTypeId = Source->GetElementTypeId();
+		switch ((TypeId)ElementTypeId)
+		{
+			case TypeId::INT8:
+				return WriteNumbers<int8_t>(*this, Source, false);
+			case TypeId::INT16:
+				return WriteNumbers<int16_t>(*this, Source, false);
+			case TypeId::INT32:
+				return WriteNumbers<int32_t>(*this, Source, false);
+			case TypeId::INT64:
+				return WriteNumbers<int64_t>(*this, Source, false);
+			case TypeId::UINT8:
+				return WriteBinary(std::string_view((char*)Source->GetBuffer(), Source->Size()));
+			case TypeId::UINT16:
+				return WriteNumbers<uint16_t>(*this, Source, false);
+			case TypeId::UINT32:
+				return WriteNumbers<uint32_t>(*this, Source, false);
+			case TypeId::UINT64:
+				return WriteNumbers<uint64_t>(*this, Source, false);
+			case TypeId::FLOAT:
+				return WriteNumbers<float>(*this, Source, true);
+			case TypeId::DOUBLE:
+				return WriteNumbers<double>(*this, Source, true);
+			default:
+				break;
+		}
+
+		size_t Size = Source->Size();
+		BeginArray(Size);
+		for (size_t i = 0; i < Size; i++)
+			WriteAny(Source->At(i), ElementTypeId, Depth + 1);
+	}
+	bool PackEncoder::IsOverflow() const
+	{
+		return Overflow;
+	}
+	void PackEncoder::WriteHead(uint8_t Major, uint64_t Value)
+	{
+		uint8_t Type = (uint8_t)(Major << 5);
+		if (Value < 24)
+			Output.push_back((char)(Type | (uint8_t)Value));
+		else if (Value <= UINT8_MAX)
+		{
+			Output.push_back((char)(Type | 24));
+			WriteBigEndian(Value, 1);
+		}
+		else if (Value <= UINT16_MAX)
+		{
+			Output.push_back((char)(Type | 25));
+			WriteBigEndian(Value, 2);
+		}
+		else if (Value <= UINT32_MAX)
+		{
+			Output.push_back((char)(Type | 26));
+			WriteBigEndian(Value, 4);
+		}
+		else
+		{
+			Output.push_back((char)(Type | 27));
+			WriteBigEndian(Value, 8);
+		}
+	}
+	void PackEncoder::WriteSized(uint8_t Fixed, uint8_t FixedLimit, uint8_t Tag, bool Short, uint64_t Size)
+	{
+		if (Size < FixedLimit)
+			Output.push_back((char)(Fixed | (uint8_t)Size));
+		else if (Short && Size <= UINT8_MAX)
+		{
+			Output.push_back((char)Tag);
+			WriteBigEndian(Size, 1);
+		}
+		else if (Size <= UINT16_MAX)
+		{
+			Output.push_back((char)(Tag + (Short ? 1 : 0)));
+			WriteBigEndian(Size, 2);
+		}
+		else
+		{
+			Output.push_back((char)(Tag + (Short ? 2 : 1)));
+			WriteBigEndian(Size, 4);
+		}
+	}
+	void PackEncoder::WriteBigEndian(uint64_t Value, size_t Bytes)
+	{
+		char Buffer[8];
+		for (size_t i = 0; i < Bytes; i++)
+			Buffer[i] = (char)(Value >> ((Bytes - i - 1) * 8));
+		Output.append(Buffer, Bytes);
+	}
+
+	PackDecoder::PackDecoder(const std::string_view& NewData, PackFormat NewFormat, size_t NewOffset) : Data(NewData), Format(NewFormat), Status(PackStatus::Success), Offset(NewOffset)
+	{
+	}
+	Schema* PackDecoder::ReadSchema(size_t Depth)
+	{
+		if (Offset >= Data.size())
+			return Fail(PackStatus::Incomplete);
+		else if (Depth > PACK_MAX_DEPTH)
+			return Fail(PackStatus::Overflow);
+
+		Schema* Result = Format == PackFormat::MessagePack ? ReadMessagePack(Depth) : ReadCBOR(Depth);
+		return Result ? Result : Fail(PackStatus::Invalid);
+	}
+	PackStatus PackDecoder::GetStatus() const
+	{
+		return Status;
+	}
+	size_t PackDecoder::GetOffset() const
+	{
+		return Offset;
+	}
+	Schema* PackDecoder::ReadMessagePack(size_t Depth)
+	{
+		uint8_t Type = (uint8_t)Data[Offset++];
+		if (Type <= 0x7F)
+			return Var::Set::Integer(Type);
+		else if (Type >= 0xE0)
+			return Var::Set::Integer((int8_t)Type);
+		else if (Type >= 0x80 && Type <= 0x8F)
+			return ReadMap(Type & 0x0F, Depth);
+		else if (Type >= 0x90 && Type <= 0x9F)
+			return ReadArray(Type & 0x0F, Depth);
+
+		uint64_t Value = 0;
+		std::string_view Bytes;
+		if (Type >= 0xA0 && Type <= 0xBF)
+			return ReadBytes(Type & 0x1F, Bytes) ? Var::Set::String(Bytes) : nullptr;
+
+		switch (Type)
+		{
+			case 0xC0:
+				return Var::Set::Null();
+			case 0xC2:
+				return Var::Set::Boolean(false);
+			case 0xC3:
+				return Var::Set::Boolean(true);
+			case 0xC4:
+			case 0xC5:
+			case 0xC6:
+				if (!ReadBigEndian((size_t)1 << (Type - 0xC4), Value) || !ReadBytes((size_t)Value, Bytes))
+					return nullptr;
+				return Var::Set::Binary(Bytes);
+			case 0xCA:
+			{
+				if (!ReadBigEndian(4, Value))
+					return nullptr;
+				float Number; uint32_t Bits = (uint32_t)Value;
+				memcpy(&Number, &Bits, sizeof(Number));
+				return Var::Set::Number(Number);
+			}
+			case 0xCB:
+			{
+				if (!ReadBigEndian(8, Value))
+					return nullptr;
+				double Number;
+				memcpy(&Number, &Value, sizeof(Number));
+				return Var::Set::Number(Number);
+			}
+			case 0xCC:
+			case 0xCD:
+			case 0xCE:
+			case 0xCF:
+				if (!ReadBigEndian((size_t)1 << (Type - 0xCC), Value))
+					return nullptr;
+				return Value > (uint64_t)INT64_MAX ? Var::Set::Number((double)Value) : Var::Set::Integer((int64_t)Value);
+			case 0xD0:
+				return ReadBigEndian(1, Value) ? Var::Set::Integer((int8_t)Value) : nullptr;
+			case 0xD1:
+				return ReadBigEndian(2, Value) ? Var::Set::Integer((int16_t)Value) : nullptr;
+			case 0xD2:
+				return ReadBigEndian(4, Value) ? Var::Set::Integer((int32_t)Value) : nullptr;
+			case 0xD3:
+				return ReadBigEndian(8, Value) ? Var::Set::Integer((int64_t)Value) : nullptr;
+			case 0xD9:
+			case 0xDA:
+			case 0xDB:
+				if (!ReadBigEndian((size_t)1 << (Type - 0xD9), Value) || !ReadBytes((size_t)Value, Bytes))
+					return nullptr;
+				return Var::Set::String(Bytes);
+			case 0xDC:
+			case 0xDD:
+				return ReadBigEndian(Type == 0xDC ? 2 : 4, Value) ? ReadArray((size_t)Value, Depth) : nullptr;
+			case 0xDE:
+			case 0xDF:
+				return ReadBigEndian(Type == 0xDE ? 2 : 4, Value) ? ReadMap((size_t)Value, Depth) : nullptr;
+			default:
+				return nullptr;
+		}
+	}
+	Schema* PackDecoder::ReadCBOR(size_t Depth)
+	{
+		uint8_t Type = (uint8_t)Data[Offset++];
+		uint8_t Major = Type >> 5, Minor = Type & 0x1F;
+		uint64_t Value = Minor;
+		if (Minor >= 24 && Minor <= 27)
+		{
+			if (!ReadBigEndian((size_t)1 << (Minor - 24), Value))
+				return nullptr;
+		}
+		else if (Minor > 27 && (Minor != 31 || Major == 0 || Major == 1 || Major == 6))
+			return nullptr;
+
+		std::string_view Bytes;
+		switch (Major)
+		{
+			case 0:
+				return Value > (uint64_t)INT64_MAX ? Var::Set::Number((double)Value) : Var::Set::Integer((int64_t)Value);
+			case 1:
+				return Value > (uint64_t)INT64_MAX ? Var::Set::Number(-1.0 - (double)Value) : Var::Set::Integer(-1 - (int64_t)Value);
+			case 2:
+			case 3:
+			{
+				if (Minor != 31)
+				{
+					if (!ReadBytes((size_t)Value, Bytes))
+						return nullptr;
+					return Major == 2 ? Var::Set::Binary(Bytes) : Var::Set::String(Bytes);
+				}
+
+				String Chunks;
+				if (!ReadChunks(Major, Chunks))
+					return nullptr;
+				return Major == 2 ? Var::Set::Binary(Chunks) : Var::Set::String(Chunks);
+			}
+			case 4:
+				return ReadArray(Minor == 31 ? std::string::npos : (size_t)Value, Depth);
+			case 5:
+				return ReadMap(Minor == 31 ? std::string::npos : (size_t)Value, Depth);
+			case 6:
+				return ReadSchema(Depth + 1);
+			default:
+				break;
+		}
+
+		switch (Minor)
+		{
+			case 20:
+				return Var::Set::Boolean(false);
+			case 21:
+				return Var::Set::Boolean(true);
+			case 22:
+				return Var::Set::Null();
+			case 23:
+				return Var::Set::Undefined();
+			case 25:
+				return Var::Set::Number(GetHalfFloat((uint16_t)Value));
+			case 26:
+			{
+				float Number; uint32_t Bits = (uint32_t)Value;
+				memcpy(&Number, &Bits, sizeof(Number));
+				return Var::Set::Number(Number);
+			}
+			case 27:
+			{
+				double Number;
+				memcpy(&Number, &Value, sizeof(Number));
+				return Var::Set::Number(Number);
+			}
+			default:
+				return nullptr;
+		}
+	}
+	Schema* PackDecoder::ReadArray(size_t Size, size_t Depth)
+	{
+		Schema* Result = Var::Set::Array();
+		for (size_t i = 0; i < Size; i++)
+		{
+			if (Size == std::string::npos && Offset < Data.size() && (uint8_t)Data[Offset] == 0xFF)
+			{
+				++Offset;
+				return Result;
+			}
+
+			Schema* Next = ReadSchema(Depth + 1);
+			if (!Next)
+			{
+				Memory::Release(Result);
+				return nullptr;
+			}
+			Result->Push(Next);
+		}
+		return Result;
+	}
+	Schema* PackDecoder::ReadMap(size_t Size, size_t Depth)
+	{
+		Schema* Result = Var::Set::Object();
+		for (size_t i = 0; i < Size; i++)
+		{
+			if (Size == std::string::npos && Offset < Data.size() && (uint8_t)Data[Offset] == 0xFF)
+			{
+				++Offset;
+				return Result;
+			}
+
+			Schema* Key = ReadSchema(Depth + 1);
+			Schema* Next = Key ? ReadSchema(Depth + 1) : nullptr;
+			if (!Next)
+			{
+				if (Key != nullptr)
+					Memory::Release(Key);
+				Memory::Release(Result);
+				return nullptr;
+			}
+
+			Result->Set(Key->Value.GetBlob(), Next);
+			Memory::Release(Key);
+		}
+		return Result;
+	}
+	bool PackDecoder::ReadChunks(uint8_t Major, String& Value)
+	{
+		while (Offset < Data.size())
+		{
+			uint8_t Type = (uint8_t)Data[Offset++];
+			if (Type == 0xFF)
+				return true;
+			else if ((Type >> 5) != Major || (Type & 0x1F) > 27)
+				return false;
+
+			uint64_t Size = Type & 0x1F;
+			std::string_view Chunk;
+			if (Size >= 24 && !ReadBigEndian((size_t)1 << (Size - 24), Size))
+				return false;
+			else if (!ReadBytes((size_t)Size, Chunk))
+				return false;
+			Value.append(Chunk);
+		}
+
+		Fail(PackStatus::Incomplete);
+		return false;
+	}
+	bool PackDecoder::ReadBigEndian(size_t Bytes, uint64_t& Value)
+	{
+		if (Data.size() - Offset < Bytes)
+		{
+			Fail(PackStatus::Incomplete);
+			return false;
+		}
+
+		Value = 0;
+		for (size_t i = 0; i < Bytes; i++)
+			Value = (Value << 8) | (uint8_t)Data[Offset + i];
+		Offset += Bytes;
+		return true;
+	}
+	bool PackDecoder::ReadBytes(size_t Size, std::string_view& Value)
+	{
+		if (Data.size() - Offset < Size)
+		{
+			Fail(PackStatus::Incomplete);
+			return false;
+		}
+
+		Value = Data.substr(Offset, Size);
+		Offset += Size;
+		return true;
+	}
+	Schema* PackDecoder::Fail(PackStatus NewStatus)
+	{
+		if (Status == PackStatus::Success)
+			Status = NewStatus;
+		return nullptr;
+	}
+
+	String Pack::Encode(Schema* Value, PackFormat Format, bool* Overflow)
+	{
+		String Result;
+		PackEncoder Encoder(Result, Format);
+		Encoder.WriteSchema(Value);
+		if (Overflow != nullptr)
+			*Overflow = Encoder.IsOverflow();
+		return Result;
+	}
+	Schema* Pack::Decode(const std::string_view& Data, PackFormat Format, size_t* Offset, PackStatus* Status)
+	{
+		PackDecoder Decoder(Data, Format, Offset ? *Offset : 0);
+		Schema* Result = Decoder.ReadSchema();
+		if (Offset != nullptr)
+			*Offset = Result ? Decoder.GetOffset() : *Offset;
+		if (Status != nullptr)
+			*Status = Decoder.GetStatus();
+		return Result;
+	}
+	void Pack::BindSyntax(VirtualMachine* VM)
+	{
+		VM->ImportSystemAddon("string");
+		VM->ImportSystemAddon("schema");
+		auto VStatus = VM->SetEnum("pack_status");
+		VStatus->SetValue("success", (int)PackStatus::Success);
+		VStatus->SetValue("incomplete", (int)PackStatus::Incomplete);
+		VStatus->SetValue("invalid", (int)PackStatus::Invalid);
+		VStatus->SetValue("overflow", (int)PackStatus::Overflow);
+		BindFormat<PackFormat::MessagePack>(VM, "msgpack");
+		BindFormat<PackFormat::CBOR>(VM, "cbor");
+	}
+	template <PackFormat Format>
+	void Pack::BindFormat(VirtualMachine* VM, const char* Namespace)
+	{
+		VM->BeginNamespace(Namespace);
+		VM->SetFunction("string encode(schema@+)", &Pack::ScriptEncode<Format>);
+		VM->SetFunction("void encode_into(string_builder@+, schema@+)", &Pack::ScriptEncodeInto<Format>);
+		VM->SetFunction("string pack(const ?&in)", &Pack::ScriptPack<Format>);
+		VM->SetFunction("void pack_into(string_builder@+, const ?&in)", &Pack::ScriptPackInto<Format>);
+		VM->SetFunction("schema@ decode(const string&in)", &Pack::ScriptDecode<Format>);
+		VM->SetFunction("schema@ decode_next(const string&in, usize, usize&out, pack_status&out)", &Pack::ScriptDecodeNext<Format>);
+		VM->EndNamespace();
+	}
+	template <PackFormat Format>
+	String Pack::ScriptEncode(Schema* Value)
+	{
+		bool Overflow = false;
+		String Result = Encode(Value, Format, &Overflow);
+		return ThrowOverflow(Overflow) ? String() : Result;
+	}
+	template <PackFormat Format>
+	void Pack::ScriptEncodeInto(StringBuffer* Target, Schema* Value)
+	{
+		if (!Target)
+			return;
+
+		String& Data = Target->GetData();
+		size_t Size = Data.size();
+		PackEncoder Encoder(Data, Format);
+		Encoder.WriteSchema(Value);
+		if (ThrowOverflow(Encoder.IsOverflow()))
+			Data.resize(Size);
+	}
+	template <PackFormat Format>
+	String Pack::ScriptPack(void* Ref, int Type)
+	{
+		String Result;
+		PackEncoder Encoder(Result, Format);
+		Encoder.WriteAny(Ref, Type);
+		return ThrowOverflow(Encoder.IsOverflow()) ? String() : Result;
+	}
+	template <PackFormat Format>
+	void Pack::ScriptPackInto(StringBuffer* Target, void* Ref, int Type)
+	{
+		if (!Target)
+			return;
+
+		String& Data = Target->GetData();
+		size_t Size = Data.size();
+		PackEncoder Encoder(Data, Format);
+		Encoder.WriteAny(Ref, Type);
+		if (ThrowOverflow(Encoder.IsOverflow()))
+			Data.resize(Size);
+	}
+	template <PackFormat Format>
+	Schema* Pack::ScriptDecode(const String& Data)
+	{
+		PackStatus Status = PackStatus::Success;
+		Schema* Result = Decode(Data, Format, nullptr, &Status);
+		ThrowOverflow(Status == PackStatus::Overflow);
+		return Result;
+	}
+	template <PackFormat Format>
+	Schema* Pack::ScriptDecodeNext(const String& Data, size_t Offset, size_t& Next, PackStatus& Status)
+	{
+		Next = Offset;
+		Schema* Result = Decode(Data, Format, &Next, &Status);
+		ThrowOverflow(Status == PackStatus::Overflow);
+		return Result;
+	}
+	bool Pack::ThrowOverflow(bool Overflow)
+	{
+		if (Overflow)
+			ImmediateContext::Get()->SetException(Stringify::Text("pack nesting is deeper than %i levels", (int)PACK_MAX_DEPTH).c_str());
+		return Overflow;
+	}
+}
\ No newline at end of file
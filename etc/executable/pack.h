@@ -0,0 +1,101 @@
+#ifndef PACK_H
+#define PACK_H
+#include "runtime.hpp"
+#include "text.h"
+#include <vengeance/vengeance.h>
+
+namespace ASX
+{
+	enum class PackFormat
+	{
+		MessagePack,
+		CBOR
+	};
+
+	enum class PackStatus
+	{
+		Success,
+		Incomplete,
+		Invalid,
+		Overflow
+	};
+
+	class PackEncoder
+	{
+	private:
+		String& Output;
+		PackFormat Format;
+		bool Overflow;
+
+	public:
+		PackEncoder(String& NewOutput, PackFormat NewFormat);
+		void WriteNull();
+		void WriteBoolean(bool Value);
+		void WriteInteger(int64_t Value);
+		void WriteUnsigned(uint64_t Value);
+		void WriteNumber(double Value);
+		void WriteString(const std::string_view& Value);
+		void WriteBinary(const std::string_view& Value);
+		void BeginArray(size_t Size);
+		void BeginMap(size_t Size);
+		void WriteSchema(Schema* Value, size_t Depth = 0);
+		void WriteAny(void* Ref, int Type, size_t Depth = 0);
+		bool IsOverflow() const;
+
+	private:
+		void WriteHead(uint8_t Major, uint64_t Value);
+		void WriteSized(uint8_t Fixed, uint8_t FixedLimit, uint8_t Tag, bool Short, uint64_t Size);
+		void WriteBigEndian(uint64_t Value, size_t Bytes);
+	};
+
+	class PackDecoder
+	{
+	private:
+		std::string_view Data;
+		PackFormat Format;
+		PackStatus Status;
+		size_t Offset;
+
+	public:
+		PackDecoder(const std::string_view& NewData, PackFormat NewFormat, size_t NewOffset = 0);
+		Schema* ReadSchema(size_t Depth = 0);
+		PackStatus GetStatus() const;
+		size_t GetOffset() const;
+
+	private:
+		Schema* ReadMessagePack(size_t Depth);
+		Schema* ReadCBOR(size_t Depth);
+		Schema* ReadArray(size_t Size, size_t Depth);
+		Schema* ReadMap(size_t Size, size_t Depth);
+		bool ReadChunks(uint8_t Major, String& Value);
+		bool ReadBigEndian(size_t Bytes, uint64_t& Value);
+		bool ReadBytes(size_t Size, std::string_view& Value);
+		Schema* Fail(PackStatus NewStatus);
+	};
+
+	class Pack
+	{
+	public:
+		static String Encode(Schema* Value, PackFormat Format, bool* Overflow = nullptr);
+		static Schema* Decode(const std::string_view& Data, PackFormat Format, size_t* Offset = nullptr, PackStatus* Status = nullptr);
+		static void BindSyntax(VirtualMachine* VM);
+
+	private:
+		template <PackFormat Format>
+		static void BindFormat(VirtualMachine* VM, const char* Namespace);
+		template <PackFormat Format>
+		static String ScriptEncode(Schema* Value);
+		template <PackFormat Format>
+		static void ScriptEncodeInto(StringBuffer* Target, Schema* Value);
+		template <PackFormat Format>
+		static String ScriptPack(void* Ref, int Type);
+		template <PackFormat Format>
+		static void ScriptPackInto(StringBuffer* Target, void* Ref, int Type);
+		template <PackFormat Format>
+		static Schema* ScriptDecode(const String& Data);
+		template <PackFormat Format>
+		static Schema* ScriptDecodeNext(const String& Data, size_t Offset, size_t& Next, PackStatus& Status);
+		static bool ThrowOverflow(bool Overflow);
+	};
+}
+#endif
\ No newline at end of file
@@ -1,256 +1,402 @@
-#ifndef RUNTIME_H
-#define RUNTIME_H
-#include <vengeance/bindings.h>
-#include <vengeance/vengeance.h>
-
-using namespace Vitex::Core;
-using namespace Vitex::Compute;
-using namespace Vitex::Scripting;
-
-namespace ASX
-{
-	enum class ExitStatus
-	{
-		Continue = 0x00fffff - 1,
-		OK = 0,
-		RuntimeError,
-		PrepareError,
-		LoadingError,
-		SavingError,
-		CompilerError,
-		EntrypointError,
-		InputError,
-		InvalidCommand,
-		InvalidDeclaration,
-		CommandError,
-		Kill
-	};
-
-	struct ProgramEntrypoint
-	{
-		const char* ReturnsWithArgs = "int main(array<string>@)";
-		const char* Returns = "int main()";
-		const char* Simple = "void main()";
-	};
-
-	struct EnvironmentConfig
-	{
-		InlineArgs Commandline;
-		UnorderedSet<String> Addons;
-		FunctionDelegate AtExit;
-		FileEntry File;
-		String Name;
-		String Path;
-		String Program;
-		String Registry;
-		String Mode;
-		String Output;
-		String Addon;
-		Compiler* ThisCompiler;
-		const char* Module;
-		int32_t AutoSchedule;
-		bool AutoConsole;
-		bool AutoStop;
-		bool Inline;
-
-		EnvironmentConfig() : ThisCompiler(nullptr), Module("__anonymous__"), AutoSchedule(-1), AutoConsole(false), AutoStop(false), Inline(true)
-		{
-		}
-		void Parse(int ArgsCount, char** ArgsData, const UnorderedSet<String>& Flags = { })
-		{
-			Commandline = OS::Process::ParseArgs(ArgsCount, ArgsData, (size_t)ArgsFormat::KeyValue | (size_t)ArgsFormat::FlagValue | (size_t)ArgsFormat::StopIfNoMatch, Flags);
-		}
-		static EnvironmentConfig& Get(EnvironmentConfig* Other = nullptr)
-		{
-			static EnvironmentConfig* Base = Other;
-			VI_ASSERT(Base != nullptr, "env was not set");
-			return *Base;
-		}
-	};
-
-	struct SystemConfig
-	{
-		UnorderedMap<String, std::pair<String, String>> Functions;
-		UnorderedMap<AccessOption, bool> Permissions;
-		Vector<std::pair<String, bool>> Libraries;
-		Vector<std::pair<String, int32_t>> Settings;
-		Vector<String> SystemAddons;
-		bool TsImports = true;
-		bool Tags = true;
-		bool Debug = false;
-		bool Interactive = false;
-		bool EssentialsOnly = true;
-		bool PrettyProgress = true;
-		bool LoadByteCode = false;
-		bool SaveByteCode = false;
-		bool SaveSourceCode = false;
-		bool Dependencies = false;
-		bool Install = false;
-		size_t Installed = 0;
-	};
-
-	class Runtime
-	{
-	public:
-		static void StartupEnvironment(EnvironmentConfig& Env)
-		{
-			if (Env.AutoSchedule >= 0)
-				Schedule::Get()->Start(Env.AutoSchedule > 0 ? Schedule::Desc((size_t)Env.AutoSchedule) : Schedule::Desc());
-
-			if (Env.AutoConsole)
-				Console::Get()->Attach();
-		}
-		static void ShutdownEnvironment(EnvironmentConfig& Env)
-		{
-			if (Env.AutoStop)
-				Schedule::Get()->Stop();
-		}
-		static void ConfigureSystem(SystemConfig& Config)
-		{
-			for (auto& Option : Config.Permissions)
-				OS::Control::Set(Option.first, Option.second);
-		}
-		static bool ConfigureContext(SystemConfig& Config, EnvironmentConfig& Env, VirtualMachine* VM, Compiler* ThisCompiler)
-		{
-			VM->SetTsImports(Config.TsImports);
-			VM->SetModuleDirectory(OS::Path::GetDirectory(Env.Path.c_str()));
-			VM->SetPreserveSourceCode(Config.SaveSourceCode);
-
-			for (auto& Name : Config.SystemAddons)
-			{
-				if (!VM->ImportSystemAddon(Name))
-				{
-					VI_ERR("system addon <%s> cannot be loaded", Name.c_str());
-					return false;
-				}
-			}
-
-			for (auto& Path : Config.Libraries)
-			{
-				if (!VM->ImportCLibrary(Path.first, Path.second))
-				{
-					VI_ERR("external %s <%s> cannot be loaded", Path.second ? "addon" : "clibrary", Path.first.c_str());
-					return false;
-				}
-			}
-
-			for (auto& Data : Config.Functions)
-			{
-				if (!VM->ImportCFunction({ Data.first }, Data.second.first, Data.second.second))
-				{
-					VI_ERR("clibrary function <%s> from <%s> cannot be loaded", Data.second.first.c_str(), Data.first.c_str());
-					return false;
-				}
-			}
-
-			auto* Macro = ThisCompiler->GetProcessor();
-			Macro->AddDefaultDefinitions();
-
-			Env.ThisCompiler = ThisCompiler;
-			Bindings::Tags::BindSyntax(VM, Config.Tags, &Runtime::ProcessTags);
-			EnvironmentConfig::Get(&Env);
-
-			VM->ImportSystemAddon("ctypes");
-			VM->BeginNamespace("this_process");
-			VM->SetFunctionDef("void exit_event(int)");
-			VM->SetFunction("void before_exit(exit_event@)", &Runtime::ApplyContextExit);
-			VM->SetFunction("uptr@ get_compiler()", &Runtime::GetCompiler);
-			VM->EndNamespace();
-			return true;
-		}
-		static bool TryContextExit(EnvironmentConfig& Env, int Value)
-		{
-			if (!Env.AtExit.IsValid())
-				return false;
-
-			auto Status = Env.AtExit([Value](ImmediateContext* Context)
-			{
-				Context->SetArg32(0, Value);
-			}).Get();
-			Env.AtExit.Release();
-			VirtualMachine::CleanupThisThread();
-			return !!Status;
-		}
-		static void ApplyContextExit(asIScriptFunction* Callback)
-		{
-			auto& Env = EnvironmentConfig::Get();
-			UPtr<ImmediateContext> Context = Callback ? Env.ThisCompiler->GetVM()->RequestContext() : nullptr;
-			Env.AtExit = FunctionDelegate(Callback, *Context);
-		}
-		static void AwaitContext(std::mutex& Mutex, EventLoop* Loop, VirtualMachine* VM, ImmediateContext* Context)
-		{
-			EventLoop::Set(Loop);
-			while (Loop->PollExtended(Context, 1000))
-			{
-				VM->PerformPeriodicGarbageCollection(60000);
-				Loop->Dequeue(VM);
-			}
-
-			UMutex<std::mutex> Unique(Mutex);
-			if (Schedule::HasInstance())
-			{
-				auto* Queue = Schedule::Get();
-				while (!Queue->CanEnqueue() && Queue->HasAnyTasks())
-					Queue->Dispatch();
-			}
-
-			EventLoop::Set(nullptr);
-			Context->Reset();
-			VM->PerformFullGarbageCollection();
-			ApplyContextExit(nullptr);
-		}
-		static Function GetEntrypoint(EnvironmentConfig& Env, ProgramEntrypoint& Entrypoint, Compiler* Unit, bool Silent = false)
-		{
-			Function MainReturnsWithArgs = Unit->GetModule().GetFunctionByDecl(Entrypoint.ReturnsWithArgs);
-			Function MainReturns = Unit->GetModule().GetFunctionByDecl(Entrypoint.Returns);
-			Function MainSimple = Unit->GetModule().GetFunctionByDecl(Entrypoint.Simple);
-			if (MainReturnsWithArgs.IsValid() || MainReturns.IsValid() || MainSimple.IsValid())
-				return MainReturnsWithArgs.IsValid() ? MainReturnsWithArgs : (MainReturns.IsValid() ? MainReturns : MainSimple);
-
-			if (!Silent)
-				VI_ERR("module %s must contain either: <%s>, <%s> or <%s>", Env.Module, Entrypoint.ReturnsWithArgs, Entrypoint.Returns, Entrypoint.Simple);
-			return Function(nullptr);
-		}
-		static Compiler* GetCompiler()
-		{
-			return EnvironmentConfig::Get().ThisCompiler;
-		}
-
-	private:
-		static void ProcessTags(VirtualMachine* VM, Bindings::Tags::TagInfo&& Info)
-		{
-			auto& Env = EnvironmentConfig::Get();
-			for (auto& Tag : Info)
-			{
-				if (Tag.Name != "main")
-					continue;
-
-				for (auto& Directive : Tag.Directives)
-				{
-					if (Directive.Name == "#schedule::main")
-					{
-						auto Threads = Directive.Args.find("threads");
-						if (Threads != Directive.Args.end())
-							Env.AutoSchedule = FromString<uint8_t>(Threads->second).Or(0);
-						else
-							Env.AutoSchedule = 0;
-
-						auto Stop = Directive.Args.find("stop");
-						if (Stop != Directive.Args.end())
-						{
-							Stringify::ToLower(Threads->second);
-							auto Value = FromString<uint8_t>(Threads->second);
-							if (!Value)
-								Env.AutoStop = (Threads->second == "on" || Threads->second == "true" || Threads->second == "yes");
-							else
-								Env.AutoStop = *Value > 0;
-						}
-					}
-					else if (Directive.Name == "#console::main")
-						Env.AutoConsole = true;
-				}
-			}
-		}
-	};
-}
+#ifndef RUNTIME_H
+#define RUNTIME_H
+#include <vengeance/bindings.h>
+#include <vengeance/vengeance.h>
+#ifdef __linux__
+#include <unistd.h>
+#endif
+#define RUNTIME_DEQUEUE_PASSES 64
+
+using namespace Vitex::Core;
+using namespace Vitex::Compute;
+using namespace Vitex::Scripting;
+
+namespace ASX
+{
+	enum class ExitStatus
+	{
+		Continue = 0x00fffff - 1,
+		OK = 0,
+		RuntimeError,
+		PrepareError,
+		LoadingError,
+		SavingError,
+		CompilerError,
+		EntrypointError,
+		InputError,
+		InvalidCommand,
+		InvalidDeclaration,
+		CommandError,
+		Kill
+	};
+
+	struct ProgramEntrypoint
+	{
+		const char* ReturnsWithArgs = "int main(array<string>@)";
+		const char* Returns = "int main()";
+		const char* Simple = "void main()";
+	};
+
+	struct EnvironmentConfig
+	{
+		InlineArgs Commandline;
+		UnorderedSet<String> Addons;
+		FunctionDelegate AtExit;
+		FileEntry File;
+		String Name;
+		String Path;
+		String Program;
+		String Registry;
+		String Mode;
+		String Output;
+		String Addon;
+		Compiler* ThisCompiler;
+		const char* Module;
+		int32_t AutoSchedule;
+		bool AutoConsole;
+		bool AutoStop;
+		bool Inline;
+
+		EnvironmentConfig() : ThisCompiler(nullptr), Module("__anonymous__"), AutoSchedule(-1), AutoConsole(false), AutoStop(false), Inline(true)
+		{
+		}
+		void Parse(int ArgsCount, char** ArgsData, const UnorderedSet<String>& Flags = { })
+		{
+			Commandline = OS::Process::ParseArgs(ArgsCount, ArgsData, (size_t)ArgsFormat::KeyValue | (size_t)ArgsFormat::FlagValue | (size_t)ArgsFormat::StopIfNoMatch, Flags);
+		}
+		static EnvironmentConfig& Get(EnvironmentConfig* Other = nullptr)
+		{
+			static EnvironmentConfig* Base = Other;
+			VI_ASSERT(Base != nullptr, "env was not set");
+			return *Base;
+		}
+	};
+
+	struct MemoryBudget
+	{
+		std::atomic<size_t> Limit = 0;
+		std::atomic<size_t> Usage = 0;
+		std::atomic<size_t> Peak = 0;
+		size_t (*Measure)() = nullptr;
+	};
+
+	struct SystemConfig
+	{
+		UnorderedMap<String, std::pair<String, String>> Functions;
+		UnorderedMap<AccessOption, bool> Permissions;
+		Vector<std::pair<String, bool>> Libraries;
+		Vector<std::pair<String, int32_t>> Settings;
+		Vector<String> SystemAddons;
+		bool TsImports = true;
+		bool Tags = true;
+		bool Debug = false;
+		bool Interactive = false;
+		bool EssentialsOnly = true;
+		bool PrettyProgress = true;
+		bool LoadByteCode = false;
+		bool SaveByteCode = false;
+		bool SaveSourceCode = false;
+		bool Dependencies = false;
+		bool Install = false;
+		bool IncrementalGC = false;
+		bool AllocatorStats = false;
+		bool Watch = false;
+		bool TraceStartup = false;
+		bool VerbatimIncludes = false;
+		bool Lazy = false;
+		bool Check = false;
+		bool Shake = false;
+		size_t Installed = 0;
+		size_t Contexts = 0;
+		size_t MemoryLimit = 0;
+		size_t Cluster = 0;
+	};
+
+	class Modules
+	{
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+		static void Cleanup();
+		static uint64_t Update(uint64_t Timeout);
+		static void Cancel(EventLoop* Loop);
+	};
+
+	class Runtime
+	{
+	public:
+		static void StartupEnvironment(EnvironmentConfig& Env)
+		{
+			if (Env.AutoSchedule >= 0)
+				Schedule::Get()->Start(Env.AutoSchedule > 0 ? Schedule::Desc((size_t)Env.AutoSchedule) : Schedule::Desc());
+
+			if (Env.AutoConsole)
+				Console::Get()->Attach();
+		}
+		static void ShutdownEnvironment(EnvironmentConfig& Env)
+		{
+			if (Env.AutoStop)
+				Schedule::Get()->Stop();
+		}
+		static void ConfigureSystem(SystemConfig& Config)
+		{
+			for (auto& Option : Config.Permissions)
+				OS::Control::Set(Option.first, Option.second);
+		}
+		static bool ConfigureContext(SystemConfig& Config, EnvironmentConfig& Env, VirtualMachine* VM, Compiler* ThisCompiler)
+		{
+			VM->SetTsImports(Config.TsImports);
+			VM->SetModuleDirectory(OS::Path::GetDirectory(Env.Path.c_str()));
+			VM->SetPreserveSourceCode(Config.SaveSourceCode);
+
+			for (auto& Name : Config.SystemAddons)
+			{
+				if (!VM->ImportSystemAddon(Name))
+				{
+					VI_ERR("system addon <%s> cannot be loaded", Name.c_str());
+					return false;
+				}
+			}
+
+			for (auto& Path : Config.Libraries)
+			{
+				if (!VM->ImportCLibrary(Path.first, Path.second))
+				{
+					VI_ERR("external %s <%s> cannot be loaded", Path.second ? "addon" : "clibrary", Path.first.c_str());
+					return false;
+				}
+			}
+
+			for (auto& Data : Config.Functions)
+			{
+				if (!VM->ImportCFunction({ Data.first }, Data.second.first, Data.second.second))
+				{
+					VI_ERR("clibrary function <%s> from <%s> cannot be loaded", Data.second.first.c_str(), Data.first.c_str());
+					return false;
+				}
+			}
+
+			auto* Macro = ThisCompiler->GetProcessor();
+			Macro->AddDefaultDefinitions();
+
+			Env.ThisCompiler = ThisCompiler;
+			Bindings::Tags::BindSyntax(VM, Config.Tags, &Runtime::ProcessTags);
+			EnvironmentConfig::Get(&Env);
+
+			VM->ImportSystemAddon("ctypes");
+			VM->BeginNamespace("this_process");
+			VM->SetFunctionDef("void exit_event(int)");
+			VM->SetFunction("void before_exit(exit_event@)", &Runtime::ApplyContextExit);
+			VM->SetFunction("uptr@ get_compiler()", &Runtime::GetCompiler);
+			VM->SetFunction("usize get_memory_usage()", &Runtime::UpdateMemoryUsage);
+			VM->SetFunction("usize get_memory_peak()", &Runtime::GetMemoryPeak);
+			VM->SetFunction("usize get_memory_limit()", &Runtime::GetMemoryLimit);
+			VM->EndNamespace();
+			Modules::BindSyntax(VM);
+			return true;
+		}
+		static void PrepareContexts(SystemConfig& Config, VirtualMachine* VM)
+		{
+			if (!Config.Contexts)
+				return;
+
+			Vector<ImmediateContext*> Contexts;
+			Contexts.reserve(Config.Contexts);
+			for (size_t i = 0; i < Config.Contexts; i++)
+				Contexts.push_back(VM->RequestContext());
+
+			for (auto* Next : Contexts)
+				VM->ReturnContext(Next);
+		}
+		static void PrepareMemoryLimit(SystemConfig& Config)
+		{
+			GetMemoryBudget().Limit = Config.MemoryLimit;
+		}
+		static void ApplyMemoryLimit(size_t Usage)
+		{
+			size_t Limit = GetMemoryBudget().Limit;
+			if (!Limit || StoreMemoryUsage(Usage) <= Limit)
+				return;
+
+			ImmediateContext* Context = ImmediateContext::Get();
+			if (Context != nullptr && Context->GetState() == Execution::Active)
+				Context->SetException("memory limit exceeded");
+		}
+		static bool ApplyMemoryPressure(VirtualMachine* VM)
+		{
+			auto& Budget = GetMemoryBudget();
+			size_t Limit = Budget.Limit;
+			if (!Limit)
+				return false;
+
+			size_t Usage = UpdateMemoryUsage();
+			if (Usage < Limit - Limit / 5)
+				return false;
+
+			VM->GarbageCollect((size_t)GarbageCollector::ONE_STEP | (size_t)GarbageCollector::DETECT_GARBAGE | (size_t)GarbageCollector::DESTROY_GARBAGE, 256);
+			return UpdateMemoryUsage() > Limit;
+		}
+		static size_t UpdateMemoryUsage()
+		{
+			auto& Budget = GetMemoryBudget();
+			return StoreMemoryUsage(Budget.Measure ? Budget.Measure() : GetResidentMemory());
+		}
+		static size_t StoreMemoryUsage(size_t Usage)
+		{
+			auto& Budget = GetMemoryBudget();
+			size_t Peak = Budget.Peak;
+			Budget.Usage = Usage;
+			while (Usage > Peak && !Budget.Peak.compare_exchange_weak(Peak, Usage))
+				continue;
+			return Usage;
+		}
+		static size_t GetResidentMemory()
+		{
+#ifdef __linux__
+			FILE* Stream = fopen("/proc/self/statm", "r");
+			if (!Stream)
+				return 0;
+
+			unsigned long long Size = 0, Resident = 0;
+			int Count = fscanf(Stream, "%llu %llu", &Size, &Resident);
+			fclose(Stream);
+			return Count == 2 ? (size_t)Resident * (size_t)sysconf(_SC_PAGESIZE) : 0;
+#else
+			return 0;
+#endif
+		}
+		static size_t GetMemoryPeak()
+		{
+			return GetMemoryBudget().Peak;
+		}
+		static size_t GetMemoryLimit()
+		{
+			return GetMemoryBudget().Limit;
+		}
+		static MemoryBudget& GetMemoryBudget()
+		{
+			static MemoryBudget Base;
+			return Base;
+		}
+		static bool TryContextExit(EnvironmentConfig& Env, int Value)
+		{
+			if (!Env.AtExit.IsValid())
+				return false;
+
+			auto Status = Env.AtExit([Value](ImmediateContext* Context)
+			{
+				Context->SetArg32(0, Value);
+			}).Get();
+			Env.AtExit.Release();
+			VirtualMachine::CleanupThisThread();
+			return !!Status;
+		}
+		static void ApplyContextExit(asIScriptFunction* Callback)
+		{
+			auto& Env = EnvironmentConfig::Get();
+			UPtr<ImmediateContext> Context = Callback ? Env.ThisCompiler->GetVM()->RequestContext() : nullptr;
+			Env.AtExit = FunctionDelegate(Callback, *Context);
+		}
+		static void AwaitContext(SystemConfig& Config, std::mutex& Mutex, EventLoop* Loop, VirtualMachine* VM, ImmediateContext* Context)
+		{
+			AwaitLoop(Config, Loop, VM, Context);
+			UMutex<std::mutex> Unique(Mutex);
+			if (Schedule::HasInstance())
+			{
+				auto* Queue = Schedule::Get();
+				while (!Queue->CanEnqueue() && Queue->HasAnyTasks())
+					Queue->Dispatch();
+			}
+
+			EventLoop::Set(nullptr);
+			Context->Reset();
+			VM->PerformFullGarbageCollection();
+			ApplyContextExit(nullptr);
+		}
+		static void AwaitLoop(SystemConfig& Config, EventLoop* Loop, VirtualMachine* VM, ImmediateContext* Context)
+		{
+			uint64_t Timeout = 1000;
+			EventLoop::Set(Loop);
+			while (Loop->PollExtended(Context, Timeout))
+			{
+				if (Config.MemoryLimit > 0)
+					ApplyMemoryPressure(VM);
+
+				if (Config.IncrementalGC)
+				{
+					PerformIncrementalGarbageCollection(VM);
+					VM->PerformPeriodicGarbageCollection(600000);
+				}
+				else
+					VM->PerformPeriodicGarbageCollection(60000);
+
+				Timeout = Modules::Update(1000);
+				for (size_t Passes = 0; Passes < RUNTIME_DEQUEUE_PASSES; Passes++)
+				{
+					if (!Loop->Dequeue(VM))
+						break;
+				}
+			}
+			Modules::Cancel(Loop);
+		}
+		static void PerformIncrementalGarbageCollection(VirtualMachine* VM)
+		{
+			unsigned int NewObjects = 0;
+			VM->GetStatistics(nullptr, nullptr, nullptr, &NewObjects, nullptr);
+			if (NewObjects > 0)
+				VM->GarbageCollect((size_t)GarbageCollector::ONE_STEP | (size_t)GarbageCollector::DETECT_GARBAGE | (size_t)GarbageCollector::DESTROY_GARBAGE, std::min<size_t>(NewObjects, 1024));
+		}
+		static Function GetEntrypoint(EnvironmentConfig& Env, ProgramEntrypoint& Entrypoint, Compiler* Unit, bool Silent = false)
+		{
+			Function MainReturnsWithArgs = Unit->GetModule().GetFunctionByDecl(Entrypoint.ReturnsWithArgs);
+			Function MainReturns = Unit->GetModule().GetFunctionByDecl(Entrypoint.Returns);
+			Function MainSimple = Unit->GetModule().GetFunctionByDecl(Entrypoint.Simple);
+			if (MainReturnsWithArgs.IsValid() || MainReturns.IsValid() || MainSimple.IsValid())
+				return MainReturnsWithArgs.IsValid() ? MainReturnsWithArgs : (MainReturns.IsValid() ? MainReturns : MainSimple);
+
+			if (!Silent)
+				VI_ERR("module %s must contain either: <%s>, <%s> or <%s>", Env.Module, Entrypoint.ReturnsWithArgs, Entrypoint.Returns, Entrypoint.Simple);
+			return Function(nullptr);
+		}
+		static Compiler* GetCompiler()
+		{
+			return EnvironmentConfig::Get().ThisCompiler;
+		}
+
+	private:
+		static void ProcessTags(VirtualMachine* VM, Bindings::Tags::TagInfo&& Info)
+		{
+			auto& Env = EnvironmentConfig::Get();
+			for (auto& Tag : Info)
+			{
+				if (Tag.Name != "main")
+					continue;
+
+				for (auto& Directive : Tag.Directives)
+				{
+					if (Directive.Name == "#schedule::main")
+					{
+						auto Threads = Directive.Args.find("threads");
+						if (Threads != Directive.Args.end())
+							Env.AutoSchedule = FromString<uint8_t>(Threads->second).Or(0);
+						else
+							Env.AutoSchedule = 0;
+
+						auto Stop = Directive.Args.find("stop");
+						if (Stop != Directive.Args.end())
+						{
+							Stringify::ToLower(Threads->second);
+							auto Value = FromString<uint8_t>(Threads->second);
+							if (!Value)
+								Env.AutoStop = (Threads->second == "on" || Threads->second == "true" || Threads->second == "yes");
+							else
+								Env.AutoStop = *Value > 0;
+						}
+					}
+					else if (Directive.Name == "#console::main")
+						Env.AutoConsole = true;
+				}
+			}
+		}
+	};
+}
 #endif
\ No newline at end of file
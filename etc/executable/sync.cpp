@@ -0,0 +1,484 @@
+#include "sync.h"
+#include <angelscript.h>
+
+namespace ASX
+{
+	static std::memory_order GetOrder(int Order)
+	{
+		switch (Order)
+		{
+			case 0:
+				return std::memory_order_relaxed;
+			case 1:
+				return std::memory_order_acquire;
+			case 2:
+				return std::memory_order_release;
+			case 3:
+				return std::memory_order_acq_rel;
+			default:
+				return std::memory_order_seq_cst;
+		}
+	}
+	static std::memory_order GetLoadOrder(int Order)
+	{
+		auto Result = GetOrder(Order);
+		if (Result == std::memory_order_release || Result == std::memory_order_acq_rel)
+			return std::memory_order_acquire;
+		return Result;
+	}
+	static std::memory_order GetStoreOrder(int Order)
+	{
+		auto Result = GetOrder(Order);
+		if (Result == std::memory_order_acquire || Result == std::memory_order_acq_rel)
+			return std::memory_order_release;
+		return Result;
+	}
+	static size_t GetCapacity(size_t Capacity)
+	{
+		size_t Size = 2;
+		while (Size < Capacity)
+			Size <<= 1;
+		return Size;
+	}
+	static size_t GetPrimitiveSize(int Type)
+	{
+		switch ((TypeId)Type)
+		{
+			case TypeId::BOOL:
+			case TypeId::INT8:
+			case TypeId::UINT8:
+				return 1;
+			case TypeId::INT16:
+			case TypeId::UINT16:
+				return 2;
+			case TypeId::INT64:
+			case TypeId::UINT64:
+			case TypeId::DOUBLE:
+				return 8;
+			default:
+				return 4;
+		}
+	}
+	static bool HasDefaultConstructor(asITypeInfo* Type)
+	{
+		asDWORD Flags = Type->GetFlags();
+		if (Flags & asOBJ_POD)
+			return true;
+
+		if (Flags & asOBJ_VALUE)
+		{
+			for (asUINT i = 0; i < Type->GetBehaviourCount(); i++)
+			{
+				asEBehaviours Behaviour;
+				asIScriptFunction* Function = Type->GetBehaviourByIndex(i, &Behaviour);
+				if (Behaviour == asBEHAVE_CONSTRUCT && Function->GetParamCount() == 0)
+					return true;
+			}
+			return false;
+		}
+
+		for (asUINT i = 0; i < Type->GetFactoryCount(); i++)
+		{
+			if (Type->GetFactoryByIndex(i)->GetParamCount() == 0)
+				return true;
+		}
+		return false;
+	}
+	static bool HasCopyOperation(asITypeInfo* Type)
+	{
+		asDWORD Flags = Type->GetFlags();
+		if (Flags & asOBJ_NOCOPY)
+			return false;
+		else if (Flags & asOBJ_POD)
+			return true;
+
+		for (asUINT i = 0; i < Type->GetBehaviourCount(); i++)
+		{
+			asEBehaviours Behaviour;
+			Type->GetBehaviourByIndex(i, &Behaviour);
+			if (Behaviour == asBEHAVE_COPYCONSTRUCT)
+				return true;
+		}
+		return Type->GetMethodByName("opAssign") != nullptr;
+	}
+	static bool ChannelTemplateCallback(asITypeInfo* Info, bool& DontGarbageCollect)
+	{
+		DontGarbageCollect = true;
+		int SubTypeId = Info->GetSubTypeId();
+		if (SubTypeId == asTYPEID_VOID)
+			return false;
+		else if (!(SubTypeId & asTYPEID_MASK_OBJECT) || (SubTypeId & asTYPEID_OBJHANDLE))
+			return true;
+
+		asIScriptEngine* Engine = Info->GetEngine();
+		asITypeInfo* SubType = Engine->GetTypeInfoById(SubTypeId);
+		if (!SubType || (SubType->GetFlags() & asOBJ_TEMPLATE_SUBTYPE))
+			return true;
+
+		if (!HasDefaultConstructor(SubType))
+		{
+			Engine->WriteMessage("channel", 0, 0, asMSGTYPE_ERROR, Stringify::Text("channel<%s> requires a default constructible value type, use a handle instead", SubType->GetName()).c_str());
+			return false;
+		}
+		else if (!HasCopyOperation(SubType))
+		{
+			Engine->WriteMessage("channel", 0, 0, asMSGTYPE_ERROR, Stringify::Text("channel<%s> requires a copyable value type, use a handle instead", SubType->GetName()).c_str());
+			return false;
+		}
+		return true;
+	}
+
+	Atomic::Atomic(int64_t NewValue) : Value(NewValue)
+	{
+	}
+	int64_t Atomic::Load(int Order)
+	{
+		return Value.load(GetLoadOrder(Order));
+	}
+	void Atomic::Store(int64_t NewValue, int Order)
+	{
+		Value.store(NewValue, GetStoreOrder(Order));
+	}
+	int64_t Atomic::Exchange(int64_t NewValue, int Order)
+	{
+		return Value.exchange(NewValue, GetOrder(Order));
+	}
+	int64_t Atomic::FetchAdd(int64_t NewValue, int Order)
+	{
+		return Value.fetch_add(NewValue, GetOrder(Order));
+	}
+	int64_t Atomic::FetchSub(int64_t NewValue, int Order)
+	{
+		return Value.fetch_sub(NewValue, GetOrder(Order));
+	}
+	int64_t Atomic::FetchAnd(int64_t NewValue, int Order)
+	{
+		return Value.fetch_and(NewValue, GetOrder(Order));
+	}
+	int64_t Atomic::FetchOr(int64_t NewValue, int Order)
+	{
+		return Value.fetch_or(NewValue, GetOrder(Order));
+	}
+	bool Atomic::CompareExchange(int64_t& Expected, int64_t NewValue, int Order)
+	{
+		return Value.compare_exchange_strong(Expected, NewValue, GetOrder(Order), GetLoadOrder(Order));
+	}
+
+	RingChannel::RingChannel(asITypeInfo* Info, size_t Capacity) : Cells(GetCapacity(Capacity)), Head(0), Tail(0), Waiters(0), Closed(false), VM(VirtualMachine::Get()), ElementType(nullptr), PromiseType(nullptr), ElementSize(0), Mask(Cells.size() - 1), ElementTypeId(0)
+	{
+		for (size_t i = 0; i < Cells.size(); i++)
+			Cells[i].Sequence.store(i, std::memory_order_relaxed);
+
+		ElementTypeId = TypeInfo(Info).GetSubTypeId();
+		ElementType = VM->GetTypeInfoById(ElementTypeId);
+		PromiseType = VM->GetTypeInfoByDecl(("promise<" + String(VM->GetTypeIdDecl(ElementTypeId)) + ">").c_str());
+		if (!(ElementTypeId & (int)TypeId::MASK_OBJECT))
+			ElementSize = GetPrimitiveSize(ElementTypeId);
+	}
+	RingChannel::~RingChannel()
+	{
+		Close();
+		Message Value;
+		while (Dequeue(Value))
+			Free(Value);
+	}
+	bool RingChannel::Send(void* Ref)
+	{
+		Message Value;
+		if (!Compose(Value, Ref))
+			return false;
+
+		bool Success = Enqueue(Value);
+		while (!Success && !Closed)
+		{
+			std::unique_lock<std::mutex> Unique(Mutex);
+			++Waiters;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			Success = Enqueue(Value);
+			if (!Success && !Closed)
+				Condition.wait(Unique);
+			--Waiters;
+		}
+
+		if (!Success)
+		{
+			Free(Value);
+			return false;
+		}
+
+		Notify();
+		return true;
+	}
+	bool RingChannel::TrySend(void* Ref)
+	{
+		Message Value;
+		if (!Compose(Value, Ref))
+			return false;
+
+		if (!Enqueue(Value))
+		{
+			Free(Value);
+			return false;
+		}
+
+		Notify();
+		return true;
+	}
+	bool RingChannel::Receive(void* Ref)
+	{
+		Message Value;
+		bool Success = Dequeue(Value);
+		while (!Success)
+		{
+			std::unique_lock<std::mutex> Unique(Mutex);
+			++Waiters;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			Success = Dequeue(Value);
+			if (!Success && Closed)
+			{
+				--Waiters;
+				return false;
+			}
+			else if (!Success)
+				Condition.wait(Unique);
+			--Waiters;
+		}
+
+		Notify();
+		Extract(Value, Ref);
+		return true;
+	}
+	bool RingChannel::TryReceive(void* Ref)
+	{
+		Message Value;
+		if (!Dequeue(Value))
+			return false;
+
+		Notify();
+		Extract(Value, Ref);
+		return true;
+	}
+	Bindings::Promise* RingChannel::ReceiveAsync()
+	{
+		Bindings::Promise* Future = Bindings::Promise::CreateFactoryType(PromiseType.GetTypeInfo());
+		Message Value;
+		bool Success = Dequeue(Value);
+		if (!Success)
+		{
+			UMutex<std::mutex> Unique(Mutex);
+			++Waiters;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			Success = Dequeue(Value);
+			if (!Success && !Closed)
+			{
+				Future->AddRef();
+				Pending.push(Future);
+				return Future;
+			}
+			--Waiters;
+		}
+
+		if (!Success)
+		{
+			Future->StoreException(Bindings::Exception::Pointer("channel", "channel is closed"));
+			return Future;
+		}
+
+		Notify();
+		Settle(Future, Value);
+		return Future;
+	}
+	void RingChannel::Close()
+	{
+		SingleQueue<Bindings::Promise*> Rejected;
+		Closed = true;
+		{
+			UMutex<std::mutex> Unique(Mutex);
+			Waiters -= Pending.size();
+			Rejected.swap(Pending);
+			Condition.notify_all();
+		}
+
+		while (!Rejected.empty())
+		{
+			Bindings::Promise* Future = Rejected.front();
+			Future->StoreException(Bindings::Exception::Pointer("channel", "channel is closed"));
+			Future->Release();
+			Rejected.pop();
+		}
+	}
+	bool RingChannel::IsClosed()
+	{
+		return Closed;
+	}
+	bool RingChannel::Enqueue(Message& Value)
+	{
+		if (Closed)
+			return false;
+
+		size_t Position = Tail.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Cell& Next = Cells[Position & Mask];
+			size_t Sequence = Next.Sequence.load(std::memory_order_acquire);
+			intptr_t Difference = (intptr_t)Sequence - (intptr_t)Position;
+			if (Difference == 0)
+			{
+				if (!Tail.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+					continue;
+
+				Next.Value = Value;
+				Next.Sequence.store(Position + 1, std::memory_order_release);
+				return true;
+			}
+			else if (Difference < 0)
+				return false;
+
+			Position = Tail.load(std::memory_order_relaxed);
+		}
+	}
+	bool RingChannel::Dequeue(Message& Value)
+	{
+		size_t Position = Head.load(std::memory_order_relaxed);
+		while (true)
+		{
+			Cell& Next = Cells[Position & Mask];
+			size_t Sequence = Next.Sequence.load(std::memory_order_acquire);
+			intptr_t Difference = (intptr_t)Sequence - (intptr_t)(Position + 1);
+			if (Difference == 0)
+			{
+				if (!Head.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))
+					continue;
+
+				Value = Next.Value;
+				Next.Value.Primitive = 0;
+				Next.Sequence.store(Position + Mask + 1, std::memory_order_release);
+				return true;
+			}
+			else if (Difference < 0)
+				return false;
+
+			Position = Head.load(std::memory_order_relaxed);
+		}
+	}
+	void RingChannel::Notify()
+	{
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (!Waiters.load(std::memory_order_relaxed))
+			return;
+
+		Vector<std::pair<Bindings::Promise*, Message>> Ready;
+		{
+			UMutex<std::mutex> Unique(Mutex);
+			while (!Pending.empty())
+			{
+				Message Value;
+				if (!Dequeue(Value))
+					break;
+
+				Ready.emplace_back(Pending.front(), Value);
+				Pending.pop();
+				--Waiters;
+			}
+			Condition.notify_all();
+		}
+
+		for (auto& Next : Ready)
+		{
+			Settle(Next.first, Next.second);
+			Next.first->Release();
+		}
+	}
+	void RingChannel::Settle(Bindings::Promise* Future, Message& Value)
+	{
+		if (ElementTypeId & (int)TypeId::OBJHANDLE)
+			Future->Store(&Value.Object, ElementTypeId);
+		else if (ElementTypeId & (int)TypeId::MASK_OBJECT)
+			Future->Store(Value.Object, ElementTypeId);
+		else
+			Future->Store(&Value.Primitive, ElementTypeId);
+		Free(Value);
+	}
+	bool RingChannel::Compose(Message& Value, void* Ref)
+	{
+		Value.Primitive = 0;
+		if (ElementTypeId & (int)TypeId::OBJHANDLE)
+		{
+			Value.Object = *(void**)Ref;
+			if (Value.Object != nullptr)
+				VM->AddRefObject(Value.Object, ElementType);
+		}
+		else if (ElementTypeId & (int)TypeId::MASK_OBJECT)
+		{
+			Value.Object = VM->CreateObjectCopy(Ref, ElementType);
+			if (!Value.Object)
+			{
+				ImmediateContext::Get()->SetException(Stringify::Text("channel cannot copy a value of type %s", String(VM->GetTypeIdDecl(ElementTypeId)).c_str()).c_str());
+				return false;
+			}
+		}
+		else
+			memcpy(&Value.Primitive, Ref, ElementSize);
+		return true;
+	}
+	void RingChannel::Extract(Message& Value, void* Ref)
+	{
+		if (ElementTypeId & (int)TypeId::OBJHANDLE)
+		{
+			void** Target = (void**)Ref;
+			if (*Target != nullptr)
+				VM->ReleaseObject(*Target, ElementType);
+			*Target = Value.Object;
+		}
+		else if (ElementTypeId & (int)TypeId::MASK_OBJECT)
+		{
+			if (Value.Object != nullptr)
+			{
+				VM->AssignObject(Ref, Value.Object, ElementType);
+				VM->ReleaseObject(Value.Object, ElementType);
+			}
+		}
+		else
+			memcpy(Ref, &Value.Primitive, ElementSize);
+	}
+	void RingChannel::Free(Message& Value)
+	{
+		if ((ElementTypeId & (int)TypeId::MASK_OBJECT) && Value.Object != nullptr)
+			VM->ReleaseObject(Value.Object, ElementType);
+		Value.Primitive = 0;
+	}
+
+	void Sync::BindSyntax(VirtualMachine* VM)
+	{
+		VM->ImportSystemAddon("ctypes");
+		VM->ImportSystemAddon("promise");
+		auto VOrder = VM->SetEnum("memory_order");
+		VOrder->SetValue("relaxed", 0);
+		VOrder->SetValue("acquire", 1);
+		VOrder->SetValue("release", 2);
+		VOrder->SetValue("acq_rel", 3);
+		VOrder->SetValue("seq_cst", 4);
+
+		auto VAtomic = VM->SetClass<Atomic>("atomic", false);
+		VAtomic->SetConstructor<Atomic, int64_t>("atomic@ f(int64 = 0)");
+		VAtomic->SetMethod("int64 load(memory_order = memory_order::seq_cst)", &Atomic::Load);
+		VAtomic->SetMethod("void store(int64, memory_order = memory_order::seq_cst)", &Atomic::Store);
+		VAtomic->SetMethod("int64 exchange(int64, memory_order = memory_order::seq_cst)", &Atomic::Exchange);
+		VAtomic->SetMethod("int64 fetch_add(int64, memory_order = memory_order::seq_cst)", &Atomic::FetchAdd);
+		VAtomic->SetMethod("int64 fetch_sub(int64, memory_order = memory_order::seq_cst)", &Atomic::FetchSub);
+		VAtomic->SetMethod("int64 fetch_and(int64, memory_order = memory_order::seq_cst)", &Atomic::FetchAnd);
+		VAtomic->SetMethod("int64 fetch_or(int64, memory_order = memory_order::seq_cst)", &Atomic::FetchOr);
+		VAtomic->SetMethod("bool compare_exchange(int64&inout, int64, memory_order = memory_order::seq_cst)", &Atomic::CompareExchange);
+
+		auto VChannel = VM->SetTemplateClass<RingChannel>("channel<class T>", "channel<T>", false);
+		VChannel->SetConstructor<RingChannel, asITypeInfo*, size_t>("channel<T>@ f(int&in, usize = 1024)");
+		VM->GetEngine()->RegisterObjectBehaviour("channel<T>", asBEHAVE_TEMPLATE_CALLBACK, "bool f(int&in, bool&out)", asFUNCTION(ChannelTemplateCallback), asCALL_CDECL);
+		VChannel->SetMethod("bool send(const T&in)", &RingChannel::Send);
+		VChannel->SetMethod("bool try_send(const T&in)", &RingChannel::TrySend);
+		VChannel->SetMethod("bool receive(T&out)", &RingChannel::Receive);
+		VChannel->SetMethod("bool try_receive(T&out)", &RingChannel::TryReceive);
+		VChannel->SetMethod("promise<T>@ receive_async()", &RingChannel::ReceiveAsync);
+		VChannel->SetMethod("void close()", &RingChannel::Close);
+		VChannel->SetMethod("bool is_closed()", &RingChannel::IsClosed);
+	}
+}
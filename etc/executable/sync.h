@@ -0,0 +1,83 @@
+#ifndef SYNC_H
+#define SYNC_H
+#include "runtime.hpp"
+#include <vengeance/vengeance.h>
+
+namespace ASX
+{
+	class Atomic : public Reference<Atomic>
+	{
+	private:
+		std::atomic<int64_t> Value;
+
+	public:
+		Atomic(int64_t NewValue);
+		int64_t Load(int Order);
+		void Store(int64_t NewValue, int Order);
+		int64_t Exchange(int64_t NewValue, int Order);
+		int64_t FetchAdd(int64_t NewValue, int Order);
+		int64_t FetchSub(int64_t NewValue, int Order);
+		int64_t FetchAnd(int64_t NewValue, int Order);
+		int64_t FetchOr(int64_t NewValue, int Order);
+		bool CompareExchange(int64_t& Expected, int64_t NewValue, int Order);
+	};
+
+	class RingChannel : public Reference<RingChannel>
+	{
+	private:
+		union Message
+		{
+			uint64_t Primitive;
+			void* Object;
+		};
+
+		struct Cell
+		{
+			std::atomic<size_t> Sequence;
+			Message Value;
+		};
+
+	private:
+		Vector<Cell> Cells;
+		SingleQueue<Bindings::Promise*> Pending;
+		std::atomic<size_t> Head;
+		std::atomic<size_t> Tail;
+		std::atomic<size_t> Waiters;
+		std::atomic<bool> Closed;
+		std::condition_variable Condition;
+		std::mutex Mutex;
+		VirtualMachine* VM;
+		TypeInfo ElementType;
+		TypeInfo PromiseType;
+		size_t ElementSize;
+		size_t Mask;
+		int ElementTypeId;
+
+	public:
+		RingChannel(asITypeInfo* Info, size_t Capacity);
+		~RingChannel();
+		bool Send(void* Ref);
+		bool TrySend(void* Ref);
+		bool Receive(void* Ref);
+		bool TryReceive(void* Ref);
+		Bindings::Promise* ReceiveAsync();
+		void Close();
+		bool IsClosed();
+
+	private:
+		bool Enqueue(Message& Value);
+		bool Dequeue(Message& Value);
+		void Notify();
+		void Settle(Bindings::Promise* Future, Message& Value);
+		bool Compose(Message& Value, void* Ref);
+		void Extract(Message& Value, void* Ref);
+		void Free(Message& Value);
+	};
+
+	class Sync
+	{
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+	};
+}
+#endif
@@ -0,0 +1,786 @@
+#include "text.h"
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#define TEXT_SSE2
+#if defined(__GNUC__) || defined(__clang__)
+#include <immintrin.h>
+#define TEXT_AVX2
+#define TEXT_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace ASX
+{
+	static const char HexAlphabet[] = "0123456789abcdef";
+	static const char Base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+	static inline uint32_t CountTrailingZeros(uint32_t Value)
+	{
+#ifdef _MSC_VER
+		unsigned long Index = 0;
+		_BitScanForward(&Index, Value);
+		return (uint32_t)Index;
+#else
+		return (uint32_t)__builtin_ctz(Value);
+#endif
+	}
+	static inline bool IsWhitespace(char Value)
+	{
+		return Value == ' ' || Value == '\t' || Value == '\n' || Value == '\r' || Value == '\f' || Value == '\v';
+	}
+	static inline int GetHexValue(char Value)
+	{
+		if (Value >= '0' && Value <= '9')
+			return Value - '0';
+		else if (Value >= 'a' && Value <= 'f')
+			return Value - 'a' + 10;
+		else if (Value >= 'A' && Value <= 'F')
+			return Value - 'A' + 10;
+		return -1;
+	}
+	static inline int GetBase64Value(char Value)
+	{
+		if (Value >= 'A' && Value <= 'Z')
+			return Value - 'A';
+		else if (Value >= 'a' && Value <= 'z')
+			return Value - 'a' + 26;
+		else if (Value >= '0' && Value <= '9')
+			return Value - '0' + 52;
+		else if (Value == '+')
+			return 62;
+		else if (Value == '/')
+			return 63;
+		return -1;
+	}
+	static size_t GetUTF8Sequence(const uint8_t* Data, size_t Size, size_t Offset)
+	{
+		uint8_t Value = Data[Offset];
+		if (Value < 0x80)
+			return 1;
+
+		size_t Length = 0;
+		uint32_t Code = 0;
+		if ((Value & 0xE0) == 0xC0)
+		{
+			Length = 2;
+			Code = Value & 0x1F;
+		}
+		else if ((Value & 0xF0) == 0xE0)
+		{
+			Length = 3;
+			Code = Value & 0x0F;
+		}
+		else if ((Value & 0xF8) == 0xF0)
+		{
+			Length = 4;
+			Code = Value & 0x07;
+		}
+		else
+			return 0;
+
+		if (Offset + Length > Size)
+			return 0;
+
+		for (size_t i = 1; i < Length; i++)
+		{
+			uint8_t Next = Data[Offset + i];
+			if ((Next & 0xC0) != 0x80)
+				return 0;
+			Code = (Code << 6) | (Next & 0x3F);
+		}
+
+		if ((Length == 2 && Code < 0x80) || (Length == 3 && Code < 0x800) || (Length == 4 && Code < 0x10000))
+			return 0;
+		else if (Code > 0x10FFFF || (Code >= 0xD800 && Code <= 0xDFFF))
+			return 0;
+		return Length;
+	}
+	static bool IsValidHex(const std::string_view& Data)
+	{
+		if (Data.size() % 2 != 0)
+			return false;
+
+		for (char Next : Data)
+		{
+			if (GetHexValue(Next) < 0)
+				return false;
+		}
+		return true;
+	}
+	static bool IsValidBase64(const std::string_view& Data, bool& Whitespace)
+	{
+		size_t Digits = 0, Padding = 0;
+		Whitespace = false;
+		for (char Next : Data)
+		{
+			if (IsWhitespace(Next))
+				Whitespace = true;
+			else if (Next == '=')
+				++Padding;
+			else if (Padding > 0 || GetBase64Value(Next) < 0)
+				return false;
+			else
+				++Digits;
+		}
+
+		if (Padding > 2 || Digits % 4 == 1)
+			return false;
+		return !Padding || (Digits + Padding) % 4 == 0;
+	}
+	static size_t FindScalar(const char* Data, size_t Size, const char* Needle, size_t NeedleSize, size_t Offset)
+	{
+		size_t Index = std::string_view(Data, Size).find(std::string_view(Needle, NeedleSize), Offset);
+		return Index == std::string_view::npos ? Size : Index;
+	}
+	static size_t FindAnyOfScalar(const char* Data, size_t Size, const char* Set, size_t SetSize, size_t Offset)
+	{
+		bool Table[256] = { false };
+		for (size_t i = 0; i < SetSize; i++)
+			Table[(uint8_t)Set[i]] = true;
+
+		for (size_t i = Offset; i < Size; i++)
+		{
+			if (Table[(uint8_t)Data[i]])
+				return i;
+		}
+		return Size;
+	}
+	static void ToCaseScalar(char* Data, size_t Size, char From, char To)
+	{
+		for (size_t i = 0; i < Size; i++)
+		{
+			if (Data[i] >= From && Data[i] <= To)
+				Data[i] ^= 0x20;
+		}
+	}
+	static bool IsUTF8Scalar(const uint8_t* Data, size_t Size, size_t Offset)
+	{
+		while (Offset < Size)
+		{
+			size_t Length = GetUTF8Sequence(Data, Size, Offset);
+			if (!Length)
+				return false;
+			Offset += Length;
+		}
+		return true;
+	}
+#ifdef TEXT_SSE2
+	static size_t FindSSE2(const char* Data, size_t Size, const char* Needle, size_t NeedleSize, size_t Offset)
+	{
+		const __m128i First = _mm_set1_epi8(Needle[0]);
+		const __m128i Last = _mm_set1_epi8(Needle[NeedleSize - 1]);
+		size_t Index = Offset;
+		for (; Index + NeedleSize + 15 <= Size; Index += 16)
+		{
+			__m128i BlockFirst = _mm_loadu_si128((const __m128i*)(Data + Index));
+			__m128i BlockLast = _mm_loadu_si128((const __m128i*)(Data + Index + NeedleSize - 1));
+			uint32_t Mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(First, BlockFirst), _mm_cmpeq_epi8(Last, BlockLast)));
+			while (Mask != 0)
+			{
+				uint32_t Bit = CountTrailingZeros(Mask);
+				if (NeedleSize <= 2 || !memcmp(Data + Index + Bit + 1, Needle + 1, NeedleSize - 2))
+					return Index + Bit;
+				Mask &= Mask - 1;
+			}
+		}
+		return FindScalar(Data, Size, Needle, NeedleSize, Index);
+	}
+	static size_t FindAnyOfSSE2(const char* Data, size_t Size, const char* Set, size_t SetSize, size_t Offset)
+	{
+		__m128i Needles[16];
+		for (size_t i = 0; i < SetSize; i++)
+			Needles[i] = _mm_set1_epi8(Set[i]);
+
+		size_t Index = Offset;
+		for (; Index + 16 <= Size; Index += 16)
+		{
+			__m128i Block = _mm_loadu_si128((const __m128i*)(Data + Index));
+			__m128i Match = _mm_setzero_si128();
+			for (size_t i = 0; i < SetSize; i++)
+				Match = _mm_or_si128(Match, _mm_cmpeq_epi8(Block, Needles[i]));
+
+			uint32_t Mask = (uint32_t)_mm_movemask_epi8(Match);
+			if (Mask != 0)
+				return Index + CountTrailingZeros(Mask);
+		}
+		return FindAnyOfScalar(Data, Size, Set, SetSize, Index);
+	}
+	static void ToCaseSSE2(char* Data, size_t Size, char From, char To)
+	{
+		const __m128i Low = _mm_set1_epi8(From - 1);
+		const __m128i High = _mm_set1_epi8(To + 1);
+		const __m128i Flip = _mm_set1_epi8(0x20);
+		size_t Index = 0;
+		for (; Index + 16 <= Size; Index += 16)
+		{
+			__m128i Block = _mm_loadu_si128((const __m128i*)(Data + Index));
+			__m128i Range = _mm_and_si128(_mm_cmpgt_epi8(Block, Low), _mm_cmplt_epi8(Block, High));
+			_mm_storeu_si128((__m128i*)(Data + Index), _mm_xor_si128(Block, _mm_and_si128(Range, Flip)));
+		}
+		ToCaseScalar(Data + Index, Size - Index, From, To);
+	}
+	static bool IsUTF8SSE2(const uint8_t* Data, size_t Size)
+	{
+		size_t Index = 0;
+		while (Index < Size)
+		{
+			if (Index + 16 <= Size && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(Data + Index))))
+			{
+				Index += 16;
+				continue;
+			}
+
+			size_t Length = GetUTF8Sequence(Data, Size, Index);
+			if (!Length)
+				return false;
+			Index += Length;
+		}
+		return true;
+	}
+#endif
+#ifdef TEXT_AVX2
+	TEXT_TARGET_AVX2 static size_t FindAVX2(const char* Data, size_t Size, const char* Needle, size_t NeedleSize, size_t Offset)
+	{
+		const __m256i First = _mm256_set1_epi8(Needle[0]);
+		const __m256i Last = _mm256_set1_epi8(Needle[NeedleSize - 1]);
+		size_t Index = Offset;
+		for (; Index + NeedleSize + 31 <= Size; Index += 32)
+		{
+			__m256i BlockFirst = _mm256_loadu_si256((const __m256i*)(Data + Index));
+			__m256i BlockLast = _mm256_loadu_si256((const __m256i*)(Data + Index + NeedleSize - 1));
+			uint32_t Mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(First, BlockFirst), _mm256_cmpeq_epi8(Last, BlockLast)));
+			while (Mask != 0)
+			{
+				uint32_t Bit = CountTrailingZeros(Mask);
+				if (NeedleSize <= 2 || !memcmp(Data + Index + Bit + 1, Needle + 1, NeedleSize - 2))
+					return Index + Bit;
+				Mask &= Mask - 1;
+			}
+		}
+		return FindSSE2(Data, Size, Needle, NeedleSize, Index);
+	}
+	TEXT_TARGET_AVX2 static size_t FindAnyOfAVX2(const char* Data, size_t Size, const char* Set, size_t SetSize, size_t Offset)
+	{
+		__m256i Needles[16];
+		for (size_t i = 0; i < SetSize; i++)
+			Needles[i] = _mm256_set1_epi8(Set[i]);
+
+		size_t Index = Offset;
+		for (; Index + 32 <= Size; Index += 32)
+		{
+			__m256i Block = _mm256_loadu_si256((const __m256i*)(Data + Index));
+			__m256i Match = _mm256_setzero_si256();
+			for (size_t i = 0; i < SetSize; i++)
+				Match = _mm256_or_si256(Match, _mm256_cmpeq_epi8(Block, Needles[i]));
+
+			uint32_t Mask = (uint32_t)_mm256_movemask_epi8(Match);
+			if (Mask != 0)
+				return Index + CountTrailingZeros(Mask);
+		}
+		return FindAnyOfSSE2(Data, Size, Set, SetSize, Index);
+	}
+	TEXT_TARGET_AVX2 static void ToCaseAVX2(char* Data, size_t Size, char From, char To)
+	{
+		const __m256i Low = _mm256_set1_epi8(From - 1);
+		const __m256i High = _mm256_set1_epi8(To + 1);
+		const __m256i Flip = _mm256_set1_epi8(0x20);
+		size_t Index = 0;
+		for (; Index + 32 <= Size; Index += 32)
+		{
+			__m256i Block = _mm256_loadu_si256((const __m256i*)(Data + Index));
+			__m256i Range = _mm256_and_si256(_mm256_cmpgt_epi8(Block, Low), _mm256_cmpgt_epi8(High, Block));
+			_mm256_storeu_si256((__m256i*)(Data + Index), _mm256_xor_si256(Block, _mm256_and_si256(Range, Flip)));
+		}
+		ToCaseSSE2(Data + Index, Size - Index, From, To);
+	}
+	TEXT_TARGET_AVX2 static bool IsUTF8AVX2(const uint8_t* Data, size_t Size)
+	{
+		size_t Index = 0;
+		while (Index < Size)
+		{
+			if (Index + 32 <= Size && !_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(Data + Index))))
+			{
+				Index += 32;
+				continue;
+			}
+
+			size_t Length = GetUTF8Sequence(Data, Size, Index);
+			if (!Length)
+				return false;
+			Index += Length;
+		}
+		return true;
+	}
+#endif
+	static TextAcceleration DetectAcceleration()
+	{
+#ifdef TEXT_AVX2
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx2"))
+			return TextAcceleration::AVX2;
+#endif
+#ifdef TEXT_SSE2
+		return TextAcceleration::SSE2;
+#else
+		return TextAcceleration::Scalar;
+#endif
+	}
+	static void ToCase(char* Data, size_t Size, char From, char To, TextAcceleration Level)
+	{
+		switch (Level)
+		{
+#ifdef TEXT_AVX2
+			case TextAcceleration::AVX2:
+				return ToCaseAVX2(Data, Size, From, To);
+#endif
+#ifdef TEXT_SSE2
+			case TextAcceleration::SSE2:
+				return ToCaseSSE2(Data, Size, From, To);
+#endif
+			default:
+				return ToCaseScalar(Data, Size, From, To);
+		}
+	}
+
+	StringBuffer::StringBuffer(size_t Capacity)
+	{
+		if (Capacity > 0)
+			Data.reserve(Capacity);
+	}
+	void StringBuffer::Append(const std::string_view& Value)
+	{
+		if (Data.size() + Value.size() > Data.capacity())
+			Data.reserve(std::max(Data.capacity() * 2, Data.size() + Value.size()));
+		Data.append(Value);
+	}
+	void StringBuffer::AppendString(const String& Value)
+	{
+		Append(Value);
+	}
+	void StringBuffer::AppendInteger(int64_t Value)
+	{
+		char Buffer[32];
+		auto Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Value);
+		Append(std::string_view(Buffer, Result.ptr - Buffer));
+	}
+	void StringBuffer::AppendNumber(double Value)
+	{
+		Append(Vitex::Core::ToString(Value));
+	}
+	void StringBuffer::AppendLine()
+	{
+		Append("\n");
+	}
+	void StringBuffer::Reserve(size_t Capacity)
+	{
+		Data.reserve(Capacity);
+	}
+	void StringBuffer::Clear()
+	{
+		Data.clear();
+	}
+	void StringBuffer::Write()
+	{
+		if (!Data.empty())
+			Console::Get()->Write(Data);
+	}
+	String StringBuffer::Take()
+	{
+		String Result = std::move(Data);
+		Data.clear();
+		return Result;
+	}
+	String StringBuffer::ToString() const
+	{
+		return Data;
+	}
+	size_t StringBuffer::GetSize() const
+	{
+		return Data.size();
+	}
+	String& StringBuffer::GetData()
+	{
+		return Data;
+	}
+	void StringBuffer::BindSyntax(VirtualMachine* VM)
+	{
+		VM->ImportSystemAddon("string");
+		auto VBuilder = VM->SetClass<StringBuffer>("string_builder", false);
+		VBuilder->SetConstructor<StringBuffer, size_t>("string_builder@ f(usize = 0)");
+		VBuilder->SetMethod("void append(const string&in)", &StringBuffer::AppendString);
+		VBuilder->SetMethod("void append_int(int64)", &StringBuffer::AppendInteger);
+		VBuilder->SetMethod("void append_float(double)", &StringBuffer::AppendNumber);
+		VBuilder->SetMethod("void append_line()", &StringBuffer::AppendLine);
+		VBuilder->SetMethod("void reserve(usize)", &StringBuffer::Reserve);
+		VBuilder->SetMethod("void clear()", &StringBuffer::Clear);
+		VBuilder->SetMethod("void write()", &StringBuffer::Write);
+		VBuilder->SetMethod("string take()", &StringBuffer::Take);
+		VBuilder->SetMethod("string to_string() const", &StringBuffer::ToString);
+		VBuilder->SetMethod("usize size() const", &StringBuffer::GetSize);
+	}
+
+	size_t Text::Find(const std::string_view& Data, const std::string_view& Needle, size_t Offset)
+	{
+		size_t Index = Data.size();
+		if (Offset >= Data.size() || Needle.empty() || !Accelerated)
+			return Data.find(Needle, Offset);
+
+		switch (Level)
+		{
+#ifdef TEXT_AVX2
+			case TextAcceleration::AVX2:
+				Index = FindAVX2(Data.data(), Data.size(), Needle.data(), Needle.size(), Offset);
+				break;
+#endif
+#ifdef TEXT_SSE2
+			case TextAcceleration::SSE2:
+				Index = FindSSE2(Data.data(), Data.size(), Needle.data(), Needle.size(), Offset);
+				break;
+#endif
+			default:
+				Index = FindScalar(Data.data(), Data.size(), Needle.data(), Needle.size(), Offset);
+				break;
+		}
+		return Index < Data.size() ? Index : std::string_view::npos;
+	}
+	size_t Text::FindAnyOf(const std::string_view& Data, const std::string_view& Set, size_t Offset)
+	{
+		size_t Index = Data.size();
+		if (Offset >= Data.size() || Set.empty() || !Accelerated)
+			return Data.find_first_of(Set, Offset);
+
+		if (Set.size() > 16)
+			Index = FindAnyOfScalar(Data.data(), Data.size(), Set.data(), Set.size(), Offset);
+		else
+		{
+			switch (Level)
+			{
+#ifdef TEXT_AVX2
+				case TextAcceleration::AVX2:
+					Index = FindAnyOfAVX2(Data.data(), Data.size(), Set.data(), Set.size(), Offset);
+					break;
+#endif
+#ifdef TEXT_SSE2
+				case TextAcceleration::SSE2:
+					Index = FindAnyOfSSE2(Data.data(), Data.size(), Set.data(), Set.size(), Offset);
+					break;
+#endif
+				default:
+					Index = FindAnyOfScalar(Data.data(), Data.size(), Set.data(), Set.size(), Offset);
+					break;
+			}
+		}
+		return Index < Data.size() ? Index : std::string_view::npos;
+	}
+	Vector<String> Text::Split(const std::string_view& Data, const std::string_view& Separator)
+	{
+		if (!Accelerated)
+			return Stringify::Split(Data, Separator);
+
+		Vector<String> Result;
+		if (Separator.empty())
+		{
+			Result.emplace_back(Data);
+			return Result;
+		}
+
+		size_t Offset = 0;
+		while (Offset <= Data.size())
+		{
+			size_t Index = Find(Data, Separator, Offset);
+			if (Index == std::string_view::npos)
+			{
+				Result.emplace_back(Data.substr(Offset));
+				break;
+			}
+
+			Result.emplace_back(Data.substr(Offset, Index - Offset));
+			Offset = Index + Separator.size();
+		}
+		return Result;
+	}
+	String Text::ReplaceAll(const std::string_view& Data, const std::string_view& From, const std::string_view& To)
+	{
+		if (!Accelerated)
+		{
+			String Result = String(Data);
+			Stringify::Replace(Result, From, To);
+			return Result;
+		}
+
+		if (From.empty())
+			return String(Data);
+
+		String Result;
+		Result.reserve(Data.size());
+		size_t Offset = 0;
+		while (Offset < Data.size())
+		{
+			size_t Index = Find(Data, From, Offset);
+			if (Index == std::string_view::npos)
+			{
+				Result.append(Data.data() + Offset, Data.size() - Offset);
+				return Result;
+			}
+
+			Result.append(Data.data() + Offset, Index - Offset);
+			Result.append(To);
+			Offset = Index + From.size();
+		}
+		return Result;
+	}
+	String Text::Trim(const std::string_view& Data)
+	{
+		if (!Accelerated)
+		{
+			String Result = String(Data);
+			Stringify::Trim(Result);
+			return Result;
+		}
+
+		size_t Start = 0, End = Data.size();
+		while (Start < End && IsWhitespace(Data[Start]))
+			++Start;
+		while (End > Start && IsWhitespace(Data[End - 1]))
+			--End;
+		return String(Data.substr(Start, End - Start));
+	}
+	String Text::ToLower(const std::string_view& Data)
+	{
+		String Result = String(Data);
+		if (!Accelerated)
+			Stringify::ToLower(Result);
+		else
+			ToCase((char*)Result.data(), Result.size(), 'A', 'Z', Level);
+		return Result;
+	}
+	String Text::ToUpper(const std::string_view& Data)
+	{
+		String Result = String(Data);
+		if (!Accelerated)
+			Stringify::ToUpper(Result);
+		else
+			ToCase((char*)Result.data(), Result.size(), 'a', 'z', Level);
+		return Result;
+	}
+	bool Text::IsUTF8(const std::string_view& Data)
+	{
+		const uint8_t* Buffer = (const uint8_t*)Data.data();
+		if (!Accelerated)
+			return IsUTF8Scalar(Buffer, Data.size(), 0);
+
+		switch (Level)
+		{
+#ifdef TEXT_AVX2
+			case TextAcceleration::AVX2:
+				return IsUTF8AVX2(Buffer, Data.size());
+#endif
+#ifdef TEXT_SSE2
+			case TextAcceleration::SSE2:
+				return IsUTF8SSE2(Buffer, Data.size());
+#endif
+			default:
+				return IsUTF8Scalar(Buffer, Data.size(), 0);
+		}
+	}
+	String Text::HexEncode(const std::string_view& Data)
+	{
+		if (!Accelerated)
+			return Codec::HexEncode(Data);
+
+		String Result;
+		Result.resize(Data.size() * 2);
+		char* Output = (char*)Result.data();
+		for (size_t i = 0; i < Data.size(); i++)
+		{
+			uint8_t Value = (uint8_t)Data[i];
+			Output[i * 2 + 0] = HexAlphabet[Value >> 4];
+			Output[i * 2 + 1] = HexAlphabet[Value & 0x0F];
+		}
+		return Result;
+	}
+	String Text::HexDecode(const std::string_view& Data)
+	{
+		if (!IsValidHex(Data))
+			return String();
+		else if (!Accelerated)
+			return Codec::HexDecode(Data);
+
+		String Result;
+		Result.resize(Data.size() / 2);
+		char* Output = (char*)Result.data();
+		for (size_t i = 0; i < Result.size(); i++)
+			Output[i] = (char)((GetHexValue(Data[i * 2 + 0]) << 4) | GetHexValue(Data[i * 2 + 1]));
+		return Result;
+	}
+	String Text::Base64Encode(const std::string_view& Data)
+	{
+		if (!Accelerated)
+			return Codec::Base64Encode(Data);
+
+		String Result;
+		Result.resize((Data.size() + 2) / 3 * 4);
+		const uint8_t* Input = (const uint8_t*)Data.data();
+		char* Output = (char*)Result.data();
+		size_t Index = 0, Offset = 0;
+		for (; Index + 3 <= Data.size(); Index += 3, Offset += 4)
+		{
+			uint32_t Value = ((uint32_t)Input[Index] << 16) | ((uint32_t)Input[Index + 1] << 8) | (uint32_t)Input[Index + 2];
+			Output[Offset + 0] = Base64Alphabet[(Value >> 18) & 0x3F];
+			Output[Offset + 1] = Base64Alphabet[(Value >> 12) & 0x3F];
+			Output[Offset + 2] = Base64Alphabet[(Value >> 6) & 0x3F];
+			Output[Offset + 3] = Base64Alphabet[Value & 0x3F];
+		}
+
+		size_t Remainder = Data.size() - Index;
+		if (Remainder > 0)
+		{
+			uint32_t Value = (uint32_t)Input[Index] << 16;
+			if (Remainder > 1)
+				Value |= (uint32_t)Input[Index + 1] << 8;
+			Output[Offset + 0] = Base64Alphabet[(Value >> 18) & 0x3F];
+			Output[Offset + 1] = Base64Alphabet[(Value >> 12) & 0x3F];
+			Output[Offset + 2] = Remainder > 1 ? Base64Alphabet[(Value >> 6) & 0x3F] : '=';
+			Output[Offset + 3] = '=';
+		}
+		return Result;
+	}
+	String Text::Base64Decode(const std::string_view& Data)
+	{
+		bool Whitespace = false;
+		if (!IsValidBase64(Data, Whitespace))
+			return String();
+
+		if (!Accelerated)
+		{
+			if (!Whitespace)
+				return Codec::Base64Decode(Data);
+
+			String Compact;
+			Compact.reserve(Data.size());
+			for (char Next : Data)
+			{
+				if (!IsWhitespace(Next))
+					Compact.push_back(Next);
+			}
+			return Codec::Base64Decode(Compact);
+		}
+
+		String Result;
+		Result.reserve(Data.size() / 4 * 3);
+		uint32_t Value = 0;
+		size_t Bits = 0;
+		for (char Next : Data)
+		{
+			if (Next == '=' || IsWhitespace(Next))
+				continue;
+
+			Value = (Value << 6) | (uint32_t)GetBase64Value(Next);
+			Bits += 6;
+			if (Bits >= 8)
+			{
+				Bits -= 8;
+				Result.push_back((char)((Value >> Bits) & 0xFF));
+			}
+		}
+		return Result;
+	}
+	TextAcceleration Text::GetAcceleration()
+	{
+		return Accelerated ? Level : TextAcceleration::Scalar;
+	}
+	void Text::BindSyntax(VirtualMachine* VM)
+	{
+		VM->ImportSystemAddon("array");
+		VM->ImportSystemAddon("string");
+		VM->BeginNamespace("text");
+		VM->SetProperty("const usize npos", &Text::NotFound);
+		VM->SetFunction("usize find(const string&in, const string&in, usize = 0)", &Text::ScriptFind);
+		VM->SetFunction("usize find_any_of(const string&in, const string&in, usize = 0)", &Text::ScriptFindAnyOf);
+		VM->SetFunction("array<string>@ split(const string&in, const string&in)", &Text::ScriptSplit);
+		VM->SetFunction("string replace_all(const string&in, const string&in, const string&in)", &Text::ScriptReplaceAll);
+		VM->SetFunction("string trim(const string&in)", &Text::ScriptTrim);
+		VM->SetFunction("string to_lower(const string&in)", &Text::ScriptToLower);
+		VM->SetFunction("string to_upper(const string&in)", &Text::ScriptToUpper);
+		VM->SetFunction("bool is_utf8(const string&in)", &Text::ScriptIsUTF8);
+		VM->SetFunction("string hex_encode(const string&in)", &Text::ScriptHexEncode);
+		VM->SetFunction("string hex_decode(const string&in)", &Text::ScriptHexDecode);
+		VM->SetFunction("string base64_encode(const string&in)", &Text::ScriptBase64Encode);
+		VM->SetFunction("string base64_decode(const string&in)", &Text::ScriptBase64Decode);
+		VM->SetFunction("void set_accelerated(bool)", &Text::SetAccelerated);
+		VM->SetFunction("string get_acceleration()", &Text::GetAccelerationName);
+		VM->EndNamespace();
+	}
+	size_t Text::ScriptFind(const String& Data, const String& Needle, size_t Offset)
+	{
+		return Find(Data, Needle, Offset);
+	}
+	size_t Text::ScriptFindAnyOf(const String& Data, const String& Set, size_t Offset)
+	{
+		return FindAnyOf(Data, Set, Offset);
+	}
+	Bindings::Array* Text::ScriptSplit(const String& Data, const String& Separator)
+	{
+		auto* VM = ImmediateContext::Get()->GetVM();
+		TypeInfo Type = VM->GetTypeInfoByDecl("array<string>@");
+		return Bindings::Array::Compose<String>(Type.GetTypeInfo(), Split(Data, Separator));
+	}
+	String Text::ScriptReplaceAll(const String& Data, const String& From, const String& To)
+	{
+		return ReplaceAll(Data, From, To);
+	}
+	String Text::ScriptTrim(const String& Data)
+	{
+		return Trim(Data);
+	}
+	String Text::ScriptToLower(const String& Data)
+	{
+		return ToLower(Data);
+	}
+	String Text::ScriptToUpper(const String& Data)
+	{
+		return ToUpper(Data);
+	}
+	bool Text::ScriptIsUTF8(const String& Data)
+	{
+		return IsUTF8(Data);
+	}
+	String Text::ScriptHexEncode(const String& Data)
+	{
+		return HexEncode(Data);
+	}
+	String Text::ScriptHexDecode(const String& Data)
+	{
+		return HexDecode(Data);
+	}
+	String Text::ScriptBase64Encode(const String& Data)
+	{
+		return Base64Encode(Data);
+	}
+	String Text::ScriptBase64Decode(const String& Data)
+	{
+		return Base64Decode(Data);
+	}
+	void Text::SetAccelerated(bool Enabled)
+	{
+		Accelerated = Enabled;
+	}
+	String Text::GetAccelerationName()
+	{
+		switch (GetAcceleration())
+		{
+			case TextAcceleration::AVX2:
+				return "avx2";
+			case TextAcceleration::SSE2:
+				return "sse2";
+			default:
+				return "scalar";
+		}
+	}
+	TextAcceleration Text::Level = DetectAcceleration();
+	std::atomic<bool> Text::Accelerated = true;
+	size_t Text::NotFound = std::string_view::npos;
+}
\ No newline at end of file
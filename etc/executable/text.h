@@ -0,0 +1,80 @@
+#ifndef TEXT_H
+#define TEXT_H
+#include "runtime.hpp"
+#include <vengeance/vengeance.h>
+#include <charconv>
+
+namespace ASX
+{
+	enum class TextAcceleration
+	{
+		Scalar,
+		SSE2,
+		AVX2
+	};
+
+	class StringBuffer : public Reference<StringBuffer>
+	{
+	private:
+		String Data;
+
+	public:
+		StringBuffer(size_t Capacity);
+		void Append(const std::string_view& Value);
+		void AppendString(const String& Value);
+		void AppendInteger(int64_t Value);
+		void AppendNumber(double Value);
+		void AppendLine();
+		void Reserve(size_t Capacity);
+		void Clear();
+		void Write();
+		String Take();
+		String ToString() const;
+		size_t GetSize() const;
+		String& GetData();
+
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+	};
+
+	class Text
+	{
+	private:
+		static TextAcceleration Level;
+		static std::atomic<bool> Accelerated;
+		static size_t NotFound;
+
+	public:
+		static size_t Find(const std::string_view& Data, const std::string_view& Needle, size_t Offset = 0);
+		static size_t FindAnyOf(const std::string_view& Data, const std::string_view& Set, size_t Offset = 0);
+		static Vector<String> Split(const std::string_view& Data, const std::string_view& Separator);
+		static String ReplaceAll(const std::string_view& Data, const std::string_view& From, const std::string_view& To);
+		static String Trim(const std::string_view& Data);
+		static String ToLower(const std::string_view& Data);
+		static String ToUpper(const std::string_view& Data);
+		static bool IsUTF8(const std::string_view& Data);
+		static String HexEncode(const std::string_view& Data);
+		static String HexDecode(const std::string_view& Data);
+		static String Base64Encode(const std::string_view& Data);
+		static String Base64Decode(const std::string_view& Data);
+		static TextAcceleration GetAcceleration();
+		static void BindSyntax(VirtualMachine* VM);
+
+	private:
+		static size_t ScriptFind(const String& Data, const String& Needle, size_t Offset);
+		static size_t ScriptFindAnyOf(const String& Data, const String& Set, size_t Offset);
+		static Bindings::Array* ScriptSplit(const String& Data, const String& Separator);
+		static String ScriptReplaceAll(const String& Data, const String& From, const String& To);
+		static String ScriptTrim(const String& Data);
+		static String ScriptToLower(const String& Data);
+		static String ScriptToUpper(const String& Data);
+		static bool ScriptIsUTF8(const String& Data);
+		static String ScriptHexEncode(const String& Data);
+		static String ScriptHexDecode(const String& Data);
+		static String ScriptBase64Encode(const String& Data);
+		static String ScriptBase64Decode(const String& Data);
+		static void SetAccelerated(bool Enabled);
+		static String GetAccelerationName();
+	};
+}
+#endif
\ No newline at end of file
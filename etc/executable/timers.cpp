@@ -0,0 +1,353 @@
+#include "timers.h"
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace ASX
+{
+	static inline uint64_t CountTrailingZeros(uint64_t Value)
+	{
+#ifdef _MSC_VER
+		unsigned long Index = 0;
+		_BitScanForward64(&Index, Value);
+		return (uint64_t)Index;
+#else
+		return (uint64_t)__builtin_ctzll(Value);
+#endif
+	}
+	static inline uint64_t RotateRight(uint64_t Value, uint64_t Shift)
+	{
+		return Shift ? (Value >> Shift) | (Value << (64 - Shift)) : Value;
+	}
+
+	TimerWheel::TimerWheel() : Epoch(std::chrono::steady_clock::now()), Elapsed(0), Slack(1), Free(TIMERS_NONE), Pending(0)
+	{
+		for (size_t i = 0; i < TIMERS_LEVELS; i++)
+		{
+			for (size_t j = 0; j < TIMERS_SLOTS; j++)
+				Slots[i][j] = TIMERS_NONE;
+			Occupied[i] = 0;
+		}
+	}
+	TimerWheel::~TimerWheel()
+	{
+		for (auto& Next : Nodes)
+		{
+			if (Next.Active)
+				Next.Callback.Release();
+		}
+		for (auto& Next : Expired)
+			Next.Callback.Release();
+	}
+	uint64_t TimerWheel::SetTimeout(uint64_t Timeout, FunctionDelegate&& Callback, EventLoop* Loop)
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		uint32_t Index = Free;
+		if (Index != TIMERS_NONE)
+			Free = Nodes[Index].Next;
+		else
+		{
+			Index = (uint32_t)Nodes.size();
+			Nodes.emplace_back();
+		}
+
+		Node& Next = Nodes[Index];
+		Next.Callback = std::move(Callback);
+		Next.Loop = Loop;
+		Next.Deadline = GetTime() + Timeout;
+		Next.Active = true;
+		Insert(Index);
+		++Pending;
+		return ((uint64_t)Next.Generation << 32) | (uint64_t)(Index + 1);
+	}
+	bool TimerWheel::ClearTimeout(uint64_t Id)
+	{
+		uint32_t Index = (uint32_t)(Id & 0xffffffff);
+		if (!Index--)
+			return false;
+
+		UMutex<std::mutex> Unique(Mutex);
+		if (Index >= Nodes.size())
+			return false;
+
+		Node& Next = Nodes[Index];
+		if (!Next.Active || Next.Generation != (uint32_t)(Id >> 32))
+			return false;
+
+		Unlink(Index);
+		Next.Callback.Release();
+		Next.Loop = nullptr;
+		Next.Active = false;
+		++Next.Generation;
+		Next.Next = Free;
+		Free = Index;
+		--Pending;
+		return true;
+	}
+	size_t TimerWheel::Cancel(EventLoop* Loop)
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		size_t Count = 0;
+		for (uint32_t i = 0; i < (uint32_t)Nodes.size(); i++)
+		{
+			Node& Next = Nodes[i];
+			if (!Next.Active || Next.Loop != Loop)
+				continue;
+
+			Unlink(i);
+			Next.Callback.Release();
+			Next.Loop = nullptr;
+			Next.Active = false;
+			++Next.Generation;
+			Next.Next = Free;
+			Free = i;
+			--Pending;
+			++Count;
+		}
+
+		for (auto It = Expired.begin(); It != Expired.end();)
+		{
+			if (It->Loop == Loop)
+			{
+				It->Callback.Release();
+				It = Expired.erase(It);
+				++Count;
+			}
+			else
+				++It;
+		}
+		return Count;
+	}
+	uint64_t TimerWheel::Update(uint64_t Timeout)
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		uint64_t Time = GetTime();
+		Advance(Time / Slack);
+		for (auto& Next : Expired)
+			Next.Loop->Enqueue(std::move(Next.Callback), [](ImmediateContext*) { }, [](ImmediateContext*) { });
+		Expired.clear();
+
+		uint64_t Tick = GetNextTick();
+		if (Tick != std::numeric_limits<uint64_t>::max())
+			Timeout = std::min(Timeout, Tick * Slack > Time ? Tick * Slack - Time : 0);
+		return Timeout;
+	}
+	void TimerWheel::SetSlack(uint64_t Milliseconds)
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		Milliseconds = std::max<uint64_t>(1, Milliseconds);
+		if (Milliseconds == Slack)
+			return;
+
+		for (size_t i = 0; i < TIMERS_LEVELS; i++)
+		{
+			for (size_t j = 0; j < TIMERS_SLOTS; j++)
+				Slots[i][j] = TIMERS_NONE;
+			Occupied[i] = 0;
+		}
+
+		Elapsed = Elapsed * Slack / Milliseconds;
+		Slack = Milliseconds;
+		for (uint32_t i = 0; i < (uint32_t)Nodes.size(); i++)
+		{
+			if (Nodes[i].Active)
+				Insert(i);
+		}
+	}
+	uint64_t TimerWheel::GetSlack()
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		return Slack;
+	}
+	size_t TimerWheel::GetPending()
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		return Pending;
+	}
+	size_t TimerWheel::GetMemoryUsage()
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		return sizeof(TimerWheel) + Nodes.capacity() * sizeof(Node) + Expired.capacity() * sizeof(Expiry);
+	}
+	void TimerWheel::Insert(uint32_t Index)
+	{
+		Node& Next = Nodes[Index];
+		uint64_t Tick = (Next.Deadline + Slack - 1) / Slack;
+		if (Tick <= Elapsed)
+			Tick = Elapsed + 1;
+
+		uint8_t Level = 0;
+		while (Level + 1 < TIMERS_LEVELS && (Tick >> (TIMERS_BITS * Level)) - (Elapsed >> (TIMERS_BITS * Level)) > TIMERS_SLOTS)
+			++Level;
+
+		uint64_t Shift = TIMERS_BITS * Level;
+		if ((Tick >> Shift) - (Elapsed >> Shift) > TIMERS_SLOTS)
+			Tick = ((Elapsed >> Shift) + TIMERS_SLOTS) << Shift;
+
+		uint8_t Slot = (uint8_t)((Tick >> (TIMERS_BITS * Level)) & (TIMERS_SLOTS - 1));
+		uint32_t& Head = Slots[Level][Slot];
+		Next.Level = Level;
+		Next.Slot = Slot;
+		Next.Prev = TIMERS_NONE;
+		Next.Next = Head;
+		if (Head != TIMERS_NONE)
+			Nodes[Head].Prev = Index;
+		Head = Index;
+		Occupied[Level] |= 1ull << Slot;
+	}
+	void TimerWheel::Unlink(uint32_t Index)
+	{
+		Node& Next = Nodes[Index];
+		if (Next.Prev != TIMERS_NONE)
+			Nodes[Next.Prev].Next = Next.Next;
+		else
+			Slots[Next.Level][Next.Slot] = Next.Next;
+
+		if (Next.Next != TIMERS_NONE)
+			Nodes[Next.Next].Prev = Next.Prev;
+
+		if (Slots[Next.Level][Next.Slot] == TIMERS_NONE)
+			Occupied[Next.Level] &= ~(1ull << Next.Slot);
+		Next.Prev = Next.Next = TIMERS_NONE;
+	}
+	void TimerWheel::Cascade(uint8_t Level, uint8_t Slot)
+	{
+		uint32_t Index = Slots[Level][Slot];
+		Slots[Level][Slot] = TIMERS_NONE;
+		Occupied[Level] &= ~(1ull << Slot);
+		while (Index != TIMERS_NONE)
+		{
+			uint32_t Next = Nodes[Index].Next;
+			Insert(Index);
+			Index = Next;
+		}
+	}
+	void TimerWheel::Expire(uint8_t Slot)
+	{
+		uint32_t Index = Slots[0][Slot];
+		Slots[0][Slot] = TIMERS_NONE;
+		Occupied[0] &= ~(1ull << Slot);
+		while (Index != TIMERS_NONE)
+		{
+			Node& Next = Nodes[Index];
+			uint32_t Following = Next.Next;
+			Expired.push_back({ std::move(Next.Callback), Next.Loop });
+			Next.Loop = nullptr;
+			Next.Active = false;
+			Next.Prev = TIMERS_NONE;
+			Next.Next = Free;
+			++Next.Generation;
+			Free = Index;
+			--Pending;
+			Index = Following;
+		}
+	}
+	void TimerWheel::Advance(uint64_t Tick)
+	{
+		while (Elapsed < Tick)
+		{
+			uint64_t Next = GetNextTick();
+			if (Next > Tick)
+			{
+				Elapsed = Tick;
+				break;
+			}
+
+			Elapsed = Next - 1;
+			uint8_t Level = 0;
+			while (Level + 1 < TIMERS_LEVELS && !(Next & ((1ull << (TIMERS_BITS * (Level + 1))) - 1)))
+				++Level;
+
+			for (; Level > 0; Level--)
+				Cascade(Level, (uint8_t)((Next >> (TIMERS_BITS * Level)) & (TIMERS_SLOTS - 1)));
+
+			Elapsed = Next;
+			Expire((uint8_t)(Next & (TIMERS_SLOTS - 1)));
+		}
+	}
+	uint64_t TimerWheel::GetNextTick()
+	{
+		uint64_t Result = std::numeric_limits<uint64_t>::max();
+		if (Occupied[0] != 0)
+		{
+			uint64_t From = (Elapsed + 1) & (TIMERS_SLOTS - 1);
+			Result = Elapsed + 1 + CountTrailingZeros(RotateRight(Occupied[0], From));
+		}
+
+		for (size_t i = 1; i < TIMERS_LEVELS; i++)
+		{
+			if (Occupied[i] != 0)
+				return std::min(Result, (Elapsed | (TIMERS_SLOTS - 1)) + 1);
+		}
+
+		return Result;
+	}
+	uint64_t TimerWheel::GetTime()
+	{
+		return (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - Epoch).count();
+	}
+	void TimerWheel::BindSyntax(VirtualMachine* VM)
+	{
+		VM->BeginNamespace("timers");
+		VM->SetFunctionDef("void timeout_event()");
+		VM->SetFunction("uint64 set_timeout(uint64, timeout_event@)", &TimerWheel::ScriptSetTimeout);
+		VM->SetFunction("bool clear_timeout(uint64)", &TimerWheel::ScriptClearTimeout);
+		VM->SetFunction("void set_slack(uint64)", &TimerWheel::ScriptSetSlack);
+		VM->SetFunction("uint64 get_slack()", &TimerWheel::ScriptGetSlack);
+		VM->SetFunction("usize get_pending()", &TimerWheel::ScriptGetPending);
+		VM->SetFunction("usize get_memory_usage()", &TimerWheel::ScriptGetMemoryUsage);
+		VM->EndNamespace();
+	}
+	void TimerWheel::Cleanup()
+	{
+		Memory::Delete(Instance);
+	}
+	bool TimerWheel::HasInstance()
+	{
+		return Instance != nullptr;
+	}
+	TimerWheel* TimerWheel::Get()
+	{
+		static std::mutex Initialization;
+		UMutex<std::mutex> Unique(Initialization);
+		if (!Instance)
+			Instance = Memory::New<TimerWheel>();
+		return Instance;
+	}
+	uint64_t TimerWheel::ScriptSetTimeout(uint64_t Timeout, asIScriptFunction* Callback)
+	{
+		if (!Callback)
+			return 0;
+
+		auto* Loop = EventLoop::Get();
+		if (!Loop)
+		{
+			Function(Callback).Release();
+			ImmediateContext::Get()->SetException("timers require an active event loop");
+			return 0;
+		}
+
+		return Get()->SetTimeout(Timeout, FunctionDelegate(Callback), Loop);
+	}
+	bool TimerWheel::ScriptClearTimeout(uint64_t Id)
+	{
+		return Get()->ClearTimeout(Id);
+	}
+	void TimerWheel::ScriptSetSlack(uint64_t Milliseconds)
+	{
+		Get()->SetSlack(Milliseconds);
+	}
+	uint64_t TimerWheel::ScriptGetSlack()
+	{
+		return Get()->GetSlack();
+	}
+	size_t TimerWheel::ScriptGetPending()
+	{
+		return Get()->GetPending();
+	}
+	size_t TimerWheel::ScriptGetMemoryUsage()
+	{
+		return Get()->GetMemoryUsage();
+	}
+	TimerWheel* TimerWheel::Instance = nullptr;
+}
\ No newline at end of file
@@ -0,0 +1,538 @@
+#include "allocator.h"
+#include <angelscript.h>
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+#define ALLOCATOR_CHUNK_SIZE (2 * 1024 * 1024)
+#define ALLOCATOR_ARENA_SIZE (64 * 1024)
+#define ALLOCATOR_SCOPED (ThreadAllocator::Classes + 1)
+#define ALLOCATOR_BUDGET_STEP (256 * 1024)
+#define ALLOCATOR_PAGE_SIZE ((size_t)1 << ALLOCATOR_PAGE_BITS)
+
+namespace ASX
+{
+	ThreadAllocator::Cache::~Cache()
+	{
+		if (!Owner)
+			return;
+
+		for (size_t i = 0; i < Classes; i++)
+		{
+			if (Pools[i].Count > 0)
+				Owner->Return(Pools[i], i, Pools[i].Count);
+		}
+
+		UMutex<std::mutex> Unique(Owner->CachesMutex);
+		Accumulate(Owner->Retired, Stats);
+		Owner->Caches.erase(this);
+	}
+
+	ThreadAllocator::ThreadAllocator() : Arenas(0), Buffer(nullptr), BufferOffset(ALLOCATOR_CHUNK_SIZE), HugePages(false)
+	{
+	}
+	void* ThreadAllocator::Allocate(MemoryLocation&& Location, size_t Size) noexcept
+	{
+		return Allocate(Size);
+	}
+	void* ThreadAllocator::Allocate(size_t Size) noexcept
+	{
+		if (Size <= ALLOCATOR_ARENA_SIZE / 16 && Arenas.load(std::memory_order_relaxed) > 0)
+		{
+			Arena* Current = GetArena();
+			if (Current != nullptr)
+				return AllocateScoped(Current, Size);
+		}
+
+		Cache& Current = GetCache();
+		size_t Class = GetClass(Size + sizeof(Header));
+		Header* Base = nullptr;
+		if (Class >= Classes)
+		{
+			size_t Total = (Size + sizeof(Header) + ALLOCATOR_PAGE_SIZE - 1) & ~(ALLOCATOR_PAGE_SIZE - 1);
+			Base = (Header*)AllocatePages(Total);
+			if (!Base)
+				return nullptr;
+
+			SetRegion(Base, Total, Region::Large);
+			Increment(Current.Stats.Large);
+			Increment(Current.Stats.Allocated, Total);
+			Base->Size = Total;
+			Account(Current, Total);
+		}
+		else
+		{
+			Pool& Target = Current.Pools[Class];
+			if (!Target.Head)
+			{
+				Refill(Target, Class);
+				if (!Target.Head)
+					return nullptr;
+			}
+
+			Block* Next = Target.Head;
+			Target.Head = Next->Next;
+			--Target.Count;
+			Increment(Current.Stats.Sizes[Class].Allocations);
+			Increment(Current.Stats.Allocated, GetClassSize(Class));
+			Base = (Header*)Next;
+			Base->Size = GetClassSize(Class);
+			Account(Current, (size_t)Base->Size);
+		}
+
+		Base->Class = Class;
+		return (char*)Base + sizeof(Header);
+	}
+	void ThreadAllocator::Free(void* Address) noexcept
+	{
+		if (!Address)
+			return;
+
+		Region Type = GetRegion(Address);
+		if (Type == Region::Foreign)
+			return std::free(Address);
+
+		Cache& Current = GetCache();
+		Header* Base = (Header*)((char*)Address - sizeof(Header));
+		Increment(Current.Stats.Released, Base->Size);
+		if (Type == Region::Scoped)
+			return FreeScoped(Base);
+		else if (Type == Region::Large)
+		{
+			SetRegion(Base, (size_t)Base->Size, Region::Foreign);
+			return FreePages(Base);
+		}
+
+		size_t Class = (size_t)Base->Class;
+		Pool& Target = Current.Pools[Class];
+		Block* Next = (Block*)Base;
+		Next->Next = Target.Head;
+		Target.Head = Next;
+		Increment(Current.Stats.Sizes[Class].Frees);
+		if (++Target.Count > GetClassLimit(Class))
+			Return(Target, Class, Target.Count / 2);
+	}
+	void ThreadAllocator::Transfer(void* Address, MemoryLocation&& Location) noexcept
+	{
+	}
+	void ThreadAllocator::Transfer(void* Address, size_t Size) noexcept
+	{
+	}
+	void ThreadAllocator::Watch(MemoryLocation&& Location, void* Address) noexcept
+	{
+	}
+	void ThreadAllocator::Unwatch(void* Address) noexcept
+	{
+	}
+	void ThreadAllocator::Finalize() noexcept
+	{
+	}
+	bool ThreadAllocator::IsValid(void* Address) noexcept
+	{
+		return Address != nullptr && GetRegion(Address) != Region::Foreign;
+	}
+	bool ThreadAllocator::IsFinalizable() noexcept
+	{
+		return false;
+	}
+	void ThreadAllocator::SetHugePages(bool Enabled)
+	{
+		HugePages = Enabled;
+	}
+	void ThreadAllocator::PrintStatistics()
+	{
+		Statistics Total;
+		{
+			UMutex<std::mutex> Unique(CachesMutex);
+			Accumulate(Total, Retired);
+			for (auto* Next : Caches)
+				Accumulate(Total, Next->Stats);
+		}
+
+		auto* Terminal = Console::Get();
+		Terminal->WriteLine("Allocator statistics:");
+		for (size_t i = 0; i < Classes; i++)
+		{
+			auto& Next = Total.Sizes[i];
+			Terminal->WriteLine("  " + ToString(GetClassSize(i)) + " bytes: " + ToString(Next.Allocations.load()) + " allocations, " + ToString(Next.Frees.load()) + " frees, " + ToString(Next.Refills.load()) + " refills, " + ToString(Next.Returns.load()) + " returns");
+		}
+		Terminal->WriteLine("  large: " + ToString(Total.Large.load()) + " allocations");
+		Terminal->WriteLine("  scoped: " + ToString(Total.Scoped.load()) + " allocations in " + ToString(Total.Arenas.load()) + " arenas");
+	}
+	size_t ThreadAllocator::GetMemoryUsage()
+	{
+		Statistics Total;
+		{
+			UMutex<std::mutex> Unique(CachesMutex);
+			Accumulate(Total, Retired);
+			for (auto* Next : Caches)
+				Accumulate(Total, Next->Stats);
+		}
+
+		uint64_t Allocated = Total.Allocated.load(), Released = Total.Released.load();
+		return Allocated > Released ? (size_t)(Allocated - Released) : 0;
+	}
+	ThreadAllocator::Arena* ThreadAllocator::EnterArena(ImmediateContext* Context)
+	{
+		Arena* Next = (Arena*)std::malloc(sizeof(Arena));
+		if (!Next)
+			return nullptr;
+
+		UMutex<std::mutex> Unique(ArenaMutex);
+		Next->Context = Context;
+		Next->Parent = (Arena*)Context->GetUserData(ALLOCATOR_ARENA_DATA);
+		Next->Current = nullptr;
+		Context->SetUserData(Next, ALLOCATOR_ARENA_DATA);
+		if (!Next->Parent)
+			Context->AppendStopExecutionCallback([this, Context]() { DetachArenas(Context); });
+		Increment(GetCache().Stats.Arenas);
+		++Arenas;
+		return Next;
+	}
+	void ThreadAllocator::LeaveArena(Arena* Base)
+	{
+		UMutex<std::mutex> Unique(ArenaMutex);
+		if (Base->Context != nullptr)
+		{
+			Arena* Top = (Arena*)Base->Context->GetUserData(ALLOCATOR_ARENA_DATA);
+			if (Top == Base)
+				Base->Context->SetUserData(Base->Parent, ALLOCATOR_ARENA_DATA);
+			else
+			{
+				while (Top != nullptr && Top->Parent != Base)
+					Top = Top->Parent;
+				if (Top != nullptr)
+					Top->Parent = Base->Parent;
+			}
+
+			if (Base->Current != nullptr)
+				ReleaseChunk(Base->Current);
+		}
+
+		std::free(Base);
+		--Arenas;
+	}
+	void ThreadAllocator::DetachArenas(ImmediateContext* Context)
+	{
+		UMutex<std::mutex> Unique(ArenaMutex);
+		Detach((Arena*)Context->GetUserData(ALLOCATOR_ARENA_DATA));
+		Context->SetUserData(nullptr, ALLOCATOR_ARENA_DATA);
+	}
+	void ThreadAllocator::BindSyntax(VirtualMachine* VM)
+	{
+		auto VArena = VM->SetClass<ArenaScope>("arena", false);
+		VArena->SetConstructor<ArenaScope>("arena@ f()");
+		VArena->SetMethod("void leave()", &ArenaScope::Leave);
+		VArena->SetMethod("bool is_active() const", &ArenaScope::IsActive);
+		VM->GetEngine()->SetContextUserDataCleanupCallback(&ThreadAllocator::ArenaCleanup, ALLOCATOR_ARENA_DATA);
+	}
+	ThreadAllocator* ThreadAllocator::Get()
+	{
+		if (!Instance)
+			Instance = new ThreadAllocator();
+		return Instance;
+	}
+	size_t ThreadAllocator::GetLiveMemory()
+	{
+		return Instance != nullptr ? Instance->GetMemoryUsage() : 0;
+	}
+	ThreadAllocator::Cache& ThreadAllocator::GetCache()
+	{
+		if (!Local.Owner)
+		{
+			Local.Owner = this;
+			Local.Accounting = true;
+			{
+				UMutex<std::mutex> Unique(CachesMutex);
+				Caches.insert(&Local);
+			}
+			Local.Accounting = false;
+		}
+		return Local;
+	}
+	void ThreadAllocator::Account(Cache& Current, size_t Size)
+	{
+		Current.Pending += Size;
+		if (Current.Pending < ALLOCATOR_BUDGET_STEP || Current.Accounting)
+			return;
+
+		Current.Pending = 0;
+		if (!Runtime::GetMemoryLimit())
+			return;
+
+		Current.Accounting = true;
+		Runtime::ApplyMemoryLimit(GetMemoryUsage());
+		Current.Accounting = false;
+	}
+	void ThreadAllocator::Refill(Pool& Target, size_t Class)
+	{
+		size_t Batch = GetClassLimit(Class) / 2;
+		Increment(Local.Stats.Sizes[Class].Refills);
+		{
+			UMutex<std::mutex> Unique(Mutexes[Class]);
+			Pool& Source = Central[Class];
+			while (Source.Head != nullptr && Target.Count < Batch)
+			{
+				Block* Next = Source.Head;
+				Source.Head = Next->Next;
+				--Source.Count;
+				Next->Next = Target.Head;
+				Target.Head = Next;
+				++Target.Count;
+			}
+		}
+
+		if (Target.Count > 0)
+			return;
+
+		size_t Size = GetClassSize(Class);
+		char* Buffer = Carve(Size * Batch);
+		if (!Buffer)
+			return;
+
+		for (size_t i = 0; i < Batch; i++)
+		{
+			Block* Next = (Block*)(Buffer + i * Size);
+			Next->Next = Target.Head;
+			Target.Head = Next;
+			++Target.Count;
+		}
+	}
+	void ThreadAllocator::Return(Pool& Target, size_t Class, size_t Count)
+	{
+		Block* First = Target.Head;
+		Block* Last = First;
+		for (size_t i = 1; i < Count; i++)
+			Last = Last->Next;
+
+		Target.Head = Last->Next;
+		Target.Count -= Count;
+		Increment(Local.Stats.Sizes[Class].Returns);
+
+		UMutex<std::mutex> Unique(Mutexes[Class]);
+		Pool& Source = Central[Class];
+		Last->Next = Source.Head;
+		Source.Head = First;
+		Source.Count += Count;
+	}
+	char* ThreadAllocator::Carve(size_t Size)
+	{
+		UMutex<std::mutex> Unique(ChunkMutex);
+		if (BufferOffset + Size > ALLOCATOR_CHUNK_SIZE)
+		{
+			char* Next = nullptr;
+#ifdef __linux__
+			if (HugePages)
+			{
+				void* Address = mmap(nullptr, ALLOCATOR_CHUNK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (Address != MAP_FAILED)
+				{
+#ifdef MADV_HUGEPAGE
+					madvise(Address, ALLOCATOR_CHUNK_SIZE, MADV_HUGEPAGE);
+#endif
+					Next = (char*)Address;
+				}
+			}
+#endif
+			if (!Next)
+				Next = (char*)AllocatePages(ALLOCATOR_CHUNK_SIZE);
+			if (!Next)
+				return nullptr;
+
+			SetRegion(Next, ALLOCATOR_CHUNK_SIZE, Region::Pooled);
+			Buffer = Next;
+			BufferOffset = 0;
+		}
+
+		char* Result = Buffer + BufferOffset;
+		BufferOffset += Size;
+		return Result;
+	}
+	ThreadAllocator::Arena* ThreadAllocator::GetArena()
+	{
+		auto* Context = ImmediateContext::Get();
+		return Context ? (Arena*)Context->GetUserData(ALLOCATOR_ARENA_DATA) : nullptr;
+	}
+	void* ThreadAllocator::AllocateScoped(Arena* Current, size_t Size)
+	{
+		size_t Total = (sizeof(Header) * 2 + Size + 15) & ~(size_t)15;
+		Chunk* Next = Current->Current;
+		if (!Next || Next->Offset + Total > ALLOCATOR_ARENA_SIZE)
+		{
+			Next = (Chunk*)AllocatePages(ALLOCATOR_ARENA_SIZE);
+			if (!Next)
+				return nullptr;
+
+			SetRegion(Next, ALLOCATOR_ARENA_SIZE, Region::Scoped);
+			new (&Next->References) std::atomic<size_t>(1);
+			Next->Offset = (sizeof(Chunk) + 15) & ~(size_t)15;
+			if (Current->Current != nullptr)
+				ReleaseChunk(Current->Current);
+			Current->Current = Next;
+		}
+
+		char* Block = (char*)Next + Next->Offset;
+		Next->Offset += Total;
+		*(Chunk**)Block = Next;
+		++Next->References;
+		Cache& Target = GetCache();
+		Increment(Target.Stats.Scoped);
+		Increment(Target.Stats.Allocated, Total);
+
+		Header* Base = (Header*)(Block + sizeof(Header));
+		Base->Size = Total;
+		Base->Class = ALLOCATOR_SCOPED;
+		return (char*)Base + sizeof(Header);
+	}
+	void ThreadAllocator::Detach(Arena* Top)
+	{
+		while (Top != nullptr)
+		{
+			Arena* Parent = Top->Parent;
+			if (Top->Current != nullptr)
+				ReleaseChunk(Top->Current);
+			Top->Context = nullptr;
+			Top->Parent = nullptr;
+			Top->Current = nullptr;
+			Top = Parent;
+		}
+	}
+	void ThreadAllocator::FreeScoped(Header* Base)
+	{
+		ReleaseChunk(*(Chunk**)((char*)Base - sizeof(Header)));
+	}
+	void ThreadAllocator::ReleaseChunk(Chunk* Base)
+	{
+		if (--Base->References > 0)
+			return;
+
+		Base->References.~atomic();
+		SetRegion(Base, ALLOCATOR_ARENA_SIZE, Region::Foreign);
+		FreePages(Base);
+	}
+	void* ThreadAllocator::AllocatePages(size_t Size)
+	{
+#ifdef _MSC_VER
+		return _aligned_malloc(Size, ALLOCATOR_PAGE_SIZE);
+#else
+		return std::aligned_alloc(ALLOCATOR_PAGE_SIZE, Size);
+#endif
+	}
+	void ThreadAllocator::FreePages(void* Address)
+	{
+#ifdef _MSC_VER
+		_aligned_free(Address);
+#else
+		std::free(Address);
+#endif
+	}
+	void ThreadAllocator::SetRegion(void* Address, size_t Size, Region Type)
+	{
+		uintptr_t From = (uintptr_t)Address >> ALLOCATOR_PAGE_BITS;
+		uintptr_t To = ((uintptr_t)Address + Size - 1) >> ALLOCATOR_PAGE_BITS;
+		for (uintptr_t Page = From; Page <= To; Page++)
+		{
+			auto& Root = Regions[Page >> ALLOCATOR_LEAF_BITS];
+			uint8_t* Leaf = Root.load(std::memory_order_acquire);
+			if (!Leaf)
+			{
+				uint8_t* Next = (uint8_t*)std::calloc((size_t)1 << ALLOCATOR_LEAF_BITS, sizeof(uint8_t));
+				if (!Next)
+					return;
+				else if (Root.compare_exchange_strong(Leaf, Next, std::memory_order_acq_rel))
+					Leaf = Next;
+				else
+					std::free(Next);
+			}
+			Leaf[Page & (((uintptr_t)1 << ALLOCATOR_LEAF_BITS) - 1)] = (uint8_t)Type;
+		}
+	}
+	ThreadAllocator::Region ThreadAllocator::GetRegion(void* Address)
+	{
+		uintptr_t Page = (uintptr_t)Address >> ALLOCATOR_PAGE_BITS;
+		if (Page >> (ALLOCATOR_LEAF_BITS + ALLOCATOR_ROOT_BITS))
+			return Region::Foreign;
+
+		uint8_t* Leaf = Regions[Page >> ALLOCATOR_LEAF_BITS].load(std::memory_order_acquire);
+		return Leaf ? (Region)Leaf[Page & (((uintptr_t)1 << ALLOCATOR_LEAF_BITS) - 1)] : Region::Foreign;
+	}
+	void ThreadAllocator::Increment(std::atomic<uint64_t>& Counter, uint64_t Value)
+	{
+		Counter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);
+	}
+	void ThreadAllocator::Accumulate(Statistics& Target, const Statistics& Source)
+	{
+		for (size_t i = 0; i < Classes; i++)
+		{
+			Target.Sizes[i].Allocations += Source.Sizes[i].Allocations.load(std::memory_order_relaxed);
+			Target.Sizes[i].Frees += Source.Sizes[i].Frees.load(std::memory_order_relaxed);
+			Target.Sizes[i].Refills += Source.Sizes[i].Refills.load(std::memory_order_relaxed);
+			Target.Sizes[i].Returns += Source.Sizes[i].Returns.load(std::memory_order_relaxed);
+		}
+		Target.Large += Source.Large.load(std::memory_order_relaxed);
+		Target.Scoped += Source.Scoped.load(std::memory_order_relaxed);
+		Target.Arenas += Source.Arenas.load(std::memory_order_relaxed);
+		Target.Allocated += Source.Allocated.load(std::memory_order_relaxed);
+		Target.Released += Source.Released.load(std::memory_order_relaxed);
+	}
+	ThreadAllocator::Arena* ThreadAllocator::ArenaEnter()
+	{
+		auto* Context = ImmediateContext::Get();
+		return Instance != nullptr && Context != nullptr ? Instance->EnterArena(Context) : nullptr;
+	}
+	void ThreadAllocator::ArenaLeave(Arena* Base)
+	{
+		if (Instance != nullptr && Base != nullptr)
+			Instance->LeaveArena(Base);
+	}
+	bool ThreadAllocator::ArenaIsAttached(Arena* Base)
+	{
+		if (!Instance || !Base)
+			return false;
+
+		UMutex<std::mutex> Unique(Instance->ArenaMutex);
+		return Base->Context != nullptr;
+	}
+	void ThreadAllocator::ArenaCleanup(asIScriptContext* Context)
+	{
+		if (!Instance)
+			return;
+
+		UMutex<std::mutex> Unique(Instance->ArenaMutex);
+		Instance->Detach((Arena*)Context->GetUserData(ALLOCATOR_ARENA_DATA));
+	}
+	size_t ThreadAllocator::GetClass(size_t Size)
+	{
+		size_t Class = 0;
+		while (Class < Classes && GetClassSize(Class) < Size)
+			++Class;
+		return Class;
+	}
+	size_t ThreadAllocator::GetClassSize(size_t Class)
+	{
+		return (size_t)32 << Class;
+	}
+	size_t ThreadAllocator::GetClassLimit(size_t Class)
+	{
+		return std::max<size_t>(8, (64 * 1024) / GetClassSize(Class));
+	}
+	ArenaScope::ArenaScope() : Base(ThreadAllocator::ArenaEnter())
+	{
+	}
+	ArenaScope::~ArenaScope()
+	{
+		Leave();
+	}
+	void ArenaScope::Leave()
+	{
+		ThreadAllocator::ArenaLeave(Base);
+		Base = nullptr;
+	}
+	bool ArenaScope::IsActive() const
+	{
+		return ThreadAllocator::ArenaIsAttached(Base);
+	}
+
+	std::atomic<uint8_t*> ThreadAllocator::Regions[1 << ALLOCATOR_ROOT_BITS];
+	ThreadAllocator* ThreadAllocator::Instance = nullptr;
+	thread_local ThreadAllocator::Cache ThreadAllocator::Local;
+}
\ No newline at end of file
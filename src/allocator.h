@@ -0,0 +1,168 @@
+#ifndef ALLOCATOR_H
+#define ALLOCATOR_H
+#include "runtime.hpp"
+#include <vengeance/vengeance.h>
+#define ALLOCATOR_PAGE_BITS 12
+#define ALLOCATOR_LEAF_BITS 18
+#define ALLOCATOR_ROOT_BITS 18
+#define ALLOCATOR_ARENA_DATA 0x61736172656e61
+
+namespace ASX
+{
+	class ThreadAllocator final : public GlobalAllocator
+	{
+	public:
+		static constexpr size_t Classes = 10;
+
+	public:
+		struct Counters
+		{
+			std::atomic<uint64_t> Allocations = 0;
+			std::atomic<uint64_t> Frees = 0;
+			std::atomic<uint64_t> Refills = 0;
+			std::atomic<uint64_t> Returns = 0;
+		};
+
+		struct Statistics
+		{
+			Counters Sizes[Classes];
+			std::atomic<uint64_t> Large = 0;
+			std::atomic<uint64_t> Scoped = 0;
+			std::atomic<uint64_t> Arenas = 0;
+			std::atomic<uint64_t> Allocated = 0;
+			std::atomic<uint64_t> Released = 0;
+		};
+
+		struct Chunk
+		{
+			std::atomic<size_t> References;
+			size_t Offset;
+		};
+
+		struct Arena
+		{
+			ImmediateContext* Context;
+			Arena* Parent;
+			Chunk* Current;
+		};
+
+	private:
+		enum class Region : uint8_t
+		{
+			Foreign = 0,
+			Pooled,
+			Large,
+			Scoped
+		};
+
+		struct Header
+		{
+			uint64_t Size;
+			uint64_t Class;
+		};
+
+		struct Block
+		{
+			Block* Next;
+		};
+
+		struct Pool
+		{
+			Block* Head = nullptr;
+			size_t Count = 0;
+		};
+
+		struct Cache
+		{
+			Pool Pools[Classes];
+			Statistics Stats;
+			ThreadAllocator* Owner = nullptr;
+			size_t Pending = 0;
+			bool Accounting = false;
+			~Cache();
+		};
+
+	private:
+		static std::atomic<uint8_t*> Regions[1 << ALLOCATOR_ROOT_BITS];
+		static ThreadAllocator* Instance;
+		static thread_local Cache Local;
+
+	private:
+		Pool Central[Classes];
+		std::mutex Mutexes[Classes];
+		UnorderedSet<Cache*> Caches;
+		Statistics Retired;
+		std::mutex CachesMutex;
+		std::mutex ChunkMutex;
+		std::mutex ArenaMutex;
+		std::atomic<size_t> Arenas;
+		char* Buffer;
+		size_t BufferOffset;
+		bool HugePages;
+
+	private:
+		ThreadAllocator();
+
+	public:
+		~ThreadAllocator() override = default;
+		void* Allocate(MemoryLocation&& Location, size_t Size) noexcept override;
+		void* Allocate(size_t Size) noexcept override;
+		void Free(void* Address) noexcept override;
+		void Transfer(void* Address, MemoryLocation&& Location) noexcept override;
+		void Transfer(void* Address, size_t Size) noexcept override;
+		void Watch(MemoryLocation&& Location, void* Address) noexcept override;
+		void Unwatch(void* Address) noexcept override;
+		void Finalize() noexcept override;
+		bool IsValid(void* Address) noexcept override;
+		bool IsFinalizable() noexcept override;
+		void SetHugePages(bool Enabled);
+		void PrintStatistics();
+		size_t GetMemoryUsage();
+		Arena* EnterArena(ImmediateContext* Context);
+		void LeaveArena(Arena* Base);
+		void DetachArenas(ImmediateContext* Context);
+
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+		static ThreadAllocator* Get();
+		static size_t GetLiveMemory();
+		static Arena* ArenaEnter();
+		static void ArenaLeave(Arena* Base);
+		static bool ArenaIsAttached(Arena* Base);
+
+	private:
+		Cache& GetCache();
+		void Account(Cache& Current, size_t Size);
+		void Refill(Pool& Target, size_t Class);
+		void Return(Pool& Target, size_t Class, size_t Count);
+		char* Carve(size_t Size);
+		Arena* GetArena();
+		void* AllocateScoped(Arena* Current, size_t Size);
+		void FreeScoped(Header* Base);
+		void Detach(Arena* Top);
+		static void ArenaCleanup(asIScriptContext* Context);
+		static void ReleaseChunk(Chunk* Base);
+		static void* AllocatePages(size_t Size);
+		static void FreePages(void* Address);
+		static void SetRegion(void* Address, size_t Size, Region Type);
+		static Region GetRegion(void* Address);
+		static void Increment(std::atomic<uint64_t>& Counter, uint64_t Value = 1);
+		static void Accumulate(Statistics& Target, const Statistics& Source);
+		static size_t GetClass(size_t Size);
+		static size_t GetClassSize(size_t Class);
+		static size_t GetClassLimit(size_t Class);
+	};
+
+	class ArenaScope : public Reference<ArenaScope>
+	{
+	private:
+		ThreadAllocator::Arena* Base;
+
+	public:
+		ArenaScope();
+		~ArenaScope();
+		void Leave();
+		bool IsActive() const;
+	};
+}
+#endif
\ No newline at end of file
@@ -1,1020 +1,1968 @@
-#include "app.h"
-#include <signal.h>
-
-namespace ASX
-{
-	Environment::Environment(int ArgsCount, char** Args) : Loop(nullptr), VM(nullptr), Context(nullptr), Unit(nullptr)
-	{
-		AddDefaultCommands();
-		AddDefaultSettings();
-		ListenForSignals();
-		Env.Parse(ArgsCount, Args, Flags);
-		ErrorHandling::SetFlag(LogOption::ReportSysErrors, false);
-		ErrorHandling::SetFlag(LogOption::Active, true);
-		ErrorHandling::SetFlag(LogOption::Pretty, false);
-		Config.EssentialsOnly = !Env.Commandline.Has("game", "g");
-		Config.Install = Env.Commandline.Has("install", "i") || Env.Commandline.Has("target");
-#ifndef NDEBUG
-		OS::Directory::SetWorking(OS::Directory::GetModule()->c_str());
-		Config.SaveSourceCode = true;
-#endif
-	}
-	Environment::~Environment()
-	{
-		Templates::Cleanup();
-		if (Console::HasInstance())
-			Console::Get()->Detach();
-		Memory::Release(Context);
-		Memory::Release(Unit);
-		Memory::Release(VM);
-		Memory::Release(Loop);
-	}
-	int Environment::Dispatch()
-	{
-		auto* Terminal = Console::Get();
-		Terminal->Attach();
-
-		VM = new VirtualMachine();
-		Bindings::HeavyRegistry().BindAddons(VM);
-		for (auto& Next : Env.Commandline.Args)
-		{
-			if (Next.first == "__path__")
-				continue;
-
-			auto* Command = FindArgument(Next.first);
-			if (!Command)
-			{
-				VI_ERR("command <%s> is not a valid operation", Next.first.c_str());
-				return (int)ExitStatus::InvalidCommand;
-			}
-
-			int ExitCode = Command->Callback(Next.second);
-			if (ExitCode != (int)ExitStatus::Continue)
-				return ExitCode;
-		}
-
-		if (!Env.Commandline.Params.empty())
-		{
-			String Directory = *OS::Directory::GetWorking();
-			auto File = OS::Path::Resolve(Env.Commandline.Params.front(), Directory, true);
-			if (!File || !OS::File::GetState(*File, &Env.File) || Env.File.IsDirectory)
-			{
-				File = OS::Path::Resolve(Env.Commandline.Params.front() + (Config.LoadByteCode ? ".as.gz" : ".as"), Directory, true);
-				if (File && OS::File::GetState(*File, &Env.File) && !Env.File.IsDirectory)
-					Env.Path = *File;
-			}
-			else
-				Env.Path = *File;
-
-			if (!Env.File.IsExists)
-			{
-				VI_ERR("path <%s> does not exist", Env.Commandline.Params.front().c_str());
-				return (int)ExitStatus::InputError;
-			}
-
-			Env.Registry = OS::Path::GetDirectory(Env.Path);
-			if (Env.Registry == Env.Path)
-			{
-				Env.Path = Directory + Env.Path;
-				Env.Registry = OS::Path::GetDirectory(Env.Path);
-			}
-
-			Env.Module = OS::Path::GetFilename(Env.Path).data();
-			Env.Program = *OS::File::ReadAsString(Env.Path);
-			Env.Registry += "addons";
-			Env.Registry += VI_SPLITTER;
-		}
-
-		if (!Config.Interactive && Env.Addon.empty() && Env.Program.empty())
-		{
-			Config.Interactive = true;
-			if (Env.Commandline.Args.size() > 1)
-			{
-				VI_ERR("provide a path to existing script file");
-				return (int)ExitStatus::InputError;
-			}
-		}
-		else if (!Env.Addon.empty())
-		{
-			if (Builder::InitializeIntoAddon(Config, Env, VM, Builder::GetDefaultSettings()) != StatusCode::OK)
-				return (int)ExitStatus::CommandError;
-
-			Terminal->WriteLine("Initialized " + Env.Mode + " addon: " + Env.Addon);
-			return (int)ExitStatus::OK;
-		}
-
-		Unit = VM->CreateCompiler();
-		if (!Runtime::ConfigureContext(Config, Env, VM, Unit))
-			return (int)ExitStatus::CompilerError;
-
-		OS::Directory::SetWorking(OS::Path::GetDirectory(Env.Path.c_str()).c_str());
-		if (Config.Debug)
-		{
-			DebuggerContext* Debugger = new DebuggerContext();
-			Bindings::HeavyRegistry().BindStringifiers(Debugger);
-			Debugger->SetInterruptCallback([](bool IsInterrupted)
-			{
-				if (!Schedule::IsAvailable())
-					return;
-
-				auto* Queue = Schedule::Get();
-				if (IsInterrupted)
-					Queue->Suspend();
-				else
-					Queue->Resume();
-			});
-			VM->SetDebugger(Debugger);
-		}
-
-		Unit->SetIncludeCallback(std::bind(&Environment::ImportAddon, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
-		auto Status = Unit->Prepare(Env.Module);
-		if (!Status)
-		{
-			VI_ERR("cannot prepare <%s> module scope\n  %s", Env.Module, Status.Error().what());
-			return (int)ExitStatus::PrepareError;
-		}
-
-		Context = VM->RequestContext();
-		if (!Env.Program.empty())
-		{
-			if (!Config.LoadByteCode)
-			{
-				Status = Unit->LoadCode(Env.Path, Env.Program);
-				if (!Status)
-				{
-					VI_ERR("cannot load <%s> module script code\n  %s", Env.Module, Status.Error().what());
-					return (int)ExitStatus::LoadingError;
-				}
-
-				Runtime::ConfigureSystem(Config);
-				Status = Unit->Compile().Get();
-				if (!Status)
-				{
-					VI_ERR("cannot compile <%s> module\n  %s", Env.Module, Status.Error().what());
-					return (int)ExitStatus::CompilerError;
-				}
-			}
-			else
-			{
-				ByteCodeInfo Info;
-				Info.Data.insert(Info.Data.begin(), Env.Program.begin(), Env.Program.end());
-
-				Runtime::ConfigureSystem(Config);
-				Status = Unit->LoadByteCode(&Info).Get();
-				if (!Status)
-				{
-					VI_ERR("cannot load <%s> module bytecode\n  %s", Env.Module, Status.Error().what());
-					return (int)ExitStatus::LoadingError;
-				}
-			}
-		}
-
-		if (Config.Install)
-		{
-			if (Config.Installed > 0)
-			{
-				Terminal->WriteLine("Successfully installed " + ToString(Config.Installed) + String(Config.Installed > 1 ? " addons" : " addon"));
-				return EXIT_SUCCESS;
-			}
-			else if (Env.Output.empty())
-				return Builder::PullAddonRepository(Config, Env) == StatusCode::OK ? (int)ExitStatus::OK : (int)ExitStatus::CommandError;
-
-			if (Builder::CompileIntoExecutable(Config, Env, VM, Builder::GetDefaultSettings()) != StatusCode::OK)
-				return (int)ExitStatus::CommandError;
-
-			Terminal->WriteLine("Built binaries directory: " + Env.Output + "bin");
-			return (int)ExitStatus::OK;
-		}
-		else if (Config.SaveByteCode)
-		{
-			ByteCodeInfo Info;
-			Info.Debug = Config.Debug;
-			if (Unit->SaveByteCode(&Info) && OS::File::Write(Env.Path + ".gz", (uint8_t*)Info.Data.data(), Info.Data.size()))
-				return (int)ExitStatus::OK;
-
-			VI_ERR("cannot save <%s> module bytecode", Env.Module);
-			return (int)ExitStatus::SavingError;
-		}
-		else if (Config.Dependencies)
-		{
-			PrintDependencies();
-			return (int)ExitStatus::OK;
-		}
-		else if (Config.Interactive)
-		{
-			if (Env.Path.empty())
-				Env.Path = *OS::Directory::GetWorking();
-
-			String Data, Multidata;
-			Data.reserve(1024 * 1024);
-			if (Config.EssentialsOnly)
-			{
-				VM->ImportSystemAddon("any");
-				VM->ImportSystemAddon("uint256");
-				VM->ImportSystemAddon("math");
-				VM->ImportSystemAddon("random");
-				VM->ImportSystemAddon("timestamp");
-				VM->ImportSystemAddon("console");
-			}
-			else
-				VM->ImportSystemAddon("*");
-			PrintIntroduction("interactive mode");
-
-			auto* Debugger = new DebuggerContext(DebugType::Detach);
-			Bindings::HeavyRegistry().BindStringifiers(Debugger);
-
-			char DefaultCode[] = "void main(){}";
-			bool Editor = false;
-			size_t Section = 0;
-			Env.Path += Env.Module;
-			Debugger->SetEngine(VM);
-
-			Function Main = Runtime::GetEntrypoint(Env, Entrypoint, Unit, true);
-			if (!Main.IsValid())
-			{
-				Status = Unit->LoadCode(Env.Path + ":0", DefaultCode);
-				if (!Status)
-				{
-					VI_ERR("cannot load default entrypoint for interactive mode\n  %s", Status.Error().what());
-					Memory::Release(Debugger);
-					return (int)ExitStatus::LoadingError;
-				}
-
-				Runtime::ConfigureSystem(Config);
-				Status = Unit->Compile().Get();
-				if (!Status)
-				{
-					VI_ERR("cannot compile default module for interactive mode\n  %s", Status.Error().what());
-					Memory::Release(Debugger);
-					return (int)ExitStatus::CompilerError;
-				}
-			}
-
-			for (;;)
-			{
-				if (!Editor)
-					Terminal->Write("> ");
-
-				if (!Terminal->ReadLine(Data, Data.capacity()))
-				{
-					if (!Editor)
-						break;
-
-				ExitEditor:
-					Editor = false;
-					Data = Multidata;
-					Multidata.clear();
-					goto Execute;
-				}
-				else if (Data.empty())
-					continue;
-
-				Stringify::Trim(Data);
-				if (Editor)
-				{
-					if (!Data.empty() && Data.back() == '\x4')
-					{
-						Data.erase(Data.end() - 1);
-						if (Env.Inline && !Data.empty() && Data.back() != ';')
-							Data += ';';
-
-						Multidata += Data;
-						goto ExitEditor;
-					}
-
-					if (Env.Inline && !Data.empty() && Data.back() != ';')
-						Data += ';';
-
-					Multidata += Data;
-					continue;
-				}
-				else if (Stringify::StartsWith(Data, ".help"))
-				{
-					Terminal->WriteLine("  .mode   - switch between registering and executing the code");
-					Terminal->WriteLine("  .help   - show available commands");
-					Terminal->WriteLine("  .editor - enter editor mode");
-					Terminal->WriteLine("  .exit   - exit interactive mode");
-					Terminal->WriteLine("  .use    - import system addons by name (comma separated list)");
-					Terminal->WriteLine("  *       - anything else will be interpreted as script code");
-					continue;
-				}
-				else if (Stringify::StartsWith(Data, ".use"))
-				{
-					size_t Imports = 0;
-					auto Addons = Stringify::Split(Data.substr(4), ',');
-					for (auto& Addon : Addons)
-					{
-						Stringify::Trim(Addon);
-						if (!VM->ImportSystemAddon(Addon.empty() ? "*" : Addon))
-							Terminal->WriteLine("  use: addon @" + Addon + " not found");
-						else
-							++Imports;
-					}
-					if (Imports > 0)
-						PrintIntroduction("interactive mode");
-					continue;
-				}
-				else if (Stringify::StartsWith(Data, ".mode"))
-				{
-					Env.Inline = !Env.Inline;
-					if (Env.Inline)
-						Terminal->WriteLine("  evaluation mode: you may now execute your code");
-					else
-						Terminal->WriteLine("  register mode: you may now register script interfaces");
-					continue;
-				}
-				else if (Stringify::StartsWith(Data, ".editor"))
-				{
-					Terminal->WriteLine("  editor mode: you may write multiple lines of code (Ctrl+D to finish)\n");
-					Editor = true;
-					continue;
-				}
-				else if (Data == ".exit")
-					break;
-
-			Execute:
-				if (Data.empty())
-					continue;
-
-				if (!Env.Inline)
-				{
-					String Index = ":" + ToString(++Section);
-					if (!Unit->LoadCode(Env.Path + Index, Data) || Unit->Compile().Get())
-						continue;
-				}
-
-				auto Inline = Unit->CompileFunction(Data, "any@").Get();
-				if (!Inline)
-					continue;
-
-				Bindings::Any* Value = nullptr;
-				auto Execution = Context->ExecuteCall(*Inline, nullptr).Get();
-				if (Execution && *Execution == Execution::Finished)
-				{
-					String Indent = "  ";
-					Value = Context->GetReturnObject<Bindings::Any>();
-					Terminal->WriteLine(Indent + Debugger->ToString(Indent, 3, Value, VM->GetTypeInfoByName("any").GetTypeId()));
-				}
-				else
-					Context->Abort();
-				Context->Unprepare();
-			}
-
-			Memory::Release(Debugger);
-			ExitProcess(ExitStatus::OK);
-			return (int)ExitStatus::OK;
-		}
-
-		Function Main = Runtime::GetEntrypoint(Env, Entrypoint, Unit);
-		if (!Main.IsValid())
-			return (int)ExitStatus::EntrypointError;
-
-		if (Config.Debug)
-			PrintIntroduction("debugger");
-
-		int ExitCode = 0;
-		TypeInfo Type = VM->GetTypeInfoByDecl("array<string>@");
-		Bindings::Array* ArgsArray = Type.IsValid() ? Bindings::Array::Compose<String>(Type.GetTypeInfo(), Env.Commandline.Params) : nullptr;
-		VM->SetExceptionCallback([](ImmediateContext* Context)
-		{
-			if (!Context->WillExceptionBeCaught())
-				ExitProcess(ExitStatus::RuntimeError);
-		});
-
-		Main.AddRef();
-		Loop = new EventLoop();
-		Loop->Listen(Context);
-		Loop->Enqueue(FunctionDelegate(Main, Context), [&Main, ArgsArray](ImmediateContext* Context)
-		{
-			Runtime::StartupEnvironment(EnvironmentConfig::Get());
-			if (Main.GetArgsCount() > 0)
-				Context->SetArgObject(0, ArgsArray);
-		}, [this, &ExitCode, &Type, &Main, ArgsArray](ImmediateContext* Context)
-		{
-			ExitCode = Main.GetReturnTypeId() == (int)TypeId::VOIDF ? 0 : (int)Context->GetReturnDWord();
-			if (ArgsArray != nullptr)
-				Context->GetVM()->ReleaseObject(ArgsArray, Type);
-			Runtime::ShutdownEnvironment(EnvironmentConfig::Get());
-			Loop->Wakeup();
-		});
-
-		Runtime::AwaitContext(Mutex, Loop, VM, Context);
-		return ExitCode;
-	}
-	void Environment::Shutdown(int Value)
-	{
-		UMutex<std::mutex> Unique(Mutex);
-		{
-			if (Runtime::TryContextExit(Env, Value))
-			{
-				Loop->Wakeup();
-				VI_DEBUG("graceful shutdown using [signal vcall]");
-				goto GracefulShutdown;
-			}
-
-			auto* App = Application::Get();
-			if (App != nullptr && App->GetState() == ApplicationState::Active)
-			{
-				App->Stop();
-				Loop->Wakeup();
-				VI_DEBUG("graceful shutdown using [application stop]");
-				goto GracefulShutdown;
-			}
-
-			if (Schedule::IsAvailable())
-			{
-				Schedule::Get()->Stop();
-				Loop->Wakeup();
-				VI_DEBUG("graceful shutdown using [scheduler stop]");
-				goto GracefulShutdown;
-			}
-
-			VI_DEBUG("forcing shutdown using [kill]");
-			return ExitProcess(ExitStatus::Kill);
-		}
-	GracefulShutdown:
-		ListenForSignals();
-	}
-	void Environment::Interrupt(int Value)
-	{
-		if (Config.Debug && VM->GetDebugger() && VM->GetDebugger()->Interrupt())
-			ListenForSignals();
-		else
-			Shutdown(Value);
-	}
-	void Environment::Abort(const char* Signal)
-	{
-		VI_PANIC(false, "%s which is a critical runtime error", Signal);
-	}
-	size_t Environment::GetInitFlags()
-	{
-		size_t LibraryLayer = Vitex::LOAD_NETWORKING | Vitex::LOAD_CRYPTOGRAPHY | Vitex::LOAD_LOCALE;
-		size_t ApplicationLayer = LibraryLayer | Vitex::LOAD_PROVIDERS;
-		size_t GameLayer = ApplicationLayer | Vitex::LOAD_PLATFORM | Vitex::LOAD_AUDIO | Vitex::LOAD_GRAPHICS;
-		if (Config.Install)
-			return LibraryLayer;
-
-		if (Config.EssentialsOnly)
-			return ApplicationLayer;
-
-		return GameLayer;
-	}
-	void Environment::AddDefaultCommands()
-	{
-		AddCommand("application", "-h, --help", "show help message", true, [this](const std::string_view&)
-		{
-			PrintHelp();
-			return (int)ExitStatus::OK;
-		});
-		AddCommand("application", "-v, --version", "show version message", true, [this](const std::string_view&)
-		{
-			PrintIntroduction("runtime");
-			return (int)ExitStatus::OK;
-		});
-		AddCommand("application", "--plain", "show detailed log messages as is", true, [this](const std::string_view&)
-		{
-			Config.PrettyProgress = false;
-			ErrorHandling::SetFlag(LogOption::Pretty, false);
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("application", "--quiet", "disable logging", true, [](const std::string_view&)
-		{
-			ErrorHandling::SetFlag(LogOption::Active, false);
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("application", "--timings", "append date for each logging message", true, [](const std::string_view&)
-		{
-			ErrorHandling::SetFlag(LogOption::Dated, true);
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("execution", "-b, --bytecode", "load gz compressed compiled bytecode and execute it as normal", true, [this](const std::string_view&)
-		{
-			Config.LoadByteCode = true;
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("execution", "-s, --save", "save gz compressed compiled bytecode to a file near script file", true, [this](const std::string_view&)
-		{
-			Config.SaveByteCode = true;
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("execution", "-I, --interactive", "run only in interactive mode", true, [this](const std::string_view&)
-		{
-			Config.Interactive = true;
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("execution", "-d, --debug", "enable debugger interface", true, [this](const std::string_view&)
-		{
-			Config.Debug = true;
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("execution", "-g, --game", "enable game engine mode for graphics and audio support", true, [this](const std::string_view&)
-		{
-			Config.EssentialsOnly = false;
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("execution", "-p, --preserve", "enable in memory source code preservation for better exception messages", true, [this](const std::string_view&)
-		{
-			Config.SaveSourceCode = true;
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("execution", "-D, --deny", "deny permissions by name [expects: plus(+) separated list]", false, [this](const std::string_view& Value)
-		{
-			for (auto& Item : Stringify::Split(Value, '+'))
-			{
-				auto Option = OS::Control::ToOption(Item);
-				if (!Option)
-				{
-					VI_ERR("os access control option not found: %s (options = %s)", Item.c_str(), OS::Control::ToOptions());
-					return (int)ExitStatus::InputError;
-				}
-
-				Config.Permissions[*Option] = false;
-			}
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("execution", "-A, --allow", "allow permissions by name [expects: plus(+) separated list]", false, [this](const std::string_view& Value)
-		{
-			for (auto& Item : Stringify::Split(Value, '+'))
-			{
-				auto Option = OS::Control::ToOption(Item);
-				if (!Option)
-				{
-					VI_ERR("os access control option not found: %s (options = %s)", Item.c_str(), OS::Control::ToOptions());
-					return (int)ExitStatus::InputError;
-				}
-
-				Config.Permissions[*Option] = true;
-			}
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("building", "--target", "set a CMake name for output target [expects: name]", false, [this](const std::string_view& Name)
-		{
-			Env.Name = Name;
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("building", "--output", "directory where to build an executable from source code [expects: path]", false, [this](const std::string_view& Path)
-		{
-			FileEntry File;
-			if (Path != ".")
-			{
-				auto Target = OS::Path::Resolve(Path, *OS::Directory::GetWorking(), true);
-				if (Target)
-					Env.Output = *Target;
-			}
-			else
-				Env.Output = *OS::Directory::GetWorking();
-
-			if (!Env.Output.empty() && (Env.Output.back() == '/' || Env.Output.back() == '\\'))
-				Env.Output.erase(Env.Output.end() - 1);
-
-			if (ExecuteArgument({ "target" }) == ExitStatus::InvalidCommand || Env.Name.empty())
-			{
-				Env.Name = OS::Path::GetFilename(Env.Output.c_str());
-				if (Env.Name.empty())
-				{
-					VI_ERR("init directory is set but name was not specified: use --target");
-					return (int)ExitStatus::InputError;
-				}
-			}
-
-			Env.Output += VI_SPLITTER + Env.Name + VI_SPLITTER;
-			if (!OS::File::GetState(Env.Output, &File))
-			{
-				OS::Directory::Patch(Env.Output);
-				return (int)ExitStatus::Continue;
-			}
-
-			if (File.IsDirectory)
-				return (int)ExitStatus::Continue;
-
-			VI_ERR("output path <%s> must be a directory", Path.data());
-			return (int)ExitStatus::InputError;
-		});
-		AddCommand("building", "--import-std", "import standard addon(s) by name [expects: plus(+) separated list]", false, [this](const std::string_view& Value)
-		{
-			for (auto& Item : Stringify::Split(Value, '+'))
-				Config.SystemAddons.push_back(Item);
-
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("building", "--import-user", "import user addon(s) by path [expects: plus(+) separated list]", false, [this](const std::string_view& Value)
-		{
-			for (auto& Item : Stringify::Split(Value, '+'))
-				Config.Libraries.emplace_back(std::make_pair(Item, true));
-
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("building", "--import-lib", "import clibrary(ies) by path [expects: plus(+) separated list]", false, [this](const std::string_view& Value)
-		{
-			for (auto& Item : Stringify::Split(Value, '+'))
-				Config.Libraries.emplace_back(std::make_pair(Item, false));
-
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("building", "--import-func", "import clibrary function by declaration [expects: clib_name:cfunc_name=asfunc_decl]", false, [this](const std::string_view& Value)
-		{
-			size_t Offset1 = Value.find(':');
-			if (Offset1 == std::string::npos)
-			{
-				VI_ERR("invalid clibrary cfunction declaration <%s>", Value.data());
-				return (int)ExitStatus::InvalidDeclaration;
-			}
-
-			size_t Offset2 = Value.find('=', Offset1);
-			if (Offset2 == std::string::npos)
-			{
-				VI_ERR("invalid clibrary cfunction declaration <%s>", Value.data());
-				return (int)ExitStatus::InvalidDeclaration;
-			}
-
-			String CLibraryName = String(Value.substr(0, Offset1));
-			Stringify::Trim(CLibraryName);
-
-			String CFunctionName = String(Value.substr(Offset1 + 1, Offset2 - Offset1 - 1));
-			Stringify::Trim(CLibraryName);
-
-			String Declaration = String(Value.substr(Offset2 + 1));
-			Stringify::Trim(CLibraryName);
-
-			if (CLibraryName.empty() || CFunctionName.empty() || Declaration.empty())
-			{
-				VI_ERR("invalid clibrary cfunction declaration <%s>", Value.data());
-				return (int)ExitStatus::InvalidDeclaration;
-			}
-
-			auto& Data = Config.Functions[CLibraryName];
-			Data.first = CFunctionName;
-			Data.second = Declaration;
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("building", "--prop", "set virtual machine property [expects: prop_name:prop_value]", false, [this](const std::string_view& Value)
-		{
-			auto Args = Stringify::Split(Value, ':');
-			if (Args.size() != 2)
-			{
-				VI_ERR("invalid property declaration <%s>", Value.data());
-				return (int)ExitStatus::InputError;
-			}
-
-			auto It = Settings.find(Stringify::Trim(Args[0]));
-			if (It == Settings.end())
-			{
-				VI_ERR("invalid property name <%s>", Args[0].c_str());
-				return (int)ExitStatus::InputError;
-			}
-
-			String& Data = Args[1];
-			Stringify::Trim(Data);
-			Stringify::ToLower(Data);
-
-			if (Data.empty())
-			{
-			InputFailure:
-				VI_ERR("property value <%s>: %s", Args[0].c_str(), Args[1].empty() ? "?" : Args[1].c_str());
-				return (int)ExitStatus::InputError;
-			}
-			else if (!Stringify::HasInteger(Data))
-			{
-				if (Args[1] == "on" || Args[1] == "true")
-					VM->SetProperty((Features)It->second, 1);
-				else if (Args[1] == "off" || Args[1] == "false")
-					VM->SetProperty((Features)It->second, 1);
-				else
-					goto InputFailure;
-			}
-
-			VM->SetProperty((Features)It->second, (size_t)*FromString<uint64_t>(Data));
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("building", "--props", "show virtual machine properties message", true, [this](const std::string_view&)
-		{
-			PrintProperties();
-			return (int)ExitStatus::OK;
-		});
-		AddCommand("addons", "-a, --addon", "initialize an addon in given directory [expects: [native|vm]:?relpath]", false, [this](const std::string_view& Value)
-		{
-			String Path = String(Value);
-			size_t Where = Value.find(':');
-			if (Where != std::string::npos)
-			{
-				Path = Path.substr(Where + 1);
-				if (Path.empty())
-				{
-					VI_ERR("addon initialization expects <mode:path> format: path must not be empty");
-					return (int)ExitStatus::InputError;
-				}
-
-				Env.Mode = Value.substr(0, Where);
-				if (Env.Mode != "native" && Env.Mode != "vm")
-				{
-					VI_ERR("addon initialization expects <mode:path> format: mode <%s> is invalid, [native|vm] expected", Env.Mode.c_str());
-					return (int)ExitStatus::InputError;
-				}
-			}
-			else
-				Env.Mode = "vm";
-
-			FileEntry File;
-			if (Path != ".")
-			{
-				auto Target = OS::Path::Resolve(Path, *OS::Directory::GetWorking(), true);
-				if (Target)
-					Env.Addon = *Target;
-			}
-			else
-				Env.Addon = *OS::Directory::GetWorking();
-
-			if (!Env.Addon.empty() && (Env.Addon.back() == '/' || Env.Addon.back() == '\\'))
-				Env.Addon.erase(Env.Addon.end() - 1);
-
-			if (ExecuteArgument({ "target" }) == ExitStatus::InvalidCommand || Env.Name.empty())
-			{
-				Env.Name = OS::Path::GetFilename(Env.Addon.c_str());
-				if (Env.Name.empty())
-				{
-					VI_ERR("init directory is set but name was not specified: use --target");
-					return (int)ExitStatus::InputError;
-				}
-			}
-
-			Env.Addon += VI_SPLITTER + Env.Name + VI_SPLITTER;
-			if (!OS::File::GetState(Env.Addon, &File))
-			{
-				OS::Directory::Patch(Env.Addon);
-				return (int)ExitStatus::Continue;
-			}
-
-			if (File.IsDirectory)
-				return (int)ExitStatus::Continue;
-
-			VI_ERR("addon path <%s> must be a directory", Path.c_str());
-			return (int)ExitStatus::InputError;
-		});
-		AddCommand("addons", "-i, --install", "install or update script dependencies", true, [this](const std::string_view& Value)
-		{
-			Config.Install = true;
-			return (int)ExitStatus::Continue;
-		});
-		AddCommand("addons", "--deps", "install and show dependencies message", true, [this](const std::string_view&)
-		{
-			Config.Dependencies = true;
-			return (int)ExitStatus::Continue;
-		});
-	}
-	void Environment::AddDefaultSettings()
-	{
-		Settings["default_stack_size"] = (uint32_t)Features::INIT_STACK_SIZE;
-		Settings["default_callstack_size"] = (uint32_t)Features::INIT_CALL_STACK_SIZE;
-		Settings["callstack_size"] = (uint32_t)Features::MAX_CALL_STACK_SIZE;
-		Settings["stack_size"] = (uint32_t)Features::MAX_STACK_SIZE;
-		Settings["string_encoding"] = (uint32_t)Features::STRING_ENCODING;
-		Settings["script_encoding_utf8"] = (uint32_t)Features::SCRIPT_SCANNER;
-		Settings["no_globals"] = (uint32_t)Features::DISALLOW_GLOBAL_VARS;
-		Settings["warnings"] = (uint32_t)Features::COMPILER_WARNINGS;
-		Settings["unicode"] = (uint32_t)Features::ALLOW_UNICODE_IDENTIFIERS;
-		Settings["nested_calls"] = (uint32_t)Features::MAX_NESTED_CALLS;
-		Settings["unsafe_references"] = (uint32_t)Features::ALLOW_UNSAFE_REFERENCES;
-		Settings["optimized_bytecode"] = (uint32_t)Features::OPTIMIZE_BYTECODE;
-		Settings["copy_scripts"] = (uint32_t)Features::COPY_SCRIPT_SECTIONS;
-		Settings["character_literals"] = (uint32_t)Features::USE_CHARACTER_LITERALS;
-		Settings["multiline_strings"] = (uint32_t)Features::ALLOW_MULTILINE_STRINGS;
-		Settings["implicit_handles"] = (uint32_t)Features::ALLOW_IMPLICIT_HANDLE_TYPES;
-		Settings["suspends"] = (uint32_t)Features::BUILD_WITHOUT_LINE_CUES;
-		Settings["init_globals"] = (uint32_t)Features::INIT_GLOBAL_VARS_AFTER_BUILD;
-		Settings["require_enum_scope"] = (uint32_t)Features::REQUIRE_ENUM_SCOPE;
-		Settings["jit_instructions"] = (uint32_t)Features::INCLUDE_JIT_INSTRUCTIONS;
-		Settings["accessor_mode"] = (uint32_t)Features::PROPERTY_ACCESSOR_MODE;
-		Settings["array_template_message"] = (uint32_t)Features::EXPAND_DEF_ARRAY_TO_TMPL;
-		Settings["automatic_gc"] = (uint32_t)Features::AUTO_GARBAGE_COLLECT;
-		Settings["automatic_constructors"] = (uint32_t)Features::ALWAYS_IMPL_DEFAULT_CONSTRUCT;
-		Settings["value_assignment_to_references"] = (uint32_t)Features::DISALLOW_VALUE_ASSIGN_FOR_REF_TYPE;
-		Settings["named_args_mode"] = (uint32_t)Features::ALTER_SYNTAX_NAMED_ARGS;
-		Settings["integer_division_mode"] = (uint32_t)Features::DISABLE_INTEGER_DIVISION;
-		Settings["no_empty_list_elements"] = (uint32_t)Features::DISALLOW_EMPTY_LIST_ELEMENTS;
-		Settings["private_is_protected"] = (uint32_t)Features::PRIVATE_PROP_AS_PROTECTED;
-		Settings["heredoc_trim_mode"] = (uint32_t)Features::HEREDOC_TRIM_MODE;
-		Settings["generic_auto_handles_mode"] = (uint32_t)Features::GENERIC_CALL_MODE;
-		Settings["ignore_shared_interface_duplicates"] = (uint32_t)Features::IGNORE_DUPLICATE_SHARED_INTF;
-		Settings["ignore_debug_output"] = (uint32_t)Features::NO_DEBUG_OUTPUT;
-	}
-	void Environment::AddCommand(const std::string_view& Category, const std::string_view& Name, const std::string_view& Description, bool IsFlagOnly, const CommandCallback& Callback)
-	{
-		EnvironmentCommand Command;
-		Command.Arguments = Stringify::Split(Name, ',');
-		Command.Description = Description;
-		Command.Callback = Callback;
-
-		for (auto& Argument : Command.Arguments)
-		{
-			Stringify::Trim(Argument);
-			while (!Argument.empty() && Argument.front() == '-')
-				Argument.erase(Argument.begin());
-			if (IsFlagOnly)
-				Flags.insert(Argument);
-		}
-
-		auto& Target = Commands[String(Category)];
-		Target.push_back(std::move(Command));
-	}
-	ExitStatus Environment::ExecuteArgument(const UnorderedSet<String>& Names)
-	{
-		for (auto& Next : Env.Commandline.Args)
-		{
-			if (Names.find(Next.first) == Names.end())
-				continue;
-
-			auto* Command = FindArgument(Next.first);
-			if (!Command)
-				return ExitStatus::InvalidCommand;
-
-			int ExitCode = Command->Callback(Next.second);
-			if (ExitCode != (int)ExitStatus::Continue)
-				return (ExitStatus)ExitCode;
-		}
-
-		return ExitStatus::OK;
-	}
-	EnvironmentCommand* Environment::FindArgument(const std::string_view& Name)
-	{
-		for (auto& Category : Commands)
-		{
-			for (auto& Command : Category.second)
-			{
-				for (auto& Argument : Command.Arguments)
-				{
-					if (Argument == Name)
-						return &Command;
-				}
-			}
-		}
-
-		return nullptr;
-	}
-	ExpectsPreprocessor<IncludeType> Environment::ImportAddon(Preprocessor* Base, const IncludeResult& File, String& Output)
-	{
-		if (File.Module.empty() || File.Module.front() != '@')
-			return IncludeType::Unchanged;
-
-		if (!Control::Has(Config, AccessOption::Https))
-		{
-			VI_ERR("cannot import addon <%s> from remote repository: permission denied", File.Module.c_str());
-			return IncludeType::Error;
-		}
-
-		IncludeType Status;
-		if (!Builder::IsAddonTargetExists(Env, VM, File.Module))
-		{
-			if (!Config.Install)
-			{
-				VI_ERR("program requires <%s> addon: run installation with --install flag", File.Module.c_str());
-				Status = IncludeType::Error;
-			}
-			else if (Builder::CompileIntoAddon(Config, Env, VM, File.Module, Output) == StatusCode::OK)
-			{
-				Status = Output.empty() ? IncludeType::Virtual : IncludeType::Preprocess;
-				++Config.Installed;
-			}
-			else
-				Status = IncludeType::Error;
-		}
-		else if (Builder::ImportIntoAddon(Env, VM, File.Module, Output) == StatusCode::OK)
-			Status = Output.empty() ? IncludeType::Virtual : IncludeType::Preprocess;
-		else
-			Status = IncludeType::Error;
-		Env.Addons.insert(File.Module);
-		return Status;
-	}
-	void Environment::PrintIntroduction(const char* Label)
-	{
-		auto* Terminal = Console::Get();
-		auto* Lib = Vitex::Runtime::Get();
-		Terminal->Write("Welcome to ASX ");
-		Terminal->Write(Label);
-		Terminal->Write(" v");
-		Terminal->Write(ToString((uint32_t)Vitex::MAJOR_VERSION));
-		Terminal->Write(".");
-		Terminal->Write(ToString((uint32_t)Vitex::MINOR_VERSION));
-		Terminal->Write(".");
-		Terminal->Write(ToString((uint32_t)Vitex::PATCH_VERSION));
-		Terminal->Write(".");
-		Terminal->Write(ToString((uint32_t)Vitex::BUILD_VERSION));
-		Terminal->Write(" [");
-		Terminal->Write(Lib->GetCompiler());
-		Terminal->Write(" ");
-		Terminal->Write(Lib->GetBuild());
-		Terminal->Write(" on ");
-		Terminal->Write(Lib->GetPlatform());
-		Terminal->Write("]\n");
-		Terminal->Write("Run \"" + String(Config.Interactive ? ".help" : (Config.Debug ? "help" : "asx --help")) + "\" for more information");
-		if (Config.Interactive)
-			Terminal->Write(" (loaded " + ToString(VM->GetExposedAddons().size()) + " addons)");
-		Terminal->Write("\n");
-	}
-	void Environment::PrintHelp()
-	{
-		size_t Max = 0;
-		for (auto& Category : Commands)
-		{
-			for (auto& Next : Category.second)
-			{
-				size_t Size = 0;
-				for (auto& Argument : Next.Arguments)
-					Size += (Argument.size() > 1 ? 2 : 1) + Argument.size() + 2;
-				Size -= 2;
-				if (Size > Max)
-					Max = Size;
-			}
-		}
-
-		auto* Terminal = Console::Get();
-		Terminal->WriteLine("Usage: asx [options?...]");
-		Terminal->WriteLine("       asx [options?...] [file.as] [arguments?...]\n");
-		for (auto& Category : Commands)
-		{
-			String Name = Category.first;
-			Terminal->WriteLine("Category: " + Stringify::ToUpper(Name));
-			for (auto& Next : Category.second)
-			{
-				String Command;
-				for (auto& Argument : Next.Arguments)
-					Command += (Argument.size() > 1 ? "--" : "-") + Argument + ", ";
-
-				Command.erase(Command.size() - 2, 2);
-				size_t Spaces = Max - Command.size();
-				Terminal->Write("    ");
-				Terminal->Write(Command);
-				for (size_t i = 0; i < Spaces; i++)
-					Terminal->Write(" ");
-				Terminal->WriteLine(" - " + Next.Description);
-			}
-			Terminal->WriteChar('\n');
-		}
-	}
-	void Environment::PrintProperties()
-	{
-		auto* Terminal = Console::Get();
-		for (auto& Item : Settings)
-		{
-			size_t Value = VM->GetProperty((Features)Item.second);
-			Terminal->Write("  " + Item.first + ": ");
-			if (Stringify::EndsWith(Item.first, "mode"))
-				Terminal->Write("mode " + ToString(Value));
-			else if (Stringify::EndsWith(Item.first, "size"))
-				Terminal->Write((Value > 0 ? ToString(Value) : "unlimited"));
-			else if (Value == 0)
-				Terminal->Write("OFF");
-			else if (Value == 1)
-				Terminal->Write("ON");
-			else
-				Terminal->Write(ToString(Value));
-			Terminal->Write("\n");
-		}
-	}
-	void Environment::PrintDependencies()
-	{
-		auto* Terminal = Console::Get();
-		auto Exposes = VM->GetExposedAddons();
-		if (!Exposes.empty())
-		{
-			Terminal->WriteLine("  local dependencies list:");
-			for (auto& Item : Exposes)
-				Terminal->WriteLine("    " + Stringify::Replace(Item, ":", ": "));
-		}
-
-		if (!Env.Addons.empty())
-		{
-			Terminal->WriteLine("  remote dependencies list:");
-			for (auto& Item : Env.Addons)
-				Terminal->WriteLine("    " + Item + ": " + Builder::GetAddonTargetLibrary(Env, VM, Item, nullptr));
-		}
-	}
-	void Environment::ListenForSignals()
-	{
-		static Environment* Instance = this;
-		signal(SIGINT, [](int Value) { Instance->Interrupt(Value); });
-		signal(SIGTERM, [](int Value) { Instance->Shutdown(Value); });
-		signal(SIGFPE, [](int) { Instance->Abort("division by zero"); });
-		signal(SIGILL, [](int) { Instance->Abort("illegal instruction"); });
-		signal(SIGSEGV, [](int) { Instance->Abort("segmentation fault"); });
-#ifdef VI_UNIX
-		signal(SIGPIPE, SIG_IGN);
-		signal(SIGCHLD, SIG_IGN);
-#endif
-	}
-	void Environment::ExitProcess(ExitStatus Code)
-	{
-		if (Code != ExitStatus::RuntimeError)
-			OS::Process::Exit((int)Code);
-		else
-			OS::Process::Abort();
-	}
-}
-
-int main(int argc, char* argv[])
-{
-	auto* Instance = new ASX::Environment(argc, argv);
-	Vitex::HeavyRuntime Scope(Instance->GetInitFlags());
-	int ExitCode = Instance->Dispatch();
-	delete Instance;
-	return ExitCode;
-}
+#include "app.h"
+#include <signal.h>
+#ifdef VI_UNIX
+#include <sys/wait.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <dlfcn.h>
+#endif
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <sys/syscall.h>
+#endif
+#if defined(VI_UNIX) && defined(SO_REUSEPORT)
+#define APP_REUSE_PORTS
+
+static std::atomic<bool> ReusePorts(false);
+
+extern "C" int bind(int Fd, const struct sockaddr* Address, socklen_t AddressSize)
+{
+	typedef int(*BindCallback)(int, const struct sockaddr*, socklen_t);
+	static BindCallback Callback = (BindCallback)dlsym(RTLD_NEXT, "bind");
+	if (ReusePorts && Address != nullptr && (Address->sa_family == AF_INET || Address->sa_family == AF_INET6))
+	{
+		int Value = 1;
+		setsockopt(Fd, SOL_SOCKET, SO_REUSEPORT, &Value, sizeof(Value));
+	}
+
+	if (Callback != nullptr)
+		return Callback(Fd, Address, AddressSize);
+#ifdef SYS_bind
+	return (int)syscall(SYS_bind, Fd, Address, AddressSize);
+#else
+	errno = ENOSYS;
+	return -1;
+#endif
+}
+#endif
+
+namespace ASX
+{
+	static bool IsWatchGlobal(VirtualMachine* VM, int Type)
+	{
+		if (Type & (int)TypeId::OBJHANDLE)
+			return false;
+		else if (!(Type & (int)TypeId::MASK_OBJECT))
+			return Type != (int)TypeId::VOIDF;
+
+		return Type == VM->GetTypeInfoByName("string").GetTypeId();
+	}
+	static String GetWatchGlobalKey(const PropertyInfo& Info)
+	{
+		return String(Info.Namespace) + "::" + String(Info.Name) + ":" + ToString(Info.TypeId);
+	}
+	static String SaveGlobals(VirtualMachine* VM, Compiler* Unit)
+	{
+		Vector<PropertyInfo> Globals;
+		Module Base = Unit->GetModule();
+		for (size_t i = 0; i < Base.GetPropertiesCount(); i++)
+		{
+			PropertyInfo Info;
+			if (Base.GetProperty(i, &Info) && Info.Pointer != nullptr && !Info.IsConst && IsWatchGlobal(VM, Info.TypeId))
+				Globals.push_back(Info);
+		}
+
+		String State;
+		PackEncoder Encoder(State, PackFormat::MessagePack);
+		Encoder.BeginMap(Globals.size());
+		for (auto& Info : Globals)
+		{
+			Encoder.WriteString(GetWatchGlobalKey(Info));
+			Encoder.WriteAny(Info.Pointer, Info.TypeId);
+		}
+		return State;
+	}
+	static size_t RestoreGlobals(VirtualMachine* VM, Compiler* Unit, const std::string_view& State)
+	{
+		UPtr<Schema> Root = Pack::Decode(State, PackFormat::MessagePack);
+		if (!Root)
+			return 0;
+
+		size_t Count = 0;
+		Module Base = Unit->GetModule();
+		for (size_t i = 0; i < Base.GetPropertiesCount(); i++)
+		{
+			PropertyInfo Info;
+			if (!Base.GetProperty(i, &Info) || !Info.Pointer || Info.IsConst || !IsWatchGlobal(VM, Info.TypeId))
+				continue;
+
+			Schema* Value = Root->Get(GetWatchGlobalKey(Info));
+			if (!Value)
+				continue;
+
+			switch ((TypeId)Info.TypeId)
+			{
+				case TypeId::BOOL:
+					*(bool*)Info.Pointer = Value->Value.GetBoolean();
+					break;
+				case TypeId::INT8:
+				case TypeId::UINT8:
+					*(int8_t*)Info.Pointer = (int8_t)Value->Value.GetInteger();
+					break;
+				case TypeId::INT16:
+				case TypeId::UINT16:
+					*(int16_t*)Info.Pointer = (int16_t)Value->Value.GetInteger();
+					break;
+				case TypeId::INT64:
+				case TypeId::UINT64:
+					*(int64_t*)Info.Pointer = Value->Value.GetInteger();
+					break;
+				case TypeId::FLOAT:
+					*(float*)Info.Pointer = (float)Value->Value.GetNumber();
+					break;
+				case TypeId::DOUBLE:
+					*(double*)Info.Pointer = Value->Value.GetNumber();
+					break;
+				default:
+					if (Info.TypeId & (int)TypeId::MASK_OBJECT)
+						*(String*)Info.Pointer = Value->Value.GetBlob();
+					else
+						*(int32_t*)Info.Pointer = (int32_t)Value->Value.GetInteger();
+					break;
+			}
+			++Count;
+		}
+		return Count;
+	}
+	static void TraceStartup(SystemConfig& Config, const char* Stage, std::chrono::microseconds& Time)
+	{
+		auto Now = std::chrono::duration_cast<std::chrono::microseconds>(Schedule::GetClock());
+		if (Config.TraceStartup)
+			Console::Get()->WriteLine(Stringify::Text("startup %s: %.3f ms", Stage, (double)(Now - Time).count() / 1000.0));
+		Time = Now;
+	}
+#ifdef VI_UNIX
+	static bool WriteDescriptor(int Fd, const std::string_view& Data)
+	{
+		size_t Offset = 0;
+		while (Offset < Data.size())
+		{
+			ssize_t Size = write(Fd, Data.data() + Offset, Data.size() - Offset);
+			if (Size < 0 && errno == EINTR)
+				continue;
+			else if (Size <= 0)
+				return false;
+			Offset += (size_t)Size;
+		}
+		return true;
+	}
+	static bool ReadDescriptor(int Fd, String& Data, size_t Size)
+	{
+		size_t Offset = 0;
+		Data.resize(Size);
+		while (Offset < Size)
+		{
+			ssize_t Count = read(Fd, (char*)Data.data() + Offset, Size - Offset);
+			if (Count < 0 && errno == EINTR)
+				continue;
+			else if (Count <= 0)
+				return false;
+			Offset += (size_t)Count;
+		}
+		return true;
+	}
+	static bool ReadDescriptorLine(int Fd, String& Data)
+	{
+		Data.clear();
+		while (true)
+		{
+			char Next;
+			ssize_t Count = read(Fd, &Next, 1);
+			if (Count < 0 && errno == EINTR)
+				continue;
+			else if (Count <= 0)
+				return false;
+			else if (Next == '\n')
+				return true;
+			Data.push_back(Next);
+		}
+	}
+#endif
+
+	Environment::Environment(int ArgsCount, char** Args) : Loop(nullptr), VM(nullptr), Context(nullptr), Unit(nullptr), Allocator(nullptr)
+	{
+		AddDefaultCommands();
+		AddDefaultSettings();
+		ListenForSignals();
+		Env.Parse(ArgsCount, Args, Flags);
+		ErrorHandling::SetFlag(LogOption::ReportSysErrors, false);
+		ErrorHandling::SetFlag(LogOption::Active, true);
+		ErrorHandling::SetFlag(LogOption::Pretty, false);
+		Config.EssentialsOnly = !Env.Commandline.Has("game", "g");
+		Config.Install = Env.Commandline.Has("install", "i") || Env.Commandline.Has("target");
+
+		auto Type = Env.Commandline.Args.find("allocator");
+		if (Type != Env.Commandline.Args.end() && (Type->second == "threaded" || Type->second == "huge"))
+		{
+			auto* Base = ThreadAllocator::Get();
+			Base->SetHugePages(Type->second == "huge");
+			Allocator = Base;
+		}
+		else if (Type == Env.Commandline.Args.end() && Env.Commandline.Args.find("memory-limit") != Env.Commandline.Args.end())
+			Allocator = ThreadAllocator::Get();
+
+		if (Allocator != nullptr)
+			Runtime::GetMemoryBudget().Measure = &ThreadAllocator::GetLiveMemory;
+#ifndef NDEBUG
+		OS::Directory::SetWorking(OS::Directory::GetModule()->c_str());
+		Config.SaveSourceCode = true;
+#endif
+	}
+	Environment::~Environment()
+	{
+		Templates::Cleanup();
+		Manifests::Cleanup();
+		Modules::Cleanup();
+		if (Config.AllocatorStats && Allocator != nullptr)
+			ThreadAllocator::Get()->PrintStatistics();
+		if (Console::HasInstance())
+			Console::Get()->Detach();
+		Memory::Release(Context);
+		Memory::Release(Unit);
+		Memory::Release(VM);
+		Memory::Release(Loop);
+	}
+	int Environment::Dispatch()
+	{
+		auto* Terminal = Console::Get();
+		Terminal->Attach();
+
+		auto Startup = std::chrono::duration_cast<std::chrono::microseconds>(Schedule::GetClock());
+		VM = new VirtualMachine();
+		Bindings::HeavyRegistry().BindAddons(VM);
+		for (auto& Next : Env.Commandline.Args)
+		{
+			if (Next.first == "__path__")
+				continue;
+
+			auto* Command = FindArgument(Next.first);
+			if (!Command)
+			{
+				VI_ERR("command <%s> is not a valid operation", Next.first.c_str());
+				return (int)ExitStatus::InvalidCommand;
+			}
+
+			int ExitCode = Command->Callback(Next.second);
+			if (ExitCode != (int)ExitStatus::Continue)
+				return ExitCode;
+		}
+
+		if (!Env.Commandline.Params.empty())
+		{
+			String Directory = *OS::Directory::GetWorking();
+			auto File = OS::Path::Resolve(Env.Commandline.Params.front(), Directory, true);
+			if (!File || !OS::File::GetState(*File, &Env.File) || Env.File.IsDirectory)
+			{
+				File = OS::Path::Resolve(Env.Commandline.Params.front() + (Config.LoadByteCode ? ".as.gz" : ".as"), Directory, true);
+				if (File && OS::File::GetState(*File, &Env.File) && !Env.File.IsDirectory)
+					Env.Path = *File;
+			}
+			else
+				Env.Path = *File;
+
+			if (!Env.File.IsExists)
+			{
+				VI_ERR("path <%s> does not exist", Env.Commandline.Params.front().c_str());
+				return (int)ExitStatus::InputError;
+			}
+
+			Env.Registry = OS::Path::GetDirectory(Env.Path);
+			if (Env.Registry == Env.Path)
+			{
+				Env.Path = Directory + Env.Path;
+				Env.Registry = OS::Path::GetDirectory(Env.Path);
+			}
+
+			Env.Module = OS::Path::GetFilename(Env.Path).data();
+			Env.Program = *OS::File::ReadAsString(Env.Path);
+			Env.Registry += "addons";
+			Env.Registry += VI_SPLITTER;
+		}
+
+		if (Config.Check)
+		{
+			if (Env.Program.empty() || Config.Install || Config.Interactive || Config.LoadByteCode)
+			{
+				VI_ERR("check mode expects a script file to compile");
+				return (int)ExitStatus::InputError;
+			}
+		}
+		else if (Config.Cluster > 0)
+		{
+			if (Env.Program.empty() || Config.Install || Config.Interactive || Config.Debug)
+			{
+				VI_ERR("cluster mode expects a script file to execute");
+				return (int)ExitStatus::InputError;
+			}
+
+			int ExitCode = DispatchCluster();
+			if (ExitCode != (int)ExitStatus::Continue)
+				return ExitCode;
+		}
+		else if (Config.Watch)
+		{
+			if (Env.Program.empty() || Config.Install || Config.Interactive || Config.Debug || Config.LoadByteCode)
+			{
+				VI_ERR("watch mode expects a script file to execute");
+				return (int)ExitStatus::InputError;
+			}
+
+			int ExitCode = DispatchWatch();
+			if (ExitCode != (int)ExitStatus::Continue)
+				return ExitCode;
+		}
+
+		if (!Config.Interactive && Env.Addon.empty() && Env.Program.empty())
+		{
+			Config.Interactive = true;
+			if (Env.Commandline.Args.size() > 1)
+			{
+				VI_ERR("provide a path to existing script file");
+				return (int)ExitStatus::InputError;
+			}
+		}
+		else if (!Env.Addon.empty())
+		{
+			if (Builder::InitializeIntoAddon(Config, Env, VM, Builder::GetDefaultSettings()) != StatusCode::OK)
+				return (int)ExitStatus::CommandError;
+
+			Terminal->WriteLine("Initialized " + Env.Mode + " addon: " + Env.Addon);
+			return (int)ExitStatus::OK;
+		}
+
+		Unit = VM->CreateCompiler();
+		if (!Runtime::ConfigureContext(Config, Env, VM, Unit))
+			return (int)ExitStatus::CompilerError;
+
+		OS::Directory::SetWorking(OS::Path::GetDirectory(Env.Path.c_str()).c_str());
+		if (Config.Debug)
+		{
+			DebuggerContext* Debugger = new DebuggerContext();
+			Bindings::HeavyRegistry().BindStringifiers(Debugger);
+			Debugger->SetInterruptCallback([](bool IsInterrupted)
+			{
+				if (!Schedule::IsAvailable())
+					return;
+
+				auto* Queue = Schedule::Get();
+				if (IsInterrupted)
+					Queue->Suspend();
+				else
+					Queue->Resume();
+			});
+			VM->SetDebugger(Debugger);
+		}
+
+		Unit->SetIncludeCallback(std::bind(&Environment::ImportAddon, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+		TraceStartup(Config, "runtime", Startup);
+		auto Status = Unit->Prepare(Env.Module);
+		if (!Status)
+		{
+			VI_ERR("cannot prepare <%s> module scope\n  %s", Env.Module, Status.Error().what());
+			return (int)ExitStatus::PrepareError;
+		}
+
+		TraceStartup(Config, "prepare", Startup);
+
+		Runtime::PrepareMemoryLimit(Config);
+		Runtime::PrepareContexts(Config, VM);
+		Context = VM->RequestContext();
+		if (!Env.Program.empty())
+		{
+			String Image = Env.Path + SOURCES_IMAGE;
+			bool Lazy = Config.Lazy && !Config.Check && !Config.Debug && !Config.Watch && !Config.LoadByteCode;
+			if (Lazy && ProgramImage::Load(Config, Env, VM, Unit, Image))
+				TraceStartup(Config, "image", Startup);
+			else if (!Config.LoadByteCode)
+			{
+				String Cache = Env.Path + SOURCES_FILE;
+				Sources.SetVerbatim(Config.VerbatimIncludes);
+				Sources.SetProcessor(Unit->GetProcessor());
+				if (Config.VerbatimIncludes)
+					Sources.Load(Cache);
+
+				Sources.Prefetch(Env.Path, Env.Program);
+				Builder::PrefetchAddons(Env, Sources.GetAddons());
+
+				TraceStartup(Config, "discovery", Startup);
+				Status = Unit->LoadCode(Env.Path, Env.Program);
+				if (!Status)
+				{
+					VI_ERR("cannot load <%s> module script code\n  %s", Env.Module, Status.Error().what());
+					return (int)ExitStatus::LoadingError;
+				}
+
+				TraceStartup(Config, "preprocess", Startup);
+				if (Config.TraceStartup && Config.VerbatimIncludes)
+					Terminal->WriteLine("startup sources: " + ToString(Sources.GetHits()) + " cached, " + ToString(Sources.GetMisses()) + " scanned, " + ToString(Sources.GetVerbatims()) + " included verbatim");
+
+				Runtime::ConfigureSystem(Config);
+				Status = Unit->Compile().Get();
+				if (!Status)
+				{
+					VI_ERR("cannot compile <%s> module\n  %s", Env.Module, Status.Error().what());
+					return (int)ExitStatus::CompilerError;
+				}
+
+				TraceStartup(Config, "compile", Startup);
+				if (Config.VerbatimIncludes)
+					Sources.Save(Cache);
+				if (Lazy)
+					ProgramImage::Save(Config, Env, VM, Unit, Sources, Image);
+			}
+			else
+			{
+				ByteCodeInfo Info;
+				Info.Data.insert(Info.Data.begin(), Env.Program.begin(), Env.Program.end());
+
+				Runtime::ConfigureSystem(Config);
+				Status = Unit->LoadByteCode(&Info).Get();
+				if (!Status)
+				{
+					VI_ERR("cannot load <%s> module bytecode\n  %s", Env.Module, Status.Error().what());
+					return (int)ExitStatus::LoadingError;
+				}
+			}
+		}
+
+		if (Config.Check)
+		{
+			Terminal->WriteLine("Successfully compiled " + String(Env.Module) + ": no errors found");
+			return (int)ExitStatus::OK;
+		}
+		else if (Config.Install)
+		{
+			if (Config.Installed > 0)
+			{
+				Terminal->WriteLine("Successfully installed " + ToString(Config.Installed) + String(Config.Installed > 1 ? " addons" : " addon"));
+				return EXIT_SUCCESS;
+			}
+			else if (Env.Output.empty())
+				return Builder::PullAddonRepository(Config, Env) == StatusCode::OK ? (int)ExitStatus::OK : (int)ExitStatus::CommandError;
+
+			if (Builder::CompileIntoExecutable(Config, Env, VM, Builder::GetDefaultSettings()) != StatusCode::OK)
+				return (int)ExitStatus::CommandError;
+
+			Terminal->WriteLine("Built binaries directory: " + Env.Output + "bin");
+			return (int)ExitStatus::OK;
+		}
+		else if (Config.SaveByteCode)
+		{
+			ByteCodeInfo Info;
+			Info.Debug = Config.Debug;
+			if (Unit->SaveByteCode(&Info) && OS::File::Write(Env.Path + ".gz", (uint8_t*)Info.Data.data(), Info.Data.size()))
+				return (int)ExitStatus::OK;
+
+			VI_ERR("cannot save <%s> module bytecode", Env.Module);
+			return (int)ExitStatus::SavingError;
+		}
+		else if (Config.Dependencies)
+		{
+			PrintDependencies();
+			return (int)ExitStatus::OK;
+		}
+		else if (Config.Interactive)
+		{
+			if (Env.Path.empty())
+				Env.Path = *OS::Directory::GetWorking();
+
+			String Data, Multidata, Origin = Env.Path;
+			Data.reserve(1024 * 1024);
+			Env.Path += Env.Module;
+
+			InteractiveSession Session(VM, Unit, Env.Path);
+			if (Config.EssentialsOnly)
+			{
+				Session.Use("any");
+				Session.Use("uint256");
+				Session.Use("math");
+				Session.Use("random");
+				Session.Use("timestamp");
+				Session.Use("console");
+			}
+			else
+				Session.Use("*");
+			PrintIntroduction("interactive mode");
+
+			auto* Debugger = new DebuggerContext(DebugType::Detach);
+			Bindings::HeavyRegistry().BindStringifiers(Debugger);
+
+			char DefaultCode[] = "void main(){}";
+			bool Editor = false;
+			Debugger->SetEngine(VM);
+
+			Function Main = Runtime::GetEntrypoint(Env, Entrypoint, Unit, true);
+			if (Main.IsValid() && !Config.LoadByteCode)
+				Session.AddSection(Origin, Env.Program);
+			else
+			{
+				Status = Unit->LoadCode(Env.Path + ":0", DefaultCode);
+				if (!Status)
+				{
+					VI_ERR("cannot load default entrypoint for interactive mode\n  %s", Status.Error().what());
+					Memory::Release(Debugger);
+					return (int)ExitStatus::LoadingError;
+				}
+
+				Runtime::ConfigureSystem(Config);
+				Status = Unit->Compile().Get();
+				if (!Status)
+				{
+					VI_ERR("cannot compile default module for interactive mode\n  %s", Status.Error().what());
+					Memory::Release(Debugger);
+					return (int)ExitStatus::CompilerError;
+				}
+				Session.AddSection(Env.Path + ":0", DefaultCode);
+			}
+
+			for (;;)
+			{
+				if (!Editor)
+					Terminal->Write("> ");
+
+				if (!Terminal->ReadLine(Data, Data.capacity()))
+				{
+					if (!Editor)
+						break;
+
+				ExitEditor:
+					Editor = false;
+					Data = Multidata;
+					Multidata.clear();
+					goto Execute;
+				}
+				else if (Data.empty())
+					continue;
+
+				Stringify::Trim(Data);
+				if (Editor)
+				{
+					if (!Data.empty() && Data.back() == '\x4')
+					{
+						Data.erase(Data.end() - 1);
+						if (Env.Inline && !Data.empty() && Data.back() != ';')
+							Data += ';';
+
+						Multidata += Data;
+						goto ExitEditor;
+					}
+
+					if (Env.Inline && !Data.empty() && Data.back() != ';')
+						Data += ';';
+
+					Multidata += Data;
+					continue;
+				}
+				else if (Stringify::StartsWith(Data, ".help"))
+				{
+					Terminal->WriteLine("  .mode   - switch between registering and executing the code");
+					Terminal->WriteLine("  .help   - show available commands");
+					Terminal->WriteLine("  .editor - enter editor mode");
+					Terminal->WriteLine("  .exit   - exit interactive mode");
+					Terminal->WriteLine("  .use    - import system addons by name (comma separated list)");
+					Terminal->WriteLine("  *       - anything else will be interpreted as script code");
+					Terminal->WriteLine("  results of evaluation are kept in _ (last result) and _1, _2, ... variables");
+					continue;
+				}
+				else if (Stringify::StartsWith(Data, ".use"))
+				{
+					size_t Imports = 0;
+					auto Addons = Stringify::Split(Data.substr(4), ',');
+					for (auto& Addon : Addons)
+					{
+						Stringify::Trim(Addon);
+						if (!Session.Use(Addon.empty() ? "*" : Addon))
+							Terminal->WriteLine("  use: addon @" + Addon + " not found");
+						else
+							++Imports;
+					}
+					if (Imports > 0)
+						PrintIntroduction("interactive mode");
+					continue;
+				}
+				else if (Stringify::StartsWith(Data, ".mode"))
+				{
+					Env.Inline = !Env.Inline;
+					if (Env.Inline)
+						Terminal->WriteLine("  evaluation mode: you may now execute your code");
+					else
+						Terminal->WriteLine("  register mode: you may now register script interfaces");
+					continue;
+				}
+				else if (Stringify::StartsWith(Data, ".editor"))
+				{
+					Terminal->WriteLine("  editor mode: you may write multiple lines of code (Ctrl+D to finish)\n");
+					Editor = true;
+					continue;
+				}
+				else if (Data == ".exit")
+					break;
+
+			Execute:
+				if (Data.empty())
+					continue;
+
+				if (!Env.Inline)
+				{
+					Session.Declare(Data);
+					continue;
+				}
+
+				Function Inline = Session.Evaluate(Data);
+				if (!Inline.IsValid())
+					continue;
+
+				Bindings::Any* Value = nullptr;
+				auto Execution = Context->ExecuteCall(Inline, nullptr).Get();
+				if (Execution && *Execution == Execution::Finished)
+				{
+					String Indent = "  ";
+					Value = Context->GetReturnObject<Bindings::Any>();
+					size_t Index = Session.Keep(Value);
+					String Name = Index > 0 ? "_" + ToString(Index) + " = " : String();
+					Terminal->WriteLine(Indent + Name + Debugger->ToString(Indent, 3, Value, VM->GetTypeInfoByName("any").GetTypeId()));
+				}
+				else
+					Context->Abort();
+				Context->Unprepare();
+			}
+
+			Memory::Release(Debugger);
+			ExitProcess(ExitStatus::OK);
+			return (int)ExitStatus::OK;
+		}
+
+		Function Main = Runtime::GetEntrypoint(Env, Entrypoint, Unit);
+		if (!Main.IsValid())
+			return (int)ExitStatus::EntrypointError;
+		else if (Watch.Output >= 0 && !EnterWatch())
+			return (int)ExitStatus::OK;
+
+		if (Config.Debug)
+			PrintIntroduction("debugger");
+
+		int ExitCode = 0;
+		TypeInfo Type = VM->GetTypeInfoByDecl("array<string>@");
+		Bindings::Array* ArgsArray = Type.IsValid() ? Bindings::Array::Compose<String>(Type.GetTypeInfo(), Env.Commandline.Params) : nullptr;
+		VM->SetExceptionCallback([](ImmediateContext* Context)
+		{
+			if (!Context->WillExceptionBeCaught())
+				ExitProcess(ExitStatus::RuntimeError);
+		});
+
+		Main.AddRef();
+		Loop = new EventLoop();
+		Loop->Listen(Context);
+		Loop->Enqueue(FunctionDelegate(Main, Context), [&Main, ArgsArray](ImmediateContext* Context)
+		{
+			Runtime::StartupEnvironment(EnvironmentConfig::Get());
+			if (Main.GetArgsCount() > 0)
+				Context->SetArgObject(0, ArgsArray);
+		}, [this, &ExitCode, &Type, &Main, ArgsArray](ImmediateContext* Context)
+		{
+			ExitCode = Main.GetReturnTypeId() == (int)TypeId::VOIDF ? 0 : (int)Context->GetReturnDWord();
+			if (ArgsArray != nullptr)
+				Context->GetVM()->ReleaseObject(ArgsArray, Type);
+			Runtime::ShutdownEnvironment(EnvironmentConfig::Get());
+			Loop->Wakeup();
+		});
+
+		Runtime::AwaitContext(Config, Mutex, Loop, VM, Context);
+		if (Watch.Output >= 0)
+			LeaveWatch();
+		return ExitCode;
+	}
+	void Environment::Shutdown(int Value)
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		{
+			if (Runtime::TryContextExit(Env, Value))
+			{
+				Loop->Wakeup();
+				VI_DEBUG("graceful shutdown using [signal vcall]");
+				goto GracefulShutdown;
+			}
+
+			auto* App = Application::Get();
+			if (App != nullptr && App->GetState() == ApplicationState::Active)
+			{
+				App->Stop();
+				Loop->Wakeup();
+				VI_DEBUG("graceful shutdown using [application stop]");
+				goto GracefulShutdown;
+			}
+
+			if (Schedule::IsAvailable())
+			{
+				Schedule::Get()->Stop();
+				Loop->Wakeup();
+				VI_DEBUG("graceful shutdown using [scheduler stop]");
+				goto GracefulShutdown;
+			}
+
+			VI_DEBUG("forcing shutdown using [kill]");
+			return ExitProcess(ExitStatus::Kill);
+		}
+	GracefulShutdown:
+		ListenForSignals();
+	}
+	void Environment::Interrupt(int Value)
+	{
+		if (Config.Debug && VM->GetDebugger() && VM->GetDebugger()->Interrupt())
+			ListenForSignals();
+		else
+			Shutdown(Value);
+	}
+	void Environment::Abort(const char* Signal)
+	{
+		VI_PANIC(false, "%s which is a critical runtime error", Signal);
+	}
+	size_t Environment::GetInitFlags()
+	{
+		size_t LibraryLayer = Vitex::LOAD_NETWORKING | Vitex::LOAD_CRYPTOGRAPHY | Vitex::LOAD_LOCALE;
+		size_t ApplicationLayer = LibraryLayer | Vitex::LOAD_PROVIDERS;
+		size_t GameLayer = ApplicationLayer | Vitex::LOAD_PLATFORM | Vitex::LOAD_AUDIO | Vitex::LOAD_GRAPHICS;
+		if (Config.Install)
+			return LibraryLayer;
+
+		if (Config.EssentialsOnly)
+			return ApplicationLayer;
+
+		return GameLayer;
+	}
+	GlobalAllocator* Environment::GetAllocator()
+	{
+		return Allocator;
+	}
+	void Environment::AddDefaultCommands()
+	{
+		AddCommand("application", "-h, --help", "show help message", true, [this](const std::string_view&)
+		{
+			PrintHelp();
+			return (int)ExitStatus::OK;
+		});
+		AddCommand("application", "-v, --version", "show version message", true, [this](const std::string_view&)
+		{
+			PrintIntroduction("runtime");
+			return (int)ExitStatus::OK;
+		});
+		AddCommand("application", "--plain", "show detailed log messages as is", true, [this](const std::string_view&)
+		{
+			Config.PrettyProgress = false;
+			ErrorHandling::SetFlag(LogOption::Pretty, false);
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("application", "--quiet", "disable logging", true, [](const std::string_view&)
+		{
+			ErrorHandling::SetFlag(LogOption::Active, false);
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("application", "--timings", "append date for each logging message", true, [](const std::string_view&)
+		{
+			ErrorHandling::SetFlag(LogOption::Dated, true);
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "-b, --bytecode", "load gz compressed compiled bytecode and execute it as normal", true, [this](const std::string_view&)
+		{
+			Config.LoadByteCode = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "-s, --save", "save gz compressed compiled bytecode to a file near script file", true, [this](const std::string_view&)
+		{
+			Config.SaveByteCode = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "-I, --interactive", "run only in interactive mode", true, [this](const std::string_view&)
+		{
+			Config.Interactive = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "-d, --debug", "enable debugger interface", true, [this](const std::string_view&)
+		{
+			Config.Debug = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "-g, --game", "enable game engine mode for graphics and audio support", true, [this](const std::string_view&)
+		{
+			Config.EssentialsOnly = false;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "-p, --preserve", "enable in memory source code preservation for better exception messages", true, [this](const std::string_view&)
+		{
+			Config.SaveSourceCode = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "--contexts", "preallocate reusable execution contexts [expects: count]", false, [this](const std::string_view& Value)
+		{
+			auto Count = FromString<uint64_t>(Value);
+			if (!Count)
+			{
+				VI_ERR("invalid execution contexts count <%s>", Value.data());
+				return (int)ExitStatus::InputError;
+			}
+
+			Config.Contexts = (size_t)*Count;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "--memory-limit", "limit live heap memory of the process, exceeding it throws a script exception [expects: bytes with optional K, M or G suffix]", false, [this](const std::string_view& Value)
+		{
+			size_t Multiplier = 1;
+			String Number = String(Value);
+			if (!Number.empty())
+			{
+				switch (Number.back())
+				{
+					case 'K':
+					case 'k':
+						Multiplier = 1024;
+						break;
+					case 'M':
+					case 'm':
+						Multiplier = 1024 * 1024;
+						break;
+					case 'G':
+					case 'g':
+						Multiplier = 1024 * 1024 * 1024;
+						break;
+					default:
+						break;
+				}
+				if (Multiplier > 1)
+					Number.pop_back();
+			}
+
+			auto Limit = FromString<uint64_t>(Number);
+			if (!Limit || !*Limit)
+			{
+				VI_ERR("invalid memory limit <%s>", Value.data());
+				return (int)ExitStatus::InputError;
+			}
+			if (!Vitex::HeavyRuntime::Get()->HasFtAllocator())
+			{
+				Runtime::GetMemoryBudget().Measure = nullptr;
+#ifndef __linux__
+				VI_WARN("memory limit is ignored: runtime was built without allocator feature and resident memory cannot be measured on this platform");
+#else
+				VI_WARN("memory limit falls back to resident memory and only triggers garbage collection: runtime was built without allocator feature");
+#endif
+			}
+			Config.MemoryLimit = (size_t)*Limit * Multiplier;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "--incremental-gc", "run bounded incremental garbage collection steps after every event loop turn and full cycles rarely", true, [this](const std::string_view&)
+		{
+			Config.IncrementalGC = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "--cluster", "run a supervising process with forked workers of the script [expects: count]", false, [this](const std::string_view& Value)
+		{
+#ifdef VI_UNIX
+			auto Count = FromString<uint64_t>(Value);
+			if (!Count || !*Count)
+			{
+				VI_ERR("invalid cluster workers count <%s>", Value.data());
+				return (int)ExitStatus::InputError;
+			}
+
+			Config.Cluster = (size_t)*Count;
+			return (int)ExitStatus::Continue;
+#else
+			VI_ERR("cluster mode is not supported on this platform");
+			return (int)ExitStatus::InvalidCommand;
+#endif
+		});
+		AddCommand("execution", "--watch", "restart the script in place when its source files or addons change, keeping plain global variables", true, [this](const std::string_view&)
+		{
+#ifdef VI_UNIX
+			Config.Watch = true;
+			return (int)ExitStatus::Continue;
+#else
+			VI_ERR("watch mode is not supported on this platform");
+			return (int)ExitStatus::InvalidCommand;
+#endif
+		});
+		AddCommand("execution", "--allocator", "select memory allocator used by runtime [expects: system|threaded|huge]", false, [](const std::string_view& Value)
+		{
+			if (Value != "system" && Value != "threaded" && Value != "huge")
+			{
+				VI_ERR("invalid allocator type <%s>", Value.data());
+				return (int)ExitStatus::InputError;
+			}
+
+			if (Value != "system" && !Vitex::HeavyRuntime::Get()->HasFtAllocator())
+				VI_WARN("allocator type <%s> is ignored: runtime was built without allocator feature", Value.data());
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "--allocator-stats", "print per size class allocator statistics on exit", true, [this](const std::string_view&)
+		{
+			Config.AllocatorStats = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "--lazy", "compile the script only when its sources change, otherwise load compiled image saved near script file", true, [this](const std::string_view&)
+		{
+			Config.Lazy = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "--check", "compile the script and report errors without executing it", true, [this](const std::string_view&)
+		{
+			Config.Check = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "--verbatim-includes", "insert included files that use no directives, imports or macros as is, skipping the preprocessor", true, [this](const std::string_view&)
+		{
+			Config.VerbatimIncludes = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "--trace-startup", "print time spent in each startup stage and preprocessor cache usage", true, [this](const std::string_view&)
+		{
+			Config.TraceStartup = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "-D, --deny", "deny permissions by name [expects: plus(+) separated list]", false, [this](const std::string_view& Value)
+		{
+			for (auto& Item : Stringify::Split(Value, '+'))
+			{
+				auto Option = OS::Control::ToOption(Item);
+				if (!Option)
+				{
+					VI_ERR("os access control option not found: %s (options = %s)", Item.c_str(), OS::Control::ToOptions());
+					return (int)ExitStatus::InputError;
+				}
+
+				Config.Permissions[*Option] = false;
+			}
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("execution", "-A, --allow", "allow permissions by name [expects: plus(+) separated list]", false, [this](const std::string_view& Value)
+		{
+			for (auto& Item : Stringify::Split(Value, '+'))
+			{
+				auto Option = OS::Control::ToOption(Item);
+				if (!Option)
+				{
+					VI_ERR("os access control option not found: %s (options = %s)", Item.c_str(), OS::Control::ToOptions());
+					return (int)ExitStatus::InputError;
+				}
+
+				Config.Permissions[*Option] = true;
+			}
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("building", "--target", "set a CMake name for output target [expects: name]", false, [this](const std::string_view& Name)
+		{
+			Env.Name = Name;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("building", "--output", "directory where to build an executable from source code [expects: path]", false, [this](const std::string_view& Path)
+		{
+			FileEntry File;
+			if (Path != ".")
+			{
+				auto Target = OS::Path::Resolve(Path, *OS::Directory::GetWorking(), true);
+				if (Target)
+					Env.Output = *Target;
+			}
+			else
+				Env.Output = *OS::Directory::GetWorking();
+
+			if (!Env.Output.empty() && (Env.Output.back() == '/' || Env.Output.back() == '\\'))
+				Env.Output.erase(Env.Output.end() - 1);
+
+			if (ExecuteArgument({ "target" }) == ExitStatus::InvalidCommand || Env.Name.empty())
+			{
+				Env.Name = OS::Path::GetFilename(Env.Output.c_str());
+				if (Env.Name.empty())
+				{
+					VI_ERR("init directory is set but name was not specified: use --target");
+					return (int)ExitStatus::InputError;
+				}
+			}
+
+			Env.Output += VI_SPLITTER + Env.Name + VI_SPLITTER;
+			if (!OS::File::GetState(Env.Output, &File))
+			{
+				OS::Directory::Patch(Env.Output);
+				return (int)ExitStatus::Continue;
+			}
+
+			if (File.IsDirectory)
+				return (int)ExitStatus::Continue;
+
+			VI_ERR("output path <%s> must be a directory", Path.data());
+			return (int)ExitStatus::InputError;
+		});
+		AddCommand("building", "--shake", "embed only script functions and imported system addons reachable from entrypoint or named by string constants", true, [this](const std::string_view&)
+		{
+			Config.Shake = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("building", "--import-std", "import standard addon(s) by name [expects: plus(+) separated list]", false, [this](const std::string_view& Value)
+		{
+			for (auto& Item : Stringify::Split(Value, '+'))
+				Config.SystemAddons.push_back(Item);
+
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("building", "--import-user", "import user addon(s) by path [expects: plus(+) separated list]", false, [this](const std::string_view& Value)
+		{
+			for (auto& Item : Stringify::Split(Value, '+'))
+				Config.Libraries.emplace_back(std::make_pair(Item, true));
+
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("building", "--import-lib", "import clibrary(ies) by path [expects: plus(+) separated list]", false, [this](const std::string_view& Value)
+		{
+			for (auto& Item : Stringify::Split(Value, '+'))
+				Config.Libraries.emplace_back(std::make_pair(Item, false));
+
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("building", "--import-func", "import clibrary function by declaration [expects: clib_name:cfunc_name=asfunc_decl]", false, [this](const std::string_view& Value)
+		{
+			size_t Offset1 = Value.find(':');
+			if (Offset1 == std::string::npos)
+			{
+				VI_ERR("invalid clibrary cfunction declaration <%s>", Value.data());
+				return (int)ExitStatus::InvalidDeclaration;
+			}
+
+			size_t Offset2 = Value.find('=', Offset1);
+			if (Offset2 == std::string::npos)
+			{
+				VI_ERR("invalid clibrary cfunction declaration <%s>", Value.data());
+				return (int)ExitStatus::InvalidDeclaration;
+			}
+
+			String CLibraryName = String(Value.substr(0, Offset1));
+			Stringify::Trim(CLibraryName);
+
+			String CFunctionName = String(Value.substr(Offset1 + 1, Offset2 - Offset1 - 1));
+			Stringify::Trim(CLibraryName);
+
+			String Declaration = String(Value.substr(Offset2 + 1));
+			Stringify::Trim(CLibraryName);
+
+			if (CLibraryName.empty() || CFunctionName.empty() || Declaration.empty())
+			{
+				VI_ERR("invalid clibrary cfunction declaration <%s>", Value.data());
+				return (int)ExitStatus::InvalidDeclaration;
+			}
+
+			auto& Data = Config.Functions[CLibraryName];
+			Data.first = CFunctionName;
+			Data.second = Declaration;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("building", "--prop", "set virtual machine property [expects: prop_name:prop_value]", false, [this](const std::string_view& Value)
+		{
+			auto Args = Stringify::Split(Value, ':');
+			if (Args.size() != 2)
+			{
+				VI_ERR("invalid property declaration <%s>", Value.data());
+				return (int)ExitStatus::InputError;
+			}
+
+			auto It = Settings.find(Stringify::Trim(Args[0]));
+			if (It == Settings.end())
+			{
+				VI_ERR("invalid property name <%s>", Args[0].c_str());
+				return (int)ExitStatus::InputError;
+			}
+
+			String& Data = Args[1];
+			Stringify::Trim(Data);
+			Stringify::ToLower(Data);
+
+			if (Data.empty())
+			{
+			InputFailure:
+				VI_ERR("property value <%s>: %s", Args[0].c_str(), Args[1].empty() ? "?" : Args[1].c_str());
+				return (int)ExitStatus::InputError;
+			}
+			else if (!Stringify::HasInteger(Data))
+			{
+				if (Args[1] == "on" || Args[1] == "true")
+					VM->SetProperty((Features)It->second, 1);
+				else if (Args[1] == "off" || Args[1] == "false")
+					VM->SetProperty((Features)It->second, 1);
+				else
+					goto InputFailure;
+			}
+
+			VM->SetProperty((Features)It->second, (size_t)*FromString<uint64_t>(Data));
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("building", "--props", "show virtual machine properties message", true, [this](const std::string_view&)
+		{
+			PrintProperties();
+			return (int)ExitStatus::OK;
+		});
+		AddCommand("addons", "-a, --addon", "initialize an addon in given directory [expects: [native|vm]:?relpath]", false, [this](const std::string_view& Value)
+		{
+			String Path = String(Value);
+			size_t Where = Value.find(':');
+			if (Where != std::string::npos)
+			{
+				Path = Path.substr(Where + 1);
+				if (Path.empty())
+				{
+					VI_ERR("addon initialization expects <mode:path> format: path must not be empty");
+					return (int)ExitStatus::InputError;
+				}
+
+				Env.Mode = Value.substr(0, Where);
+				if (Env.Mode != "native" && Env.Mode != "vm")
+				{
+					VI_ERR("addon initialization expects <mode:path> format: mode <%s> is invalid, [native|vm] expected", Env.Mode.c_str());
+					return (int)ExitStatus::InputError;
+				}
+			}
+			else
+				Env.Mode = "vm";
+
+			FileEntry File;
+			if (Path != ".")
+			{
+				auto Target = OS::Path::Resolve(Path, *OS::Directory::GetWorking(), true);
+				if (Target)
+					Env.Addon = *Target;
+			}
+			else
+				Env.Addon = *OS::Directory::GetWorking();
+
+			if (!Env.Addon.empty() && (Env.Addon.back() == '/' || Env.Addon.back() == '\\'))
+				Env.Addon.erase(Env.Addon.end() - 1);
+
+			if (ExecuteArgument({ "target" }) == ExitStatus::InvalidCommand || Env.Name.empty())
+			{
+				Env.Name = OS::Path::GetFilename(Env.Addon.c_str());
+				if (Env.Name.empty())
+				{
+					VI_ERR("init directory is set but name was not specified: use --target");
+					return (int)ExitStatus::InputError;
+				}
+			}
+
+			Env.Addon += VI_SPLITTER + Env.Name + VI_SPLITTER;
+			if (!OS::File::GetState(Env.Addon, &File))
+			{
+				OS::Directory::Patch(Env.Addon);
+				return (int)ExitStatus::Continue;
+			}
+
+			if (File.IsDirectory)
+				return (int)ExitStatus::Continue;
+
+			VI_ERR("addon path <%s> must be a directory", Path.c_str());
+			return (int)ExitStatus::InputError;
+		});
+		AddCommand("addons", "-i, --install", "install or update script dependencies", true, [this](const std::string_view& Value)
+		{
+			Config.Install = true;
+			return (int)ExitStatus::Continue;
+		});
+		AddCommand("addons", "--deps", "install and show dependencies message", true, [this](const std::string_view&)
+		{
+			Config.Dependencies = true;
+			return (int)ExitStatus::Continue;
+		});
+	}
+	void Environment::AddDefaultSettings()
+	{
+		Settings["default_stack_size"] = (uint32_t)Features::INIT_STACK_SIZE;
+		Settings["default_callstack_size"] = (uint32_t)Features::INIT_CALL_STACK_SIZE;
+		Settings["callstack_size"] = (uint32_t)Features::MAX_CALL_STACK_SIZE;
+		Settings["stack_size"] = (uint32_t)Features::MAX_STACK_SIZE;
+		Settings["string_encoding"] = (uint32_t)Features::STRING_ENCODING;
+		Settings["script_encoding_utf8"] = (uint32_t)Features::SCRIPT_SCANNER;
+		Settings["no_globals"] = (uint32_t)Features::DISALLOW_GLOBAL_VARS;
+		Settings["warnings"] = (uint32_t)Features::COMPILER_WARNINGS;
+		Settings["unicode"] = (uint32_t)Features::ALLOW_UNICODE_IDENTIFIERS;
+		Settings["nested_calls"] = (uint32_t)Features::MAX_NESTED_CALLS;
+		Settings["unsafe_references"] = (uint32_t)Features::ALLOW_UNSAFE_REFERENCES;
+		Settings["optimized_bytecode"] = (uint32_t)Features::OPTIMIZE_BYTECODE;
+		Settings["copy_scripts"] = (uint32_t)Features::COPY_SCRIPT_SECTIONS;
+		Settings["character_literals"] = (uint32_t)Features::USE_CHARACTER_LITERALS;
+		Settings["multiline_strings"] = (uint32_t)Features::ALLOW_MULTILINE_STRINGS;
+		Settings["implicit_handles"] = (uint32_t)Features::ALLOW_IMPLICIT_HANDLE_TYPES;
+		Settings["suspends"] = (uint32_t)Features::BUILD_WITHOUT_LINE_CUES;
+		Settings["init_globals"] = (uint32_t)Features::INIT_GLOBAL_VARS_AFTER_BUILD;
+		Settings["require_enum_scope"] = (uint32_t)Features::REQUIRE_ENUM_SCOPE;
+		Settings["jit_instructions"] = (uint32_t)Features::INCLUDE_JIT_INSTRUCTIONS;
+		Settings["accessor_mode"] = (uint32_t)Features::PROPERTY_ACCESSOR_MODE;
+		Settings["array_template_message"] = (uint32_t)Features::EXPAND_DEF_ARRAY_TO_TMPL;
+		Settings["automatic_gc"] = (uint32_t)Features::AUTO_GARBAGE_COLLECT;
+		Settings["automatic_constructors"] = (uint32_t)Features::ALWAYS_IMPL_DEFAULT_CONSTRUCT;
+		Settings["value_assignment_to_references"] = (uint32_t)Features::DISALLOW_VALUE_ASSIGN_FOR_REF_TYPE;
+		Settings["named_args_mode"] = (uint32_t)Features::ALTER_SYNTAX_NAMED_ARGS;
+		Settings["integer_division_mode"] = (uint32_t)Features::DISABLE_INTEGER_DIVISION;
+		Settings["no_empty_list_elements"] = (uint32_t)Features::DISALLOW_EMPTY_LIST_ELEMENTS;
+		Settings["private_is_protected"] = (uint32_t)Features::PRIVATE_PROP_AS_PROTECTED;
+		Settings["heredoc_trim_mode"] = (uint32_t)Features::HEREDOC_TRIM_MODE;
+		Settings["generic_auto_handles_mode"] = (uint32_t)Features::GENERIC_CALL_MODE;
+		Settings["ignore_shared_interface_duplicates"] = (uint32_t)Features::IGNORE_DUPLICATE_SHARED_INTF;
+		Settings["ignore_debug_output"] = (uint32_t)Features::NO_DEBUG_OUTPUT;
+	}
+	void Environment::AddCommand(const std::string_view& Category, const std::string_view& Name, const std::string_view& Description, bool IsFlagOnly, const CommandCallback& Callback)
+	{
+		EnvironmentCommand Command;
+		Command.Arguments = Stringify::Split(Name, ',');
+		Command.Description = Description;
+		Command.Callback = Callback;
+
+		for (auto& Argument : Command.Arguments)
+		{
+			Stringify::Trim(Argument);
+			while (!Argument.empty() && Argument.front() == '-')
+				Argument.erase(Argument.begin());
+			if (IsFlagOnly)
+				Flags.insert(Argument);
+		}
+
+		auto& Target = Commands[String(Category)];
+		Target.push_back(std::move(Command));
+	}
+	ExitStatus Environment::ExecuteArgument(const UnorderedSet<String>& Names)
+	{
+		for (auto& Next : Env.Commandline.Args)
+		{
+			if (Names.find(Next.first) == Names.end())
+				continue;
+
+			auto* Command = FindArgument(Next.first);
+			if (!Command)
+				return ExitStatus::InvalidCommand;
+
+			int ExitCode = Command->Callback(Next.second);
+			if (ExitCode != (int)ExitStatus::Continue)
+				return (ExitStatus)ExitCode;
+		}
+
+		return ExitStatus::OK;
+	}
+	EnvironmentCommand* Environment::FindArgument(const std::string_view& Name)
+	{
+		for (auto& Category : Commands)
+		{
+			for (auto& Command : Category.second)
+			{
+				for (auto& Argument : Command.Arguments)
+				{
+					if (Argument == Name)
+						return &Command;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+	ExpectsPreprocessor<IncludeType> Environment::ImportAddon(Preprocessor* Base, const IncludeResult& File, String& Output)
+	{
+		if (File.Module.empty() || File.Module.front() != '@')
+		{
+			if (!File.IsFile)
+				return IncludeType::Unchanged;
+
+			if (Config.Watch)
+				Watch.Files.insert(File.Module);
+			return Sources.Resolve(File.Module, Output);
+		}
+
+		if (!Control::Has(Config, AccessOption::Https))
+		{
+			VI_ERR("cannot import addon <%s> from remote repository: permission denied", File.Module.c_str());
+			return IncludeType::Error;
+		}
+
+		IncludeType Status;
+		if (!Builder::IsAddonTargetExists(Env, VM, File.Module))
+		{
+			if (!Config.Install)
+			{
+				VI_ERR("program requires <%s> addon: run installation with --install flag", File.Module.c_str());
+				Status = IncludeType::Error;
+			}
+			else if (Builder::CompileIntoAddon(Config, Env, VM, File.Module, Output) == StatusCode::OK)
+			{
+				Status = Output.empty() ? IncludeType::Virtual : IncludeType::Preprocess;
+				++Config.Installed;
+			}
+			else
+				Status = IncludeType::Error;
+		}
+		else if (Builder::ImportIntoAddon(Env, VM, File.Module, Output) == StatusCode::OK)
+			Status = Output.empty() ? IncludeType::Virtual : IncludeType::Preprocess;
+		else
+			Status = IncludeType::Error;
+		if (Status == IncludeType::Preprocess)
+			Sources.AddSource(Output);
+		Env.Addons.insert(File.Module);
+		if (Config.Watch)
+		{
+			for (auto& Path : Builder::GetAddonFiles(Env, File.Module))
+				Watch.Files.insert(Path);
+		}
+		return Status;
+	}
+	void Environment::PrintIntroduction(const char* Label)
+	{
+		auto* Terminal = Console::Get();
+		auto* Lib = Vitex::Runtime::Get();
+		Terminal->Write("Welcome to ASX ");
+		Terminal->Write(Label);
+		Terminal->Write(" v");
+		Terminal->Write(ToString((uint32_t)Vitex::MAJOR_VERSION));
+		Terminal->Write(".");
+		Terminal->Write(ToString((uint32_t)Vitex::MINOR_VERSION));
+		Terminal->Write(".");
+		Terminal->Write(ToString((uint32_t)Vitex::PATCH_VERSION));
+		Terminal->Write(".");
+		Terminal->Write(ToString((uint32_t)Vitex::BUILD_VERSION));
+		Terminal->Write(" [");
+		Terminal->Write(Lib->GetCompiler());
+		Terminal->Write(" ");
+		Terminal->Write(Lib->GetBuild());
+		Terminal->Write(" on ");
+		Terminal->Write(Lib->GetPlatform());
+		Terminal->Write("]\n");
+		Terminal->Write("Run \"" + String(Config.Interactive ? ".help" : (Config.Debug ? "help" : "asx --help")) + "\" for more information");
+		if (Config.Interactive)
+			Terminal->Write(" (loaded " + ToString(VM->GetExposedAddons().size()) + " addons)");
+		Terminal->Write("\n");
+	}
+	void Environment::PrintHelp()
+	{
+		size_t Max = 0;
+		for (auto& Category : Commands)
+		{
+			for (auto& Next : Category.second)
+			{
+				size_t Size = 0;
+				for (auto& Argument : Next.Arguments)
+					Size += (Argument.size() > 1 ? 2 : 1) + Argument.size() + 2;
+				Size -= 2;
+				if (Size > Max)
+					Max = Size;
+			}
+		}
+
+		auto* Terminal = Console::Get();
+		Terminal->WriteLine("Usage: asx [options?...]");
+		Terminal->WriteLine("       asx [options?...] [file.as] [arguments?...]\n");
+		for (auto& Category : Commands)
+		{
+			String Name = Category.first;
+			Terminal->WriteLine("Category: " + Stringify::ToUpper(Name));
+			for (auto& Next : Category.second)
+			{
+				String Command;
+				for (auto& Argument : Next.Arguments)
+					Command += (Argument.size() > 1 ? "--" : "-") + Argument + ", ";
+
+				Command.erase(Command.size() - 2, 2);
+				size_t Spaces = Max - Command.size();
+				Terminal->Write("    ");
+				Terminal->Write(Command);
+				for (size_t i = 0; i < Spaces; i++)
+					Terminal->Write(" ");
+				Terminal->WriteLine(" - " + Next.Description);
+			}
+			Terminal->WriteChar('\n');
+		}
+	}
+	void Environment::PrintProperties()
+	{
+		auto* Terminal = Console::Get();
+		for (auto& Item : Settings)
+		{
+			size_t Value = VM->GetProperty((Features)Item.second);
+			Terminal->Write("  " + Item.first + ": ");
+			if (Stringify::EndsWith(Item.first, "mode"))
+				Terminal->Write("mode " + ToString(Value));
+			else if (Stringify::EndsWith(Item.first, "size"))
+				Terminal->Write((Value > 0 ? ToString(Value) : "unlimited"));
+			else if (Value == 0)
+				Terminal->Write("OFF");
+			else if (Value == 1)
+				Terminal->Write("ON");
+			else
+				Terminal->Write(ToString(Value));
+			Terminal->Write("\n");
+		}
+	}
+	void Environment::PrintDependencies()
+	{
+		auto* Terminal = Console::Get();
+		auto Exposes = VM->GetExposedAddons();
+		if (!Exposes.empty())
+		{
+			Terminal->WriteLine("  local dependencies list:");
+			for (auto& Item : Exposes)
+				Terminal->WriteLine("    " + Stringify::Replace(Item, ":", ": "));
+		}
+
+		if (!Env.Addons.empty())
+		{
+			Terminal->WriteLine("  remote dependencies list:");
+			for (auto& Item : Env.Addons)
+				Terminal->WriteLine("    " + Item + ": " + Builder::GetAddonTargetLibrary(Env, VM, Item, nullptr));
+		}
+	}
+	void Environment::ListenForSignals()
+	{
+		static Environment* Instance = this;
+		signal(SIGINT, [](int Value) { Instance->Interrupt(Value); });
+		signal(SIGTERM, [](int Value) { Instance->Shutdown(Value); });
+		signal(SIGFPE, [](int) { Instance->Abort("division by zero"); });
+		signal(SIGILL, [](int) { Instance->Abort("illegal instruction"); });
+		signal(SIGSEGV, [](int) { Instance->Abort("segmentation fault"); });
+#ifdef VI_UNIX
+		signal(SIGPIPE, SIG_IGN);
+		signal(SIGCHLD, SIG_IGN);
+#endif
+	}
+	int Environment::DispatchCluster()
+	{
+#ifdef VI_UNIX
+		struct ClusterWorker
+		{
+			std::chrono::microseconds Started;
+			bool Retiring = false;
+		};
+
+		static volatile sig_atomic_t Stopping = 0, Restarting = 0;
+		struct sigaction Action;
+		memset(&Action, 0, sizeof(Action));
+		sigemptyset(&Action.sa_mask);
+		Action.sa_handler = [](int) { Stopping = 1; };
+		sigaction(SIGINT, &Action, nullptr);
+		sigaction(SIGTERM, &Action, nullptr);
+		Action.sa_handler = [](int) { Restarting = 1; };
+		sigaction(SIGHUP, &Action, nullptr);
+		Action.sa_handler = SIG_DFL;
+		sigaction(SIGCHLD, &Action, nullptr);
+
+		UnorderedMap<pid_t, ClusterWorker> Workers;
+		auto Spawn = [this, &Workers]() -> pid_t
+		{
+			pid_t Pid = fork();
+			if (Pid > 0)
+			{
+				Workers[Pid].Started = Schedule::GetClock();
+				VI_DEBUG("cluster worker %i started", (int)Pid);
+				return Pid;
+			}
+			else if (Pid < 0)
+			{
+				VI_ERR("cannot fork a cluster worker");
+				return Pid;
+			}
+
+			setpgid(0, 0);
+			signal(SIGHUP, SIG_DFL);
+			ListenForSignals();
+#ifdef APP_REUSE_PORTS
+			ReusePorts = true;
+#endif
+			auto Program = OS::File::ReadAsString(Env.Path);
+			if (Program)
+				Env.Program = *Program;
+			return Pid;
+		};
+
+		for (size_t i = 0; i < Config.Cluster; i++)
+		{
+			pid_t Pid = Spawn();
+			if (!Pid)
+				return (int)ExitStatus::Continue;
+			else if (Pid < 0)
+				Stopping = 1;
+		}
+
+		Vector<pid_t> Replacing;
+		pid_t Replaced = 0, Replacement = 0;
+		std::chrono::microseconds RespawnTime = std::chrono::microseconds(0);
+		size_t Respawns = 0, Failures = 0;
+		int ExitCode = (int)ExitStatus::OK;
+		while (!Workers.empty() || (Respawns > 0 && !Stopping))
+		{
+			auto Time = Schedule::GetClock();
+			if (Stopping == 1)
+			{
+				for (auto& Worker : Workers)
+					kill(Worker.first, SIGTERM);
+				Replacing.clear();
+				Replacement = 0;
+				Respawns = 0;
+				Stopping = 2;
+			}
+			else if (Restarting && !Stopping)
+			{
+				Restarting = 0;
+				Replacing.clear();
+				for (auto& Worker : Workers)
+				{
+					if (!Worker.second.Retiring && Worker.first != Replacement)
+						Replacing.push_back(Worker.first);
+				}
+			}
+
+			if (!Stopping && !Replacement && !Replacing.empty())
+			{
+				Replaced = Replacing.back();
+				Replacing.pop_back();
+				if (Workers.find(Replaced) != Workers.end())
+				{
+					Replacement = Spawn();
+					if (!Replacement)
+						return (int)ExitStatus::Continue;
+					else if (Replacement < 0)
+					{
+						VI_ERR("cannot spawn a replacement for cluster worker %i: rolling restart aborted", (int)Replaced);
+						Replacing.clear();
+						Replacement = 0;
+					}
+				}
+			}
+			else if (!Stopping && Replacement > 0)
+			{
+				auto It = Workers.find(Replacement);
+				if (It == Workers.end())
+				{
+					VI_ERR("replacement for cluster worker %i has failed: rolling restart aborted", (int)Replaced);
+					Replacing.clear();
+					Replacement = 0;
+				}
+				else if (Time - It->second.Started >= std::chrono::seconds(1))
+				{
+					auto Previous = Workers.find(Replaced);
+					if (Previous != Workers.end())
+					{
+						Previous->second.Retiring = true;
+						kill(Replaced, SIGTERM);
+					}
+					else if (Respawns > 0)
+						--Respawns;
+
+					VI_DEBUG("cluster worker %i replaced by %i", (int)Replaced, (int)Replacement);
+					Replacement = 0;
+				}
+			}
+
+			if (!Stopping && Respawns > 0 && Time >= RespawnTime)
+			{
+				--Respawns;
+				pid_t Pid = Spawn();
+				if (!Pid)
+					return (int)ExitStatus::Continue;
+				else if (Pid < 0)
+					Stopping = 1;
+			}
+
+			int Status = 0;
+			pid_t Pid = waitpid(-1, &Status, WNOHANG);
+			if (!Pid || (Pid < 0 && errno == EINTR))
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(100));
+				continue;
+			}
+			else if (Pid < 0)
+			{
+				if (Workers.empty())
+				{
+					std::this_thread::sleep_for(std::chrono::milliseconds(100));
+					continue;
+				}
+				break;
+			}
+
+			auto It = Workers.find(Pid);
+			if (It == Workers.end())
+				continue;
+
+			auto Uptime = Time - It->second.Started;
+			bool Retiring = It->second.Retiring;
+			bool Crashed = WIFSIGNALED(Status) || (WIFEXITED(Status) && WEXITSTATUS(Status) != 0);
+			Workers.erase(It);
+			if (!Crashed || Stopping || Retiring)
+			{
+				if (WIFEXITED(Status) && WEXITSTATUS(Status) != 0 && !Retiring)
+					ExitCode = WEXITSTATUS(Status);
+				continue;
+			}
+
+			ExitCode = WIFEXITED(Status) ? WEXITSTATUS(Status) : (int)ExitStatus::RuntimeError;
+			Failures = Uptime < std::chrono::seconds(10) ? Failures + 1 : 0;
+			if (Failures >= CLUSTER_MAX_FAILURES)
+			{
+				VI_ERR("cluster worker %i keeps failing on startup: stopping", (int)Pid);
+				Stopping = 1;
+				continue;
+			}
+
+			auto Delay = std::chrono::milliseconds(std::min<int64_t>(CLUSTER_MAX_BACKOFF, (int64_t)CLUSTER_MIN_BACKOFF << (Failures > 0 ? Failures - 1 : 0)));
+			VI_WARN("cluster worker %i crashed: restarting in %i ms", (int)Pid, (int)Delay.count());
+			RespawnTime = std::max(RespawnTime, Time) + std::chrono::duration_cast<std::chrono::microseconds>(Delay);
+			++Respawns;
+		}
+
+		return ExitCode;
+#else
+		return (int)ExitStatus::InvalidCommand;
+#endif
+	}
+	int Environment::DispatchWatch()
+	{
+#ifdef VI_UNIX
+		struct WatchWorker
+		{
+			String Buffer;
+			pid_t Pid = -1;
+			int Input = -1;
+			int Output = -1;
+			bool Ready = false;
+			bool Running = false;
+		};
+
+		static volatile sig_atomic_t Stopping = 0;
+		struct sigaction Action;
+		memset(&Action, 0, sizeof(Action));
+		sigemptyset(&Action.sa_mask);
+		Action.sa_handler = [](int) { Stopping = 1; };
+		sigaction(SIGINT, &Action, nullptr);
+		sigaction(SIGTERM, &Action, nullptr);
+		Action.sa_handler = SIG_DFL;
+		sigaction(SIGCHLD, &Action, nullptr);
+
+		WatchWorker Active, Pending;
+		UnorderedMap<String, int64_t> Modified;
+		UnorderedMap<int, String> Directories;
+		int Notifier = -1;
+#ifdef __linux__
+		Notifier = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+#endif
+		auto Close = [](WatchWorker& Worker)
+		{
+			if (Worker.Input >= 0)
+				close(Worker.Input);
+			if (Worker.Output >= 0)
+				close(Worker.Output);
+			Worker = WatchWorker();
+		};
+		auto Spawn = [this, &Active, &Notifier](WatchWorker& Worker) -> pid_t
+		{
+			int Input[2], Output[2];
+			if (pipe(Input) != 0)
+			{
+				VI_ERR("cannot create a watch worker channel");
+				return -1;
+			}
+			else if (pipe(Output) != 0)
+			{
+				close(Input[0]);
+				close(Input[1]);
+				VI_ERR("cannot create a watch worker channel");
+				return -1;
+			}
+
+			pid_t Pid = fork();
+			if (Pid > 0)
+			{
+				close(Input[0]);
+				close(Output[1]);
+				fcntl(Output[0], F_SETFL, fcntl(Output[0], F_GETFL) | O_NONBLOCK);
+				Worker = WatchWorker();
+				Worker.Pid = Pid;
+				Worker.Input = Input[1];
+				Worker.Output = Output[0];
+				return Pid;
+			}
+			else if (Pid < 0)
+			{
+				close(Input[0]);
+				close(Input[1]);
+				close(Output[0]);
+				close(Output[1]);
+				VI_ERR("cannot fork a watch worker");
+				return Pid;
+			}
+
+			close(Input[1]);
+			close(Output[0]);
+			if (&Worker != &Active && Active.Pid > 0)
+			{
+				close(Active.Input);
+				close(Active.Output);
+			}
+			if (Notifier >= 0)
+				close(Notifier);
+
+			setpgid(0, 0);
+			ListenForSignals();
+			Watch.Input = Input[0];
+			Watch.Output = Output[1];
+
+			auto Program = OS::File::ReadAsString(Env.Path);
+			if (Program)
+				Env.Program = *Program;
+			return Pid;
+		};
+		auto AddFile = [this, &Modified, &Directories, &Notifier](const String& Path)
+		{
+			Watch.Files.insert(Path);
+			FileEntry Entry;
+			Modified[Path] = OS::File::GetState(Path, &Entry) ? Entry.LastModified : 0;
+#ifdef __linux__
+			if (Notifier < 0)
+				return;
+
+			String Directory = OS::Path::GetDirectory(Path.c_str());
+			int Handle = inotify_add_watch(Notifier, Directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE);
+			if (Handle >= 0)
+				Directories[Handle] = Directory;
+#endif
+		};
+		auto Receive = [&AddFile, this](WatchWorker& Worker) -> bool
+		{
+			char Buffer[4096];
+			bool Alive = true;
+			while (true)
+			{
+				ssize_t Size = read(Worker.Output, Buffer, sizeof(Buffer));
+				if (Size > 0)
+				{
+					Worker.Buffer.append(Buffer, (size_t)Size);
+					continue;
+				}
+				else if (Size < 0 && errno == EINTR)
+					continue;
+
+				Alive = Size < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+				break;
+			}
+
+			size_t Offset = 0;
+			while (Offset < Worker.Buffer.size())
+			{
+				size_t End = Worker.Buffer.find('\n', Offset);
+				if (End == std::string::npos)
+					break;
+
+				char Type = Worker.Buffer[Offset];
+				String Value = Worker.Buffer.substr(Offset + 1, End - Offset - 1);
+				if (Type == 'S')
+				{
+					size_t Size = (size_t)FromString<uint64_t>(Value).Or(0);
+					if (Worker.Buffer.size() - End - 1 < Size)
+						break;
+
+					Watch.State = Worker.Buffer.substr(End + 1, Size);
+					Offset = End + 1 + Size;
+					continue;
+				}
+				else if (Type == 'F')
+					AddFile(Value);
+				else if (Type == 'R')
+					Worker.Ready = true;
+				Offset = End + 1;
+			}
+
+			Worker.Buffer.erase(0, Offset);
+			return Alive;
+		};
+		auto Stop = [&Receive, &Close](WatchWorker& Worker)
+		{
+			if (Worker.Pid <= 0)
+				return;
+
+			kill(Worker.Pid, SIGTERM);
+			auto Deadline = Schedule::GetClock() + std::chrono::seconds(5);
+			while (Receive(Worker) && Schedule::GetClock() < Deadline)
+				std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+			if (Schedule::GetClock() >= Deadline)
+			{
+				VI_WARN("watch worker %i did not stop in time: global variables are not preserved", (int)Worker.Pid);
+				kill(Worker.Pid, SIGKILL);
+			}
+
+			while (waitpid(Worker.Pid, nullptr, 0) < 0 && errno == EINTR)
+				continue;
+			Close(Worker);
+		};
+		auto Detect = [this, &Modified, &Directories, &Notifier]() -> bool
+		{
+			bool Changed = false;
+#ifdef __linux__
+			if (Notifier >= 0)
+			{
+				alignas(struct inotify_event) char Buffer[4096];
+				ssize_t Size;
+				while ((Size = read(Notifier, Buffer, sizeof(Buffer))) > 0)
+				{
+					for (char* Next = Buffer; Next < Buffer + Size; Next += sizeof(struct inotify_event) + ((struct inotify_event*)Next)->len)
+					{
+						auto* Event = (struct inotify_event*)Next;
+						auto Directory = Directories.find(Event->wd);
+						if (Event->len > 0 && Directory != Directories.end() && Watch.Files.count(Directory->second + Event->name) > 0)
+							Changed = true;
+					}
+				}
+				return Changed;
+			}
+#endif
+			for (auto& File : Modified)
+			{
+				FileEntry Entry;
+				int64_t Time = OS::File::GetState(File.first, &Entry) ? Entry.LastModified : 0;
+				if (Time != File.second)
+				{
+					File.second = Time;
+					Changed = true;
+				}
+			}
+			return Changed;
+		};
+
+		AddFile(Env.Path);
+
+		pid_t Pid = Spawn(Active);
+		if (!Pid)
+			return (int)ExitStatus::Continue;
+		else if (Pid < 0)
+			return (int)ExitStatus::CommandError;
+
+		auto Changed = Schedule::GetClock();
+		int ExitCode = (int)ExitStatus::OK;
+		while (!Stopping)
+		{
+			pollfd Events[3];
+			nfds_t Count = 0;
+			for (int Handle : { Notifier, Active.Output, Pending.Output })
+			{
+				if (Handle >= 0)
+					Events[Count++] = { Handle, POLLIN, 0 };
+			}
+			poll(Events, Count, Notifier >= 0 ? 250 : 500);
+
+			if (Active.Pid > 0)
+			{
+				bool Alive = Receive(Active);
+				if (Active.Ready && !Active.Running)
+				{
+					Active.Running = WriteDescriptor(Active.Input, ToString(Watch.State.size()) + "\n" + Watch.State);
+					Watch.State.clear();
+					VI_INFO("watching %i files of <%s>: started in %i ms", (int)Watch.Files.size(), Env.Module, (int)std::chrono::duration_cast<std::chrono::milliseconds>(Schedule::GetClock() - Changed).count());
+				}
+
+				if (!Alive)
+				{
+					int Status = 0;
+					while (waitpid(Active.Pid, &Status, 0) < 0 && errno == EINTR)
+						continue;
+
+					ExitCode = WIFEXITED(Status) ? WEXITSTATUS(Status) : (int)ExitStatus::RuntimeError;
+					VI_INFO("script <%s> exited with code %i: waiting for changes", Env.Module, ExitCode);
+					Close(Active);
+				}
+			}
+
+			if (Pending.Pid > 0)
+			{
+				bool Alive = Receive(Pending);
+				if (Pending.Ready)
+				{
+					Stop(Active);
+					Pending.Running = WriteDescriptor(Pending.Input, ToString(Watch.State.size()) + "\n" + Watch.State);
+					Watch.State.clear();
+					Active = Pending;
+					Pending = WatchWorker();
+					VI_INFO("reloaded <%s> in %i ms", Env.Module, (int)std::chrono::duration_cast<std::chrono::milliseconds>(Schedule::GetClock() - Changed).count());
+				}
+				else if (!Alive)
+				{
+					while (waitpid(Pending.Pid, nullptr, 0) < 0 && errno == EINTR)
+						continue;
+
+					VI_WARN("cannot reload <%s>: previous version is kept running", Env.Module);
+					Close(Pending);
+				}
+			}
+
+			if (!Detect())
+				continue;
+
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			Detect();
+			Changed = Schedule::GetClock();
+			if (Pending.Pid > 0)
+			{
+				kill(Pending.Pid, SIGKILL);
+				while (waitpid(Pending.Pid, nullptr, 0) < 0 && errno == EINTR)
+					continue;
+				Close(Pending);
+			}
+
+			Pid = Spawn(Pending);
+			if (!Pid)
+				return (int)ExitStatus::Continue;
+		}
+
+		Stop(Pending);
+		Stop(Active);
+		if (Notifier >= 0)
+			close(Notifier);
+		return ExitCode;
+#else
+		return (int)ExitStatus::InvalidCommand;
+#endif
+	}
+	bool Environment::EnterWatch()
+	{
+#ifdef VI_UNIX
+		String Message;
+		for (auto& File : Watch.Files)
+			Message += "F" + File + "\n";
+		Message += "R\n";
+
+		String Size;
+		if (!WriteDescriptor(Watch.Output, Message) || !ReadDescriptorLine(Watch.Input, Size) || !ReadDescriptor(Watch.Input, Watch.State, (size_t)FromString<uint64_t>(Size).Or(0)))
+			return false;
+
+		close(Watch.Input);
+		Watch.Input = -1;
+		if (!Watch.State.empty())
+			VI_DEBUG("watch worker restored %i global variables", (int)RestoreGlobals(VM, Unit, Watch.State));
+		return true;
+#else
+		return false;
+#endif
+	}
+	void Environment::LeaveWatch()
+	{
+#ifdef VI_UNIX
+		String State = SaveGlobals(VM, Unit);
+		WriteDescriptor(Watch.Output, "S" + ToString(State.size()) + "\n" + State);
+		close(Watch.Output);
+		Watch.Output = -1;
+#endif
+	}
+	void Environment::ExitProcess(ExitStatus Code)
+	{
+		if (Code != ExitStatus::RuntimeError)
+			OS::Process::Exit((int)Code);
+		else
+			OS::Process::Abort();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	auto* Instance = new ASX::Environment(argc, argv);
+	Vitex::HeavyRuntime Scope(Instance->GetInitFlags(), Instance->GetAllocator());
+	int ExitCode = Instance->Dispatch();
+	delete Instance;
+	return ExitCode;
+}
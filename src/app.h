@@ -1,60 +1,91 @@
-#ifndef APP_H
-#define APP_H
-#include "builder.h"
-#include <vengeance/bindings.h>
-#include <vitex/network.h>
-
-using namespace Vitex::Layer;
-using namespace Vitex::Network;
-
-namespace ASX
-{
-	typedef std::function<int(const std::string_view&)> CommandCallback;
-
-	struct EnvironmentCommand
-	{
-		CommandCallback Callback;
-		Vector<String> Arguments;
-		String Description;
-	};
-
-	class Environment
-	{
-	private:
-		UnorderedMap<String, Vector<EnvironmentCommand>> Commands;
-		UnorderedMap<String, uint32_t> Settings;
-		UnorderedSet<String> Flags;
-		EnvironmentConfig Env;
-		ProgramEntrypoint Entrypoint;
-		SystemConfig Config;
-		EventLoop* Loop;
-		VirtualMachine* VM;
-		ImmediateContext* Context;
-		Compiler* Unit;
-		std::mutex Mutex;
-
-	public:
-		Environment(int ArgsCount, char** Args);
-		~Environment();
-		int Dispatch();
-		void Shutdown(int Value);
-		void Interrupt(int Value);
-		void Abort(const char* Signal);
-		size_t GetInitFlags();
-
-	private:
-		void AddDefaultCommands();
-		void AddDefaultSettings();
-		void AddCommand(const std::string_view& Category, const std::string_view& Name, const std::string_view& Description, bool IsFlagOnly, const CommandCallback& Callback);
-		ExitStatus ExecuteArgument(const UnorderedSet<String>& Names);
-		EnvironmentCommand* FindArgument(const std::string_view& Name);
-		void PrintIntroduction(const char* Label);
-		void PrintHelp();
-		void PrintProperties();
-		void PrintDependencies();
-		void ListenForSignals();
-		static void ExitProcess(ExitStatus Code);
-		ExpectsPreprocessor<IncludeType> ImportAddon(Preprocessor* Base, const IncludeResult& File, String& Output);
-	};
-}
+#ifndef APP_H
+#define APP_H
+#include "allocator.h"
+#include "buffers.h"
+#include "builder.h"
+#include "cache.h"
+#include "image.h"
+#include "isolate.h"
+#include "json.h"
+#include "pack.h"
+#include "parallel.h"
+#include "session.h"
+#include "sources.h"
+#include "sync.h"
+#include "text.h"
+#include <vengeance/bindings.h>
+#include <vitex/network.h>
+#define CLUSTER_MIN_BACKOFF 250
+#define CLUSTER_MAX_BACKOFF 30000
+#define CLUSTER_MAX_FAILURES 8
+
+using namespace Vitex::Layer;
+using namespace Vitex::Network;
+
+namespace ASX
+{
+	typedef std::function<int(const std::string_view&)> CommandCallback;
+
+	struct EnvironmentCommand
+	{
+		CommandCallback Callback;
+		Vector<String> Arguments;
+		String Description;
+	};
+
+	struct WatchChannel
+	{
+		UnorderedSet<String> Files;
+		String State;
+		int Input = -1;
+		int Output = -1;
+	};
+
+	class Environment
+	{
+	private:
+		UnorderedMap<String, Vector<EnvironmentCommand>> Commands;
+		UnorderedMap<String, uint32_t> Settings;
+		UnorderedSet<String> Flags;
+		EnvironmentConfig Env;
+		ProgramEntrypoint Entrypoint;
+		SystemConfig Config;
+		WatchChannel Watch;
+		SourceCache Sources;
+		EventLoop* Loop;
+		VirtualMachine* VM;
+		ImmediateContext* Context;
+		Compiler* Unit;
+		GlobalAllocator* Allocator;
+		std::mutex Mutex;
+
+	public:
+		Environment(int ArgsCount, char** Args);
+		~Environment();
+		int Dispatch();
+		void Shutdown(int Value);
+		void Interrupt(int Value);
+		void Abort(const char* Signal);
+		size_t GetInitFlags();
+		GlobalAllocator* GetAllocator();
+
+	private:
+		void AddDefaultCommands();
+		void AddDefaultSettings();
+		void AddCommand(const std::string_view& Category, const std::string_view& Name, const std::string_view& Description, bool IsFlagOnly, const CommandCallback& Callback);
+		ExitStatus ExecuteArgument(const UnorderedSet<String>& Names);
+		EnvironmentCommand* FindArgument(const std::string_view& Name);
+		void PrintIntroduction(const char* Label);
+		void PrintHelp();
+		void PrintProperties();
+		void PrintDependencies();
+		void ListenForSignals();
+		int DispatchCluster();
+		int DispatchWatch();
+		bool EnterWatch();
+		void LeaveWatch();
+		static void ExitProcess(ExitStatus Code);
+		ExpectsPreprocessor<IncludeType> ImportAddon(Preprocessor* Base, const IncludeResult& File, String& Output);
+	};
+}
 #endif
\ No newline at end of file
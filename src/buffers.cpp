@@ -0,0 +1,245 @@
+#include "buffers.h"
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)
+#define BUFFER_KERNEL __attribute__((target_clones("avx2", "default")))
+#else
+#define BUFFER_KERNEL
+#endif
+
+namespace ASX
+{
+	template <typename T>
+	BUFFER_KERNEL static void AddScalarKernel(T* __restrict Target, size_t Size, T Value)
+	{
+		for (size_t i = 0; i < Size; i++)
+			Target[i] += Value;
+	}
+	template <typename T>
+	BUFFER_KERNEL static void AddArrayKernel(T* __restrict Target, const T* __restrict Source, size_t Size)
+	{
+		for (size_t i = 0; i < Size; i++)
+			Target[i] += Source[i];
+	}
+	template <typename T>
+	BUFFER_KERNEL static void MulScalarKernel(T* __restrict Target, size_t Size, T Value)
+	{
+		for (size_t i = 0; i < Size; i++)
+			Target[i] *= Value;
+	}
+	template <typename T>
+	BUFFER_KERNEL static void MulArrayKernel(T* __restrict Target, const T* __restrict Source, size_t Size)
+	{
+		for (size_t i = 0; i < Size; i++)
+			Target[i] *= Source[i];
+	}
+	template <typename T>
+	BUFFER_KERNEL static void FmaKernel(T* __restrict Target, const T* __restrict Source, size_t Size, T Value)
+	{
+		for (size_t i = 0; i < Size; i++)
+			Target[i] += Source[i] * Value;
+	}
+	template <typename T, typename R>
+	BUFFER_KERNEL static R SumKernel(const T* __restrict Source, size_t Size)
+	{
+		R Result[8] = { 0 };
+		size_t Index = 0;
+		for (; Index + 8 <= Size; Index += 8)
+		{
+			for (size_t i = 0; i < 8; i++)
+				Result[i] += (R)Source[Index + i];
+		}
+		for (; Index < Size; Index++)
+			Result[0] += (R)Source[Index];
+		return ((Result[0] + Result[1]) + (Result[2] + Result[3])) + ((Result[4] + Result[5]) + (Result[6] + Result[7]));
+	}
+	template <typename T, typename R>
+	BUFFER_KERNEL static R DotKernel(const T* __restrict Left, const T* __restrict Right, size_t Size)
+	{
+		R Result[8] = { 0 };
+		size_t Index = 0;
+		for (; Index + 8 <= Size; Index += 8)
+		{
+			for (size_t i = 0; i < 8; i++)
+				Result[i] += (R)Left[Index + i] * (R)Right[Index + i];
+		}
+		for (; Index < Size; Index++)
+			Result[0] += (R)Left[Index] * (R)Right[Index];
+		return ((Result[0] + Result[1]) + (Result[2] + Result[3])) + ((Result[4] + Result[5]) + (Result[6] + Result[7]));
+	}
+	template <typename T>
+	BUFFER_KERNEL static T MinKernel(const T* __restrict Source, size_t Size)
+	{
+		T Result = Source[0];
+		for (size_t i = 1; i < Size; i++)
+			Result = Source[i] < Result ? Source[i] : Result;
+		return Result;
+	}
+	template <typename T>
+	BUFFER_KERNEL static T MaxKernel(const T* __restrict Source, size_t Size)
+	{
+		T Result = Source[0];
+		for (size_t i = 1; i < Size; i++)
+			Result = Source[i] > Result ? Source[i] : Result;
+		return Result;
+	}
+	template <typename T>
+	static T* GetData(Bindings::Array* Base)
+	{
+		return Base ? (T*)Base->GetBuffer() : nullptr;
+	}
+	static size_t GetSize(Bindings::Array* Base)
+	{
+		return Base ? Base->Size() : 0;
+	}
+
+	void Buffers::BindSyntax(VirtualMachine* VM)
+	{
+		VM->ImportSystemAddon("array");
+		VM->BeginNamespace("buffer");
+		BindType<int32_t>(VM, "int32", "int64");
+		BindType<int64_t>(VM, "int64", "int64");
+		BindType<float>(VM, "float", "float");
+		BindType<double>(VM, "double", "double");
+		VM->EndNamespace();
+	}
+	template <typename T>
+	void Buffers::BindType(VirtualMachine* VM, const char* Name, const char* Accumulator)
+	{
+		VM->SetFunction(Stringify::Text("void add(array<%s>@+, %s)", Name, Name).c_str(), &Buffers::AddScalar<T>);
+		VM->SetFunction(Stringify::Text("void add(array<%s>@+, array<%s>@+)", Name, Name).c_str(), &Buffers::AddArray<T>);
+		VM->SetFunction(Stringify::Text("void mul(array<%s>@+, %s)", Name, Name).c_str(), &Buffers::MulScalar<T>);
+		VM->SetFunction(Stringify::Text("void mul(array<%s>@+, array<%s>@+)", Name, Name).c_str(), &Buffers::MulArray<T>);
+		VM->SetFunction(Stringify::Text("void fma(array<%s>@+, array<%s>@+, %s)", Name, Name, Name).c_str(), &Buffers::Fma<T>);
+		VM->SetFunction(Stringify::Text("%s sum(array<%s>@+)", Accumulator, Name).c_str(), &Buffers::Sum<T>);
+		VM->SetFunction(Stringify::Text("%s min(array<%s>@+)", Name, Name).c_str(), &Buffers::Min<T>);
+		VM->SetFunction(Stringify::Text("%s max(array<%s>@+)", Name, Name).c_str(), &Buffers::Max<T>);
+		VM->SetFunction(Stringify::Text("double mean(array<%s>@+)", Name).c_str(), &Buffers::Mean<T>);
+		VM->SetFunction(Stringify::Text("%s dot(array<%s>@+, array<%s>@+)", Accumulator, Name, Name).c_str(), &Buffers::Dot<T>);
+		VM->SetFunction(Stringify::Text("void prefix_sum(array<%s>@+)", Name).c_str(), &Buffers::PrefixSum<T>);
+		VM->SetFunction(Stringify::Text("void sort(array<%s>@+)", Name).c_str(), &Buffers::Sort<T>);
+		VM->SetFunction(Stringify::Text("array<%s>@ filter(array<%s>@+, array<bool>@+)", Name, Name).c_str(), &Buffers::Filter<T>);
+	}
+	template <typename T>
+	void Buffers::AddScalar(Bindings::Array* Target, T Value)
+	{
+		if (GetSize(Target) > 0)
+			AddScalarKernel<T>(GetData<T>(Target), GetSize(Target), Value);
+	}
+	template <typename T>
+	void Buffers::AddArray(Bindings::Array* Target, Bindings::Array* Source)
+	{
+		if (!IsSameSize(Target, Source))
+			return;
+
+		size_t Size = GetSize(Target);
+		if (Size > 0 && Target != Source)
+			AddArrayKernel<T>(GetData<T>(Target), GetData<T>(Source), Size);
+		else if (Size > 0)
+			MulScalarKernel<T>(GetData<T>(Target), Size, (T)2);
+	}
+	template <typename T>
+	void Buffers::MulScalar(Bindings::Array* Target, T Value)
+	{
+		if (GetSize(Target) > 0)
+			MulScalarKernel<T>(GetData<T>(Target), GetSize(Target), Value);
+	}
+	template <typename T>
+	void Buffers::MulArray(Bindings::Array* Target, Bindings::Array* Source)
+	{
+		if (!IsSameSize(Target, Source))
+			return;
+
+		size_t Size = GetSize(Target);
+		if (Size > 0 && Target != Source)
+			MulArrayKernel<T>(GetData<T>(Target), GetData<T>(Source), Size);
+		else if (Size > 0)
+		{
+			T* Data = GetData<T>(Target);
+			for (size_t i = 0; i < Size; i++)
+				Data[i] *= Data[i];
+		}
+	}
+	template <typename T>
+	void Buffers::Fma(Bindings::Array* Target, Bindings::Array* Source, T Value)
+	{
+		if (!IsSameSize(Target, Source))
+			return;
+
+		size_t Size = GetSize(Target);
+		if (Size > 0 && Target != Source)
+			FmaKernel<T>(GetData<T>(Target), GetData<T>(Source), Size, Value);
+		else if (Size > 0)
+			MulScalarKernel<T>(GetData<T>(Target), Size, (T)1 + Value);
+	}
+	template <typename T>
+	BufferAccumulator<T> Buffers::Sum(Bindings::Array* Source)
+	{
+		return GetSize(Source) > 0 ? SumKernel<T, BufferAccumulator<T>>(GetData<T>(Source), GetSize(Source)) : (BufferAccumulator<T>)0;
+	}
+	template <typename T>
+	T Buffers::Min(Bindings::Array* Source)
+	{
+		return GetSize(Source) > 0 ? MinKernel<T>(GetData<T>(Source), GetSize(Source)) : (T)0;
+	}
+	template <typename T>
+	T Buffers::Max(Bindings::Array* Source)
+	{
+		return GetSize(Source) > 0 ? MaxKernel<T>(GetData<T>(Source), GetSize(Source)) : (T)0;
+	}
+	template <typename T>
+	double Buffers::Mean(Bindings::Array* Source)
+	{
+		size_t Size = GetSize(Source);
+		return Size > 0 ? SumKernel<T, double>(GetData<T>(Source), Size) / (double)Size : 0.0;
+	}
+	template <typename T>
+	BufferAccumulator<T> Buffers::Dot(Bindings::Array* Left, Bindings::Array* Right)
+	{
+		if (!IsSameSize(Left, Right))
+			return (BufferAccumulator<T>)0;
+
+		size_t Size = GetSize(Left);
+		return Size > 0 ? DotKernel<T, BufferAccumulator<T>>(GetData<T>(Left), GetData<T>(Right), Size) : (BufferAccumulator<T>)0;
+	}
+	template <typename T>
+	void Buffers::PrefixSum(Bindings::Array* Target)
+	{
+		size_t Size = GetSize(Target);
+		T* Data = GetData<T>(Target);
+		for (size_t i = 1; i < Size; i++)
+			Data[i] += Data[i - 1];
+	}
+	template <typename T>
+	void Buffers::Sort(Bindings::Array* Target)
+	{
+		size_t Size = GetSize(Target);
+		if (Size > 1)
+			std::sort(GetData<T>(Target), GetData<T>(Target) + Size, &IsOrdered<T>);
+	}
+	template <typename T>
+	Bindings::Array* Buffers::Filter(Bindings::Array* Source, Bindings::Array* Mask)
+	{
+		if (!Source || !IsSameSize(Source, Mask))
+			return nullptr;
+
+		size_t Size = GetSize(Source);
+		T* Data = GetData<T>(Source);
+		bool* Flags = GetData<bool>(Mask);
+		Vector<T> Result;
+		Result.reserve(Size);
+		for (size_t i = 0; i < Size; i++)
+		{
+			if (Flags[i])
+				Result.push_back(Data[i]);
+		}
+
+		return Bindings::Array::Compose<T>(Source->GetArrayObjectType(), Result);
+	}
+	bool Buffers::IsSameSize(Bindings::Array* Left, Bindings::Array* Right)
+	{
+		if (GetSize(Left) == GetSize(Right))
+			return true;
+
+		ImmediateContext::Get()->SetException(Stringify::Text("buffer size mismatch: %i and %i elements", (int)GetSize(Left), (int)GetSize(Right)).c_str());
+		return false;
+	}
+}
\ No newline at end of file
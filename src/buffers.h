@@ -0,0 +1,57 @@
+#ifndef BUFFERS_H
+#define BUFFERS_H
+#include "runtime.hpp"
+#include <vengeance/vengeance.h>
+
+namespace ASX
+{
+	template <typename T>
+	using BufferAccumulator = typename std::conditional<std::is_integral<T>::value, int64_t, T>::type;
+
+	template <typename T>
+	inline bool IsOrdered(T A, T B)
+	{
+		if constexpr (std::is_floating_point<T>::value)
+			return std::isnan(B) ? !std::isnan(A) : A < B;
+		else
+			return A < B;
+	}
+
+	class Buffers
+	{
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+
+	private:
+		template <typename T>
+		static void BindType(VirtualMachine* VM, const char* Name, const char* Accumulator);
+		template <typename T>
+		static void AddScalar(Bindings::Array* Target, T Value);
+		template <typename T>
+		static void AddArray(Bindings::Array* Target, Bindings::Array* Source);
+		template <typename T>
+		static void MulScalar(Bindings::Array* Target, T Value);
+		template <typename T>
+		static void MulArray(Bindings::Array* Target, Bindings::Array* Source);
+		template <typename T>
+		static void Fma(Bindings::Array* Target, Bindings::Array* Source, T Value);
+		template <typename T>
+		static BufferAccumulator<T> Sum(Bindings::Array* Source);
+		template <typename T>
+		static T Min(Bindings::Array* Source);
+		template <typename T>
+		static T Max(Bindings::Array* Source);
+		template <typename T>
+		static double Mean(Bindings::Array* Source);
+		template <typename T>
+		static BufferAccumulator<T> Dot(Bindings::Array* Left, Bindings::Array* Right);
+		template <typename T>
+		static void PrefixSum(Bindings::Array* Target);
+		template <typename T>
+		static void Sort(Bindings::Array* Target);
+		template <typename T>
+		static Bindings::Array* Filter(Bindings::Array* Source, Bindings::Array* Mask);
+		static bool IsSameSize(Bindings::Array* Left, Bindings::Array* Right);
+	};
+}
+#endif
\ No newline at end of file
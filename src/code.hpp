@@ -21,21 +21,147 @@ namespace code_bundle
 		const char* sc_addon_addon_json = "{\n    \"name\": \"{{BUILDER_OUTPUT}}\",\n    \"type\": \"{{BUILDER_MODE}}\",\n    \"runtime\": \"{{BUILDER_VERSION}}\",\n    \"version\": \"1.0.0\",\n    \"index\": {{BUILDER_INDEX}}\n}";
 		callback(context, "addon/addon.json", sc_addon_addon_json, 162);
 
-		const char* sc_executable_cmakelists_txt = "cmake_minimum_required(VERSION 3.6)\nset(VI_DIRECTORY \"{{BUILDER_VENGEANCE_PATH}}\" CACHE STRING \"-\")\n{{BUILDER_FEATURES}}\ninclude(${VI_DIRECTORY}/deps/toolchain.cmake)\nproject({{BUILDER_OUTPUT}})\nset(CMAKE_DISABLE_IN_SOURCE_BUILD ON)\nset(CMAKE_RUNTIME_OUTPUT_DIRECTORY ${CMAKE_SOURCE_DIR}/bin)\nset(CMAKE_RUNTIME_OUTPUT_DIRECTORY_DEBUG ${CMAKE_SOURCE_DIR}/bin)\nset(CMAKE_RUNTIME_OUTPUT_DIRECTORY_RELEASE ${CMAKE_SOURCE_DIR}/bin)\nset(CMAKE_RUNTIME_OUTPUT_DIRECTORY_RELWITHDEBINFO ${CMAKE_SOURCE_DIR}/bin)\nset(BUFFER_DATA \"#ifndef HAS_PROGRAM_BYTECODE\\n#define HAS_PROGRAM_BYTECODE\\n#include <string>\\n\\nnamespace program_bytecode\\n{\\n\\tvoid foreach(void* context, void(*callback)(void*, const char*, unsigned))\\n\\t{\\n\\t\\tif (!callback)\\n\\t\\t\\treturn;\\n\")\nset(BUFFER_OUT \"${CMAKE_SOURCE_DIR}/program\")\nset(FILENAME \"program_bytecode\")\nfile(READ \"${CMAKE_SOURCE_DIR}/program.b64\" FILEDATA)\nif (NOT FILEDATA STREQUAL \"\")\n    string(LENGTH \"${FILEDATA}\" FILESIZE)\n    if (FILESIZE GREATER 4096)\n        set(FILEOFFSET 0)\n        string(APPEND BUFFER_DATA \"\\n\\t\\tstd::string dc_${FILENAME};\\n\\t\\tdc_${FILENAME}.reserve(${FILESIZE});\")\n        while (FILEOFFSET LESS FILESIZE)\n            math(EXPR CHUNKSIZE \"${FILESIZE}-${FILEOFFSET}\")\n            if (CHUNKSIZE GREATER 4096)\n                set(CHUNKSIZE 4096)\n                string(SUBSTRING \"${FILEDATA}\" \"${FILEOFFSET}\" \"${CHUNKSIZE}\" CHUNKDATA)\n            else()\n                string(SUBSTRING \"${FILEDATA}\" \"${FILEOFFSET}\" \"-1\" CHUNKDATA)\n            endif()\n            string(APPEND BUFFER_DATA \"\\n\\t\\tdc_${FILENAME} += \\\"${CHUNKDATA}\\\";\")\n            math(EXPR FILEOFFSET \"${FILEOFFSET}+${CHUNKSIZE}\")\n        endwhile()\n        string(APPEND BUFFER_DATA \"\\n\\t\\tcallback(context, dc_${FILENAME}.c_str(), (unsigned int)dc_${FILENAME}.size());\\n\")\n    else()\n        string(APPEND BUFFER_DATA \"\\n\\t\\tconst char* sc_${FILENAME} = \\\"${FILEDATA}\\\";\\n\\t\\tcallback(context, sc_${FILENAME}, ${FILESIZE});\\n\")\n    endif()    \nendif()\nstring(APPEND BUFFER_DATA \"\\t}\\n}\\n#endif\")\nfile(WRITE ${BUFFER_OUT}.hpp \"${BUFFER_DATA}\")\t\nlist(APPEND SOURCE \"${BUFFER_OUT}.hpp\")\nadd_executable({{BUILDER_OUTPUT}}\n    ${CMAKE_CURRENT_SOURCE_DIR}/runtime.hpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/program.hpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/program.cpp)\nset_target_properties({{BUILDER_OUTPUT}} PROPERTIES\n    OUTPUT_NAME \"{{BUILDER_OUTPUT}}\"\n    CXX_STANDARD ${VI_CXX}\n    CXX_STANDARD_REQUIRED ON\n    CXX_EXTENSIONS OFF\n    VERSION ${PROJECT_VERSION}\n    SOVERSION ${PROJECT_VERSION})\nif (MSVC AND {{BUILDER_APPLICATION}})\n    set(CMAKE_EXE_LINKER_FLAGS \"/ENTRY:mainCRTStartup /SUBSYSTEM:WINDOWS\")\nendif()\nadd_subdirectory(${VI_DIRECTORY} vitex)\nlink_directories(${VI_DIRECTORY})\ntarget_include_directories({{BUILDER_OUTPUT}} PRIVATE ${VI_DIRECTORY})\ntarget_link_libraries({{BUILDER_OUTPUT}} PRIVATE vitex)";
-		callback(context, "executable/CMakeLists.txt", sc_executable_cmakelists_txt, 2834);
+		std::string dc_executable_cmakelists_txt;
+		dc_executable_cmakelists_txt.reserve(4285);
+		dc_executable_cmakelists_txt += "cmake_minimum_required(VERSION 3.6)\nset(VI_DIRECTORY \"{{BUILDER_VENGEANCE_PATH}}\" CACHE STRING \"-\")\n{{BUILDER_FEATURES}}\ninclude(${VI_DIRECTORY}/deps/toolchain.cmake)\nproject({{BUILDER_OUTPUT}})\nset(CMAKE_DISABLE_IN_SOURCE_BUILD ON)\nset(CMAKE_RUNTIME_OUTPUT_DIRECTORY ${CMAKE_SOURCE_DIR}/bin)\nset(CMAKE_RUNTIME_OUTPUT_DIRECTORY_DEBUG ${CMAKE_SOURCE_DIR}/bin)\nset(CMAKE_RUNTIME_OUTPUT_DIRECTORY_RELEASE ${CMAKE_SOURCE_DIR}/bin)\nset(CMAKE_RUNTIME_OUTPUT_DIRECTORY_RELWITHDEBINFO ${CMAKE_SOURCE_DIR}/bin)\nset(BUFFER_DATA \"#ifndef HAS_PROGRAM_BYTECODE\\n#define HAS_PROGRAM_BYTECODE\\n#include <string>\\n\\nnamespace program_bytecode\\n{\\n\\tvoid foreach(void* context, void(*callback)(void*, const char*, unsigned))\\n\\t{\\n\\t\\tif (!callback)\\n\\t\\t\\treturn;\\n\")\nset(BUFFER_OUT \"${CMAKE_SOURCE_DIR}/program\")\nset(FILENAME \"program_bytecode\")\nfile(READ \"${CMAKE_SOURCE_DIR}/program.b64\" FILEDATA)\nif (NOT FILEDATA STREQUAL \"\")\n    string(LENGTH \"${FILEDATA}\" FILESIZE)\n    if (FILESIZE GREATER 4096)\n        set(FILEOFFSET 0)\n        string(APPEND BUFFER_DATA \"\\n\\t\\tstd::string dc_${FILENAME};\\n\\t\\tdc_${FILENAME}.reserve(${FILESIZE});\")\n        while (FILEOFFSET LESS FILESIZE)\n            math(EXPR CHUNKSIZE \"${FILESIZE}-${FILEOFFSET}\")\n            if (CHUNKSIZE GREATER 4096)\n                set(CHUNKSIZE 4096)\n                string(SUBSTRING \"${FILEDATA}\" \"${FILEOFFSET}\" \"${CHUNKSIZE}\" CHUNKDATA)\n            else()\n                string(SUBSTRING \"${FILEDATA}\" \"${FILEOFFSET}\" \"-1\" CHUNKDATA)\n            endif()\n            string(APPEND BUFFER_DATA \"\\n\\t\\tdc_${FILENAME} += \\\"${CHUNKDATA}\\\";\")\n            math(EXPR FILEOFFSET \"${FILEOFFSET}+${CHUNKSIZE}\")\n        endwhile()\n        string(APPEND BUFFER_DATA \"\\n\\t\\tcallback(context, dc_${FILENAME}.c_str(), (unsigned int)dc_${FILENAME}.size());\\n\")\n    else()\n        string(APPEND BUFFER_DATA \"\\n\\t\\tconst char* sc_${FILENAME} = \\\"${FILEDATA}\\\";\\n\\t\\tcallback(context, sc_${FILENAME}, ${FILESIZE});\\n\")\n    endif()    \nendif()\nstring(APPEND BUFFER_DATA \"\\t}\\n}\\n#endif\")\nfile(WRITE ${BUFFER_OUT}.hpp \"${BUFFER_DATA}\")\t\nlist(APPEND SOURCE \"${BUFFER_OUT}.hpp\")\nadd_executable({{BUILDER_OUTPUT}}\n    ${CMAKE_CURRENT_SOURCE_DIR}/runtime.hpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/allocator.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/allocator.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/buffers.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/buffers.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/cache.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/cache.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/isolate.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/isolate.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/json.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/json.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/pack.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/pack.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/parallel.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/parallel.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/sync.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/sync.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/text.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/text.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/timers.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/timers.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/sources.h\n    ${CMAKE_CURRENT_SOURCE_DIR}/sources.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/modules.cpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/program.hpp\n    ${CMAKE_CURRENT_SOURCE_DIR}/program.cpp)\nset_target_properties({{BUILDER_OUTPUT}} PROPERTIES\n    OUTPUT_NAME \"{{BUILDER_OUTPUT}}\"\n    CXX_STANDARD ${VI_CXX}\n    CXX_STANDARD_REQUIRED ON\n    CXX_EXTENSIONS OFF\n    VERSION ${PROJECT_VERSION}\n    SOVERSION ${PROJECT_VERSION})\nif (MSVC AND {{BUILDER_APPLICATION}})\n    set(CMAKE_EXE_LINKER_FLAGS \"/ENTRY:mainCRTStartup /SUBSYSTEM:WINDOWS\")\nendif()\nadd_subdirectory(${VI_DIRECTORY} vitex)\nlink_directories(${VI_DIRECTORY})\ntarget_include_directories({{BUILDER_OUTPUT}} PRIVATE ${VI_DIRECTORY})\nfind_path(VI_ANGELSCRIPT_DIRECTORY angelscript.h\n    HINTS ${VI_DIRECTORY}\n    PATH_SUFFIXES\n        deps/angelscript/sdk/angelscript/include\n        deps/angelscript/include\n        deps/angelscript\n        src/vengeance/internal\n    NO_DEFAULT_PATH)\nif (NOT VI_ANGELSCRIPT_DIRECTORY)\n    message(FATAL_ERROR \"angelscript.h was not found in Vengeance";
+		dc_executable_cmakelists_txt += " directory: set VI_ANGELSCRIPT_DIRECTORY\")\nendif()\ntarget_include_directories({{BUILDER_OUTPUT}} PRIVATE ${VI_ANGELSCRIPT_DIRECTORY})\ntarget_link_libraries({{BUILDER_OUTPUT}} PRIVATE vitex)";
+		callback(context, "executable/CMakeLists.txt", dc_executable_cmakelists_txt.c_str(), (unsigned int)dc_executable_cmakelists_txt.size());
+
+		std::string dc_executable_allocator_cpp;
+		dc_executable_allocator_cpp.reserve(15211);
+		dc_executable_allocator_cpp += "#include \"allocator.h\"\n#include <angelscript.h>\n#ifdef __linux__\n#include <sys/mman.h>\n#endif\n#define ALLOCATOR_CHUNK_SIZE (2 * 1024 * 1024)\n#define ALLOCATOR_ARENA_SIZE (64 * 1024)\n#define ALLOCATOR_SCOPED (ThreadAllocator::Classes + 1)\n#define ALLOCATOR_BUDGET_STEP (256 * 1024)\n#define ALLOCATOR_PAGE_SIZE ((size_t)1 << ALLOCATOR_PAGE_BITS)\n\nnamespace ASX\n{\n\tThreadAllocator::Cache::~Cache()\n\t{\n\t\tif (!Owner)\n\t\t\treturn;\n\n\t\tfor (size_t i = 0; i < Classes; i++)\n\t\t{\n\t\t\tif (Pools[i].Count > 0)\n\t\t\t\tOwner->Return(Pools[i], i, Pools[i].Count);\n\t\t}\n\n\t\tUMutex<std::mutex> Unique(Owner->CachesMutex);\n\t\tAccumulate(Owner->Retired, Stats);\n\t\tOwner->Caches.erase(this);\n\t}\n\n\tThreadAllocator::ThreadAllocator() : Arenas(0), Buffer(nullptr), BufferOffset(ALLOCATOR_CHUNK_SIZE), HugePages(false)\n\t{\n\t}\n\tvoid* ThreadAllocator::Allocate(MemoryLocation&& Location, size_t Size) noexcept\n\t{\n\t\treturn Allocate(Size);\n\t}\n\tvoid* ThreadAllocator::Allocate(size_t Size) noexcept\n\t{\n\t\tif (Size <= ALLOCATOR_ARENA_SIZE / 16 && Arenas.load(std::memory_order_relaxed) > 0)\n\t\t{\n\t\t\tArena* Current = GetArena();\n\t\t\tif (Current != nullptr)\n\t\t\t\treturn AllocateScoped(Current, Size);\n\t\t}\n\n\t\tCache& Current = GetCache();\n\t\tsize_t Class = GetClass(Size + sizeof(Header));\n\t\tHeader* Base = nullptr;\n\t\tif (Class >= Classes)\n\t\t{\n\t\t\tsize_t Total = (Size + sizeof(Header) + ALLOCATOR_PAGE_SIZE - 1) & ~(ALLOCATOR_PAGE_SIZE - 1);\n\t\t\tBase = (Header*)AllocatePages(Total);\n\t\t\tif (!Base)\n\t\t\t\treturn nullptr;\n\n\t\t\tSetRegion(Base, Total, Region::Large);\n\t\t\tIncrement(Current.Stats.Large);\n\t\t\tIncrement(Current.Stats.Allocated, Total);\n\t\t\tBase->Size = Total;\n\t\t\tAccount(Current, Total);\n\t\t}\n\t\telse\n\t\t{\n\t\t\tPool& Target = Current.Pools[Class];\n\t\t\tif (!Target.Head)\n\t\t\t{\n\t\t\t\tRefill(Target, Class);\n\t\t\t\tif (!Target.Head)\n\t\t\t\t\treturn nullptr;\n\t\t\t}\n\n\t\t\tBlock* Next = Target.Head;\n\t\t\tTarget.Head = Next->Next;\n\t\t\t--Target.Count;\n\t\t\tIncrement(Current.Stats.Sizes[Class].Allocations);\n\t\t\tIncrement(Current.Stats.Allocated, GetClassSize(Class));\n\t\t\tBase = (Header*)Next;\n\t\t\tBase->Size = GetClassSize(Class);\n\t\t\tAccount(Current, (size_t)Base->Size);\n\t\t}\n\n\t\tBase->Class = Class;\n\t\treturn (char*)Base + sizeof(Header);\n\t}\n\tvoid ThreadAllocator::Free(void* Address) noexcept\n\t{\n\t\tif (!Address)\n\t\t\treturn;\n\n\t\tRegion Type = GetRegion(Address);\n\t\tif (Type == Region::Foreign)\n\t\t\treturn std::free(Address);\n\n\t\tCache& Current = GetCache();\n\t\tHeader* Base = (Header*)((char*)Address - sizeof(Header));\n\t\tIncrement(Current.Stats.Released, Base->Size);\n\t\tif (Type == Region::Scoped)\n\t\t\treturn FreeScoped(Base);\n\t\telse if (Type == Region::Large)\n\t\t{\n\t\t\tSetRegion(Base, (size_t)Base->Size, Region::Foreign);\n\t\t\treturn FreePages(Base);\n\t\t}\n\n\t\tsize_t Class = (size_t)Base->Class;\n\t\tPool& Target = Current.Pools[Class];\n\t\tBlock* Next = (Block*)Base;\n\t\tNext->Next = Target.Head;\n\t\tTarget.Head = Next;\n\t\tIncrement(Current.Stats.Sizes[Class].Frees);\n\t\tif (++Target.Count > GetClassLimit(Class))\n\t\t\tReturn(Target, Class, Target.Count / 2);\n\t}\n\tvoid ThreadAllocator::Transfer(void* Address, MemoryLocation&& Location) noexcept\n\t{\n\t}\n\tvoid ThreadAllocator::Transfer(void* Address, size_t Size) noexcept\n\t{\n\t}\n\tvoid ThreadAllocator::Watch(MemoryLocation&& Location, void* Address) noexcept\n\t{\n\t}\n\tvoid ThreadAllocator::Unwatch(void* Address) noexcept\n\t{\n\t}\n\tvoid ThreadAllocator::Finalize() noexcept\n\t{\n\t}\n\tbool ThreadAllocator::IsValid(void* Address) noexcept\n\t{\n\t\treturn Address != nullptr && GetRegion(Address) != Region::Foreign;\n\t}\n\tbool ThreadAllocator::IsFinalizable() noexcept\n\t{\n\t\treturn false;\n\t}\n\tvoid ThreadAllocator::SetHugePages(bool Enabled)\n\t{\n\t\tHugePages = Enabled;\n\t}\n\tvoid ThreadAllocator::PrintStatistics()\n\t{\n\t\tStatistics Total;\n\t\t{\n\t\t\tUMutex<std::mutex> Unique(CachesMutex);\n\t\t\tAccumulate(Total, Retired);\n\t\t\tfor (auto* Next : Caches)\n\t\t\t\tAccumulate(Total, Next->Stats);\n\t\t}\n\n\t\tauto* Terminal = Console::Get();\n\t\tTerminal->WriteLine(\"Allocator statistics:\");\n\t\tfor (size_t i = 0; i < Classes; i++)\n\t\t{\n\t\t\tauto& Next = Total.Sizes[i];\n\t\t\tTerminal->WriteLine(\"  \" + ToString(GetClassSize(i)) + \" bytes: \" + ToString(Next.Allocations.load()) + \" allocation";
+		dc_executable_allocator_cpp += "s, \" + ToString(Next.Frees.load()) + \" frees, \" + ToString(Next.Refills.load()) + \" refills, \" + ToString(Next.Returns.load()) + \" returns\");\n\t\t}\n\t\tTerminal->WriteLine(\"  large: \" + ToString(Total.Large.load()) + \" allocations\");\n\t\tTerminal->WriteLine(\"  scoped: \" + ToString(Total.Scoped.load()) + \" allocations in \" + ToString(Total.Arenas.load()) + \" arenas\");\n\t}\n\tsize_t ThreadAllocator::GetMemoryUsage()\n\t{\n\t\tStatistics Total;\n\t\t{\n\t\t\tUMutex<std::mutex> Unique(CachesMutex);\n\t\t\tAccumulate(Total, Retired);\n\t\t\tfor (auto* Next : Caches)\n\t\t\t\tAccumulate(Total, Next->Stats);\n\t\t}\n\n\t\tuint64_t Allocated = Total.Allocated.load(), Released = Total.Released.load();\n\t\treturn Allocated > Released ? (size_t)(Allocated - Released) : 0;\n\t}\n\tThreadAllocator::Arena* ThreadAllocator::EnterArena(ImmediateContext* Context)\n\t{\n\t\tArena* Next = (Arena*)std::malloc(sizeof(Arena));\n\t\tif (!Next)\n\t\t\treturn nullptr;\n\n\t\tUMutex<std::mutex> Unique(ArenaMutex);\n\t\tNext->Context = Context;\n\t\tNext->Parent = (Arena*)Context->GetUserData(ALLOCATOR_ARENA_DATA);\n\t\tNext->Current = nullptr;\n\t\tContext->SetUserData(Next, ALLOCATOR_ARENA_DATA);\n\t\tif (!Next->Parent)\n\t\t\tContext->AppendStopExecutionCallback([this, Context]() { DetachArenas(Context); });\n\t\tIncrement(GetCache().Stats.Arenas);\n\t\t++Arenas;\n\t\treturn Next;\n\t}\n\tvoid ThreadAllocator::LeaveArena(Arena* Base)\n\t{\n\t\tUMutex<std::mutex> Unique(ArenaMutex);\n\t\tif (Base->Context != nullptr)\n\t\t{\n\t\t\tArena* Top = (Arena*)Base->Context->GetUserData(ALLOCATOR_ARENA_DATA);\n\t\t\tif (Top == Base)\n\t\t\t\tBase->Context->SetUserData(Base->Parent, ALLOCATOR_ARENA_DATA);\n\t\t\telse\n\t\t\t{\n\t\t\t\twhile (Top != nullptr && Top->Parent != Base)\n\t\t\t\t\tTop = Top->Parent;\n\t\t\t\tif (Top != nullptr)\n\t\t\t\t\tTop->Parent = Base->Parent;\n\t\t\t}\n\n\t\t\tif (Base->Current != nullptr)\n\t\t\t\tReleaseChunk(Base->Current);\n\t\t}\n\n\t\tstd::free(Base);\n\t\t--Arenas;\n\t}\n\tvoid ThreadAllocator::DetachArenas(ImmediateContext* Context)\n\t{\n\t\tUMutex<std::mutex> Unique(ArenaMutex);\n\t\tDetach((Arena*)Context->GetUserData(ALLOCATOR_ARENA_DATA));\n\t\tContext->SetUserData(nullptr, ALLOCATOR_ARENA_DATA);\n\t}\n\tvoid ThreadAllocator::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tauto VArena = VM->SetClass<ArenaScope>(\"arena\", false);\n\t\tVArena->SetConstructor<ArenaScope>(\"arena@ f()\");\n\t\tVArena->SetMethod(\"void leave()\", &ArenaScope::Leave);\n\t\tVArena->SetMethod(\"bool is_active() const\", &ArenaScope::IsActive);\n\t\tVM->GetEngine()->SetContextUserDataCleanupCallback(&ThreadAllocator::ArenaCleanup, ALLOCATOR_ARENA_DATA);\n\t}\n\tThreadAllocator* ThreadAllocator::Get()\n\t{\n\t\tif (!Instance)\n\t\t\tInstance = new ThreadAllocator();\n\t\treturn Instance;\n\t}\n\tsize_t ThreadAllocator::GetLiveMemory()\n\t{\n\t\treturn Instance != nullptr ? Instance->GetMemoryUsage() : 0;\n\t}\n\tThreadAllocator::Cache& ThreadAllocator::GetCache()\n\t{\n\t\tif (!Local.Owner)\n\t\t{\n\t\t\tLocal.Owner = this;\n\t\t\tLocal.Accounting = true;\n\t\t\t{\n\t\t\t\tUMutex<std::mutex> Unique(CachesMutex);\n\t\t\t\tCaches.insert(&Local);\n\t\t\t}\n\t\t\tLocal.Accounting = false;\n\t\t}\n\t\treturn Local;\n\t}\n\tvoid ThreadAllocator::Account(Cache& Current, size_t Size)\n\t{\n\t\tCurrent.Pending += Size;\n\t\tif (Current.Pending < ALLOCATOR_BUDGET_STEP || Current.Accounting)\n\t\t\treturn;\n\n\t\tCurrent.Pending = 0;\n\t\tif (!Runtime::GetMemoryLimit())\n\t\t\treturn;\n\n\t\tCurrent.Accounting = true;\n\t\tRuntime::ApplyMemoryLimit(GetMemoryUsage());\n\t\tCurrent.Accounting = false;\n\t}\n\tvoid ThreadAllocator::Refill(Pool& Target, size_t Class)\n\t{\n\t\tsize_t Batch = GetClassLimit(Class) / 2;\n\t\tIncrement(Local.Stats.Sizes[Class].Refills);\n\t\t{\n\t\t\tUMutex<std::mutex> Unique(Mutexes[Class]);\n\t\t\tPool& Source = Central[Class];\n\t\t\twhile (Source.Head != nullptr && Target.Count < Batch)\n\t\t\t{\n\t\t\t\tBlock* Next = Source.Head;\n\t\t\t\tSource.Head = Next->Next;\n\t\t\t\t--Source.Count;\n\t\t\t\tNext->Next = Target.Head;\n\t\t\t\tTarget.Head = Next;\n\t\t\t\t++Target.Count;\n\t\t\t}\n\t\t}\n\n\t\tif (Target.Count > 0)\n\t\t\treturn;\n\n\t\tsize_t Size = GetClassSize(Class);\n\t\tchar* Buffer = Carve(Size * Batch);\n\t\tif (!Buffer)\n\t\t\treturn;\n\n\t\tfor (size_t i = 0; i < Batch; i++)\n\t\t{\n\t\t\tBlock* Next = (Block*)(Buffer + i * Size);\n\t\t\tNext->Next = Target.Head;\n\t\t\tTarget.Head = Next;\n\t\t\t++Target.Count;\n\t\t}\n\t}\n\tvoid ThreadAllocat";
+		dc_executable_allocator_cpp += "or::Return(Pool& Target, size_t Class, size_t Count)\n\t{\n\t\tBlock* First = Target.Head;\n\t\tBlock* Last = First;\n\t\tfor (size_t i = 1; i < Count; i++)\n\t\t\tLast = Last->Next;\n\n\t\tTarget.Head = Last->Next;\n\t\tTarget.Count -= Count;\n\t\tIncrement(Local.Stats.Sizes[Class].Returns);\n\n\t\tUMutex<std::mutex> Unique(Mutexes[Class]);\n\t\tPool& Source = Central[Class];\n\t\tLast->Next = Source.Head;\n\t\tSource.Head = First;\n\t\tSource.Count += Count;\n\t}\n\tchar* ThreadAllocator::Carve(size_t Size)\n\t{\n\t\tUMutex<std::mutex> Unique(ChunkMutex);\n\t\tif (BufferOffset + Size > ALLOCATOR_CHUNK_SIZE)\n\t\t{\n\t\t\tchar* Next = nullptr;\n#ifdef __linux__\n\t\t\tif (HugePages)\n\t\t\t{\n\t\t\t\tvoid* Address = mmap(nullptr, ALLOCATOR_CHUNK_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);\n\t\t\t\tif (Address != MAP_FAILED)\n\t\t\t\t{\n#ifdef MADV_HUGEPAGE\n\t\t\t\t\tmadvise(Address, ALLOCATOR_CHUNK_SIZE, MADV_HUGEPAGE);\n#endif\n\t\t\t\t\tNext = (char*)Address;\n\t\t\t\t}\n\t\t\t}\n#endif\n\t\t\tif (!Next)\n\t\t\t\tNext = (char*)AllocatePages(ALLOCATOR_CHUNK_SIZE);\n\t\t\tif (!Next)\n\t\t\t\treturn nullptr;\n\n\t\t\tSetRegion(Next, ALLOCATOR_CHUNK_SIZE, Region::Pooled);\n\t\t\tBuffer = Next;\n\t\t\tBufferOffset = 0;\n\t\t}\n\n\t\tchar* Result = Buffer + BufferOffset;\n\t\tBufferOffset += Size;\n\t\treturn Result;\n\t}\n\tThreadAllocator::Arena* ThreadAllocator::GetArena()\n\t{\n\t\tauto* Context = ImmediateContext::Get();\n\t\treturn Context ? (Arena*)Context->GetUserData(ALLOCATOR_ARENA_DATA) : nullptr;\n\t}\n\tvoid* ThreadAllocator::AllocateScoped(Arena* Current, size_t Size)\n\t{\n\t\tsize_t Total = (sizeof(Header) * 2 + Size + 15) & ~(size_t)15;\n\t\tChunk* Next = Current->Current;\n\t\tif (!Next || Next->Offset + Total > ALLOCATOR_ARENA_SIZE)\n\t\t{\n\t\t\tNext = (Chunk*)AllocatePages(ALLOCATOR_ARENA_SIZE);\n\t\t\tif (!Next)\n\t\t\t\treturn nullptr;\n\n\t\t\tSetRegion(Next, ALLOCATOR_ARENA_SIZE, Region::Scoped);\n\t\t\tnew (&Next->References) std::atomic<size_t>(1);\n\t\t\tNext->Offset = (sizeof(Chunk) + 15) & ~(size_t)15;\n\t\t\tif (Current->Current != nullptr)\n\t\t\t\tReleaseChunk(Current->Current);\n\t\t\tCurrent->Current = Next;\n\t\t}\n\n\t\tchar* Block = (char*)Next + Next->Offset;\n\t\tNext->Offset += Total;\n\t\t*(Chunk**)Block = Next;\n\t\t++Next->References;\n\t\tCache& Target = GetCache();\n\t\tIncrement(Target.Stats.Scoped);\n\t\tIncrement(Target.Stats.Allocated, Total);\n\n\t\tHeader* Base = (Header*)(Block + sizeof(Header));\n\t\tBase->Size = Total;\n\t\tBase->Class = ALLOCATOR_SCOPED;\n\t\treturn (char*)Base + sizeof(Header);\n\t}\n\tvoid ThreadAllocator::Detach(Arena* Top)\n\t{\n\t\twhile (Top != nullptr)\n\t\t{\n\t\t\tArena* Parent = Top->Parent;\n\t\t\tif (Top->Current != nullptr)\n\t\t\t\tReleaseChunk(Top->Current);\n\t\t\tTop->Context = nullptr;\n\t\t\tTop->Parent = nullptr;\n\t\t\tTop->Current = nullptr;\n\t\t\tTop = Parent;\n\t\t}\n\t}\n\tvoid ThreadAllocator::FreeScoped(Header* Base)\n\t{\n\t\tReleaseChunk(*(Chunk**)((char*)Base - sizeof(Header)));\n\t}\n\tvoid ThreadAllocator::ReleaseChunk(Chunk* Base)\n\t{\n\t\tif (--Base->References > 0)\n\t\t\treturn;\n\n\t\tBase->References.~atomic();\n\t\tSetRegion(Base, ALLOCATOR_ARENA_SIZE, Region::Foreign);\n\t\tFreePages(Base);\n\t}\n\tvoid* ThreadAllocator::AllocatePages(size_t Size)\n\t{\n#ifdef _MSC_VER\n\t\treturn _aligned_malloc(Size, ALLOCATOR_PAGE_SIZE);\n#else\n\t\treturn std::aligned_alloc(ALLOCATOR_PAGE_SIZE, Size);\n#endif\n\t}\n\tvoid ThreadAllocator::FreePages(void* Address)\n\t{\n#ifdef _MSC_VER\n\t\t_aligned_free(Address);\n#else\n\t\tstd::free(Address);\n#endif\n\t}\n\tvoid ThreadAllocator::SetRegion(void* Address, size_t Size, Region Type)\n\t{\n\t\tuintptr_t From = (uintptr_t)Address >> ALLOCATOR_PAGE_BITS;\n\t\tuintptr_t To = ((uintptr_t)Address + Size - 1) >> ALLOCATOR_PAGE_BITS;\n\t\tfor (uintptr_t Page = From; Page <= To; Page++)\n\t\t{\n\t\t\tauto& Root = Regions[Page >> ALLOCATOR_LEAF_BITS];\n\t\t\tuint8_t* Leaf = Root.load(std::memory_order_acquire);\n\t\t\tif (!Leaf)\n\t\t\t{\n\t\t\t\tuint8_t* Next = (uint8_t*)std::calloc((size_t)1 << ALLOCATOR_LEAF_BITS, sizeof(uint8_t));\n\t\t\t\tif (!Next)\n\t\t\t\t\treturn;\n\t\t\t\telse if (Root.compare_exchange_strong(Leaf, Next, std::memory_order_acq_rel))\n\t\t\t\t\tLeaf = Next;\n\t\t\t\telse\n\t\t\t\t\tstd::free(Next);\n\t\t\t}\n\t\t\tLeaf[Page & (((uintptr_t)1 << ALLOCATOR_LEAF_BITS) - 1)] = (uint8_t)Type;\n\t\t}\n\t}\n\tThreadAllocator::Region ThreadAllocator::GetRegion(void* Address)\n\t{\n\t\tuintptr_";
+		dc_executable_allocator_cpp += "t Page = (uintptr_t)Address >> ALLOCATOR_PAGE_BITS;\n\t\tif (Page >> (ALLOCATOR_LEAF_BITS + ALLOCATOR_ROOT_BITS))\n\t\t\treturn Region::Foreign;\n\n\t\tuint8_t* Leaf = Regions[Page >> ALLOCATOR_LEAF_BITS].load(std::memory_order_acquire);\n\t\treturn Leaf ? (Region)Leaf[Page & (((uintptr_t)1 << ALLOCATOR_LEAF_BITS) - 1)] : Region::Foreign;\n\t}\n\tvoid ThreadAllocator::Increment(std::atomic<uint64_t>& Counter, uint64_t Value)\n\t{\n\t\tCounter.store(Counter.load(std::memory_order_relaxed) + Value, std::memory_order_relaxed);\n\t}\n\tvoid ThreadAllocator::Accumulate(Statistics& Target, const Statistics& Source)\n\t{\n\t\tfor (size_t i = 0; i < Classes; i++)\n\t\t{\n\t\t\tTarget.Sizes[i].Allocations += Source.Sizes[i].Allocations.load(std::memory_order_relaxed);\n\t\t\tTarget.Sizes[i].Frees += Source.Sizes[i].Frees.load(std::memory_order_relaxed);\n\t\t\tTarget.Sizes[i].Refills += Source.Sizes[i].Refills.load(std::memory_order_relaxed);\n\t\t\tTarget.Sizes[i].Returns += Source.Sizes[i].Returns.load(std::memory_order_relaxed);\n\t\t}\n\t\tTarget.Large += Source.Large.load(std::memory_order_relaxed);\n\t\tTarget.Scoped += Source.Scoped.load(std::memory_order_relaxed);\n\t\tTarget.Arenas += Source.Arenas.load(std::memory_order_relaxed);\n\t\tTarget.Allocated += Source.Allocated.load(std::memory_order_relaxed);\n\t\tTarget.Released += Source.Released.load(std::memory_order_relaxed);\n\t}\n\tThreadAllocator::Arena* ThreadAllocator::ArenaEnter()\n\t{\n\t\tauto* Context = ImmediateContext::Get();\n\t\treturn Instance != nullptr && Context != nullptr ? Instance->EnterArena(Context) : nullptr;\n\t}\n\tvoid ThreadAllocator::ArenaLeave(Arena* Base)\n\t{\n\t\tif (Instance != nullptr && Base != nullptr)\n\t\t\tInstance->LeaveArena(Base);\n\t}\n\tbool ThreadAllocator::ArenaIsAttached(Arena* Base)\n\t{\n\t\tif (!Instance || !Base)\n\t\t\treturn false;\n\n\t\tUMutex<std::mutex> Unique(Instance->ArenaMutex);\n\t\treturn Base->Context != nullptr;\n\t}\n\tvoid ThreadAllocator::ArenaCleanup(asIScriptContext* Context)\n\t{\n\t\tif (!Instance)\n\t\t\treturn;\n\n\t\tUMutex<std::mutex> Unique(Instance->ArenaMutex);\n\t\tInstance->Detach((Arena*)Context->GetUserData(ALLOCATOR_ARENA_DATA));\n\t}\n\tsize_t ThreadAllocator::GetClass(size_t Size)\n\t{\n\t\tsize_t Class = 0;\n\t\twhile (Class < Classes && GetClassSize(Class) < Size)\n\t\t\t++Class;\n\t\treturn Class;\n\t}\n\tsize_t ThreadAllocator::GetClassSize(size_t Class)\n\t{\n\t\treturn (size_t)32 << Class;\n\t}\n\tsize_t ThreadAllocator::GetClassLimit(size_t Class)\n\t{\n\t\treturn std::max<size_t>(8, (64 * 1024) / GetClassSize(Class));\n\t}\n\tArenaScope::ArenaScope() : Base(ThreadAllocator::ArenaEnter())\n\t{\n\t}\n\tArenaScope::~ArenaScope()\n\t{\n\t\tLeave();\n\t}\n\tvoid ArenaScope::Leave()\n\t{\n\t\tThreadAllocator::ArenaLeave(Base);\n\t\tBase = nullptr;\n\t}\n\tbool ArenaScope::IsActive() const\n\t{\n\t\treturn ThreadAllocator::ArenaIsAttached(Base);\n\t}\n\n\tstd::atomic<uint8_t*> ThreadAllocator::Regions[1 << ALLOCATOR_ROOT_BITS];\n\tThreadAllocator* ThreadAllocator::Instance = nullptr;\n\tthread_local ThreadAllocator::Cache ThreadAllocator::Local;\n}";
+		callback(context, "executable/allocator.cpp", dc_executable_allocator_cpp.c_str(), (unsigned int)dc_executable_allocator_cpp.size());
+
+		const char* sc_executable_allocator_h = "#ifndef ALLOCATOR_H\n#define ALLOCATOR_H\n#include \"runtime.hpp\"\n#include <vengeance/vengeance.h>\n#define ALLOCATOR_PAGE_BITS 12\n#define ALLOCATOR_LEAF_BITS 18\n#define ALLOCATOR_ROOT_BITS 18\n#define ALLOCATOR_ARENA_DATA 0x61736172656e61\n\nnamespace ASX\n{\n\tclass ThreadAllocator final : public GlobalAllocator\n\t{\n\tpublic:\n\t\tstatic constexpr size_t Classes = 10;\n\n\tpublic:\n\t\tstruct Counters\n\t\t{\n\t\t\tstd::atomic<uint64_t> Allocations = 0;\n\t\t\tstd::atomic<uint64_t> Frees = 0;\n\t\t\tstd::atomic<uint64_t> Refills = 0;\n\t\t\tstd::atomic<uint64_t> Returns = 0;\n\t\t};\n\n\t\tstruct Statistics\n\t\t{\n\t\t\tCounters Sizes[Classes];\n\t\t\tstd::atomic<uint64_t> Large = 0;\n\t\t\tstd::atomic<uint64_t> Scoped = 0;\n\t\t\tstd::atomic<uint64_t> Arenas = 0;\n\t\t\tstd::atomic<uint64_t> Allocated = 0;\n\t\t\tstd::atomic<uint64_t> Released = 0;\n\t\t};\n\n\t\tstruct Chunk\n\t\t{\n\t\t\tstd::atomic<size_t> References;\n\t\t\tsize_t Offset;\n\t\t};\n\n\t\tstruct Arena\n\t\t{\n\t\t\tImmediateContext* Context;\n\t\t\tArena* Parent;\n\t\t\tChunk* Current;\n\t\t};\n\n\tprivate:\n\t\tenum class Region : uint8_t\n\t\t{\n\t\t\tForeign = 0,\n\t\t\tPooled,\n\t\t\tLarge,\n\t\t\tScoped\n\t\t};\n\n\t\tstruct Header\n\t\t{\n\t\t\tuint64_t Size;\n\t\t\tuint64_t Class;\n\t\t};\n\n\t\tstruct Block\n\t\t{\n\t\t\tBlock* Next;\n\t\t};\n\n\t\tstruct Pool\n\t\t{\n\t\t\tBlock* Head = nullptr;\n\t\t\tsize_t Count = 0;\n\t\t};\n\n\t\tstruct Cache\n\t\t{\n\t\t\tPool Pools[Classes];\n\t\t\tStatistics Stats;\n\t\t\tThreadAllocator* Owner = nullptr;\n\t\t\tsize_t Pending = 0;\n\t\t\tbool Accounting = false;\n\t\t\t~Cache();\n\t\t};\n\n\tprivate:\n\t\tstatic std::atomic<uint8_t*> Regions[1 << ALLOCATOR_ROOT_BITS];\n\t\tstatic ThreadAllocator* Instance;\n\t\tstatic thread_local Cache Local;\n\n\tprivate:\n\t\tPool Central[Classes];\n\t\tstd::mutex Mutexes[Classes];\n\t\tUnorderedSet<Cache*> Caches;\n\t\tStatistics Retired;\n\t\tstd::mutex CachesMutex;\n\t\tstd::mutex ChunkMutex;\n\t\tstd::mutex ArenaMutex;\n\t\tstd::atomic<size_t> Arenas;\n\t\tchar* Buffer;\n\t\tsize_t BufferOffset;\n\t\tbool HugePages;\n\n\tprivate:\n\t\tThreadAllocator();\n\n\tpublic:\n\t\t~ThreadAllocator() override = default;\n\t\tvoid* Allocate(MemoryLocation&& Location, size_t Size) noexcept override;\n\t\tvoid* Allocate(size_t Size) noexcept override;\n\t\tvoid Free(void* Address) noexcept override;\n\t\tvoid Transfer(void* Address, MemoryLocation&& Location) noexcept override;\n\t\tvoid Transfer(void* Address, size_t Size) noexcept override;\n\t\tvoid Watch(MemoryLocation&& Location, void* Address) noexcept override;\n\t\tvoid Unwatch(void* Address) noexcept override;\n\t\tvoid Finalize() noexcept override;\n\t\tbool IsValid(void* Address) noexcept override;\n\t\tbool IsFinalizable() noexcept override;\n\t\tvoid SetHugePages(bool Enabled);\n\t\tvoid PrintStatistics();\n\t\tsize_t GetMemoryUsage();\n\t\tArena* EnterArena(ImmediateContext* Context);\n\t\tvoid LeaveArena(Arena* Base);\n\t\tvoid DetachArenas(ImmediateContext* Context);\n\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\t\tstatic ThreadAllocator* Get();\n\t\tstatic size_t GetLiveMemory();\n\t\tstatic Arena* ArenaEnter();\n\t\tstatic void ArenaLeave(Arena* Base);\n\t\tstatic bool ArenaIsAttached(Arena* Base);\n\n\tprivate:\n\t\tCache& GetCache();\n\t\tvoid Account(Cache& Current, size_t Size);\n\t\tvoid Refill(Pool& Target, size_t Class);\n\t\tvoid Return(Pool& Target, size_t Class, size_t Count);\n\t\tchar* Carve(size_t Size);\n\t\tArena* GetArena();\n\t\tvoid* AllocateScoped(Arena* Current, size_t Size);\n\t\tvoid FreeScoped(Header* Base);\n\t\tvoid Detach(Arena* Top);\n\t\tstatic void ArenaCleanup(asIScriptContext* Context);\n\t\tstatic void ReleaseChunk(Chunk* Base);\n\t\tstatic void* AllocatePages(size_t Size);\n\t\tstatic void FreePages(void* Address);\n\t\tstatic void SetRegion(void* Address, size_t Size, Region Type);\n\t\tstatic Region GetRegion(void* Address);\n\t\tstatic void Increment(std::atomic<uint64_t>& Counter, uint64_t Value = 1);\n\t\tstatic void Accumulate(Statistics& Target, const Statistics& Source);\n\t\tstatic size_t GetClass(size_t Size);\n\t\tstatic size_t GetClassSize(size_t Class);\n\t\tstatic size_t GetClassLimit(size_t Class);\n\t};\n\n\tclass ArenaScope : public Reference<ArenaScope>\n\t{\n\tprivate:\n\t\tThreadAllocator::Arena* Base;\n\n\tpublic:\n\t\tArenaScope();\n\t\t~ArenaScope();\n\t\tvoid Leave();\n\t\tbool IsActive() const;\n\t};\n}\n#endif";
+		callback(context, "executable/allocator.h", sc_executable_allocator_h, 4034);
+
+		std::string dc_executable_buffers_cpp;
+		dc_executable_buffers_cpp.reserve(8477);
+		dc_executable_buffers_cpp += "#include \"buffers.h\"\n#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && defined(__linux__)\n#define BUFFER_KERNEL __attribute__((target_clones(\"avx2\", \"default\")))\n#else\n#define BUFFER_KERNEL\n#endif\n\nnamespace ASX\n{\n\ttemplate <typename T>\n\tBUFFER_KERNEL static void AddScalarKernel(T* __restrict Target, size_t Size, T Value)\n\t{\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t\tTarget[i] += Value;\n\t}\n\ttemplate <typename T>\n\tBUFFER_KERNEL static void AddArrayKernel(T* __restrict Target, const T* __restrict Source, size_t Size)\n\t{\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t\tTarget[i] += Source[i];\n\t}\n\ttemplate <typename T>\n\tBUFFER_KERNEL static void MulScalarKernel(T* __restrict Target, size_t Size, T Value)\n\t{\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t\tTarget[i] *= Value;\n\t}\n\ttemplate <typename T>\n\tBUFFER_KERNEL static void MulArrayKernel(T* __restrict Target, const T* __restrict Source, size_t Size)\n\t{\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t\tTarget[i] *= Source[i];\n\t}\n\ttemplate <typename T>\n\tBUFFER_KERNEL static void FmaKernel(T* __restrict Target, const T* __restrict Source, size_t Size, T Value)\n\t{\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t\tTarget[i] += Source[i] * Value;\n\t}\n\ttemplate <typename T, typename R>\n\tBUFFER_KERNEL static R SumKernel(const T* __restrict Source, size_t Size)\n\t{\n\t\tR Result[8] = { 0 };\n\t\tsize_t Index = 0;\n\t\tfor (; Index + 8 <= Size; Index += 8)\n\t\t{\n\t\t\tfor (size_t i = 0; i < 8; i++)\n\t\t\t\tResult[i] += (R)Source[Index + i];\n\t\t}\n\t\tfor (; Index < Size; Index++)\n\t\t\tResult[0] += (R)Source[Index];\n\t\treturn ((Result[0] + Result[1]) + (Result[2] + Result[3])) + ((Result[4] + Result[5]) + (Result[6] + Result[7]));\n\t}\n\ttemplate <typename T, typename R>\n\tBUFFER_KERNEL static R DotKernel(const T* __restrict Left, const T* __restrict Right, size_t Size)\n\t{\n\t\tR Result[8] = { 0 };\n\t\tsize_t Index = 0;\n\t\tfor (; Index + 8 <= Size; Index += 8)\n\t\t{\n\t\t\tfor (size_t i = 0; i < 8; i++)\n\t\t\t\tResult[i] += (R)Left[Index + i] * (R)Right[Index + i];\n\t\t}\n\t\tfor (; Index < Size; Index++)\n\t\t\tResult[0] += (R)Left[Index] * (R)Right[Index];\n\t\treturn ((Result[0] + Result[1]) + (Result[2] + Result[3])) + ((Result[4] + Result[5]) + (Result[6] + Result[7]));\n\t}\n\ttemplate <typename T>\n\tBUFFER_KERNEL static T MinKernel(const T* __restrict Source, size_t Size)\n\t{\n\t\tT Result = Source[0];\n\t\tfor (size_t i = 1; i < Size; i++)\n\t\t\tResult = Source[i] < Result ? Source[i] : Result;\n\t\treturn Result;\n\t}\n\ttemplate <typename T>\n\tBUFFER_KERNEL static T MaxKernel(const T* __restrict Source, size_t Size)\n\t{\n\t\tT Result = Source[0];\n\t\tfor (size_t i = 1; i < Size; i++)\n\t\t\tResult = Source[i] > Result ? Source[i] : Result;\n\t\treturn Result;\n\t}\n\ttemplate <typename T>\n\tstatic T* GetData(Bindings::Array* Base)\n\t{\n\t\treturn Base ? (T*)Base->GetBuffer() : nullptr;\n\t}\n\tstatic size_t GetSize(Bindings::Array* Base)\n\t{\n\t\treturn Base ? Base->Size() : 0;\n\t}\n\n\tvoid Buffers::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->ImportSystemAddon(\"array\");\n\t\tVM->BeginNamespace(\"buffer\");\n\t\tBindType<int32_t>(VM, \"int32\", \"int64\");\n\t\tBindType<int64_t>(VM, \"int64\", \"int64\");\n\t\tBindType<float>(VM, \"float\", \"float\");\n\t\tBindType<double>(VM, \"double\", \"double\");\n\t\tVM->EndNamespace();\n\t}\n\ttemplate <typename T>\n\tvoid Buffers::BindType(VirtualMachine* VM, const char* Name, const char* Accumulator)\n\t{\n\t\tVM->SetFunction(Stringify::Text(\"void add(array<%s>@+, %s)\", Name, Name).c_str(), &Buffers::AddScalar<T>);\n\t\tVM->SetFunction(Stringify::Text(\"void add(array<%s>@+, array<%s>@+)\", Name, Name).c_str(), &Buffers::AddArray<T>);\n\t\tVM->SetFunction(Stringify::Text(\"void mul(array<%s>@+, %s)\", Name, Name).c_str(), &Buffers::MulScalar<T>);\n\t\tVM->SetFunction(Stringify::Text(\"void mul(array<%s>@+, array<%s>@+)\", Name, Name).c_str(), &Buffers::MulArray<T>);\n\t\tVM->SetFunction(Stringify::Text(\"void fma(array<%s>@+, array<%s>@+, %s)\", Name, Name, Name).c_str(), &Buffers::Fma<T>);\n\t\tVM->SetFunction(Stringify::Text(\"%s sum(array<%s>@+)\", Accumulator, Name).c_str(), &Buffers::Sum<T>);\n\t\tVM->SetFunction(Stringify::Text(\"%s min(array<%s>@+)\", Name, Name).c_str(), &Buffers::Min<T>);\n\t\tVM->SetFunction(Stringify::Text(\"%s max(array<%";
+		dc_executable_buffers_cpp += "s>@+)\", Name, Name).c_str(), &Buffers::Max<T>);\n\t\tVM->SetFunction(Stringify::Text(\"double mean(array<%s>@+)\", Name).c_str(), &Buffers::Mean<T>);\n\t\tVM->SetFunction(Stringify::Text(\"%s dot(array<%s>@+, array<%s>@+)\", Accumulator, Name, Name).c_str(), &Buffers::Dot<T>);\n\t\tVM->SetFunction(Stringify::Text(\"void prefix_sum(array<%s>@+)\", Name).c_str(), &Buffers::PrefixSum<T>);\n\t\tVM->SetFunction(Stringify::Text(\"void sort(array<%s>@+)\", Name).c_str(), &Buffers::Sort<T>);\n\t\tVM->SetFunction(Stringify::Text(\"array<%s>@ filter(array<%s>@+, array<bool>@+)\", Name, Name).c_str(), &Buffers::Filter<T>);\n\t}\n\ttemplate <typename T>\n\tvoid Buffers::AddScalar(Bindings::Array* Target, T Value)\n\t{\n\t\tif (GetSize(Target) > 0)\n\t\t\tAddScalarKernel<T>(GetData<T>(Target), GetSize(Target), Value);\n\t}\n\ttemplate <typename T>\n\tvoid Buffers::AddArray(Bindings::Array* Target, Bindings::Array* Source)\n\t{\n\t\tif (!IsSameSize(Target, Source))\n\t\t\treturn;\n\n\t\tsize_t Size = GetSize(Target);\n\t\tif (Size > 0 && Target != Source)\n\t\t\tAddArrayKernel<T>(GetData<T>(Target), GetData<T>(Source), Size);\n\t\telse if (Size > 0)\n\t\t\tMulScalarKernel<T>(GetData<T>(Target), Size, (T)2);\n\t}\n\ttemplate <typename T>\n\tvoid Buffers::MulScalar(Bindings::Array* Target, T Value)\n\t{\n\t\tif (GetSize(Target) > 0)\n\t\t\tMulScalarKernel<T>(GetData<T>(Target), GetSize(Target), Value);\n\t}\n\ttemplate <typename T>\n\tvoid Buffers::MulArray(Bindings::Array* Target, Bindings::Array* Source)\n\t{\n\t\tif (!IsSameSize(Target, Source))\n\t\t\treturn;\n\n\t\tsize_t Size = GetSize(Target);\n\t\tif (Size > 0 && Target != Source)\n\t\t\tMulArrayKernel<T>(GetData<T>(Target), GetData<T>(Source), Size);\n\t\telse if (Size > 0)\n\t\t{\n\t\t\tT* Data = GetData<T>(Target);\n\t\t\tfor (size_t i = 0; i < Size; i++)\n\t\t\t\tData[i] *= Data[i];\n\t\t}\n\t}\n\ttemplate <typename T>\n\tvoid Buffers::Fma(Bindings::Array* Target, Bindings::Array* Source, T Value)\n\t{\n\t\tif (!IsSameSize(Target, Source))\n\t\t\treturn;\n\n\t\tsize_t Size = GetSize(Target);\n\t\tif (Size > 0 && Target != Source)\n\t\t\tFmaKernel<T>(GetData<T>(Target), GetData<T>(Source), Size, Value);\n\t\telse if (Size > 0)\n\t\t\tMulScalarKernel<T>(GetData<T>(Target), Size, (T)1 + Value);\n\t}\n\ttemplate <typename T>\n\tBufferAccumulator<T> Buffers::Sum(Bindings::Array* Source)\n\t{\n\t\treturn GetSize(Source) > 0 ? SumKernel<T, BufferAccumulator<T>>(GetData<T>(Source), GetSize(Source)) : (BufferAccumulator<T>)0;\n\t}\n\ttemplate <typename T>\n\tT Buffers::Min(Bindings::Array* Source)\n\t{\n\t\treturn GetSize(Source) > 0 ? MinKernel<T>(GetData<T>(Source), GetSize(Source)) : (T)0;\n\t}\n\ttemplate <typename T>\n\tT Buffers::Max(Bindings::Array* Source)\n\t{\n\t\treturn GetSize(Source) > 0 ? MaxKernel<T>(GetData<T>(Source), GetSize(Source)) : (T)0;\n\t}\n\ttemplate <typename T>\n\tdouble Buffers::Mean(Bindings::Array* Source)\n\t{\n\t\tsize_t Size = GetSize(Source);\n\t\treturn Size > 0 ? SumKernel<T, double>(GetData<T>(Source), Size) / (double)Size : 0.0;\n\t}\n\ttemplate <typename T>\n\tBufferAccumulator<T> Buffers::Dot(Bindings::Array* Left, Bindings::Array* Right)\n\t{\n\t\tif (!IsSameSize(Left, Right))\n\t\t\treturn (BufferAccumulator<T>)0;\n\n\t\tsize_t Size = GetSize(Left);\n\t\treturn Size > 0 ? DotKernel<T, BufferAccumulator<T>>(GetData<T>(Left), GetData<T>(Right), Size) : (BufferAccumulator<T>)0;\n\t}\n\ttemplate <typename T>\n\tvoid Buffers::PrefixSum(Bindings::Array* Target)\n\t{\n\t\tsize_t Size = GetSize(Target);\n\t\tT* Data = GetData<T>(Target);\n\t\tfor (size_t i = 1; i < Size; i++)\n\t\t\tData[i] += Data[i - 1];\n\t}\n\ttemplate <typename T>\n\tvoid Buffers::Sort(Bindings::Array* Target)\n\t{\n\t\tsize_t Size = GetSize(Target);\n\t\tif (Size > 1)\n\t\t\tstd::sort(GetData<T>(Target), GetData<T>(Target) + Size, &IsOrdered<T>);\n\t}\n\ttemplate <typename T>\n\tBindings::Array* Buffers::Filter(Bindings::Array* Source, Bindings::Array* Mask)\n\t{\n\t\tif (!Source || !IsSameSize(Source, Mask))\n\t\t\treturn nullptr;\n\n\t\tsize_t Size = GetSize(Source);\n\t\tT* Data = GetData<T>(Source);\n\t\tbool* Flags = GetData<bool>(Mask);\n\t\tVector<T> Result;\n\t\tResult.reserve(Size);\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t{\n\t\t\tif (Flags[i])\n\t\t\t\tResult.push_back(Data[i]);\n\t\t}\n\n\t\treturn Bindings::Array::Compose<T>(Source->GetArrayObjectType(), Result);\n\t}\n\tbool Buffers::IsS";
+		dc_executable_buffers_cpp += "ameSize(Bindings::Array* Left, Bindings::Array* Right)\n\t{\n\t\tif (GetSize(Left) == GetSize(Right))\n\t\t\treturn true;\n\n\t\tImmediateContext::Get()->SetException(Stringify::Text(\"buffer size mismatch: %i and %i elements\", (int)GetSize(Left), (int)GetSize(Right)).c_str());\n\t\treturn false;\n\t}\n}";
+		callback(context, "executable/buffers.cpp", dc_executable_buffers_cpp.c_str(), (unsigned int)dc_executable_buffers_cpp.size());
+
+		const char* sc_executable_buffers_h = "#ifndef BUFFERS_H\n#define BUFFERS_H\n#include \"runtime.hpp\"\n#include <vengeance/vengeance.h>\n\nnamespace ASX\n{\n\ttemplate <typename T>\n\tusing BufferAccumulator = typename std::conditional<std::is_integral<T>::value, int64_t, T>::type;\n\n\ttemplate <typename T>\n\tinline bool IsOrdered(T A, T B)\n\t{\n\t\tif constexpr (std::is_floating_point<T>::value)\n\t\t\treturn std::isnan(B) ? !std::isnan(A) : A < B;\n\t\telse\n\t\t\treturn A < B;\n\t}\n\n\tclass Buffers\n\t{\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\n\tprivate:\n\t\ttemplate <typename T>\n\t\tstatic void BindType(VirtualMachine* VM, const char* Name, const char* Accumulator);\n\t\ttemplate <typename T>\n\t\tstatic void AddScalar(Bindings::Array* Target, T Value);\n\t\ttemplate <typename T>\n\t\tstatic void AddArray(Bindings::Array* Target, Bindings::Array* Source);\n\t\ttemplate <typename T>\n\t\tstatic void MulScalar(Bindings::Array* Target, T Value);\n\t\ttemplate <typename T>\n\t\tstatic void MulArray(Bindings::Array* Target, Bindings::Array* Source);\n\t\ttemplate <typename T>\n\t\tstatic void Fma(Bindings::Array* Target, Bindings::Array* Source, T Value);\n\t\ttemplate <typename T>\n\t\tstatic BufferAccumulator<T> Sum(Bindings::Array* Source);\n\t\ttemplate <typename T>\n\t\tstatic T Min(Bindings::Array* Source);\n\t\ttemplate <typename T>\n\t\tstatic T Max(Bindings::Array* Source);\n\t\ttemplate <typename T>\n\t\tstatic double Mean(Bindings::Array* Source);\n\t\ttemplate <typename T>\n\t\tstatic BufferAccumulator<T> Dot(Bindings::Array* Left, Bindings::Array* Right);\n\t\ttemplate <typename T>\n\t\tstatic void PrefixSum(Bindings::Array* Target);\n\t\ttemplate <typename T>\n\t\tstatic void Sort(Bindings::Array* Target);\n\t\ttemplate <typename T>\n\t\tstatic Bindings::Array* Filter(Bindings::Array* Source, Bindings::Array* Mask);\n\t\tstatic bool IsSameSize(Bindings::Array* Left, Bindings::Array* Right);\n\t};\n}\n#endif";
+		callback(context, "executable/buffers.h", sc_executable_buffers_h, 1804);
+
+		std::string dc_executable_cache_cpp;
+		dc_executable_cache_cpp.reserve(8762);
+		dc_executable_cache_cpp += "#include \"cache.h\"\n\nnamespace ASX\n{\n\tSharedCache::SharedCache(size_t MaxBytes) : Budget(MaxBytes), Bytes(0), Count(0), Hits(0), Misses(0), Evictions(0), Expirations(0), Rejections(0), Policy(CachePolicy::LRU)\n\t{\n\t}\n\tbool SharedCache::Set(const String& Key, const String& Value, uint64_t Timeout)\n\t{\n\t\tsize_t Size = GetEntrySize(Key, Value);\n\t\tsize_t Limit = GetEntryLimit();\n\t\tif (Limit > 0 && Size > Limit)\n\t\t{\n\t\t\tRejections.fetch_add(1, std::memory_order_relaxed);\n\t\t\treturn false;\n\t\t}\n\n\t\tint64_t Time = GetTime();\n\t\tStripe& Target = GetStripe(Key);\n\t\tstd::unique_lock<std::shared_mutex> Unique(Target.Mutex);\n\t\tauto It = Target.Entries.find(Key);\n\t\tif (It != Target.Entries.end())\n\t\t{\n\t\t\tsize_t Previous = GetEntrySize(Key, It->second.Value);\n\t\t\tTarget.Bytes -= Previous;\n\t\t\tBytes -= Previous;\n\t\t}\n\t\telse\n\t\t{\n\t\t\tIt = Target.Entries.try_emplace(Key).first;\n\t\t\t++Count;\n\t\t}\n\n\t\tCacheEntry& Entry = It->second;\n\t\tEntry.Value = Value;\n\t\tEntry.Expires = Timeout > 0 ? Time + (int64_t)Timeout : 0;\n\t\tEntry.Access.store(Time, std::memory_order_relaxed);\n\t\tEntry.Frequency.store(1, std::memory_order_relaxed);\n\t\tTarget.Bytes += Size;\n\t\tBytes += Size;\n\t\tif (Limit > 0 && Target.Bytes > Limit)\n\t\t\tEvict(Target, Limit, Time, &It->first);\n\t\treturn true;\n\t}\n\tbool SharedCache::Get(const String& Key, String& Value)\n\t{\n\t\tint64_t Time = GetTime();\n\t\tStripe& Target = GetStripe(Key);\n\t\tstd::shared_lock<std::shared_mutex> Shared(Target.Mutex);\n\t\tauto It = Target.Entries.find(Key);\n\t\tif (It == Target.Entries.end())\n\t\t{\n\t\t\tMisses.fetch_add(1, std::memory_order_relaxed);\n\t\t\treturn false;\n\t\t}\n\t\telse if (It->second.Expires > 0 && It->second.Expires <= Time)\n\t\t{\n\t\t\tShared.unlock();\n\t\t\tMisses.fetch_add(1, std::memory_order_relaxed);\n\t\t\tstd::unique_lock<std::shared_mutex> Unique(Target.Mutex);\n\t\t\tIt = Target.Entries.find(Key);\n\t\t\tif (It != Target.Entries.end() && It->second.Expires > 0 && It->second.Expires <= Time)\n\t\t\t{\n\t\t\t\tRemove(Target, It);\n\t\t\t\t++Expirations;\n\t\t\t}\n\t\t\treturn false;\n\t\t}\n\n\t\tCacheEntry& Entry = It->second;\n\t\tEntry.Access.store(Time, std::memory_order_relaxed);\n\t\tif (Entry.Frequency.load(std::memory_order_relaxed) < std::numeric_limits<uint32_t>::max())\n\t\t\tEntry.Frequency.fetch_add(1, std::memory_order_relaxed);\n\t\tHits.fetch_add(1, std::memory_order_relaxed);\n\t\tValue = Entry.Value;\n\t\treturn true;\n\t}\n\tbool SharedCache::Has(const String& Key)\n\t{\n\t\tint64_t Time = GetTime();\n\t\tStripe& Target = GetStripe(Key);\n\t\tstd::shared_lock<std::shared_mutex> Shared(Target.Mutex);\n\t\tauto It = Target.Entries.find(Key);\n\t\treturn It != Target.Entries.end() && (It->second.Expires <= 0 || It->second.Expires > Time);\n\t}\n\tbool SharedCache::Erase(const String& Key)\n\t{\n\t\tStripe& Target = GetStripe(Key);\n\t\tstd::unique_lock<std::shared_mutex> Unique(Target.Mutex);\n\t\tauto It = Target.Entries.find(Key);\n\t\tif (It == Target.Entries.end())\n\t\t\treturn false;\n\n\t\tRemove(Target, It);\n\t\treturn true;\n\t}\n\tvoid SharedCache::Clear()\n\t{\n\t\tfor (auto& Target : Stripes)\n\t\t{\n\t\t\tstd::unique_lock<std::shared_mutex> Unique(Target.Mutex);\n\t\t\tCount -= Target.Entries.size();\n\t\t\tBytes -= Target.Bytes;\n\t\t\tTarget.Entries.clear();\n\t\t\tTarget.Bytes = 0;\n\t\t}\n\t}\n\tvoid SharedCache::SetBudget(size_t MaxBytes)\n\t{\n\t\tBudget = MaxBytes;\n\t\tsize_t Limit = GetEntryLimit();\n\t\tif (!Limit)\n\t\t\treturn;\n\n\t\tint64_t Time = GetTime();\n\t\tfor (auto& Target : Stripes)\n\t\t{\n\t\t\tstd::unique_lock<std::shared_mutex> Unique(Target.Mutex);\n\t\t\tEvict(Target, Limit, Time, nullptr);\n\t\t}\n\t}\n\tvoid SharedCache::SetPolicy(CachePolicy NewPolicy)\n\t{\n\t\tPolicy = NewPolicy;\n\t}\n\tsize_t SharedCache::GetEntryLimit() const\n\t{\n\t\treturn Budget / CACHE_STRIPES;\n\t}\n\tvoid SharedCache::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->ImportSystemAddon(\"ctypes\");\n\t\tVM->ImportSystemAddon(\"string\");\n\t\tVM->BeginNamespace(\"cache\");\n\t\tauto VPolicy = VM->SetEnum(\"policy\");\n\t\tVPolicy->SetValue(\"lru\", (int)CachePolicy::LRU);\n\t\tVPolicy->SetValue(\"lfu\", (int)CachePolicy::LFU);\n\t\tVM->SetFunction(\"bool set(const string&in, const string&in, uint64 = 0)\", &SharedCache::ScriptSet);\n\t\tVM->SetFunction(\"bool get(const string&in, string&out)\", &SharedCache::ScriptGet);\n\t\tVM->SetFunction(\"bo";
+		dc_executable_cache_cpp += "ol has(const string&in)\", &SharedCache::ScriptHas);\n\t\tVM->SetFunction(\"bool erase(const string&in)\", &SharedCache::ScriptErase);\n\t\tVM->SetFunction(\"void clear()\", &SharedCache::ScriptClear);\n\t\tVM->SetFunction(\"void set_budget(usize)\", &SharedCache::ScriptSetBudget);\n\t\tVM->SetFunction(\"void set_policy(policy)\", &SharedCache::ScriptSetPolicy);\n\t\tVM->SetFunction(\"usize size()\", &SharedCache::ScriptGetSize);\n\t\tVM->SetFunction(\"usize get_bytes()\", &SharedCache::ScriptGetBytes);\n\t\tVM->SetFunction(\"uint64 get_hits()\", &SharedCache::ScriptGetHits);\n\t\tVM->SetFunction(\"uint64 get_misses()\", &SharedCache::ScriptGetMisses);\n\t\tVM->SetFunction(\"uint64 get_evictions()\", &SharedCache::ScriptGetEvictions);\n\t\tVM->SetFunction(\"uint64 get_expirations()\", &SharedCache::ScriptGetExpirations);\n\t\tVM->SetFunction(\"uint64 get_rejections()\", &SharedCache::ScriptGetRejections);\n\t\tVM->SetFunction(\"usize get_entry_limit()\", &SharedCache::ScriptGetEntryLimit);\n\t\tVM->EndNamespace();\n\t\tGet();\n\t}\n\tvoid SharedCache::Cleanup()\n\t{\n\t\tMemory::Delete(Instance);\n\t}\n\tSharedCache* SharedCache::Get()\n\t{\n\t\tstatic std::mutex Initialization;\n\t\tUMutex<std::mutex> Unique(Initialization);\n\t\tif (!Instance)\n\t\t\tInstance = Memory::New<SharedCache>(64 * 1024 * 1024);\n\t\treturn Instance;\n\t}\n\tSharedCache::Stripe& SharedCache::GetStripe(const String& Key)\n\t{\n\t\tsize_t Hash = std::hash<String>()(Key);\n\t\treturn Stripes[(Hash ^ (Hash >> 17)) % CACHE_STRIPES];\n\t}\n\tvoid SharedCache::Evict(Stripe& Target, size_t Limit, int64_t Time, const String* Keep)\n\t{\n\t\tCachePolicy Type = Policy;\n\t\twhile (Target.Bytes > Limit && !Target.Entries.empty())\n\t\t{\n\t\t\tsize_t Buckets = Target.Entries.bucket_count();\n\t\t\tsize_t Bucket = (size_t)Time * 2654435761u % Buckets;\n\t\t\tauto Victim = Target.Entries.end();\n\t\t\tsize_t Samples = 0;\n\t\t\tfor (size_t i = 0; i < Buckets && Samples < CACHE_SAMPLES; i++)\n\t\t\t{\n\t\t\t\tsize_t Index = (Bucket + i) % Buckets;\n\t\t\t\tfor (auto Next = Target.Entries.begin(Index); Next != Target.Entries.end(Index) && Samples < CACHE_SAMPLES; ++Next, ++Samples)\n\t\t\t\t{\n\t\t\t\t\tif (Keep != nullptr && Next->first == *Keep)\n\t\t\t\t\t\tcontinue;\n\n\t\t\t\t\tauto It = Target.Entries.find(Next->first);\n\t\t\t\t\tif (It->second.Expires > 0 && It->second.Expires <= Time)\n\t\t\t\t\t{\n\t\t\t\t\t\tVictim = It;\n\t\t\t\t\t\tSamples = CACHE_SAMPLES;\n\t\t\t\t\t\tbreak;\n\t\t\t\t\t}\n\t\t\t\t\telse if (Victim == Target.Entries.end())\n\t\t\t\t\t\tVictim = It;\n\t\t\t\t\telse if (Type == CachePolicy::LFU && It->second.Frequency < Victim->second.Frequency)\n\t\t\t\t\t\tVictim = It;\n\t\t\t\t\telse if ((Type == CachePolicy::LRU || It->second.Frequency == Victim->second.Frequency) && It->second.Access < Victim->second.Access)\n\t\t\t\t\t\tVictim = It;\n\t\t\t\t}\n\t\t\t}\n\n\t\t\tif (Victim == Target.Entries.end())\n\t\t\t\tbreak;\n\n\t\t\tif (Victim->second.Expires > 0 && Victim->second.Expires <= Time)\n\t\t\t\t++Expirations;\n\t\t\telse\n\t\t\t\t++Evictions;\n\t\t\tRemove(Target, Victim);\n\t\t\t++Time;\n\t\t}\n\t}\n\tvoid SharedCache::Remove(Stripe& Target, UnorderedMap<String, CacheEntry>::iterator It)\n\t{\n\t\tsize_t Size = GetEntrySize(It->first, It->second.Value);\n\t\tTarget.Bytes -= Size;\n\t\tBytes -= Size;\n\t\t--Count;\n\t\tTarget.Entries.erase(It);\n\t}\n\tint64_t SharedCache::GetTime()\n\t{\n\t\treturn std::chrono::duration_cast<std::chrono::milliseconds>(Schedule::GetClock()).count();\n\t}\n\tsize_t SharedCache::GetEntrySize(const String& Key, const String& Value)\n\t{\n\t\treturn Key.size() + Value.size() + sizeof(CacheEntry);\n\t}\n\tbool SharedCache::ScriptSet(const String& Key, const String& Value, uint64_t Timeout)\n\t{\n\t\treturn Instance->Set(Key, Value, Timeout);\n\t}\n\tbool SharedCache::ScriptGet(const String& Key, String& Value)\n\t{\n\t\treturn Instance->Get(Key, Value);\n\t}\n\tbool SharedCache::ScriptHas(const String& Key)\n\t{\n\t\treturn Instance->Has(Key);\n\t}\n\tbool SharedCache::ScriptErase(const String& Key)\n\t{\n\t\treturn Instance->Erase(Key);\n\t}\n\tvoid SharedCache::ScriptClear()\n\t{\n\t\tInstance->Clear();\n\t}\n\tvoid SharedCache::ScriptSetBudget(size_t MaxBytes)\n\t{\n\t\tInstance->SetBudget(MaxBytes);\n\t}\n\tvoid SharedCache::ScriptSetPolicy(CachePolicy NewPolicy)\n\t{\n\t\tInstance->SetPolicy(NewPolicy);\n\t}\n\tsize_t SharedCache::ScriptGetSize()\n\t{\n\t\treturn Instance->Count;\n\t}\n\tsize_t SharedCache::Sc";
+		dc_executable_cache_cpp += "riptGetBytes()\n\t{\n\t\treturn Instance->Bytes;\n\t}\n\tuint64_t SharedCache::ScriptGetHits()\n\t{\n\t\treturn Instance->Hits;\n\t}\n\tuint64_t SharedCache::ScriptGetMisses()\n\t{\n\t\treturn Instance->Misses;\n\t}\n\tuint64_t SharedCache::ScriptGetEvictions()\n\t{\n\t\treturn Instance->Evictions;\n\t}\n\tuint64_t SharedCache::ScriptGetExpirations()\n\t{\n\t\treturn Instance->Expirations;\n\t}\n\tuint64_t SharedCache::ScriptGetRejections()\n\t{\n\t\treturn Instance->Rejections;\n\t}\n\tsize_t SharedCache::ScriptGetEntryLimit()\n\t{\n\t\treturn Instance->GetEntryLimit();\n\t}\n\tSharedCache* SharedCache::Instance = nullptr;\n}";
+		callback(context, "executable/cache.cpp", dc_executable_cache_cpp.c_str(), (unsigned int)dc_executable_cache_cpp.size());
+
+		const char* sc_executable_cache_h = "#ifndef CACHE_H\n#define CACHE_H\n#include \"runtime.hpp\"\n#include <vengeance/vengeance.h>\n#include <shared_mutex>\n#define CACHE_STRIPES 64\n#define CACHE_SAMPLES 5\n\nnamespace ASX\n{\n\tenum class CachePolicy\n\t{\n\t\tLRU,\n\t\tLFU\n\t};\n\n\tstruct CacheEntry\n\t{\n\t\tString Value;\n\t\tint64_t Expires = 0;\n\t\tstd::atomic<int64_t> Access = 0;\n\t\tstd::atomic<uint32_t> Frequency = 0;\n\t};\n\n\tclass SharedCache\n\t{\n\tprivate:\n\t\tstruct Stripe\n\t\t{\n\t\t\tUnorderedMap<String, CacheEntry> Entries;\n\t\t\tstd::shared_mutex Mutex;\n\t\t\tsize_t Bytes = 0;\n\t\t};\n\n\tprivate:\n\t\tstatic SharedCache* Instance;\n\n\tprivate:\n\t\tStripe Stripes[CACHE_STRIPES];\n\t\tstd::atomic<size_t> Budget;\n\t\tstd::atomic<size_t> Bytes;\n\t\tstd::atomic<size_t> Count;\n\t\tstd::atomic<uint64_t> Hits;\n\t\tstd::atomic<uint64_t> Misses;\n\t\tstd::atomic<uint64_t> Evictions;\n\t\tstd::atomic<uint64_t> Expirations;\n\t\tstd::atomic<uint64_t> Rejections;\n\t\tstd::atomic<CachePolicy> Policy;\n\n\tpublic:\n\t\tSharedCache(size_t MaxBytes);\n\t\tbool Set(const String& Key, const String& Value, uint64_t Timeout);\n\t\tbool Get(const String& Key, String& Value);\n\t\tbool Has(const String& Key);\n\t\tbool Erase(const String& Key);\n\t\tvoid Clear();\n\t\tvoid SetBudget(size_t MaxBytes);\n\t\tvoid SetPolicy(CachePolicy NewPolicy);\n\t\tsize_t GetEntryLimit() const;\n\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\t\tstatic void Cleanup();\n\t\tstatic SharedCache* Get();\n\n\tprivate:\n\t\tStripe& GetStripe(const String& Key);\n\t\tvoid Evict(Stripe& Target, size_t Limit, int64_t Time, const String* Keep);\n\t\tvoid Remove(Stripe& Target, UnorderedMap<String, CacheEntry>::iterator It);\n\t\tstatic int64_t GetTime();\n\t\tstatic size_t GetEntrySize(const String& Key, const String& Value);\n\t\tstatic bool ScriptSet(const String& Key, const String& Value, uint64_t Timeout);\n\t\tstatic bool ScriptGet(const String& Key, String& Value);\n\t\tstatic bool ScriptHas(const String& Key);\n\t\tstatic bool ScriptErase(const String& Key);\n\t\tstatic void ScriptClear();\n\t\tstatic void ScriptSetBudget(size_t MaxBytes);\n\t\tstatic void ScriptSetPolicy(CachePolicy NewPolicy);\n\t\tstatic size_t ScriptGetSize();\n\t\tstatic size_t ScriptGetBytes();\n\t\tstatic uint64_t ScriptGetHits();\n\t\tstatic uint64_t ScriptGetMisses();\n\t\tstatic uint64_t ScriptGetEvictions();\n\t\tstatic uint64_t ScriptGetExpirations();\n\t\tstatic uint64_t ScriptGetRejections();\n\t\tstatic size_t ScriptGetEntryLimit();\n\t};\n}\n#endif";
+		callback(context, "executable/cache.h", sc_executable_cache_h, 2331);
+
+		std::string dc_executable_isolate_cpp;
+		dc_executable_isolate_cpp.reserve(9617);
+		dc_executable_isolate_cpp += "#include \"isolate.h\"\n\nnamespace ASX\n{\n\tChannel::Channel() : Closed(false)\n\t{\n\t}\n\tbool Channel::Push(String&& Message)\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tif (Closed)\n\t\t\treturn false;\n\n\t\tQueue.push(std::move(Message));\n\t\tCondition.notify_one();\n\t\treturn true;\n\t}\n\tbool Channel::Pop(String& Message)\n\t{\n\t\tstd::unique_lock<std::mutex> Unique(Mutex);\n\t\tCondition.wait(Unique, [this]() { return !Queue.empty() || Closed; });\n\t\tif (Queue.empty())\n\t\t\treturn false;\n\n\t\tMessage = std::move(Queue.front());\n\t\tQueue.pop();\n\t\treturn true;\n\t}\n\tvoid Channel::Close()\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tClosed = true;\n\t\tCondition.notify_all();\n\t}\n\n\tIsolateWorker::IsolateWorker() : Context(nullptr), Loop(nullptr), Aborted(false), ExitCode((int)ExitStatus::InputError)\n\t{\n\t}\n\tbool IsolateWorker::Attach(ImmediateContext* NewContext, EventLoop* NewLoop)\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tContext = NewContext;\n\t\tLoop = NewLoop;\n\t\treturn !Aborted;\n\t}\n\tvoid IsolateWorker::Abort()\n\t{\n\t\tInbox.Close();\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tAborted = true;\n\t\tif (Context != nullptr)\n\t\t\tContext->Abort();\n\t\tif (Loop != nullptr)\n\t\t\tLoop->Wakeup();\n\t}\n\n\tIsolate::Isolate(const String& NewPath) : Worker(new IsolateWorker())\n\t{\n\t\tauto* VM = VirtualMachine::Get();\n\t\tString Directory = VM != nullptr ? String(VM->GetModuleDirectory()) : String();\n\t\tauto Target = OS::Path::Resolve(NewPath, Directory.empty() ? *OS::Directory::GetWorking() : Directory, true);\n\t\tif (!Target || !OS::File::IsExists(Target->c_str()))\n\t\t{\n\t\t\tauto* Context = ImmediateContext::Get();\n\t\t\tif (Context != nullptr)\n\t\t\t\tContext->SetException(Stringify::Text(\"isolate module <%s> does not exist\", NewPath.c_str()).c_str());\n\t\t\tWorker->Inbox.Close();\n\t\t\tWorker->Outbox.Close();\n\t\t\treturn;\n\t\t}\n\n\t\tIsolateWorker* Base = Worker;\n\t\tBase->Path = *Target;\n\t\tBase->AddRef();\n\t\tThread = std::thread([Base]()\n\t\t{\n\t\t\tCurrent = Base;\n\t\t\tBase->ExitCode = Execute(Base);\n\t\t\tBase->Outbox.Close();\n\t\t\tCurrent = nullptr;\n\t\t\tBase->Release();\n\t\t\tVirtualMachine::CleanupThisThread();\n\t\t});\n\t}\n\tIsolate::~Isolate()\n\t{\n\t\tif (Thread.joinable())\n\t\t{\n\t\t\tWorker->Abort();\n\t\t\tThread.detach();\n\t\t}\n\t\tWorker->Release();\n\t}\n\tbool Isolate::Send(const String& Message)\n\t{\n\t\treturn Worker->Inbox.Push(String(Message));\n\t}\n\tbool Isolate::Receive(String& Message)\n\t{\n\t\treturn Worker->Outbox.Pop(Message);\n\t}\n\tint Isolate::Join()\n\t{\n\t\tWorker->Inbox.Close();\n\t\tif (Thread.joinable())\n\t\t\tThread.join();\n\t\treturn Worker->ExitCode;\n\t}\n\tbool Isolate::IsActive() const\n\t{\n\t\treturn Thread.joinable();\n\t}\n\tvoid Isolate::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->ImportSystemAddon(\"string\");\n\t\tauto VIsolate = VM->SetClass<Isolate>(\"isolate\", false);\n\t\tVIsolate->SetConstructor<Isolate, const String&>(\"isolate@ f(const string&in)\");\n\t\tVIsolate->SetMethod(\"bool send(const string&in)\", &Isolate::Send);\n\t\tVIsolate->SetMethod(\"bool receive(string&out)\", &Isolate::Receive);\n\t\tVIsolate->SetMethod(\"int join()\", &Isolate::Join);\n\t\tVIsolate->SetMethod(\"bool is_active() const\", &Isolate::IsActive);\n\t\tVM->BeginNamespace(\"this_isolate\");\n\t\tVM->SetFunction(\"bool send(const string&in)\", &Isolate::SendParent);\n\t\tVM->SetFunction(\"bool receive(string&out)\", &Isolate::ReceiveParent);\n\t\tVM->SetFunction(\"bool is_active()\", &Isolate::IsChild);\n\t\tVM->EndNamespace();\n\t}\n\tint Isolate::Execute(IsolateWorker* Base)\n\t{\n\t\tconst String& Path = Base->Path;\n\t\tUPtr<VirtualMachine> VM = new VirtualMachine();\n\t\tBindings::HeavyRegistry().BindAddons(*VM);\n\t\tBindings::Tags::BindSyntax(*VM, true, [](VirtualMachine*, Bindings::Tags::TagInfo&&) { });\n\t\tVM->SetModuleDirectory(OS::Path::GetDirectory(Path.c_str()));\n\t\tModules::BindSyntax(*VM);\n\n\t\tEnvironmentConfig Env;\n\t\tString Module = String(OS::Path::GetFilename(Path));\n\t\tEnv.Module = Module.c_str();\n\t\tEnv.Path = Path;\n\n\t\tif (!OS::File::GetState(Path, &Env.File))\n\t\t{\n\t\t\tVI_ERR(\"cannot read <%s> isolate module\", Env.Module);\n\t\t\treturn (int)ExitStatus::InputError;\n\t\t}\n\n\t\tauto Program = OS::File::ReadAsString(Path);\n\t\tif (!Program)\n\t\t{\n\t\t\tVI_ERR(\"cannot read <%s> isolate module\", Env.Module);\n\t\t\treturn (int)ExitStatus::InputError;\n\t\t}\n\n\t\tSourc";
+		dc_executable_isolate_cpp += "eCache Sources;\n\t\tEnv.Program = std::move(*Program);\n\t\tUPtr<Compiler> Unit = VM->CreateCompiler();\n\t\tUnit->GetProcessor()->AddDefaultDefinitions();\n\t\tUnit->SetIncludeCallback([&Sources](Preprocessor*, const IncludeResult& File, String& Output) -> ExpectsPreprocessor<IncludeType>\n\t\t{\n\t\t\tif (!File.IsFile || File.Module.empty() || File.Module.front() == '@')\n\t\t\t\treturn IncludeType::Unchanged;\n\n\t\t\treturn Sources.Resolve(File.Module, Output);\n\t\t});\n\n\t\tauto Status = Unit->Prepare(Env.Module);\n\t\tif (!Status)\n\t\t{\n\t\t\tVI_ERR(\"cannot prepare <%s> isolate module scope\\n  %s\", Env.Module, Status.Error().what());\n\t\t\treturn (int)ExitStatus::PrepareError;\n\t\t}\n\n\t\tbool Owner = false;\n\t\tif (!LoadImage(*Unit, Env, Owner))\n\t\t{\n\t\t\tint Compiled = Compile(*Unit, Env);\n\t\t\tif (Owner)\n\t\t\t\tSaveImage(Compiled == (int)ExitStatus::OK ? *Unit : nullptr, Env, Sources);\n\t\t\tif (Compiled != (int)ExitStatus::OK)\n\t\t\t\treturn Compiled;\n\t\t}\n\n\t\tProgramEntrypoint Entrypoint;\n\t\tFunction Main = Runtime::GetEntrypoint(Env, Entrypoint, *Unit);\n\t\tif (!Main.IsValid())\n\t\t\treturn (int)ExitStatus::EntrypointError;\n\n\t\tint Result = 0;\n\t\tUPtr<ImmediateContext> Context = VM->RequestContext();\n\t\tUPtr<EventLoop> Loop = new EventLoop();\n\t\tEventLoop* Queue = *Loop;\n\t\tLoop->Listen(*Context);\n\t\tMain.AddRef();\n\t\tLoop->Enqueue(FunctionDelegate(Main, *Context), [](ImmediateContext*) { }, [&Result, &Main, Queue](ImmediateContext* Context)\n\t\t{\n\t\t\tResult = Main.GetReturnTypeId() == (int)TypeId::VOIDF ? 0 : (int)Context->GetReturnDWord();\n\t\t\tQueue->Wakeup();\n\t\t});\n\n\t\tSystemConfig Config;\n\t\tConfig.MemoryLimit = Runtime::GetMemoryLimit();\n\t\tif (Base->Attach(*Context, Queue))\n\t\t\tRuntime::AwaitLoop(Config, Queue, *VM, *Context);\n\t\telse\n\t\t\tResult = (int)ExitStatus::Kill;\n\n\t\tBase->Attach(nullptr, nullptr);\n\t\tEventLoop::Set(nullptr);\n\t\tContext->Reset();\n\t\tVM->PerformFullGarbageCollection();\n\t\treturn Result;\n\t}\n\tint Isolate::Compile(Compiler* Unit, EnvironmentConfig& Env)\n\t{\n\t\tauto Status = Unit->LoadCode(Env.Path, Env.Program);\n\t\tif (!Status)\n\t\t{\n\t\t\tVI_ERR(\"cannot load <%s> isolate module script code\\n  %s\", Env.Module, Status.Error().what());\n\t\t\treturn (int)ExitStatus::LoadingError;\n\t\t}\n\n\t\tStatus = Unit->Compile().Get();\n\t\tif (!Status)\n\t\t{\n\t\t\tVI_ERR(\"cannot compile <%s> isolate module\\n  %s\", Env.Module, Status.Error().what());\n\t\t\treturn (int)ExitStatus::CompilerError;\n\t\t}\n\n\t\treturn (int)ExitStatus::OK;\n\t}\n\tbool Isolate::LoadImage(Compiler* Unit, EnvironmentConfig& Env, bool& Owner)\n\t{\n\t\tByteCodeInfo Info;\n\t\tVector<String> Addons;\n\t\t{\n\t\t\tstd::unique_lock<std::mutex> Unique(ImagesMutex);\n\t\t\tif (!Images)\n\t\t\t\tImages = Memory::New<UnorderedMap<String, ModuleImage>>();\n\n\t\t\twhile (true)\n\t\t\t{\n\t\t\t\tauto It = Images->find(Env.Path);\n\t\t\t\tif (It != Images->end() && It->second.Compiling)\n\t\t\t\t{\n\t\t\t\t\tImagesCondition.wait(Unique);\n\t\t\t\t\tcontinue;\n\t\t\t\t}\n\t\t\t\telse if (It == Images->end() || !IsImageCurrent(It->second, Env))\n\t\t\t\t{\n\t\t\t\t\tModuleImage& Image = (*Images)[Env.Path];\n\t\t\t\t\tImage = ModuleImage();\n\t\t\t\t\tImage.Compiling = true;\n\t\t\t\t\tOwner = true;\n\t\t\t\t\treturn false;\n\t\t\t\t}\n\n\t\t\t\tInfo = It->second.Info;\n\t\t\t\tAddons = It->second.Addons;\n\t\t\t\tbreak;\n\t\t\t}\n\t\t}\n\n\t\tauto* VM = Unit->GetVM();\n\t\tUnorderedSet<String> Exposed;\n\t\tfor (auto& Item : VM->GetSystemAddons())\n\t\t{\n\t\t\tif (Item.second.Exposed)\n\t\t\t\tExposed.insert(Item.first);\n\t\t}\n\n\t\tfor (auto& Name : Addons)\n\t\t{\n\t\t\tif (Exposed.count(Name) > 0 || VM->ImportSystemAddon(Name))\n\t\t\t\tcontinue;\n\n\t\t\tVI_WARN(\"cannot import <%s> system addon for <%s> isolate module image: recompiling\", Name.c_str(), Env.Path.c_str());\n\t\t\treturn false;\n\t\t}\n\n\t\tif (Unit->LoadByteCode(&Info).Get())\n\t\t\treturn true;\n\n\t\tVI_WARN(\"cannot load <%s> isolate module image: recompiling\", Env.Path.c_str());\n\t\tUnit->Prepare(Env.Module);\n\t\treturn false;\n\t}\n\tvoid Isolate::SaveImage(Compiler* Unit, EnvironmentConfig& Env, const SourceCache& Sources)\n\t{\n\t\tModuleImage Image;\n\t\tImage.Info.Debug = true;\n\t\tbool Success = Unit != nullptr && Unit->SaveByteCode(&Image.Info);\n\t\tif (Success)\n\t\t{\n\t\t\tImage.Dependencies = Sources.GetDependencies();\n\t\t\tImage.Dependencies[Env.Path] = SourceCache::GetHash(Env.Program);\n\t\t\tfor (auto";
+		dc_executable_isolate_cpp += "& Item : Unit->GetVM()->GetSystemAddons())\n\t\t\t{\n\t\t\t\tif (Item.second.Exposed)\n\t\t\t\t\tImage.Addons.push_back(Item.first);\n\t\t\t}\n\t\t}\n\n\t\tUMutex<std::mutex> Unique(ImagesMutex);\n\t\tauto It = Images->find(Env.Path);\n\t\tif (It != Images->end() && It->second.Compiling)\n\t\t{\n\t\t\tif (Success)\n\t\t\t\tIt->second = std::move(Image);\n\t\t\telse\n\t\t\t\tImages->erase(It);\n\t\t}\n\t\tImagesCondition.notify_all();\n\t}\n\tbool Isolate::IsImageCurrent(const ModuleImage& Image, EnvironmentConfig& Env)\n\t{\n\t\tfor (auto& Next : Image.Dependencies)\n\t\t{\n\t\t\tif (Next.first == Env.Path)\n\t\t\t{\n\t\t\t\tif (SourceCache::GetHash(Env.Program) != Next.second)\n\t\t\t\t\treturn false;\n\t\t\t\tcontinue;\n\t\t\t}\n\n\t\t\tauto Source = OS::File::ReadAsString(Next.first);\n\t\t\tif (!Source || SourceCache::GetHash(*Source) != Next.second)\n\t\t\t\treturn false;\n\t\t}\n\n\t\treturn !Image.Dependencies.empty();\n\t}\n\tvoid Isolate::Cleanup()\n\t{\n\t\tUMutex<std::mutex> Unique(ImagesMutex);\n\t\tMemory::Delete(Images);\n\t}\n\tbool Isolate::SendParent(const String& Message)\n\t{\n\t\treturn Current != nullptr && Current->Outbox.Push(String(Message));\n\t}\n\tbool Isolate::ReceiveParent(String& Message)\n\t{\n\t\treturn Current != nullptr && Current->Inbox.Pop(Message);\n\t}\n\tbool Isolate::IsChild()\n\t{\n\t\treturn Current != nullptr;\n\t}\n\tUnorderedMap<String, ModuleImage>* Isolate::Images = nullptr;\n\tstd::condition_variable Isolate::ImagesCondition;\n\tstd::mutex Isolate::ImagesMutex;\n\tthread_local IsolateWorker* Isolate::Current = nullptr;\n}";
+		callback(context, "executable/isolate.cpp", dc_executable_isolate_cpp.c_str(), (unsigned int)dc_executable_isolate_cpp.size());
+
+		const char* sc_executable_isolate_h = "#ifndef ISOLATE_H\n#define ISOLATE_H\n#include \"runtime.hpp\"\n#include \"sources.h\"\n#include <vengeance/vengeance.h>\n\nnamespace ASX\n{\n\tclass Channel\n\t{\n\tprivate:\n\t\tSingleQueue<String> Queue;\n\t\tstd::condition_variable Condition;\n\t\tstd::mutex Mutex;\n\t\tbool Closed;\n\n\tpublic:\n\t\tChannel();\n\t\tbool Push(String&& Message);\n\t\tbool Pop(String& Message);\n\t\tvoid Close();\n\t};\n\n\tstruct ModuleImage\n\t{\n\t\tByteCodeInfo Info;\n\t\tUnorderedMap<String, uint64_t> Dependencies;\n\t\tVector<String> Addons;\n\t\tbool Compiling = false;\n\t};\n\n\tclass IsolateWorker : public Reference<IsolateWorker>\n\t{\n\tprivate:\n\t\tImmediateContext* Context;\n\t\tEventLoop* Loop;\n\t\tstd::mutex Mutex;\n\t\tbool Aborted;\n\n\tpublic:\n\t\tChannel Inbox;\n\t\tChannel Outbox;\n\t\tString Path;\n\t\tstd::atomic<int> ExitCode;\n\n\tpublic:\n\t\tIsolateWorker();\n\t\tbool Attach(ImmediateContext* NewContext, EventLoop* NewLoop);\n\t\tvoid Abort();\n\t};\n\n\tclass Isolate : public Reference<Isolate>\n\t{\n\tprivate:\n\t\tstatic UnorderedMap<String, ModuleImage>* Images;\n\t\tstatic std::condition_variable ImagesCondition;\n\t\tstatic std::mutex ImagesMutex;\n\t\tstatic thread_local IsolateWorker* Current;\n\n\tprivate:\n\t\tIsolateWorker* Worker;\n\t\tstd::thread Thread;\n\n\tpublic:\n\t\tIsolate(const String& NewPath);\n\t\t~Isolate();\n\t\tbool Send(const String& Message);\n\t\tbool Receive(String& Message);\n\t\tint Join();\n\t\tbool IsActive() const;\n\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\t\tstatic void Cleanup();\n\n\tprivate:\n\t\tstatic int Execute(IsolateWorker* Base);\n\t\tstatic int Compile(Compiler* Unit, EnvironmentConfig& Env);\n\t\tstatic bool LoadImage(Compiler* Unit, EnvironmentConfig& Env, bool& Owner);\n\t\tstatic void SaveImage(Compiler* Unit, EnvironmentConfig& Env, const SourceCache& Sources);\n\t\tstatic bool IsImageCurrent(const ModuleImage& Image, EnvironmentConfig& Env);\n\t\tstatic bool SendParent(const String& Message);\n\t\tstatic bool ReceiveParent(String& Message);\n\t\tstatic bool IsChild();\n\t};\n}\n#endif";
+		callback(context, "executable/isolate.h", sc_executable_isolate_h, 1907);
+
+		std::string dc_executable_json_cpp;
+		dc_executable_json_cpp.reserve(13402);
+		dc_executable_json_cpp += "#include \"json.h\"\n#include <charconv>\n\nnamespace ASX\n{\n\tstatic inline bool IsJsonWhitespace(char Value)\n\t{\n\t\treturn Value == ' ' || Value == '\\t' || Value == '\\n' || Value == '\\r';\n\t}\n\tstatic inline bool IsJsonNumeric(char Value)\n\t{\n\t\treturn (Value >= '0' && Value <= '9') || Value == '-' || Value == '+' || Value == '.' || Value == 'e' || Value == 'E';\n\t}\n\tstatic inline int GetJsonHex(char Value)\n\t{\n\t\tif (Value >= '0' && Value <= '9')\n\t\t\treturn Value - '0';\n\t\telse if (Value >= 'a' && Value <= 'f')\n\t\t\treturn Value - 'a' + 10;\n\t\telse if (Value >= 'A' && Value <= 'F')\n\t\t\treturn Value - 'A' + 10;\n\t\treturn -1;\n\t}\n\tstatic void AppendUTF8(String& Output, uint32_t Code)\n\t{\n\t\tif (Code < 0x80)\n\t\t\tOutput.push_back((char)Code);\n\t\telse if (Code < 0x800)\n\t\t{\n\t\t\tOutput.push_back((char)(0xC0 | (Code >> 6)));\n\t\t\tOutput.push_back((char)(0x80 | (Code & 0x3F)));\n\t\t}\n\t\telse if (Code < 0x10000)\n\t\t{\n\t\t\tOutput.push_back((char)(0xE0 | (Code >> 12)));\n\t\t\tOutput.push_back((char)(0x80 | ((Code >> 6) & 0x3F)));\n\t\t\tOutput.push_back((char)(0x80 | (Code & 0x3F)));\n\t\t}\n\t\telse\n\t\t{\n\t\t\tOutput.push_back((char)(0xF0 | (Code >> 18)));\n\t\t\tOutput.push_back((char)(0x80 | ((Code >> 12) & 0x3F)));\n\t\t\tOutput.push_back((char)(0x80 | ((Code >> 6) & 0x3F)));\n\t\t\tOutput.push_back((char)(0x80 | (Code & 0x3F)));\n\t\t}\n\t}\n\n\tJsonReader::JsonReader() : State(Expectation::Value), Offset(0), Number(0.0), Boolean(false), Finished(false), Failed(false), Empty(true)\n\t{\n\t}\n\tvoid JsonReader::Feed(const String& Data)\n\t{\n\t\tif (Offset > 0)\n\t\t{\n\t\t\tBuffer.erase(0, Offset);\n\t\t\tOffset = 0;\n\t\t}\n\t\tBuffer.append(Data);\n\t\tValue = std::string_view();\n\t\tSource = std::string_view();\n\t}\n\tvoid JsonReader::Finish()\n\t{\n\t\tFinished = true;\n\t}\n\tJsonEvent JsonReader::Next()\n\t{\n\t\tif (Failed)\n\t\t\treturn JsonEvent::Error;\n\n\t\twhile (true)\n\t\t{\n\t\t\twhile (Offset < Buffer.size() && IsJsonWhitespace(Buffer[Offset]))\n\t\t\t\t++Offset;\n\n\t\t\tif (Offset >= Buffer.size())\n\t\t\t{\n\t\t\t\tif (!Finished)\n\t\t\t\t\treturn JsonEvent::Need;\n\t\t\t\telse if (Scopes.empty() && !Empty && (State == Expectation::Done || State == Expectation::Value))\n\t\t\t\t\treturn JsonEvent::End;\n\t\t\t\treturn Fail();\n\t\t\t}\n\n\t\t\tchar Next = Buffer[Offset];\n\t\t\tswitch (State)\n\t\t\t{\n\t\t\t\tcase Expectation::Done:\n\t\t\t\t\tState = Expectation::Value;\n\t\t\t\t\tcontinue;\n\t\t\t\tcase Expectation::ValueOrEnd:\n\t\t\t\t\tif (Next == ']')\n\t\t\t\t\t{\n\t\t\t\t\t\t++Offset;\n\t\t\t\t\t\treturn CloseScope('[');\n\t\t\t\t\t}\n\t\t\t\t\treturn ReadValue();\n\t\t\t\tcase Expectation::Value:\n\t\t\t\t\treturn ReadValue();\n\t\t\t\tcase Expectation::KeyOrEnd:\n\t\t\t\t\tif (Next == '}')\n\t\t\t\t\t{\n\t\t\t\t\t\t++Offset;\n\t\t\t\t\t\treturn CloseScope('{');\n\t\t\t\t\t}\n\t\t\t\t\treturn Next == '\"' ? ReadString(JsonEvent::Key) : Fail();\n\t\t\t\tcase Expectation::Key:\n\t\t\t\t\treturn Next == '\"' ? ReadString(JsonEvent::Key) : Fail();\n\t\t\t\tcase Expectation::Colon:\n\t\t\t\t\tif (Next != ':')\n\t\t\t\t\t\treturn Fail();\n\t\t\t\t\t++Offset;\n\t\t\t\t\tState = Expectation::Value;\n\t\t\t\t\tcontinue;\n\t\t\t\tcase Expectation::CommaOrEnd:\n\t\t\t\t\tif (Next == ',')\n\t\t\t\t\t{\n\t\t\t\t\t\t++Offset;\n\t\t\t\t\t\tState = Scopes.back() == '{' ? Expectation::Key : Expectation::Value;\n\t\t\t\t\t\tcontinue;\n\t\t\t\t\t}\n\t\t\t\t\telse if (Next == '}' || Next == ']')\n\t\t\t\t\t{\n\t\t\t\t\t\t++Offset;\n\t\t\t\t\t\treturn CloseScope(Next == '}' ? '{' : '[');\n\t\t\t\t\t}\n\t\t\t\t\treturn Fail();\n\t\t\t\tdefault:\n\t\t\t\t\treturn Fail();\n\t\t\t}\n\t\t}\n\t}\n\tconst std::string_view& JsonReader::GetValue() const\n\t{\n\t\treturn Value;\n\t}\n\tconst std::string_view& JsonReader::GetSource() const\n\t{\n\t\treturn Source;\n\t}\n\tString JsonReader::GetString() const\n\t{\n\t\treturn String(Value);\n\t}\n\tString JsonReader::GetRaw() const\n\t{\n\t\treturn String(Source);\n\t}\n\tdouble JsonReader::GetNumber() const\n\t{\n\t\treturn Number;\n\t}\n\tbool JsonReader::GetBoolean() const\n\t{\n\t\treturn Boolean;\n\t}\n\tsize_t JsonReader::GetDepth() const\n\t{\n\t\treturn Scopes.size();\n\t}\n\tvoid JsonReader::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->ImportSystemAddon(\"ctypes\");\n\t\tVM->ImportSystemAddon(\"string\");\n\t\tauto VEvent = VM->SetEnum(\"json_event\");\n\t\tVEvent->SetValue(\"need\", (int)JsonEvent::Need);\n\t\tVEvent->SetValue(\"begin_object\", (int)JsonEvent::BeginObject);\n\t\tVEvent->SetValue(\"end_object\", (int)JsonEvent::EndObject);\n\t\tVEvent->SetValue(\"begin_array\", (int)JsonEvent::BeginArray);\n\t\tVEvent->SetVa";
+		dc_executable_json_cpp += "lue(\"end_array\", (int)JsonEvent::EndArray);\n\t\tVEvent->SetValue(\"key\", (int)JsonEvent::Key);\n\t\tVEvent->SetValue(\"string_value\", (int)JsonEvent::String);\n\t\tVEvent->SetValue(\"number_value\", (int)JsonEvent::Number);\n\t\tVEvent->SetValue(\"boolean_value\", (int)JsonEvent::Boolean);\n\t\tVEvent->SetValue(\"null_value\", (int)JsonEvent::Null);\n\t\tVEvent->SetValue(\"end\", (int)JsonEvent::End);\n\t\tVEvent->SetValue(\"error\", (int)JsonEvent::Error);\n\n\t\tauto VReader = VM->SetClass<JsonReader>(\"json_reader\", false);\n\t\tVReader->SetConstructor<JsonReader>(\"json_reader@ f()\");\n\t\tVReader->SetMethod(\"void feed(const string&in)\", &JsonReader::Feed);\n\t\tVReader->SetMethod(\"void finish()\", &JsonReader::Finish);\n\t\tVReader->SetMethod(\"json_event next()\", &JsonReader::Next);\n\t\tVReader->SetMethod(\"string get_string() const\", &JsonReader::GetString);\n\t\tVReader->SetMethod(\"string get_raw() const\", &JsonReader::GetRaw);\n\t\tVReader->SetMethod(\"double get_number() const\", &JsonReader::GetNumber);\n\t\tVReader->SetMethod(\"bool get_boolean() const\", &JsonReader::GetBoolean);\n\t\tVReader->SetMethod(\"usize get_depth() const\", &JsonReader::GetDepth);\n\t}\n\tJsonEvent JsonReader::ReadValue()\n\t{\n\t\tchar Next = Buffer[Offset];\n\t\tswitch (Next)\n\t\t{\n\t\t\tcase '{':\n\t\t\t\t++Offset;\n\t\t\t\tScopes.push_back('{');\n\t\t\t\tState = Expectation::KeyOrEnd;\n\t\t\t\treturn JsonEvent::BeginObject;\n\t\t\tcase '[':\n\t\t\t\t++Offset;\n\t\t\t\tScopes.push_back('[');\n\t\t\t\tState = Expectation::ValueOrEnd;\n\t\t\t\treturn JsonEvent::BeginArray;\n\t\t\tcase '\"':\n\t\t\t\treturn ReadString(JsonEvent::String);\n\t\t\tcase 't':\n\t\t\t\tBoolean = true;\n\t\t\t\treturn ReadLiteral(\"true\", JsonEvent::Boolean);\n\t\t\tcase 'f':\n\t\t\t\tBoolean = false;\n\t\t\t\treturn ReadLiteral(\"false\", JsonEvent::Boolean);\n\t\t\tcase 'n':\n\t\t\t\treturn ReadLiteral(\"null\", JsonEvent::Null);\n\t\t\tdefault:\n\t\t\t\tif (Next == '-' || (Next >= '0' && Next <= '9'))\n\t\t\t\t\treturn ReadNumber();\n\t\t\t\treturn Fail();\n\t\t}\n\t}\n\tJsonEvent JsonReader::ReadString(JsonEvent Event)\n\t{\n\t\tsize_t Index = Offset + 1;\n\t\tbool Escaped = false;\n\t\twhile (Index < Buffer.size())\n\t\t{\n\t\t\tchar Next = Buffer[Index];\n\t\t\tif (Next == '\\\\')\n\t\t\t{\n\t\t\t\tEscaped = true;\n\t\t\t\tIndex += 2;\n\t\t\t\tcontinue;\n\t\t\t}\n\t\t\telse if (Next == '\"')\n\t\t\t\tbreak;\n\t\t\t++Index;\n\t\t}\n\n\t\tif (Index >= Buffer.size())\n\t\t\treturn Finished ? Fail() : JsonEvent::Need;\n\n\t\tSource = std::string_view(Buffer).substr(Offset, Index - Offset + 1);\n\t\tstd::string_view Data = Source.substr(1, Source.size() - 2);\n\t\tif (Escaped)\n\t\t{\n\t\t\tif (!Unescape(Data))\n\t\t\t\treturn Fail();\n\t\t\tValue = Unescaped;\n\t\t}\n\t\telse\n\t\t\tValue = Data;\n\n\t\tOffset = Index + 1;\n\t\tif (Event != JsonEvent::Key)\n\t\t\treturn AfterValue(Event);\n\n\t\tState = Expectation::Colon;\n\t\treturn Event;\n\t}\n\tJsonEvent JsonReader::ReadNumber()\n\t{\n\t\tsize_t Index = Offset;\n\t\twhile (Index < Buffer.size() && IsJsonNumeric(Buffer[Index]))\n\t\t\t++Index;\n\n\t\tif (Index >= Buffer.size() && !Finished)\n\t\t\treturn JsonEvent::Need;\n\n\t\tauto Result = FromString<double>(std::string_view(Buffer).substr(Offset, Index - Offset));\n\t\tif (!Result)\n\t\t\treturn Fail();\n\n\t\tNumber = *Result;\n\t\tValue = std::string_view(Buffer).substr(Offset, Index - Offset);\n\t\tSource = Value;\n\t\tOffset = Index;\n\t\treturn AfterValue(JsonEvent::Number);\n\t}\n\tJsonEvent JsonReader::ReadLiteral(const std::string_view& Literal, JsonEvent Event)\n\t{\n\t\tsize_t Size = std::min(Literal.size(), Buffer.size() - Offset);\n\t\tif (std::string_view(Buffer).substr(Offset, Size) != Literal.substr(0, Size))\n\t\t\treturn Fail();\n\t\telse if (Size < Literal.size())\n\t\t\treturn Finished ? Fail() : JsonEvent::Need;\n\n\t\tValue = std::string_view(Buffer).substr(Offset, Size);\n\t\tSource = Value;\n\t\tOffset += Size;\n\t\treturn AfterValue(Event);\n\t}\n\tJsonEvent JsonReader::CloseScope(char Scope)\n\t{\n\t\tif (Scopes.empty() || Scopes.back() != Scope)\n\t\t\treturn Fail();\n\n\t\tScopes.pop_back();\n\t\treturn AfterValue(Scope == '{' ? JsonEvent::EndObject : JsonEvent::EndArray);\n\t}\n\tJsonEvent JsonReader::AfterValue(JsonEvent Event)\n\t{\n\t\tEmpty = Empty && !Scopes.empty();\n\t\tState = Scopes.empty() ? Expectation::Done : Expectation::CommaOrEnd;\n\t\treturn Event;\n\t}\n\tJsonEvent JsonReader::Fail()\n\t{\n\t\tFailed = true;\n\t\treturn JsonEvent::Error;\n\t}\n\tbool JsonReader::Unescape(";
+		dc_executable_json_cpp += "const std::string_view& Data)\n\t{\n\t\tUnescaped.clear();\n\t\tUnescaped.reserve(Data.size());\n\t\tfor (size_t i = 0; i < Data.size(); i++)\n\t\t{\n\t\t\tchar Next = Data[i];\n\t\t\tif (Next != '\\\\')\n\t\t\t{\n\t\t\t\tUnescaped.push_back(Next);\n\t\t\t\tcontinue;\n\t\t\t}\n\t\t\telse if (++i >= Data.size())\n\t\t\t\treturn false;\n\n\t\t\tswitch (Data[i])\n\t\t\t{\n\t\t\t\tcase '\"':\n\t\t\t\tcase '\\\\':\n\t\t\t\tcase '/':\n\t\t\t\t\tUnescaped.push_back(Data[i]);\n\t\t\t\t\tbreak;\n\t\t\t\tcase 'b':\n\t\t\t\t\tUnescaped.push_back('\\b');\n\t\t\t\t\tbreak;\n\t\t\t\tcase 'f':\n\t\t\t\t\tUnescaped.push_back('\\f');\n\t\t\t\t\tbreak;\n\t\t\t\tcase 'n':\n\t\t\t\t\tUnescaped.push_back('\\n');\n\t\t\t\t\tbreak;\n\t\t\t\tcase 'r':\n\t\t\t\t\tUnescaped.push_back('\\r');\n\t\t\t\t\tbreak;\n\t\t\t\tcase 't':\n\t\t\t\t\tUnescaped.push_back('\\t');\n\t\t\t\t\tbreak;\n\t\t\t\tcase 'u':\n\t\t\t\t{\n\t\t\t\t\tuint32_t Code = 0;\n\t\t\t\t\tfor (size_t j = 0; j < 4; j++)\n\t\t\t\t\t{\n\t\t\t\t\t\tint Digit = i + 1 + j < Data.size() ? GetJsonHex(Data[i + 1 + j]) : -1;\n\t\t\t\t\t\tif (Digit < 0)\n\t\t\t\t\t\t\treturn false;\n\t\t\t\t\t\tCode = (Code << 4) | (uint32_t)Digit;\n\t\t\t\t\t}\n\n\t\t\t\t\ti += 4;\n\t\t\t\t\tif (Code >= 0xD800 && Code <= 0xDBFF && i + 6 < Data.size() && Data[i + 1] == '\\\\' && Data[i + 2] == 'u')\n\t\t\t\t\t{\n\t\t\t\t\t\tuint32_t Low = 0;\n\t\t\t\t\t\tfor (size_t j = 0; j < 4; j++)\n\t\t\t\t\t\t{\n\t\t\t\t\t\t\tint Digit = GetJsonHex(Data[i + 3 + j]);\n\t\t\t\t\t\t\tif (Digit < 0)\n\t\t\t\t\t\t\t\treturn false;\n\t\t\t\t\t\t\tLow = (Low << 4) | (uint32_t)Digit;\n\t\t\t\t\t\t}\n\n\t\t\t\t\t\tif (Low >= 0xDC00 && Low <= 0xDFFF)\n\t\t\t\t\t\t{\n\t\t\t\t\t\t\tCode = 0x10000 + ((Code - 0xD800) << 10) + (Low - 0xDC00);\n\t\t\t\t\t\t\ti += 6;\n\t\t\t\t\t\t}\n\t\t\t\t\t}\n\t\t\t\t\tAppendUTF8(Unescaped, Code);\n\t\t\t\t\tbreak;\n\t\t\t\t}\n\t\t\t\tdefault:\n\t\t\t\t\treturn false;\n\t\t\t}\n\t\t}\n\t\treturn true;\n\t}\n\n\tJsonWriter::JsonWriter() : Pending(false)\n\t{\n\t}\n\tvoid JsonWriter::BeginObject()\n\t{\n\t\tSeparate();\n\t\tBuffer.push_back('{');\n\t\tScopes.push_back(true);\n\t}\n\tvoid JsonWriter::EndObject()\n\t{\n\t\tBuffer.push_back('}');\n\t\tif (!Scopes.empty())\n\t\t\tScopes.pop_back();\n\t}\n\tvoid JsonWriter::BeginArray()\n\t{\n\t\tSeparate();\n\t\tBuffer.push_back('[');\n\t\tScopes.push_back(true);\n\t}\n\tvoid JsonWriter::EndArray()\n\t{\n\t\tBuffer.push_back(']');\n\t\tif (!Scopes.empty())\n\t\t\tScopes.pop_back();\n\t}\n\tvoid JsonWriter::Key(const String& Name)\n\t{\n\t\tSeparate();\n\t\tEscape(Name);\n\t\tBuffer.push_back(':');\n\t\tPending = true;\n\t}\n\tvoid JsonWriter::WriteString(const String& Data)\n\t{\n\t\tSeparate();\n\t\tEscape(Data);\n\t}\n\tvoid JsonWriter::WriteNumber(double Data)\n\t{\n\t\tSeparate();\n\t\tif (std::isfinite(Data))\n\t\t\tBuffer.append(Vitex::Core::ToString(Data));\n\t\telse\n\t\t\tBuffer.append(\"null\");\n\t}\n\tvoid JsonWriter::WriteInteger(int64_t Data)\n\t{\n\t\tchar Number[32];\n\t\tauto Result = std::to_chars(Number, Number + sizeof(Number), Data);\n\t\tSeparate();\n\t\tBuffer.append(Number, Result.ptr - Number);\n\t}\n\tvoid JsonWriter::WriteBoolean(bool Data)\n\t{\n\t\tSeparate();\n\t\tBuffer.append(Data ? \"true\" : \"false\");\n\t}\n\tvoid JsonWriter::WriteNull()\n\t{\n\t\tSeparate();\n\t\tBuffer.append(\"null\");\n\t}\n\tvoid JsonWriter::WriteRaw(const String& Data)\n\t{\n\t\tSeparate();\n\t\tBuffer.append(Data);\n\t}\n\tString JsonWriter::Flush()\n\t{\n\t\tString Result = std::move(Buffer);\n\t\tBuffer.clear();\n\t\treturn Result;\n\t}\n\tsize_t JsonWriter::GetSize() const\n\t{\n\t\treturn Buffer.size();\n\t}\n\tvoid JsonWriter::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->ImportSystemAddon(\"ctypes\");\n\t\tVM->ImportSystemAddon(\"string\");\n\t\tauto VWriter = VM->SetClass<JsonWriter>(\"json_writer\", false);\n\t\tVWriter->SetConstructor<JsonWriter>(\"json_writer@ f()\");\n\t\tVWriter->SetMethod(\"void begin_object()\", &JsonWriter::BeginObject);\n\t\tVWriter->SetMethod(\"void end_object()\", &JsonWriter::EndObject);\n\t\tVWriter->SetMethod(\"void begin_array()\", &JsonWriter::BeginArray);\n\t\tVWriter->SetMethod(\"void end_array()\", &JsonWriter::EndArray);\n\t\tVWriter->SetMethod(\"void key(const string&in)\", &JsonWriter::Key);\n\t\tVWriter->SetMethod(\"void write_string(const string&in)\", &JsonWriter::WriteString);\n\t\tVWriter->SetMethod(\"void write_number(double)\", &JsonWriter::WriteNumber);\n\t\tVWriter->SetMethod(\"void write_integer(int64)\", &JsonWriter::WriteInteger);\n\t\tVWriter->SetMethod(\"void write_boolean(bool)\", &JsonWriter::WriteBoolean);\n\t\tVWriter->SetMethod(\"void write_null()\", &JsonWriter::WriteNull);\n\t\tVWriter->SetMethod(\"void write_raw(const string&in)\", &JsonWriter::WriteRaw);\n\t\tVWriter";
+		dc_executable_json_cpp += "->SetMethod(\"string flush()\", &JsonWriter::Flush);\n\t\tVWriter->SetMethod(\"usize size() const\", &JsonWriter::GetSize);\n\t}\n\tvoid JsonWriter::Separate()\n\t{\n\t\tif (Pending)\n\t\t{\n\t\t\tPending = false;\n\t\t\treturn;\n\t\t}\n\n\t\tif (Scopes.empty())\n\t\t\treturn;\n\n\t\tif (!Scopes.back())\n\t\t\tBuffer.push_back(',');\n\t\tScopes.back() = false;\n\t}\n\tvoid JsonWriter::Escape(const std::string_view& Data)\n\t{\n\t\tstatic const char Alphabet[] = \"0123456789abcdef\";\n\t\tBuffer.reserve(Buffer.size() + Data.size() + 2);\n\t\tBuffer.push_back('\"');\n\t\tfor (char Next : Data)\n\t\t{\n\t\t\tswitch (Next)\n\t\t\t{\n\t\t\t\tcase '\"':\n\t\t\t\t\tBuffer.append(\"\\\\\\\"\");\n\t\t\t\t\tbreak;\n\t\t\t\tcase '\\\\':\n\t\t\t\t\tBuffer.append(\"\\\\\\\\\");\n\t\t\t\t\tbreak;\n\t\t\t\tcase '\\n':\n\t\t\t\t\tBuffer.append(\"\\\\n\");\n\t\t\t\t\tbreak;\n\t\t\t\tcase '\\r':\n\t\t\t\t\tBuffer.append(\"\\\\r\");\n\t\t\t\t\tbreak;\n\t\t\t\tcase '\\t':\n\t\t\t\t\tBuffer.append(\"\\\\t\");\n\t\t\t\t\tbreak;\n\t\t\t\tdefault:\n\t\t\t\t\tif ((uint8_t)Next < 0x20)\n\t\t\t\t\t{\n\t\t\t\t\t\tBuffer.append(\"\\\\u00\");\n\t\t\t\t\t\tBuffer.push_back(Alphabet[(uint8_t)Next >> 4]);\n\t\t\t\t\t\tBuffer.push_back(Alphabet[(uint8_t)Next & 0x0F]);\n\t\t\t\t\t}\n\t\t\t\t\telse\n\t\t\t\t\t\tBuffer.push_back(Next);\n\t\t\t\t\tbreak;\n\t\t\t}\n\t\t}\n\t\tBuffer.push_back('\"');\n\t}\n}";
+		callback(context, "executable/json.cpp", dc_executable_json_cpp.c_str(), (unsigned int)dc_executable_json_cpp.size());
+
+		const char* sc_executable_json_h = "#ifndef JSON_H\n#define JSON_H\n#include \"runtime.hpp\"\n#include <vengeance/vengeance.h>\n\nnamespace ASX\n{\n\tenum class JsonEvent\n\t{\n\t\tNeed,\n\t\tBeginObject,\n\t\tEndObject,\n\t\tBeginArray,\n\t\tEndArray,\n\t\tKey,\n\t\tString,\n\t\tNumber,\n\t\tBoolean,\n\t\tNull,\n\t\tEnd,\n\t\tError\n\t};\n\n\tclass JsonReader : public Reference<JsonReader>\n\t{\n\tprivate:\n\t\tenum class Expectation\n\t\t{\n\t\t\tValue,\n\t\t\tValueOrEnd,\n\t\t\tKeyOrEnd,\n\t\t\tKey,\n\t\t\tColon,\n\t\t\tCommaOrEnd,\n\t\t\tDone\n\t\t};\n\n\tprivate:\n\t\tVector<char> Scopes;\n\t\tString Buffer;\n\t\tString Unescaped;\n\t\tstd::string_view Value;\n\t\tstd::string_view Source;\n\t\tExpectation State;\n\t\tsize_t Offset;\n\t\tdouble Number;\n\t\tbool Boolean;\n\t\tbool Finished;\n\t\tbool Failed;\n\t\tbool Empty;\n\n\tpublic:\n\t\tJsonReader();\n\t\tvoid Feed(const String& Data);\n\t\tvoid Finish();\n\t\tJsonEvent Next();\n\t\tconst std::string_view& GetValue() const;\n\t\tconst std::string_view& GetSource() const;\n\t\tString GetString() const;\n\t\tString GetRaw() const;\n\t\tdouble GetNumber() const;\n\t\tbool GetBoolean() const;\n\t\tsize_t GetDepth() const;\n\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\n\tprivate:\n\t\tJsonEvent ReadValue();\n\t\tJsonEvent ReadString(JsonEvent Event);\n\t\tJsonEvent ReadNumber();\n\t\tJsonEvent ReadLiteral(const std::string_view& Literal, JsonEvent Event);\n\t\tJsonEvent CloseScope(char Scope);\n\t\tJsonEvent AfterValue(JsonEvent Event);\n\t\tJsonEvent Fail();\n\t\tbool Unescape(const std::string_view& Data);\n\t};\n\n\tclass JsonWriter : public Reference<JsonWriter>\n\t{\n\tprivate:\n\t\tVector<bool> Scopes;\n\t\tString Buffer;\n\t\tbool Pending;\n\n\tpublic:\n\t\tJsonWriter();\n\t\tvoid BeginObject();\n\t\tvoid EndObject();\n\t\tvoid BeginArray();\n\t\tvoid EndArray();\n\t\tvoid Key(const String& Name);\n\t\tvoid WriteString(const String& Data);\n\t\tvoid WriteNumber(double Data);\n\t\tvoid WriteInteger(int64_t Data);\n\t\tvoid WriteBoolean(bool Data);\n\t\tvoid WriteNull();\n\t\tvoid WriteRaw(const String& Data);\n\t\tString Flush();\n\t\tsize_t GetSize() const;\n\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\n\tprivate:\n\t\tvoid Separate();\n\t\tvoid Escape(const std::string_view& Data);\n\t};\n}\n#endif";
+		callback(context, "executable/json.h", sc_executable_json_h, 2017);
+
+		const char* sc_executable_modules_cpp = "#include \"allocator.h\"\n#include \"buffers.h\"\n#include \"cache.h\"\n#include \"isolate.h\"\n#include \"json.h\"\n#include \"pack.h\"\n#include \"parallel.h\"\n#include \"sync.h\"\n#include \"text.h\"\n#include \"timers.h\"\n\nnamespace ASX\n{\n\tvoid Modules::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tIsolate::BindSyntax(VM);\n\t\tParallel::BindSyntax(VM);\n\t\tSync::BindSyntax(VM);\n\t\tThreadAllocator::BindSyntax(VM);\n\t\tText::BindSyntax(VM);\n\t\tStringBuffer::BindSyntax(VM);\n\t\tBuffers::BindSyntax(VM);\n\t\tJsonReader::BindSyntax(VM);\n\t\tJsonWriter::BindSyntax(VM);\n\t\tPack::BindSyntax(VM);\n\t\tSharedCache::BindSyntax(VM);\n\t\tTimerWheel::BindSyntax(VM);\n\t}\n\tvoid Modules::Cleanup()\n\t{\n\t\tIsolate::Cleanup();\n\t\tParallel::Cleanup();\n\t\tSharedCache::Cleanup();\n\t\tTimerWheel::Cleanup();\n\t}\n\tuint64_t Modules::Update(uint64_t Timeout)\n\t{\n\t\treturn TimerWheel::HasInstance() ? TimerWheel::Get()->Update(Timeout) : Timeout;\n\t}\n\tvoid Modules::Cancel(EventLoop* Loop)\n\t{\n\t\tif (TimerWheel::HasInstance())\n\t\t\tTimerWheel::Get()->Cancel(Loop);\n\t}\n}";
+		callback(context, "executable/modules.cpp", sc_executable_modules_cpp, 984);
+
+		std::string dc_executable_pack_cpp;
+		dc_executable_pack_cpp.reserve(19874);
+		dc_executable_pack_cpp += "#include \"pack.h\"\n#define PACK_MAX_DEPTH 128\n\nnamespace ASX\n{\n\tstatic inline double GetHalfFloat(uint16_t Value)\n\t{\n\t\tint Exponent = (Value >> 10) & 0x1F;\n\t\tdouble Mantissa = (double)(Value & 0x3FF);\n\t\tdouble Result = Exponent == 0 ? std::ldexp(Mantissa, -24) : (Exponent != 31 ? std::ldexp(Mantissa + 1024.0, Exponent - 25) : (Mantissa == 0.0 ? INFINITY : NAN));\n\t\treturn Value & 0x8000 ? -Result : Result;\n\t}\n\ttemplate <typename T>\n\tstatic void WriteNumbers(PackEncoder& Encoder, Bindings::Array* Source, bool IsFloat)\n\t{\n\t\tT* Buffer = (T*)Source->GetBuffer();\n\t\tsize_t Size = Source->Size();\n\t\tEncoder.BeginArray(Size);\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t{\n\t\t\tif (IsFloat)\n\t\t\t\tEncoder.WriteNumber((double)Buffer[i]);\n\t\t\telse if (std::is_signed<T>::value)\n\t\t\t\tEncoder.WriteInteger((int64_t)Buffer[i]);\n\t\t\telse\n\t\t\t\tEncoder.WriteUnsigned((uint64_t)Buffer[i]);\n\t\t}\n\t}\n\n\tPackEncoder::PackEncoder(String& NewOutput, PackFormat NewFormat) : Output(NewOutput), Format(NewFormat), Overflow(false)\n\t{\n\t}\n\tvoid PackEncoder::WriteNull()\n\t{\n\t\tOutput.push_back(Format == PackFormat::MessagePack ? (char)0xC0 : (char)0xF6);\n\t}\n\tvoid PackEncoder::WriteBoolean(bool Value)\n\t{\n\t\tif (Format == PackFormat::MessagePack)\n\t\t\tOutput.push_back(Value ? (char)0xC3 : (char)0xC2);\n\t\telse\n\t\t\tOutput.push_back(Value ? (char)0xF5 : (char)0xF4);\n\t}\n\tvoid PackEncoder::WriteInteger(int64_t Value)\n\t{\n\t\tif (Value >= 0)\n\t\t\treturn WriteUnsigned((uint64_t)Value);\n\n\t\tif (Format == PackFormat::CBOR)\n\t\t\treturn WriteHead(1, (uint64_t)(-(Value + 1)));\n\n\t\tif (Value >= -32)\n\t\t\tOutput.push_back((char)(int8_t)Value);\n\t\telse if (Value >= INT8_MIN)\n\t\t{\n\t\t\tOutput.push_back((char)0xD0);\n\t\t\tWriteBigEndian((uint8_t)(int8_t)Value, 1);\n\t\t}\n\t\telse if (Value >= INT16_MIN)\n\t\t{\n\t\t\tOutput.push_back((char)0xD1);\n\t\t\tWriteBigEndian((uint16_t)(int16_t)Value, 2);\n\t\t}\n\t\telse if (Value >= INT32_MIN)\n\t\t{\n\t\t\tOutput.push_back((char)0xD2);\n\t\t\tWriteBigEndian((uint32_t)(int32_t)Value, 4);\n\t\t}\n\t\telse\n\t\t{\n\t\t\tOutput.push_back((char)0xD3);\n\t\t\tWriteBigEndian((uint64_t)Value, 8);\n\t\t}\n\t}\n\tvoid PackEncoder::WriteUnsigned(uint64_t Value)\n\t{\n\t\tif (Format == PackFormat::CBOR)\n\t\t\treturn WriteHead(0, Value);\n\n\t\tif (Value < 128)\n\t\t\tOutput.push_back((char)Value);\n\t\telse if (Value <= UINT8_MAX)\n\t\t{\n\t\t\tOutput.push_back((char)0xCC);\n\t\t\tWriteBigEndian(Value, 1);\n\t\t}\n\t\telse if (Value <= UINT16_MAX)\n\t\t{\n\t\t\tOutput.push_back((char)0xCD);\n\t\t\tWriteBigEndian(Value, 2);\n\t\t}\n\t\telse if (Value <= UINT32_MAX)\n\t\t{\n\t\t\tOutput.push_back((char)0xCE);\n\t\t\tWriteBigEndian(Value, 4);\n\t\t}\n\t\telse\n\t\t{\n\t\t\tOutput.push_back((char)0xCF);\n\t\t\tWriteBigEndian(Value, 8);\n\t\t}\n\t}\n\tvoid PackEncoder::WriteNumber(double Value)\n\t{\n\t\tuint64_t Bits;\n\t\tmemcpy(&Bits, &Value, sizeof(Bits));\n\t\tOutput.push_back(Format == PackFormat::MessagePack ? (char)0xCB : (char)0xFB);\n\t\tWriteBigEndian(Bits, 8);\n\t}\n\tvoid PackEncoder::WriteString(const std::string_view& Value)\n\t{\n\t\tif (Format == PackFormat::MessagePack)\n\t\t\tWriteSized(0xA0, 32, 0xD9, true, Value.size());\n\t\telse\n\t\t\tWriteHead(3, Value.size());\n\t\tOutput.append(Value);\n\t}\n\tvoid PackEncoder::WriteBinary(const std::string_view& Value)\n\t{\n\t\tif (Format == PackFormat::MessagePack)\n\t\t\tWriteSized(0, 0, 0xC4, true, Value.size());\n\t\telse\n\t\t\tWriteHead(2, Value.size());\n\t\tOutput.append(Value);\n\t}\n\tvoid PackEncoder::BeginArray(size_t Size)\n\t{\n\t\tif (Format == PackFormat::MessagePack)\n\t\t\tWriteSized(0x90, 16, 0xDC, false, Size);\n\t\telse\n\t\t\tWriteHead(4, Size);\n\t}\n\tvoid PackEncoder::BeginMap(size_t Size)\n\t{\n\t\tif (Format == PackFormat::MessagePack)\n\t\t\tWriteSized(0x80, 16, 0xDE, false, Size);\n\t\telse\n\t\t\tWriteHead(5, Size);\n\t}\n\tvoid PackEncoder::WriteSchema(Schema* Value, size_t Depth)\n\t{\n\t\tif (Depth > PACK_MAX_DEPTH)\n\t\t\tOverflow = true;\n\n\t\tif (!Value || Overflow)\n\t\t\treturn WriteNull();\n\n\t\tswitch (Value->Value.GetType())\n\t\t{\n\t\t\tcase VarType::Object:\n\t\t\t{\n\t\t\t\tauto& Nodes = Value->GetChilds();\n\t\t\t\tBeginMap(Nodes.size());\n\t\t\t\tfor (auto* Node : Nodes)\n\t\t\t\t{\n\t\t\t\t\tWriteString(Node->Key);\n\t\t\t\t\tWriteSchema(Node, Depth + 1);\n\t\t\t\t}\n\t\t\t\tbreak;\n\t\t\t}\n\t\t\tcase VarType::Array:\n\t\t\t{\n\t\t\t\tauto& Nodes = Value->GetChilds();\n\t\t\t\tBeginArray(Nodes.size());\n\t\t\t\tfor (auto*";
+		dc_executable_pack_cpp += " Node : Nodes)\n\t\t\t\t\tWriteSchema(Node, Depth + 1);\n\t\t\t\tbreak;\n\t\t\t}\n\t\t\tcase VarType::String:\n\t\t\t\tWriteString(Value->Value.GetString());\n\t\t\t\tbreak;\n\t\t\tcase VarType::Binary:\n\t\t\t\tWriteBinary(Value->Value.GetString());\n\t\t\t\tbreak;\n\t\t\tcase VarType::Integer:\n\t\t\t\tWriteInteger(Value->Value.GetInteger());\n\t\t\t\tbreak;\n\t\t\tcase VarType::Number:\n\t\t\t\tWriteNumber(Value->Value.GetNumber());\n\t\t\t\tbreak;\n\t\t\tcase VarType::Decimal:\n\t\t\t\tWriteString(Value->Value.GetBlob());\n\t\t\t\tbreak;\n\t\t\tcase VarType::Boolean:\n\t\t\t\tWriteBoolean(Value->Value.GetBoolean());\n\t\t\t\tbreak;\n\t\t\tdefault:\n\t\t\t\tWriteNull();\n\t\t\t\tbreak;\n\t\t}\n\t}\n\tvoid PackEncoder::WriteAny(void* Ref, int Type, size_t Depth)\n\t{\n\t\tif (Type & (int)TypeId::OBJHANDLE)\n\t\t\tRef = Ref ? *(void**)Ref : nullptr;\n\n\t\tif (Depth > PACK_MAX_DEPTH)\n\t\t\tOverflow = true;\n\n\t\tif (!Ref || Overflow)\n\t\t\treturn WriteNull();\n\n\t\tswitch ((TypeId)Type)\n\t\t{\n\t\t\tcase TypeId::BOOL:\n\t\t\t\treturn WriteBoolean(*(bool*)Ref);\n\t\t\tcase TypeId::INT8:\n\t\t\t\treturn WriteInteger(*(int8_t*)Ref);\n\t\t\tcase TypeId::INT16:\n\t\t\t\treturn WriteInteger(*(int16_t*)Ref);\n\t\t\tcase TypeId::INT32:\n\t\t\t\treturn WriteInteger(*(int32_t*)Ref);\n\t\t\tcase TypeId::INT64:\n\t\t\t\treturn WriteInteger(*(int64_t*)Ref);\n\t\t\tcase TypeId::UINT8:\n\t\t\t\treturn WriteUnsigned(*(uint8_t*)Ref);\n\t\t\tcase TypeId::UINT16:\n\t\t\t\treturn WriteUnsigned(*(uint16_t*)Ref);\n\t\t\tcase TypeId::UINT32:\n\t\t\t\treturn WriteUnsigned(*(uint32_t*)Ref);\n\t\t\tcase TypeId::UINT64:\n\t\t\t\treturn WriteUnsigned(*(uint64_t*)Ref);\n\t\t\tcase TypeId::FLOAT:\n\t\t\t\treturn WriteNumber(*(float*)Ref);\n\t\t\tcase TypeId::DOUBLE:\n\t\t\t\treturn WriteNumber(*(double*)Ref);\n\t\t\tdefault:\n\t\t\t\tbreak;\n\t\t}\n\n\t\tif (!(Type & (int)TypeId::MASK_OBJECT))\n\t\t\treturn WriteInteger(*(int32_t*)Ref);\n\n\t\tif (Type & (int)TypeId::SCRIPTOBJECT)\n\t\t{\n\t\t\tScriptObject Object = ScriptObject((asIScriptObject*)Ref);\n\t\t\tsize_t Count = Object.GetPropertiesCount();\n\t\t\tBeginMap(Count);\n\t\t\tfor (size_t i = 0; i < Count; i++)\n\t\t\t{\n\t\t\t\tWriteString(Object.GetPropertyName(i));\n\t\t\t\tWriteAny(Object.GetAddressOfProperty(i), Object.GetPropertyTypeId(i), Depth + 1);\n\t\t\t}\n\t\t\treturn;\n\t\t}\n\n\t\tauto* VM = VirtualMachine::Get();\n\t\tTypeInfo Info = VM ? VM->GetTypeInfoById(Type) : TypeInfo(nullptr);\n\t\tstd::string_view Name = Info.IsValid() ? Info.GetName() : std::string_view();\n\t\tif (Name == \"string\")\n\t\t\treturn WriteString(*(String*)Ref);\n\t\telse if (Name == \"schema\")\n\t\t\treturn WriteSchema((Schema*)Ref, Depth);\n\t\telse if (Name != \"array\")\n\t\t\treturn WriteNull();\n\n\t\tauto* Source = (Bindings::Array*)Ref;\n\t\tint ElementTypeId = Source->GetElementTypeId();\n\t\tswitch ((TypeId)ElementTypeId)\n\t\t{\n\t\t\tcase TypeId::INT8:\n\t\t\t\treturn WriteNumbers<int8_t>(*this, Source, false);\n\t\t\tcase TypeId::INT16:\n\t\t\t\treturn WriteNumbers<int16_t>(*this, Source, false);\n\t\t\tcase TypeId::INT32:\n\t\t\t\treturn WriteNumbers<int32_t>(*this, Source, false);\n\t\t\tcase TypeId::INT64:\n\t\t\t\treturn WriteNumbers<int64_t>(*this, Source, false);\n\t\t\tcase TypeId::UINT8:\n\t\t\t\treturn WriteBinary(std::string_view((char*)Source->GetBuffer(), Source->Size()));\n\t\t\tcase TypeId::UINT16:\n\t\t\t\treturn WriteNumbers<uint16_t>(*this, Source, false);\n\t\t\tcase TypeId::UINT32:\n\t\t\t\treturn WriteNumbers<uint32_t>(*this, Source, false);\n\t\t\tcase TypeId::UINT64:\n\t\t\t\treturn WriteNumbers<uint64_t>(*this, Source, false);\n\t\t\tcase TypeId::FLOAT:\n\t\t\t\treturn WriteNumbers<float>(*this, Source, true);\n\t\t\tcase TypeId::DOUBLE:\n\t\t\t\treturn WriteNumbers<double>(*this, Source, true);\n\t\t\tdefault:\n\t\t\t\tbreak;\n\t\t}\n\n\t\tsize_t Size = Source->Size();\n\t\tBeginArray(Size);\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t\tWriteAny(Source->At(i), ElementTypeId, Depth + 1);\n\t}\n\tbool PackEncoder::IsOverflow() const\n\t{\n\t\treturn Overflow;\n\t}\n\tvoid PackEncoder::WriteHead(uint8_t Major, uint64_t Value)\n\t{\n\t\tuint8_t Type = (uint8_t)(Major << 5);\n\t\tif (Value < 24)\n\t\t\tOutput.push_back((char)(Type | (uint8_t)Value));\n\t\telse if (Value <= UINT8_MAX)\n\t\t{\n\t\t\tOutput.push_back((char)(Type | 24));\n\t\t\tWriteBigEndian(Value, 1);\n\t\t}\n\t\telse if (Value <= UINT16_MAX)\n\t\t{\n\t\t\tOutput.push_back((char)(Type | 25));\n\t\t\tWriteBigEndian(Value, 2);\n\t\t}\n\t\telse if (Value <= UINT32_MAX)\n\t\t{\n\t\t\tOutput.push_back((char)(Type | 26));\n\t\t\tWriteBigEndian(Value, 4);\n\t";
+		dc_executable_pack_cpp += "\t}\n\t\telse\n\t\t{\n\t\t\tOutput.push_back((char)(Type | 27));\n\t\t\tWriteBigEndian(Value, 8);\n\t\t}\n\t}\n\tvoid PackEncoder::WriteSized(uint8_t Fixed, uint8_t FixedLimit, uint8_t Tag, bool Short, uint64_t Size)\n\t{\n\t\tif (Size < FixedLimit)\n\t\t\tOutput.push_back((char)(Fixed | (uint8_t)Size));\n\t\telse if (Short && Size <= UINT8_MAX)\n\t\t{\n\t\t\tOutput.push_back((char)Tag);\n\t\t\tWriteBigEndian(Size, 1);\n\t\t}\n\t\telse if (Size <= UINT16_MAX)\n\t\t{\n\t\t\tOutput.push_back((char)(Tag + (Short ? 1 : 0)));\n\t\t\tWriteBigEndian(Size, 2);\n\t\t}\n\t\telse\n\t\t{\n\t\t\tOutput.push_back((char)(Tag + (Short ? 2 : 1)));\n\t\t\tWriteBigEndian(Size, 4);\n\t\t}\n\t}\n\tvoid PackEncoder::WriteBigEndian(uint64_t Value, size_t Bytes)\n\t{\n\t\tchar Buffer[8];\n\t\tfor (size_t i = 0; i < Bytes; i++)\n\t\t\tBuffer[i] = (char)(Value >> ((Bytes - i - 1) * 8));\n\t\tOutput.append(Buffer, Bytes);\n\t}\n\n\tPackDecoder::PackDecoder(const std::string_view& NewData, PackFormat NewFormat, size_t NewOffset) : Data(NewData), Format(NewFormat), Status(PackStatus::Success), Offset(NewOffset)\n\t{\n\t}\n\tSchema* PackDecoder::ReadSchema(size_t Depth)\n\t{\n\t\tif (Offset >= Data.size())\n\t\t\treturn Fail(PackStatus::Incomplete);\n\t\telse if (Depth > PACK_MAX_DEPTH)\n\t\t\treturn Fail(PackStatus::Overflow);\n\n\t\tSchema* Result = Format == PackFormat::MessagePack ? ReadMessagePack(Depth) : ReadCBOR(Depth);\n\t\treturn Result ? Result : Fail(PackStatus::Invalid);\n\t}\n\tPackStatus PackDecoder::GetStatus() const\n\t{\n\t\treturn Status;\n\t}\n\tsize_t PackDecoder::GetOffset() const\n\t{\n\t\treturn Offset;\n\t}\n\tSchema* PackDecoder::ReadMessagePack(size_t Depth)\n\t{\n\t\tuint8_t Type = (uint8_t)Data[Offset++];\n\t\tif (Type <= 0x7F)\n\t\t\treturn Var::Set::Integer(Type);\n\t\telse if (Type >= 0xE0)\n\t\t\treturn Var::Set::Integer((int8_t)Type);\n\t\telse if (Type >= 0x80 && Type <= 0x8F)\n\t\t\treturn ReadMap(Type & 0x0F, Depth);\n\t\telse if (Type >= 0x90 && Type <= 0x9F)\n\t\t\treturn ReadArray(Type & 0x0F, Depth);\n\n\t\tuint64_t Value = 0;\n\t\tstd::string_view Bytes;\n\t\tif (Type >= 0xA0 && Type <= 0xBF)\n\t\t\treturn ReadBytes(Type & 0x1F, Bytes) ? Var::Set::String(Bytes) : nullptr;\n\n\t\tswitch (Type)\n\t\t{\n\t\t\tcase 0xC0:\n\t\t\t\treturn Var::Set::Null();\n\t\t\tcase 0xC2:\n\t\t\t\treturn Var::Set::Boolean(false);\n\t\t\tcase 0xC3:\n\t\t\t\treturn Var::Set::Boolean(true);\n\t\t\tcase 0xC4:\n\t\t\tcase 0xC5:\n\t\t\tcase 0xC6:\n\t\t\t\tif (!ReadBigEndian((size_t)1 << (Type - 0xC4), Value) || !ReadBytes((size_t)Value, Bytes))\n\t\t\t\t\treturn nullptr;\n\t\t\t\treturn Var::Set::Binary(Bytes);\n\t\t\tcase 0xCA:\n\t\t\t{\n\t\t\t\tif (!ReadBigEndian(4, Value))\n\t\t\t\t\treturn nullptr;\n\t\t\t\tfloat Number; uint32_t Bits = (uint32_t)Value;\n\t\t\t\tmemcpy(&Number, &Bits, sizeof(Number));\n\t\t\t\treturn Var::Set::Number(Number);\n\t\t\t}\n\t\t\tcase 0xCB:\n\t\t\t{\n\t\t\t\tif (!ReadBigEndian(8, Value))\n\t\t\t\t\treturn nullptr;\n\t\t\t\tdouble Number;\n\t\t\t\tmemcpy(&Number, &Value, sizeof(Number));\n\t\t\t\treturn Var::Set::Number(Number);\n\t\t\t}\n\t\t\tcase 0xCC:\n\t\t\tcase 0xCD:\n\t\t\tcase 0xCE:\n\t\t\tcase 0xCF:\n\t\t\t\tif (!ReadBigEndian((size_t)1 << (Type - 0xCC), Value))\n\t\t\t\t\treturn nullptr;\n\t\t\t\treturn Value > (uint64_t)INT64_MAX ? Var::Set::Number((double)Value) : Var::Set::Integer((int64_t)Value);\n\t\t\tcase 0xD0:\n\t\t\t\treturn ReadBigEndian(1, Value) ? Var::Set::Integer((int8_t)Value) : nullptr;\n\t\t\tcase 0xD1:\n\t\t\t\treturn ReadBigEndian(2, Value) ? Var::Set::Integer((int16_t)Value) : nullptr;\n\t\t\tcase 0xD2:\n\t\t\t\treturn ReadBigEndian(4, Value) ? Var::Set::Integer((int32_t)Value) : nullptr;\n\t\t\tcase 0xD3:\n\t\t\t\treturn ReadBigEndian(8, Value) ? Var::Set::Integer((int64_t)Value) : nullptr;\n\t\t\tcase 0xD9:\n\t\t\tcase 0xDA:\n\t\t\tcase 0xDB:\n\t\t\t\tif (!ReadBigEndian((size_t)1 << (Type - 0xD9), Value) || !ReadBytes((size_t)Value, Bytes))\n\t\t\t\t\treturn nullptr;\n\t\t\t\treturn Var::Set::String(Bytes);\n\t\t\tcase 0xDC:\n\t\t\tcase 0xDD:\n\t\t\t\treturn ReadBigEndian(Type == 0xDC ? 2 : 4, Value) ? ReadArray((size_t)Value, Depth) : nullptr;\n\t\t\tcase 0xDE:\n\t\t\tcase 0xDF:\n\t\t\t\treturn ReadBigEndian(Type == 0xDE ? 2 : 4, Value) ? ReadMap((size_t)Value, Depth) : nullptr;\n\t\t\tdefault:\n\t\t\t\treturn nullptr;\n\t\t}\n\t}\n\tSchema* PackDecoder::ReadCBOR(size_t Depth)\n\t{\n\t\tuint8_t Type = (uint8_t)Data[Offset++];\n\t\tuint8_t Major = Type >> 5, Minor = Type & 0x1F;\n\t\tuint64_t Value = Minor;\n\t\tif (Minor >= 24 && Minor <= 27)\n\t\t{\n\t\t\tif (!R";
+		dc_executable_pack_cpp += "eadBigEndian((size_t)1 << (Minor - 24), Value))\n\t\t\t\treturn nullptr;\n\t\t}\n\t\telse if (Minor > 27 && (Minor != 31 || Major == 0 || Major == 1 || Major == 6))\n\t\t\treturn nullptr;\n\n\t\tstd::string_view Bytes;\n\t\tswitch (Major)\n\t\t{\n\t\t\tcase 0:\n\t\t\t\treturn Value > (uint64_t)INT64_MAX ? Var::Set::Number((double)Value) : Var::Set::Integer((int64_t)Value);\n\t\t\tcase 1:\n\t\t\t\treturn Value > (uint64_t)INT64_MAX ? Var::Set::Number(-1.0 - (double)Value) : Var::Set::Integer(-1 - (int64_t)Value);\n\t\t\tcase 2:\n\t\t\tcase 3:\n\t\t\t{\n\t\t\t\tif (Minor != 31)\n\t\t\t\t{\n\t\t\t\t\tif (!ReadBytes((size_t)Value, Bytes))\n\t\t\t\t\t\treturn nullptr;\n\t\t\t\t\treturn Major == 2 ? Var::Set::Binary(Bytes) : Var::Set::String(Bytes);\n\t\t\t\t}\n\n\t\t\t\tString Chunks;\n\t\t\t\tif (!ReadChunks(Major, Chunks))\n\t\t\t\t\treturn nullptr;\n\t\t\t\treturn Major == 2 ? Var::Set::Binary(Chunks) : Var::Set::String(Chunks);\n\t\t\t}\n\t\t\tcase 4:\n\t\t\t\treturn ReadArray(Minor == 31 ? std::string::npos : (size_t)Value, Depth);\n\t\t\tcase 5:\n\t\t\t\treturn ReadMap(Minor == 31 ? std::string::npos : (size_t)Value, Depth);\n\t\t\tcase 6:\n\t\t\t\treturn ReadSchema(Depth + 1);\n\t\t\tdefault:\n\t\t\t\tbreak;\n\t\t}\n\n\t\tswitch (Minor)\n\t\t{\n\t\t\tcase 20:\n\t\t\t\treturn Var::Set::Boolean(false);\n\t\t\tcase 21:\n\t\t\t\treturn Var::Set::Boolean(true);\n\t\t\tcase 22:\n\t\t\t\treturn Var::Set::Null();\n\t\t\tcase 23:\n\t\t\t\treturn Var::Set::Undefined();\n\t\t\tcase 25:\n\t\t\t\treturn Var::Set::Number(GetHalfFloat((uint16_t)Value));\n\t\t\tcase 26:\n\t\t\t{\n\t\t\t\tfloat Number; uint32_t Bits = (uint32_t)Value;\n\t\t\t\tmemcpy(&Number, &Bits, sizeof(Number));\n\t\t\t\treturn Var::Set::Number(Number);\n\t\t\t}\n\t\t\tcase 27:\n\t\t\t{\n\t\t\t\tdouble Number;\n\t\t\t\tmemcpy(&Number, &Value, sizeof(Number));\n\t\t\t\treturn Var::Set::Number(Number);\n\t\t\t}\n\t\t\tdefault:\n\t\t\t\treturn nullptr;\n\t\t}\n\t}\n\tSchema* PackDecoder::ReadArray(size_t Size, size_t Depth)\n\t{\n\t\tSchema* Result = Var::Set::Array();\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t{\n\t\t\tif (Size == std::string::npos && Offset < Data.size() && (uint8_t)Data[Offset] == 0xFF)\n\t\t\t{\n\t\t\t\t++Offset;\n\t\t\t\treturn Result;\n\t\t\t}\n\n\t\t\tSchema* Next = ReadSchema(Depth + 1);\n\t\t\tif (!Next)\n\t\t\t{\n\t\t\t\tMemory::Release(Result);\n\t\t\t\treturn nullptr;\n\t\t\t}\n\t\t\tResult->Push(Next);\n\t\t}\n\t\treturn Result;\n\t}\n\tSchema* PackDecoder::ReadMap(size_t Size, size_t Depth)\n\t{\n\t\tSchema* Result = Var::Set::Object();\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t{\n\t\t\tif (Size == std::string::npos && Offset < Data.size() && (uint8_t)Data[Offset] == 0xFF)\n\t\t\t{\n\t\t\t\t++Offset;\n\t\t\t\treturn Result;\n\t\t\t}\n\n\t\t\tSchema* Key = ReadSchema(Depth + 1);\n\t\t\tSchema* Next = Key ? ReadSchema(Depth + 1) : nullptr;\n\t\t\tif (!Next)\n\t\t\t{\n\t\t\t\tif (Key != nullptr)\n\t\t\t\t\tMemory::Release(Key);\n\t\t\t\tMemory::Release(Result);\n\t\t\t\treturn nullptr;\n\t\t\t}\n\n\t\t\tResult->Set(Key->Value.GetBlob(), Next);\n\t\t\tMemory::Release(Key);\n\t\t}\n\t\treturn Result;\n\t}\n\tbool PackDecoder::ReadChunks(uint8_t Major, String& Value)\n\t{\n\t\twhile (Offset < Data.size())\n\t\t{\n\t\t\tuint8_t Type = (uint8_t)Data[Offset++];\n\t\t\tif (Type == 0xFF)\n\t\t\t\treturn true;\n\t\t\telse if ((Type >> 5) != Major || (Type & 0x1F) > 27)\n\t\t\t\treturn false;\n\n\t\t\tuint64_t Size = Type & 0x1F;\n\t\t\tstd::string_view Chunk;\n\t\t\tif (Size >= 24 && !ReadBigEndian((size_t)1 << (Size - 24), Size))\n\t\t\t\treturn false;\n\t\t\telse if (!ReadBytes((size_t)Size, Chunk))\n\t\t\t\treturn false;\n\t\t\tValue.append(Chunk);\n\t\t}\n\n\t\tFail(PackStatus::Incomplete);\n\t\treturn false;\n\t}\n\tbool PackDecoder::ReadBigEndian(size_t Bytes, uint64_t& Value)\n\t{\n\t\tif (Data.size() - Offset < Bytes)\n\t\t{\n\t\t\tFail(PackStatus::Incomplete);\n\t\t\treturn false;\n\t\t}\n\n\t\tValue = 0;\n\t\tfor (size_t i = 0; i < Bytes; i++)\n\t\t\tValue = (Value << 8) | (uint8_t)Data[Offset + i];\n\t\tOffset += Bytes;\n\t\treturn true;\n\t}\n\tbool PackDecoder::ReadBytes(size_t Size, std::string_view& Value)\n\t{\n\t\tif (Data.size() - Offset < Size)\n\t\t{\n\t\t\tFail(PackStatus::Incomplete);\n\t\t\treturn false;\n\t\t}\n\n\t\tValue = Data.substr(Offset, Size);\n\t\tOffset += Size;\n\t\treturn true;\n\t}\n\tSchema* PackDecoder::Fail(PackStatus NewStatus)\n\t{\n\t\tif (Status == PackStatus::Success)\n\t\t\tStatus = NewStatus;\n\t\treturn nullptr;\n\t}\n\n\tString Pack::Encode(Schema* Value, PackFormat Format, bool* Overflow)\n\t{\n\t\tString Result;\n\t\tPackEncoder Encoder(Result, Format);\n\t\tEncoder.WriteSchema(Value);\n\t\tif (Overflow != ";
+		dc_executable_pack_cpp += "nullptr)\n\t\t\t*Overflow = Encoder.IsOverflow();\n\t\treturn Result;\n\t}\n\tSchema* Pack::Decode(const std::string_view& Data, PackFormat Format, size_t* Offset, PackStatus* Status)\n\t{\n\t\tPackDecoder Decoder(Data, Format, Offset ? *Offset : 0);\n\t\tSchema* Result = Decoder.ReadSchema();\n\t\tif (Offset != nullptr)\n\t\t\t*Offset = Result ? Decoder.GetOffset() : *Offset;\n\t\tif (Status != nullptr)\n\t\t\t*Status = Decoder.GetStatus();\n\t\treturn Result;\n\t}\n\tvoid Pack::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->ImportSystemAddon(\"string\");\n\t\tVM->ImportSystemAddon(\"schema\");\n\t\tauto VStatus = VM->SetEnum(\"pack_status\");\n\t\tVStatus->SetValue(\"success\", (int)PackStatus::Success);\n\t\tVStatus->SetValue(\"incomplete\", (int)PackStatus::Incomplete);\n\t\tVStatus->SetValue(\"invalid\", (int)PackStatus::Invalid);\n\t\tVStatus->SetValue(\"overflow\", (int)PackStatus::Overflow);\n\t\tBindFormat<PackFormat::MessagePack>(VM, \"msgpack\");\n\t\tBindFormat<PackFormat::CBOR>(VM, \"cbor\");\n\t}\n\ttemplate <PackFormat Format>\n\tvoid Pack::BindFormat(VirtualMachine* VM, const char* Namespace)\n\t{\n\t\tVM->BeginNamespace(Namespace);\n\t\tVM->SetFunction(\"string encode(schema@+)\", &Pack::ScriptEncode<Format>);\n\t\tVM->SetFunction(\"void encode_into(string_builder@+, schema@+)\", &Pack::ScriptEncodeInto<Format>);\n\t\tVM->SetFunction(\"string pack(const ?&in)\", &Pack::ScriptPack<Format>);\n\t\tVM->SetFunction(\"void pack_into(string_builder@+, const ?&in)\", &Pack::ScriptPackInto<Format>);\n\t\tVM->SetFunction(\"schema@ decode(const string&in)\", &Pack::ScriptDecode<Format>);\n\t\tVM->SetFunction(\"schema@ decode_next(const string&in, usize, usize&out, pack_status&out)\", &Pack::ScriptDecodeNext<Format>);\n\t\tVM->EndNamespace();\n\t}\n\ttemplate <PackFormat Format>\n\tString Pack::ScriptEncode(Schema* Value)\n\t{\n\t\tbool Overflow = false;\n\t\tString Result = Encode(Value, Format, &Overflow);\n\t\treturn ThrowOverflow(Overflow) ? String() : Result;\n\t}\n\ttemplate <PackFormat Format>\n\tvoid Pack::ScriptEncodeInto(StringBuffer* Target, Schema* Value)\n\t{\n\t\tif (!Target)\n\t\t\treturn;\n\n\t\tString& Data = Target->GetData();\n\t\tsize_t Size = Data.size();\n\t\tPackEncoder Encoder(Data, Format);\n\t\tEncoder.WriteSchema(Value);\n\t\tif (ThrowOverflow(Encoder.IsOverflow()))\n\t\t\tData.resize(Size);\n\t}\n\ttemplate <PackFormat Format>\n\tString Pack::ScriptPack(void* Ref, int Type)\n\t{\n\t\tString Result;\n\t\tPackEncoder Encoder(Result, Format);\n\t\tEncoder.WriteAny(Ref, Type);\n\t\treturn ThrowOverflow(Encoder.IsOverflow()) ? String() : Result;\n\t}\n\ttemplate <PackFormat Format>\n\tvoid Pack::ScriptPackInto(StringBuffer* Target, void* Ref, int Type)\n\t{\n\t\tif (!Target)\n\t\t\treturn;\n\n\t\tString& Data = Target->GetData();\n\t\tsize_t Size = Data.size();\n\t\tPackEncoder Encoder(Data, Format);\n\t\tEncoder.WriteAny(Ref, Type);\n\t\tif (ThrowOverflow(Encoder.IsOverflow()))\n\t\t\tData.resize(Size);\n\t}\n\ttemplate <PackFormat Format>\n\tSchema* Pack::ScriptDecode(const String& Data)\n\t{\n\t\tPackStatus Status = PackStatus::Success;\n\t\tSchema* Result = Decode(Data, Format, nullptr, &Status);\n\t\tThrowOverflow(Status == PackStatus::Overflow);\n\t\treturn Result;\n\t}\n\ttemplate <PackFormat Format>\n\tSchema* Pack::ScriptDecodeNext(const String& Data, size_t Offset, size_t& Next, PackStatus& Status)\n\t{\n\t\tNext = Offset;\n\t\tSchema* Result = Decode(Data, Format, &Next, &Status);\n\t\tThrowOverflow(Status == PackStatus::Overflow);\n\t\treturn Result;\n\t}\n\tbool Pack::ThrowOverflow(bool Overflow)\n\t{\n\t\tif (Overflow)\n\t\t\tImmediateContext::Get()->SetException(Stringify::Text(\"pack nesting is deeper than %i levels\", (int)PACK_MAX_DEPTH).c_str());\n\t\treturn Overflow;\n\t}\n}";
+		callback(context, "executable/pack.cpp", dc_executable_pack_cpp.c_str(), (unsigned int)dc_executable_pack_cpp.size());
+
+		const char* sc_executable_pack_h = "#ifndef PACK_H\n#define PACK_H\n#include \"runtime.hpp\"\n#include \"text.h\"\n#include <vengeance/vengeance.h>\n\nnamespace ASX\n{\n\tenum class PackFormat\n\t{\n\t\tMessagePack,\n\t\tCBOR\n\t};\n\n\tenum class PackStatus\n\t{\n\t\tSuccess,\n\t\tIncomplete,\n\t\tInvalid,\n\t\tOverflow\n\t};\n\n\tclass PackEncoder\n\t{\n\tprivate:\n\t\tString& Output;\n\t\tPackFormat Format;\n\t\tbool Overflow;\n\n\tpublic:\n\t\tPackEncoder(String& NewOutput, PackFormat NewFormat);\n\t\tvoid WriteNull();\n\t\tvoid WriteBoolean(bool Value);\n\t\tvoid WriteInteger(int64_t Value);\n\t\tvoid WriteUnsigned(uint64_t Value);\n\t\tvoid WriteNumber(double Value);\n\t\tvoid WriteString(const std::string_view& Value);\n\t\tvoid WriteBinary(const std::string_view& Value);\n\t\tvoid BeginArray(size_t Size);\n\t\tvoid BeginMap(size_t Size);\n\t\tvoid WriteSchema(Schema* Value, size_t Depth = 0);\n\t\tvoid WriteAny(void* Ref, int Type, size_t Depth = 0);\n\t\tbool IsOverflow() const;\n\n\tprivate:\n\t\tvoid WriteHead(uint8_t Major, uint64_t Value);\n\t\tvoid WriteSized(uint8_t Fixed, uint8_t FixedLimit, uint8_t Tag, bool Short, uint64_t Size);\n\t\tvoid WriteBigEndian(uint64_t Value, size_t Bytes);\n\t};\n\n\tclass PackDecoder\n\t{\n\tprivate:\n\t\tstd::string_view Data;\n\t\tPackFormat Format;\n\t\tPackStatus Status;\n\t\tsize_t Offset;\n\n\tpublic:\n\t\tPackDecoder(const std::string_view& NewData, PackFormat NewFormat, size_t NewOffset = 0);\n\t\tSchema* ReadSchema(size_t Depth = 0);\n\t\tPackStatus GetStatus() const;\n\t\tsize_t GetOffset() const;\n\n\tprivate:\n\t\tSchema* ReadMessagePack(size_t Depth);\n\t\tSchema* ReadCBOR(size_t Depth);\n\t\tSchema* ReadArray(size_t Size, size_t Depth);\n\t\tSchema* ReadMap(size_t Size, size_t Depth);\n\t\tbool ReadChunks(uint8_t Major, String& Value);\n\t\tbool ReadBigEndian(size_t Bytes, uint64_t& Value);\n\t\tbool ReadBytes(size_t Size, std::string_view& Value);\n\t\tSchema* Fail(PackStatus NewStatus);\n\t};\n\n\tclass Pack\n\t{\n\tpublic:\n\t\tstatic String Encode(Schema* Value, PackFormat Format, bool* Overflow = nullptr);\n\t\tstatic Schema* Decode(const std::string_view& Data, PackFormat Format, size_t* Offset = nullptr, PackStatus* Status = nullptr);\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\n\tprivate:\n\t\ttemplate <PackFormat Format>\n\t\tstatic void BindFormat(VirtualMachine* VM, const char* Namespace);\n\t\ttemplate <PackFormat Format>\n\t\tstatic String ScriptEncode(Schema* Value);\n\t\ttemplate <PackFormat Format>\n\t\tstatic void ScriptEncodeInto(StringBuffer* Target, Schema* Value);\n\t\ttemplate <PackFormat Format>\n\t\tstatic String ScriptPack(void* Ref, int Type);\n\t\ttemplate <PackFormat Format>\n\t\tstatic void ScriptPackInto(StringBuffer* Target, void* Ref, int Type);\n\t\ttemplate <PackFormat Format>\n\t\tstatic Schema* ScriptDecode(const String& Data);\n\t\ttemplate <PackFormat Format>\n\t\tstatic Schema* ScriptDecodeNext(const String& Data, size_t Offset, size_t& Next, PackStatus& Status);\n\t\tstatic bool ThrowOverflow(bool Overflow);\n\t};\n}\n#endif";
+		callback(context, "executable/pack.h", sc_executable_pack_h, 2806);
+
+		std::string dc_executable_parallel_cpp;
+		dc_executable_parallel_cpp.reserve(14833);
+		dc_executable_parallel_cpp += "#include \"parallel.h\"\n#include \"buffers.h\"\n\nnamespace ASX\n{\n\ttemplate <typename T>\n\tstruct ParallelValue;\n\n\ttemplate <>\n\tstruct ParallelValue<int32_t>\n\t{\n\t\tstatic void SetArg(ImmediateContext* Context, size_t Index, int32_t Value)\n\t\t{\n\t\t\tContext->SetArg32(Index, Value);\n\t\t}\n\t\tstatic int32_t GetReturn(ImmediateContext* Context)\n\t\t{\n\t\t\treturn (int32_t)Context->GetReturnDWord();\n\t\t}\n\t};\n\n\ttemplate <>\n\tstruct ParallelValue<int64_t>\n\t{\n\t\tstatic void SetArg(ImmediateContext* Context, size_t Index, int64_t Value)\n\t\t{\n\t\t\tContext->SetArg64(Index, Value);\n\t\t}\n\t\tstatic int64_t GetReturn(ImmediateContext* Context)\n\t\t{\n\t\t\treturn (int64_t)Context->GetReturnQWord();\n\t\t}\n\t};\n\n\ttemplate <>\n\tstruct ParallelValue<float>\n\t{\n\t\tstatic void SetArg(ImmediateContext* Context, size_t Index, float Value)\n\t\t{\n\t\t\tContext->SetArgFloat(Index, Value);\n\t\t}\n\t\tstatic float GetReturn(ImmediateContext* Context)\n\t\t{\n\t\t\treturn Context->GetReturnFloat();\n\t\t}\n\t};\n\n\ttemplate <>\n\tstruct ParallelValue<double>\n\t{\n\t\tstatic void SetArg(ImmediateContext* Context, size_t Index, double Value)\n\t\t{\n\t\t\tContext->SetArgDouble(Index, Value);\n\t\t}\n\t\tstatic double GetReturn(ImmediateContext* Context)\n\t\t{\n\t\t\treturn Context->GetReturnDouble();\n\t\t}\n\t};\n\n\ttemplate <typename T>\n\tstatic void SortBuffer(Parallel* Pool, T* Buffer, size_t Size)\n\t{\n\t\tsize_t Chunks = std::min(Pool->GetThreads() + 1, std::max<size_t>(1, Size / 4096));\n\t\tsize_t Step = (Size + Chunks - 1) / Chunks;\n\t\tPool->Distribute(Chunks, [Buffer, Size, Step](size_t Index)\n\t\t{\n\t\t\tsize_t From = std::min(Size, Index * Step), To = std::min(Size, From + Step);\n\t\t\tstd::sort(Buffer + From, Buffer + To, &IsOrdered<T>);\n\t\t});\n\n\t\tfor (size_t Width = Step; Width > 0 && Width < Size; Width *= 2)\n\t\t{\n\t\t\tsize_t Merges = (Size + Width * 2 - 1) / (Width * 2);\n\t\t\tPool->Distribute(Merges, [Buffer, Size, Width](size_t Index)\n\t\t\t{\n\t\t\t\tsize_t From = Index * Width * 2, Middle = std::min(Size, From + Width), To = std::min(Size, Middle + Width);\n\t\t\t\tif (Middle < To)\n\t\t\t\t\tstd::inplace_merge(Buffer + From, Buffer + Middle, Buffer + To, &IsOrdered<T>);\n\t\t\t});\n\t\t}\n\t}\n\n\tParallelBatch::ParallelBatch(size_t NewChunks, const ChunkCallback* NewCallback) : Callback(NewCallback), Chunks(NewChunks), Next(0), Done(0)\n\t{\n\t}\n\tvoid ParallelBatch::Execute()\n\t{\n\t\tsize_t Index = Next++;\n\t\twhile (Index < Chunks)\n\t\t{\n\t\t\t(*Callback)(Index);\n\t\t\t++Done;\n\t\t\tIndex = Next++;\n\t\t}\n\t}\n\n\tParallelJob::ParallelJob(asIScriptFunction* NewCallback) : Callback(NewCallback), Finished(false), Success(false)\n\t{\n\t}\n\tParallelJob::~ParallelJob()\n\t{\n\t\tFunction(Callback).Release();\n\t}\n\tvoid ParallelJob::Execute()\n\t{\n\t\tbool Result = Parallel::ExecuteCallback(Callback, [](ImmediateContext*) { }) == Execution::Finished;\n\t\t{\n\t\t\tUMutex<std::mutex> Unique(Mutex);\n\t\t\tSuccess = Result;\n\t\t\tFinished = true;\n\t\t}\n\t\tParallel::Get()->Notify();\n\t}\n\tbool ParallelJob::Join()\n\t{\n\t\tParallel::Get()->Await([this]() { return IsFinished(); });\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\treturn Success;\n\t}\n\tbool ParallelJob::IsFinished()\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\treturn Finished;\n\t}\n\n\tParallel::Parallel(size_t Count) : Active(true)\n\t{\n\t\tThreads.reserve(Count);\n\t\tfor (size_t i = 0; i < Count; i++)\n\t\t{\n\t\t\tThreads.emplace_back([this]()\n\t\t\t{\n\t\t\t\tstd::function<void()> Task;\n\t\t\t\twhile (Dequeue(Task))\n\t\t\t\t\tTask();\n\t\t\t\tVirtualMachine::CleanupThisThread();\n\t\t\t});\n\t\t}\n\t}\n\tParallel::~Parallel()\n\t{\n\t\t{\n\t\t\tUMutex<std::mutex> Unique(Mutex);\n\t\t\tActive = false;\n\t\t\tCondition.notify_all();\n\t\t}\n\t\tfor (auto& Thread : Threads)\n\t\t\tThread.join();\n\t}\n\tvoid Parallel::Distribute(size_t Chunks, const ChunkCallback& Callback)\n\t{\n\t\tif (Chunks <= 1 || Threads.empty())\n\t\t{\n\t\t\tfor (size_t i = 0; i < Chunks; i++)\n\t\t\t\tCallback(i);\n\t\t\treturn;\n\t\t}\n\n\t\tParallelBatch* Batch = new ParallelBatch(Chunks, &Callback);\n\t\tsize_t Helpers = std::min(Threads.size(), Chunks - 1);\n\t\tfor (size_t i = 0; i < Helpers; i++)\n\t\t{\n\t\t\tBatch->AddRef();\n\t\t\tEnqueue([Batch]()\n\t\t\t{\n\t\t\t\tBatch->Execute();\n\t\t\t\tBatch->Release();\n\t\t\t});\n\t\t}\n\n\t\tBatch->Execute();\n\t\twhile (Batch->Done < Chunks)\n\t\t\tstd::this_thread::yield();\n\t\tBatch->Release();\n\t}\n\tvoid Parallel::Partition(siz";
+		dc_executable_parallel_cpp += "e_t Count, size_t Grain, const RangeCallback& Callback)\n\t{\n\t\tsize_t Workers = Threads.size() + 1;\n\t\tsize_t Minimum = Grain > 0 ? Grain : std::max<size_t>(1, Count / (Workers * PARALLEL_GRAIN_FACTOR));\n\t\tif (Count <= Minimum || Threads.empty())\n\t\t{\n\t\t\tCallback(0, Count);\n\t\t\treturn;\n\t\t}\n\n\t\tstd::atomic<size_t> Cursor(0);\n\t\tstd::atomic<bool> Stop(false);\n\t\tDistribute(std::min(Workers, (Count + Minimum - 1) / Minimum), [&Cursor, &Stop, &Callback, Count, Minimum, Workers](size_t)\n\t\t{\n\t\t\tsize_t From = Cursor.load(std::memory_order_relaxed), To = 0;\n\t\t\twhile (!Stop.load(std::memory_order_relaxed))\n\t\t\t{\n\t\t\t\tdo\n\t\t\t\t{\n\t\t\t\t\tif (From >= Count)\n\t\t\t\t\t\treturn;\n\n\t\t\t\t\tTo = std::min(Count, From + std::max(Minimum, (Count - From) / (Workers * 2)));\n\t\t\t\t} while (!Cursor.compare_exchange_weak(From, To, std::memory_order_relaxed));\n\n\t\t\t\tif (!Callback(From, To))\n\t\t\t\t\tStop = true;\n\t\t\t\tFrom = Cursor.load(std::memory_order_relaxed);\n\t\t\t}\n\t\t});\n\t}\n\tvoid Parallel::Enqueue(std::function<void()>&& Callback)\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tTasks.push(std::move(Callback));\n\t\tCondition.notify_one();\n\t}\n\tbool Parallel::Dequeue(std::function<void()>& Callback)\n\t{\n\t\tstd::unique_lock<std::mutex> Unique(Mutex);\n\t\tCondition.wait(Unique, [this]() { return !Tasks.empty() || !Active; });\n\n\t\tif (Tasks.empty())\n\t\t\treturn false;\n\n\t\tCallback = std::move(Tasks.front());\n\t\tTasks.pop();\n\t\treturn true;\n\t}\n\tvoid Parallel::Await(const std::function<bool()>& Ready)\n\t{\n\t\tstd::function<void()> Task;\n\t\twhile (true)\n\t\t{\n\t\t\t{\n\t\t\t\tstd::unique_lock<std::mutex> Unique(Mutex);\n\t\t\t\tCondition.wait(Unique, [this, &Ready]() { return !Tasks.empty() || Ready(); });\n\t\t\t\tif (Ready())\n\t\t\t\t\treturn;\n\n\t\t\t\tTask = std::move(Tasks.front());\n\t\t\t\tTasks.pop();\n\t\t\t}\n\t\t\tTask();\n\t\t}\n\t}\n\tvoid Parallel::Notify()\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tCondition.notify_all();\n\t}\n\tsize_t Parallel::GetThreads() const\n\t{\n\t\treturn Threads.size();\n\t}\n\tvoid Parallel::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->ImportSystemAddon(\"array\");\n\t\tVM->BeginNamespace(\"parallel\");\n\t\tVM->SetFunctionDef(\"void range_event(usize, usize)\");\n\t\tVM->SetFunctionDef(\"void job_event()\");\n\t\tVM->SetFunctionDef(\"int32 map_int32_event(int32)\");\n\t\tVM->SetFunctionDef(\"int64 map_int64_event(int64)\");\n\t\tVM->SetFunctionDef(\"float map_float_event(float)\");\n\t\tVM->SetFunctionDef(\"double map_double_event(double)\");\n\t\tVM->SetFunctionDef(\"int32 reduce_int32_event(int32, int32)\");\n\t\tVM->SetFunctionDef(\"int64 reduce_int64_event(int64, int64)\");\n\t\tVM->SetFunctionDef(\"float reduce_float_event(float, float)\");\n\t\tVM->SetFunctionDef(\"double reduce_double_event(double, double)\");\n\t\tVM->SetFunction(\"void for_range(usize, usize, range_event@, usize = 0)\", &Parallel::ForRange);\n\t\tauto VJob = VM->SetClass<ParallelJob>(\"job\", false);\n\t\tVJob->SetMethod(\"bool join()\", &ParallelJob::Join);\n\t\tVJob->SetMethod(\"bool is_finished()\", &ParallelJob::IsFinished);\n\t\tVM->SetFunction(\"job@ spawn(job_event@)\", &Parallel::Spawn);\n\t\tVM->SetFunction(\"void sort(array<int8>@+)\", &Parallel::Sort);\n\t\tVM->SetFunction(\"void sort(array<int16>@+)\", &Parallel::Sort);\n\t\tVM->SetFunction(\"void sort(array<int32>@+)\", &Parallel::Sort);\n\t\tVM->SetFunction(\"void sort(array<int64>@+)\", &Parallel::Sort);\n\t\tVM->SetFunction(\"void sort(array<uint8>@+)\", &Parallel::Sort);\n\t\tVM->SetFunction(\"void sort(array<uint16>@+)\", &Parallel::Sort);\n\t\tVM->SetFunction(\"void sort(array<uint32>@+)\", &Parallel::Sort);\n\t\tVM->SetFunction(\"void sort(array<uint64>@+)\", &Parallel::Sort);\n\t\tVM->SetFunction(\"void sort(array<float>@+)\", &Parallel::Sort);\n\t\tVM->SetFunction(\"void sort(array<double>@+)\", &Parallel::Sort);\n\t\tVM->SetFunction(\"array<int32>@ map(array<int32>@+, map_int32_event@)\", &Parallel::Map<int32_t>);\n\t\tVM->SetFunction(\"array<int64>@ map(array<int64>@+, map_int64_event@)\", &Parallel::Map<int64_t>);\n\t\tVM->SetFunction(\"array<float>@ map(array<float>@+, map_float_event@)\", &Parallel::Map<float>);\n\t\tVM->SetFunction(\"array<double>@ map(array<double>@+, map_double_event@)\", &Parallel::Map<double>);\n\t\tVM->SetFunction(\"int32 reduce(array<int32>@+, reduce_int32_event@, int32 = 0)\", &Parallel::Reduce<int32_t>);\n\t\t";
+		dc_executable_parallel_cpp += "VM->SetFunction(\"int64 reduce(array<int64>@+, reduce_int64_event@, int64 = 0)\", &Parallel::Reduce<int64_t>);\n\t\tVM->SetFunction(\"float reduce(array<float>@+, reduce_float_event@, float = 0)\", &Parallel::Reduce<float>);\n\t\tVM->SetFunction(\"double reduce(array<double>@+, reduce_double_event@, double = 0)\", &Parallel::Reduce<double>);\n\t\tVM->EndNamespace();\n\t}\n\tvoid Parallel::Cleanup()\n\t{\n\t\tMemory::Delete(Instance);\n\t}\n\tParallel* Parallel::Get()\n\t{\n\t\tstatic std::mutex Initialization;\n\t\tUMutex<std::mutex> Unique(Initialization);\n\t\tif (!Instance)\n\t\t\tInstance = Memory::New<Parallel>(std::max<size_t>(1, std::thread::hardware_concurrency()) - 1);\n\t\treturn Instance;\n\t}\n\tExecution Parallel::ExecuteCallback(asIScriptFunction* Callback, ArgsCallback&& OnArgs, ArgsCallback&& OnReturn)\n\t{\n\t\tauto* Context = ImmediateContext::Get();\n\t\tif (Context != nullptr)\n\t\t{\n\t\t\tauto Status = Context->ExecuteSubcall(Callback, std::move(OnArgs), std::move(OnReturn));\n\t\t\treturn Status ? *Status : Execution::Aborted;\n\t\t}\n\n\t\tauto* VM = Function(Callback).GetVM();\n\t\tauto* Next = VM->RequestContext();\n\t\tauto Status = Next->ExecuteInlineCall(Function(Callback), std::move(OnArgs));\n\t\tExecution Result = Status ? *Status : Execution::Aborted;\n\t\tif (Result == Execution::Suspended)\n\t\t\tNext->Abort();\n\t\telse if (Result == Execution::Finished && OnReturn)\n\t\t\tOnReturn(Next);\n\t\tVM->ReturnContext(Next);\n\t\treturn Result;\n\t}\n\tvoid Parallel::ThrowCallback(Execution Status)\n\t{\n\t\tauto* Context = ImmediateContext::Get();\n\t\tif (!Context)\n\t\t\treturn;\n\n\t\tif (Status == Execution::Suspended)\n\t\t\tContext->SetException(\"parallel callback cannot suspend: co_await is not allowed on worker threads\");\n\t\telse\n\t\t\tContext->SetException(\"parallel callback has failed\");\n\t}\n\tParallelJob* Parallel::Spawn(asIScriptFunction* Callback)\n\t{\n\t\tif (!Callback)\n\t\t\treturn nullptr;\n\n\t\tauto* Pool = Get();\n\t\tParallelJob* Job = new ParallelJob(Callback);\n\t\tif (!Pool->GetThreads())\n\t\t{\n\t\t\tJob->Execute();\n\t\t\treturn Job;\n\t\t}\n\n\t\tJob->AddRef();\n\t\tPool->Enqueue([Job]()\n\t\t{\n\t\t\tJob->Execute();\n\t\t\tJob->Release();\n\t\t});\n\t\treturn Job;\n\t}\n\tvoid Parallel::ForRange(size_t Begin, size_t End, asIScriptFunction* Callback, size_t Grain)\n\t{\n\t\tif (!Callback)\n\t\t\treturn;\n\n\t\tif (End > Begin)\n\t\t{\n\t\t\tstd::atomic<Execution> Status(Execution::Finished);\n\t\t\tGet()->Partition(End - Begin, Grain, [Begin, Callback, &Status](size_t From, size_t To)\n\t\t\t{\n\t\t\t\tExecution Result = ExecuteCallback(Callback, [Begin, From, To](ImmediateContext* Context)\n\t\t\t\t{\n\t\t\t\t\tContext->SetArg64(0, (int64_t)(Begin + From));\n\t\t\t\t\tContext->SetArg64(1, (int64_t)(Begin + To));\n\t\t\t\t});\n\t\t\t\tif (Result == Execution::Finished)\n\t\t\t\t\treturn true;\n\n\t\t\t\tStatus = Result;\n\t\t\t\treturn false;\n\t\t\t});\n\n\t\t\tif (Status != Execution::Finished)\n\t\t\t\tThrowCallback(Status);\n\t\t}\n\n\t\tFunction(Callback).Release();\n\t}\n\tvoid Parallel::Sort(Bindings::Array* Data)\n\t{\n\t\tif (!Data || Data->Size() < 2)\n\t\t\treturn;\n\n\t\tauto* Pool = Get();\n\t\tsize_t Size = Data->Size();\n\t\tvoid* Buffer = Data->GetBuffer();\n\t\tswitch ((TypeId)Data->GetElementTypeId())\n\t\t{\n\t\t\tcase TypeId::INT8:\n\t\t\t\treturn SortBuffer(Pool, (int8_t*)Buffer, Size);\n\t\t\tcase TypeId::INT16:\n\t\t\t\treturn SortBuffer(Pool, (int16_t*)Buffer, Size);\n\t\t\tcase TypeId::INT32:\n\t\t\t\treturn SortBuffer(Pool, (int32_t*)Buffer, Size);\n\t\t\tcase TypeId::INT64:\n\t\t\t\treturn SortBuffer(Pool, (int64_t*)Buffer, Size);\n\t\t\tcase TypeId::UINT8:\n\t\t\t\treturn SortBuffer(Pool, (uint8_t*)Buffer, Size);\n\t\t\tcase TypeId::UINT16:\n\t\t\t\treturn SortBuffer(Pool, (uint16_t*)Buffer, Size);\n\t\t\tcase TypeId::UINT32:\n\t\t\t\treturn SortBuffer(Pool, (uint32_t*)Buffer, Size);\n\t\t\tcase TypeId::UINT64:\n\t\t\t\treturn SortBuffer(Pool, (uint64_t*)Buffer, Size);\n\t\t\tcase TypeId::FLOAT:\n\t\t\t\treturn SortBuffer(Pool, (float*)Buffer, Size);\n\t\t\tcase TypeId::DOUBLE:\n\t\t\t\treturn SortBuffer(Pool, (double*)Buffer, Size);\n\t\t\tdefault:\n\t\t\t\tbreak;\n\t\t}\n\t}\n\ttemplate <typename T>\n\tBindings::Array* Parallel::Map(Bindings::Array* Data, asIScriptFunction* Callback)\n\t{\n\t\tBindings::Array* Result = nullptr;\n\t\tif (Data != nullptr && Callback != nullptr)\n\t\t{\n\t\t\tsize_t Size = Data->Size();\n\t\t\tResult = Bindings::Array::Create(Data->GetArrayObje";
+		dc_executable_parallel_cpp += "ctType(), Size);\n\t\t\tT* Input = (T*)Data->GetBuffer();\n\t\t\tT* Output = (T*)Result->GetBuffer();\n\t\t\tstd::atomic<Execution> Status(Execution::Finished);\n\t\t\tGet()->Partition(Size, 0, [Input, Output, Callback, &Status](size_t From, size_t To)\n\t\t\t{\n\t\t\t\tfor (size_t i = From; i < To; i++)\n\t\t\t\t{\n\t\t\t\t\tExecution Next = ExecuteCallback(Callback, [Input, i](ImmediateContext* Context)\n\t\t\t\t\t{\n\t\t\t\t\t\tParallelValue<T>::SetArg(Context, 0, Input[i]);\n\t\t\t\t\t}, [Output, i](ImmediateContext* Context)\n\t\t\t\t\t{\n\t\t\t\t\t\tOutput[i] = ParallelValue<T>::GetReturn(Context);\n\t\t\t\t\t});\n\t\t\t\t\tif (Next != Execution::Finished)\n\t\t\t\t\t{\n\t\t\t\t\t\tStatus = Next;\n\t\t\t\t\t\treturn false;\n\t\t\t\t\t}\n\t\t\t\t}\n\t\t\t\treturn true;\n\t\t\t});\n\n\t\t\tif (Status != Execution::Finished)\n\t\t\t\tThrowCallback(Status);\n\t\t}\n\n\t\tif (Callback != nullptr)\n\t\t\tFunction(Callback).Release();\n\t\treturn Result;\n\t}\n\ttemplate <typename T>\n\tT Parallel::Reduce(Bindings::Array* Data, asIScriptFunction* Callback, T Initial)\n\t{\n\t\tT Result = Initial;\n\t\tif (Data != nullptr && Callback != nullptr && Data->Size() > 0)\n\t\t{\n\t\t\tVector<std::pair<size_t, T>> Partials;\n\t\t\tstd::atomic<Execution> Status(Execution::Finished);\n\t\t\tstd::mutex Mutex;\n\t\t\tT* Input = (T*)Data->GetBuffer();\n\t\t\tauto Combine = [Callback](T Left, T Right, T& Value)\n\t\t\t{\n\t\t\t\treturn ExecuteCallback(Callback, [Left, Right](ImmediateContext* Context)\n\t\t\t\t{\n\t\t\t\t\tParallelValue<T>::SetArg(Context, 0, Left);\n\t\t\t\t\tParallelValue<T>::SetArg(Context, 1, Right);\n\t\t\t\t}, [&Value](ImmediateContext* Context)\n\t\t\t\t{\n\t\t\t\t\tValue = ParallelValue<T>::GetReturn(Context);\n\t\t\t\t});\n\t\t\t};\n\t\t\tGet()->Partition(Data->Size(), 0, [Input, &Combine, &Partials, &Status, &Mutex](size_t From, size_t To)\n\t\t\t{\n\t\t\t\tT Value = Input[From];\n\t\t\t\tfor (size_t i = From + 1; i < To; i++)\n\t\t\t\t{\n\t\t\t\t\tExecution Next = Combine(Value, Input[i], Value);\n\t\t\t\t\tif (Next != Execution::Finished)\n\t\t\t\t\t{\n\t\t\t\t\t\tStatus = Next;\n\t\t\t\t\t\treturn false;\n\t\t\t\t\t}\n\t\t\t\t}\n\n\t\t\t\tUMutex<std::mutex> Unique(Mutex);\n\t\t\t\tPartials.emplace_back(From, Value);\n\t\t\t\treturn true;\n\t\t\t});\n\n\t\t\tstd::sort(Partials.begin(), Partials.end(), [](const std::pair<size_t, T>& A, const std::pair<size_t, T>& B) { return A.first < B.first; });\n\t\t\tfor (auto& Next : Partials)\n\t\t\t{\n\t\t\t\tif (Status != Execution::Finished)\n\t\t\t\t\tbreak;\n\n\t\t\t\tExecution Combined = Combine(Result, Next.second, Result);\n\t\t\t\tif (Combined != Execution::Finished)\n\t\t\t\t\tStatus = Combined;\n\t\t\t}\n\n\t\t\tif (Status != Execution::Finished)\n\t\t\t\tThrowCallback(Status);\n\t\t}\n\n\t\tif (Callback != nullptr)\n\t\t\tFunction(Callback).Release();\n\t\treturn Result;\n\t}\n\tParallel* Parallel::Instance = nullptr;\n}";
+		callback(context, "executable/parallel.cpp", dc_executable_parallel_cpp.c_str(), (unsigned int)dc_executable_parallel_cpp.size());
+
+		const char* sc_executable_parallel_h = "#ifndef PARALLEL_H\n#define PARALLEL_H\n#include \"runtime.hpp\"\n#include <vengeance/vengeance.h>\n#define PARALLEL_GRAIN_FACTOR 64\n\nnamespace ASX\n{\n\ttypedef std::function<void(size_t)> ChunkCallback;\n\ttypedef std::function<bool(size_t, size_t)> RangeCallback;\n\n\tclass ParallelBatch : public Reference<ParallelBatch>\n\t{\n\tpublic:\n\t\tconst ChunkCallback* Callback;\n\t\tsize_t Chunks;\n\t\tstd::atomic<size_t> Next;\n\t\tstd::atomic<size_t> Done;\n\n\tpublic:\n\t\tParallelBatch(size_t NewChunks, const ChunkCallback* NewCallback);\n\t\tvoid Execute();\n\t};\n\n\tclass ParallelJob : public Reference<ParallelJob>\n\t{\n\tprivate:\n\t\tstd::mutex Mutex;\n\t\tasIScriptFunction* Callback;\n\t\tbool Finished;\n\t\tbool Success;\n\n\tpublic:\n\t\tParallelJob(asIScriptFunction* NewCallback);\n\t\t~ParallelJob();\n\t\tvoid Execute();\n\t\tbool Join();\n\t\tbool IsFinished();\n\t};\n\n\tclass Parallel\n\t{\n\tprivate:\n\t\tstatic Parallel* Instance;\n\n\tprivate:\n\t\tVector<std::thread> Threads;\n\t\tSingleQueue<std::function<void()>> Tasks;\n\t\tstd::condition_variable Condition;\n\t\tstd::mutex Mutex;\n\t\tbool Active;\n\n\tpublic:\n\t\tParallel(size_t Count);\n\t\t~Parallel();\n\t\tvoid Distribute(size_t Chunks, const ChunkCallback& Callback);\n\t\tvoid Partition(size_t Count, size_t Grain, const RangeCallback& Callback);\n\t\tvoid Await(const std::function<bool()>& Ready);\n\t\tvoid Notify();\n\t\tsize_t GetThreads() const;\n\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\t\tstatic void Cleanup();\n\t\tstatic Parallel* Get();\n\t\tstatic Execution ExecuteCallback(asIScriptFunction* Callback, ArgsCallback&& OnArgs, ArgsCallback&& OnReturn = nullptr);\n\n\tprivate:\n\t\tvoid Enqueue(std::function<void()>&& Callback);\n\t\tbool Dequeue(std::function<void()>& Callback);\n\t\tstatic void ThrowCallback(Execution Status);\n\t\tstatic ParallelJob* Spawn(asIScriptFunction* Callback);\n\t\tstatic void ForRange(size_t Begin, size_t End, asIScriptFunction* Callback, size_t Grain);\n\t\tstatic void Sort(Bindings::Array* Data);\n\t\ttemplate <typename T>\n\t\tstatic Bindings::Array* Map(Bindings::Array* Data, asIScriptFunction* Callback);\n\t\ttemplate <typename T>\n\t\tstatic T Reduce(Bindings::Array* Data, asIScriptFunction* Callback, T Initial);\n\t};\n}\n#endif";
+		callback(context, "executable/parallel.h", sc_executable_parallel_h, 2125);
 
 		std::string dc_executable_program_cpp;
-		dc_executable_program_cpp.reserve(5289);
-		dc_executable_program_cpp += "#include \"program.hpp\"\n#include \"runtime.hpp\"\n#include <vengeance/vengeance.h>\n#include <vengeance/bindings.h>\n#include <vengeance/layer.h>\n#include <signal.h>\n\nusing namespace Vitex::Layer;\nusing namespace ASX;\n\nEventLoop* Loop = nullptr;\nVirtualMachine* VM = nullptr;\nCompiler* Unit = nullptr;\nImmediateContext* Context = nullptr;\nstd::mutex Mutex;\nint ExitCode = 0;\n\nvoid exit_program(int sigv)\n{\n\tif (sigv != SIGINT && sigv != SIGTERM)\n        return;\n\n\tUMutex<std::mutex> Unique(Mutex);\n    {\n        if (Runtime::TryContextExit(EnvironmentConfig::Get(), sigv))\n        {\n\t\t\tLoop->Wakeup();\n            goto GracefulShutdown;\n        }\n\n        auto* App = Application::Get();\n        if (App != nullptr && App->GetState() == ApplicationState::Active)\n        {\n            App->Stop();\n\t\t\tLoop->Wakeup();\n            goto GracefulShutdown;\n        }\n\n        if (Schedule::IsAvailable())\n        {\n            Schedule::Get()->Stop();\n\t\t\tLoop->Wakeup();\n            goto GracefulShutdown;\n        }\n\n        return std::exit((int)ExitStatus::Kill);\n    }\nGracefulShutdown:\n    signal(sigv, &exit_program);\n}\nvoid setup_program(EnvironmentConfig& Env)\n{\n    OS::Directory::SetWorking(Env.Path.c_str());\n    signal(SIGINT, &exit_program);\n    signal(SIGTERM, &exit_program);\n#ifdef VI_UNIX\n    signal(SIGPIPE, SIG_IGN);\n    signal(SIGCHLD, SIG_IGN);\n#endif\n}\nbool load_program(EnvironmentConfig& Env)\n{\n#ifdef HAS_PROGRAM_BYTECODE\n    program_bytecode::foreach(&Env, [](void* Context, const char* Buffer, unsigned Size)\n    {\n        EnvironmentConfig* Env = (EnvironmentConfig*)Context;\n\t    Env->Program = Codec::Base64Decode(std::string_view(Buffer, (size_t)Size));\n    });\n    return true;\n#else\n    return false;\n#endif\n}\nint main(int argc, char* argv[])\n{\n\tEnvironmentConfig Env;\n\tEnv.Path = *OS::Directory::GetModule();\n\tEnv.Module = argc > 0 ? argv[0] : \"runtime\";\n\tEnv.AutoSchedule = {{BUILDER_ENV_AUTO_SCHEDULE}};\n\tEnv.AutoConsole = {{BUILDER_ENV_AUTO_CONSOLE}};\n\tEnv.AutoStop = {{BUILDER_ENV_AUTO_STOP}};\n    if (!load_program(Env))\n        return 0;\n\n\tVector<String> Args;\n\tArgs.reserve((size_t)argc);\n\tfor (int i = 0; i < argc; i++)\n\t\tArgs.push_back(argv[i]);\n\n\tSystemConfig Config;\n\tConfig.Permissions = { {{BUILDER_CONFIG_PERMISSIONS}} };\n\tConfig.Libraries = { {{BUILDER_CONFIG_LIBRARIES}} };\n\tConfig.Functions = { {{BUILDER_CONFIG_FUNCTIONS}} };\n\tConfig.SystemAddons = { {{BUILDER_CONFIG_ADDONS}} };\n\tConfig.Tags = {{BUILDER_CONFIG_TAGS}};\n\tConfig.TsImports = {{BUILDER_CONFIG_TS_IMPORTS}};\n\tConfig.EssentialsOnly = {{BUILDER_CONFIG_ESSENTIALS_ONLY}};\n    setup_program(Env);\n\n\tsize_t Modules = Vitex::LOAD_NETWORKING | Vitex::LOAD_CRYPTOGRAPHY | Vitex::LOAD_PROVIDERS | Vitex::LOAD_LOCALE;\n\tif (!Config.EssentialsOnly)\n\t\tModules |= Vitex::LOAD_PLATFORM | Vitex::LOAD_AUDIO | Vitex::LOAD_GRAPHICS;\n\n\tVitex::HeavyRuntime Scope(Modules);\n\t{\n\t\tVM = new VirtualMachine();\n\t\tBindings::HeavyRegistry().BindAddons(VM);\n\t\tUnit = VM->CreateCompiler();\n        Context = VM->RequestContext();\n\t\t\n        Vector<std::pair<uint32_t, size_t>> Settings = { {{BUILDER_CONFIG_SETTINGS}} };\n        for (auto& Item : Settings)\n            VM->SetProperty((Features)Item.first, Item.second);\n\n\t\tUnit = VM->CreateCompiler();\n\t\tExitCode = Runtime::ConfigureContext(Config, Env, VM, Unit) ? (int)ExitStatus::OK : (int)ExitStatus::CompilerError;\n\t\tif (ExitCode != (int)ExitStatus::OK)\n\t\t\tgoto FinishProgram;\n\n\t\tRuntime::ConfigureSystem(Config);\n\t\tif (!Unit->Prepare(Env.Module))\n\t\t{\n\t\t\tVI_ERR(\"cannot prepare <%s> module scope\", Env.Module);\n\t\t\tExitCode = (int)ExitStatus::PrepareError;\n\t\t\tgoto FinishProgram;\n\t\t}\n\n\t\tByteCodeInfo Info;\n\t\tInfo.Data.insert(Info.Data.begin(), Env.Program.begin(), Env.Program.end());\n\t\tif (!Unit->LoadByteCode(&Info).Get())\n\t\t{\n\t\t\tVI_ERR(\"cannot load <%s> module bytecode\", Env.Module);\n\t\t\tExitCode = (int)ExitStatus::LoadingError;\n\t\t\tgoto FinishProgram;\n\t\t}\n\n\t    ProgramEntrypoint Entrypoint;\n\t\tFunction Main = Runtime::GetEntrypoint(Env, Entrypoint, Unit);\n\t\tif (!Main.IsValid())\n        {\n\t\t\tExitCode = (int)ExitStatus::EntrypointError;\n\t\t\tgoto FinishProgram;\n   ";
-		dc_executable_program_cpp += "     }\n\n\t\tint ExitCode = 0;\n\t\tTypeInfo Type = VM->GetTypeInfoByDecl(\"array<string>@\");\n\t\tBindings::Array* ArgsArray = Type.IsValid() ? Bindings::Array::Compose<String>(Type.GetTypeInfo(), Args) : nullptr;\n\t\tVM->SetExceptionCallback([](ImmediateContext* Context)\n\t\t{\n\t\t\tif (!Context->WillExceptionBeCaught())\n\t\t\t\tstd::exit((int)ExitStatus::RuntimeError);\n\t\t});\n\n\t\tMain.AddRef();\n\t\tLoop = new EventLoop();\n\t\tLoop->Listen(Context);\n\t\tLoop->Enqueue(FunctionDelegate(Main, Context), [&Main, ArgsArray](ImmediateContext* Context)\n\t\t{\n\t\t\tRuntime::StartupEnvironment(EnvironmentConfig::Get());\n\t\t\tif (Main.GetArgsCount() > 0)\n\t\t\t\tContext->SetArgObject(0, ArgsArray);\n\t\t}, [&ExitCode, &Type, &Main, ArgsArray](ImmediateContext* Context)\n\t\t{\n\t\t\tExitCode = Main.GetReturnTypeId() == (int)TypeId::VOIDF ? 0 : (int)Context->GetReturnDWord();\n\t\t\tif (ArgsArray != nullptr)\n\t\t\t\tContext->GetVM()->ReleaseObject(ArgsArray, Type);\n\t\t\tRuntime::ShutdownEnvironment(EnvironmentConfig::Get());\n\t\t\tLoop->Wakeup();\n\t\t});\n        \n\t\tRuntime::AwaitContext(Mutex, Loop, VM, Context);\n\t}\nFinishProgram:\n\tMemory::Release(Context);\n\tMemory::Release(Unit);\n\tMemory::Release(VM);\n    Memory::Release(Loop);\n\treturn ExitCode;\n}";
+		dc_executable_program_cpp.reserve(5803);
+		dc_executable_program_cpp += "#include \"program.hpp\"\n#include \"runtime.hpp\"\n#include \"allocator.h\"\n#include <vengeance/vengeance.h>\n#include <vengeance/bindings.h>\n#include <vengeance/layer.h>\n#include <signal.h>\n\nusing namespace Vitex::Layer;\nusing namespace ASX;\n\nEventLoop* Loop = nullptr;\nVirtualMachine* VM = nullptr;\nCompiler* Unit = nullptr;\nImmediateContext* Context = nullptr;\nstd::mutex Mutex;\nint ExitCode = 0;\n\nvoid exit_program(int sigv)\n{\n\tif (sigv != SIGINT && sigv != SIGTERM)\n        return;\n\n\tUMutex<std::mutex> Unique(Mutex);\n    {\n        if (Runtime::TryContextExit(EnvironmentConfig::Get(), sigv))\n        {\n\t\t\tLoop->Wakeup();\n            goto GracefulShutdown;\n        }\n\n        auto* App = Application::Get();\n        if (App != nullptr && App->GetState() == ApplicationState::Active)\n        {\n            App->Stop();\n\t\t\tLoop->Wakeup();\n            goto GracefulShutdown;\n        }\n\n        if (Schedule::IsAvailable())\n        {\n            Schedule::Get()->Stop();\n\t\t\tLoop->Wakeup();\n            goto GracefulShutdown;\n        }\n\n        return std::exit((int)ExitStatus::Kill);\n    }\nGracefulShutdown:\n    signal(sigv, &exit_program);\n}\nvoid setup_program(EnvironmentConfig& Env)\n{\n    OS::Directory::SetWorking(Env.Path.c_str());\n    signal(SIGINT, &exit_program);\n    signal(SIGTERM, &exit_program);\n#ifdef VI_UNIX\n    signal(SIGPIPE, SIG_IGN);\n    signal(SIGCHLD, SIG_IGN);\n#endif\n}\nbool load_program(EnvironmentConfig& Env)\n{\n#ifdef HAS_PROGRAM_BYTECODE\n    program_bytecode::foreach(&Env, [](void* Context, const char* Buffer, unsigned Size)\n    {\n        EnvironmentConfig* Env = (EnvironmentConfig*)Context;\n\t    Env->Program = Codec::Base64Decode(std::string_view(Buffer, (size_t)Size));\n    });\n    return true;\n#else\n    return false;\n#endif\n}\nint main(int argc, char* argv[])\n{\n\tEnvironmentConfig Env;\n\tEnv.Path = *OS::Directory::GetModule();\n\tEnv.Module = argc > 0 ? argv[0] : \"runtime\";\n\tEnv.AutoSchedule = {{BUILDER_ENV_AUTO_SCHEDULE}};\n\tEnv.AutoConsole = {{BUILDER_ENV_AUTO_CONSOLE}};\n\tEnv.AutoStop = {{BUILDER_ENV_AUTO_STOP}};\n    if (!load_program(Env))\n        return 0;\n\n\tVector<String> Args;\n\tArgs.reserve((size_t)argc);\n\tfor (int i = 0; i < argc; i++)\n\t\tArgs.push_back(argv[i]);\n\n\tSystemConfig Config;\n\tConfig.Permissions = { {{BUILDER_CONFIG_PERMISSIONS}} };\n\tConfig.Libraries = { {{BUILDER_CONFIG_LIBRARIES}} };\n\tConfig.Functions = { {{BUILDER_CONFIG_FUNCTIONS}} };\n\tConfig.SystemAddons = { {{BUILDER_CONFIG_ADDONS}} };\n\tConfig.Tags = {{BUILDER_CONFIG_TAGS}};\n\tConfig.TsImports = {{BUILDER_CONFIG_TS_IMPORTS}};\n\tConfig.EssentialsOnly = {{BUILDER_CONFIG_ESSENTIALS_ONLY}};\n\tConfig.Contexts = {{BUILDER_CONFIG_CONTEXTS}};\n\tConfig.MemoryLimit = {{BUILDER_CONFIG_MEMORY_LIMIT}};\n\tConfig.IncrementalGC = {{BUILDER_CONFIG_INCREMENTAL_GC}};\n    setup_program(Env);\n\n\tsize_t Flags = Vitex::LOAD_NETWORKING | Vitex::LOAD_CRYPTOGRAPHY | Vitex::LOAD_PROVIDERS | Vitex::LOAD_LOCALE;\n\tif (!Config.EssentialsOnly)\n\t\tFlags |= Vitex::LOAD_PLATFORM | Vitex::LOAD_AUDIO | Vitex::LOAD_GRAPHICS;\n\n\tThreadAllocator* Allocator = Config.MemoryLimit > 0 ? ThreadAllocator::Get() : nullptr;\n\tVitex::HeavyRuntime Scope(Flags, Allocator);\n\tif (Allocator != nullptr && Scope.HasFtAllocator())\n\t\tRuntime::GetMemoryBudget().Measure = &ThreadAllocator::GetLiveMemory;\n\n\t{\n\t\tVM = new VirtualMachine();\n\t\tBindings::HeavyRegistry().BindAddons(VM);\n\t\tRuntime::PrepareMemoryLimit(Config);\n\t\tUnit = VM->CreateCompiler();\n        Context = VM->RequestContext();\n\t\t\n        Vector<std::pair<uint32_t, size_t>> Settings = { {{BUILDER_CONFIG_SETTINGS}} };\n        for (auto& Item : Settings)\n            VM->SetProperty((Features)Item.first, Item.second);\n\n\t\tRuntime::PrepareContexts(Config, VM);\n\n\t\tUnit = VM->CreateCompiler();\n\t\tExitCode = Runtime::ConfigureContext(Config, Env, VM, Unit) ? (int)ExitStatus::OK : (int)ExitStatus::CompilerError;\n\t\tif (ExitCode != (int)ExitStatus::OK)\n\t\t\tgoto FinishProgram;\n\n\t\tRuntime::ConfigureSystem(Config);\n\t\tif (!Unit->Prepare(Env.Module))\n\t\t{\n\t\t\tVI_ERR(\"cannot prepare <%s> module scope\", Env.Module);\n\t\t\tExitCode = (int)ExitStatus::PrepareError;\n\t\t\tgoto FinishProgram;\n\t\t}";
+		dc_executable_program_cpp += "\n\n\t\tByteCodeInfo Info;\n\t\tInfo.Data.insert(Info.Data.begin(), Env.Program.begin(), Env.Program.end());\n\t\tif (!Unit->LoadByteCode(&Info).Get())\n\t\t{\n\t\t\tVI_ERR(\"cannot load <%s> module bytecode\", Env.Module);\n\t\t\tExitCode = (int)ExitStatus::LoadingError;\n\t\t\tgoto FinishProgram;\n\t\t}\n\n\t    ProgramEntrypoint Entrypoint;\n\t\tFunction Main = Runtime::GetEntrypoint(Env, Entrypoint, Unit);\n\t\tif (!Main.IsValid())\n        {\n\t\t\tExitCode = (int)ExitStatus::EntrypointError;\n\t\t\tgoto FinishProgram;\n        }\n\n\t\tint ExitCode = 0;\n\t\tTypeInfo Type = VM->GetTypeInfoByDecl(\"array<string>@\");\n\t\tBindings::Array* ArgsArray = Type.IsValid() ? Bindings::Array::Compose<String>(Type.GetTypeInfo(), Args) : nullptr;\n\t\tVM->SetExceptionCallback([](ImmediateContext* Context)\n\t\t{\n\t\t\tif (!Context->WillExceptionBeCaught())\n\t\t\t\tstd::exit((int)ExitStatus::RuntimeError);\n\t\t});\n\n\t\tMain.AddRef();\n\t\tLoop = new EventLoop();\n\t\tLoop->Listen(Context);\n\t\tLoop->Enqueue(FunctionDelegate(Main, Context), [&Main, ArgsArray](ImmediateContext* Context)\n\t\t{\n\t\t\tRuntime::StartupEnvironment(EnvironmentConfig::Get());\n\t\t\tif (Main.GetArgsCount() > 0)\n\t\t\t\tContext->SetArgObject(0, ArgsArray);\n\t\t}, [&ExitCode, &Type, &Main, ArgsArray](ImmediateContext* Context)\n\t\t{\n\t\t\tExitCode = Main.GetReturnTypeId() == (int)TypeId::VOIDF ? 0 : (int)Context->GetReturnDWord();\n\t\t\tif (ArgsArray != nullptr)\n\t\t\t\tContext->GetVM()->ReleaseObject(ArgsArray, Type);\n\t\t\tRuntime::ShutdownEnvironment(EnvironmentConfig::Get());\n\t\t\tLoop->Wakeup();\n\t\t});\n        \n\t\tRuntime::AwaitContext(Config, Mutex, Loop, VM, Context);\n\t}\nFinishProgram:\n\tModules::Cleanup();\n\tMemory::Release(Context);\n\tMemory::Release(Unit);\n\tMemory::Release(VM);\n    Memory::Release(Loop);\n\treturn ExitCode;\n}";
 		callback(context, "executable/program.cpp", dc_executable_program_cpp.c_str(), (unsigned int)dc_executable_program_cpp.size());
 
 		std::string dc_executable_runtime_hpp;
-		dc_executable_runtime_hpp.reserve(7331);
-		dc_executable_runtime_hpp += "#ifndef RUNTIME_H\n#define RUNTIME_H\n#include <vengeance/bindings.h>\n#include <vengeance/vengeance.h>\n\nusing namespace Vitex::Core;\nusing namespace Vitex::Compute;\nusing namespace Vitex::Scripting;\n\nnamespace ASX\n{\n\tenum class ExitStatus\n\t{\n\t\tContinue = 0x00fffff - 1,\n\t\tOK = 0,\n\t\tRuntimeError,\n\t\tPrepareError,\n\t\tLoadingError,\n\t\tSavingError,\n\t\tCompilerError,\n\t\tEntrypointError,\n\t\tInputError,\n\t\tInvalidCommand,\n\t\tInvalidDeclaration,\n\t\tCommandError,\n\t\tKill\n\t};\n\n\tstruct ProgramEntrypoint\n\t{\n\t\tconst char* ReturnsWithArgs = \"int main(array<string>@)\";\n\t\tconst char* Returns = \"int main()\";\n\t\tconst char* Simple = \"void main()\";\n\t};\n\n\tstruct EnvironmentConfig\n\t{\n\t\tInlineArgs Commandline;\n\t\tUnorderedSet<String> Addons;\n\t\tFunctionDelegate AtExit;\n\t\tFileEntry File;\n\t\tString Name;\n\t\tString Path;\n\t\tString Program;\n\t\tString Registry;\n\t\tString Mode;\n\t\tString Output;\n\t\tString Addon;\n\t\tCompiler* ThisCompiler;\n\t\tconst char* Module;\n\t\tint32_t AutoSchedule;\n\t\tbool AutoConsole;\n\t\tbool AutoStop;\n\t\tbool Inline;\n\n\t\tEnvironmentConfig() : ThisCompiler(nullptr), Module(\"__anonymous__\"), AutoSchedule(-1), AutoConsole(false), AutoStop(false), Inline(true)\n\t\t{\n\t\t}\n\t\tvoid Parse(int ArgsCount, char** ArgsData, const UnorderedSet<String>& Flags = { })\n\t\t{\n\t\t\tCommandline = OS::Process::ParseArgs(ArgsCount, ArgsData, (size_t)ArgsFormat::KeyValue | (size_t)ArgsFormat::FlagValue | (size_t)ArgsFormat::StopIfNoMatch, Flags);\n\t\t}\n\t\tstatic EnvironmentConfig& Get(EnvironmentConfig* Other = nullptr)\n\t\t{\n\t\t\tstatic EnvironmentConfig* Base = Other;\n\t\t\tVI_ASSERT(Base != nullptr, \"env was not set\");\n\t\t\treturn *Base;\n\t\t}\n\t};\n\n\tstruct SystemConfig\n\t{\n\t\tUnorderedMap<String, std::pair<String, String>> Functions;\n\t\tUnorderedMap<AccessOption, bool> Permissions;\n\t\tVector<std::pair<String, bool>> Libraries;\n\t\tVector<std::pair<String, int32_t>> Settings;\n\t\tVector<String> SystemAddons;\n\t\tbool TsImports = true;\n\t\tbool Tags = true;\n\t\tbool Debug = false;\n\t\tbool Interactive = false;\n\t\tbool EssentialsOnly = true;\n\t\tbool PrettyProgress = true;\n\t\tbool LoadByteCode = false;\n\t\tbool SaveByteCode = false;\n\t\tbool SaveSourceCode = false;\n\t\tbool Dependencies = false;\n\t\tbool Install = false;\n\t\tsize_t Installed = 0;\n\t};\n\n\tclass Runtime\n\t{\n\tpublic:\n\t\tstatic void StartupEnvironment(EnvironmentConfig& Env)\n\t\t{\n\t\t\tif (Env.AutoSchedule >= 0)\n\t\t\t\tSchedule::Get()->Start(Env.AutoSchedule > 0 ? Schedule::Desc((size_t)Env.AutoSchedule) : Schedule::Desc());\n\n\t\t\tif (Env.AutoConsole)\n\t\t\t\tConsole::Get()->Attach();\n\t\t}\n\t\tstatic void ShutdownEnvironment(EnvironmentConfig& Env)\n\t\t{\n\t\t\tif (Env.AutoStop)\n\t\t\t\tSchedule::Get()->Stop();\n\t\t}\n\t\tstatic void ConfigureSystem(SystemConfig& Config)\n\t\t{\n\t\t\tfor (auto& Option : Config.Permissions)\n\t\t\t\tOS::Control::Set(Option.first, Option.second);\n\t\t}\n\t\tstatic bool ConfigureContext(SystemConfig& Config, EnvironmentConfig& Env, VirtualMachine* VM, Compiler* ThisCompiler)\n\t\t{\n\t\t\tVM->SetTsImports(Config.TsImports);\n\t\t\tVM->SetModuleDirectory(OS::Path::GetDirectory(Env.Path.c_str()));\n\t\t\tVM->SetPreserveSourceCode(Config.SaveSourceCode);\n\n\t\t\tfor (auto& Name : Config.SystemAddons)\n\t\t\t{\n\t\t\t\tif (!VM->ImportSystemAddon(Name))\n\t\t\t\t{\n\t\t\t\t\tVI_ERR(\"system addon <%s> cannot be loaded\", Name.c_str());\n\t\t\t\t\treturn false;\n\t\t\t\t}\n\t\t\t}\n\n\t\t\tfor (auto& Path : Config.Libraries)\n\t\t\t{\n\t\t\t\tif (!VM->ImportCLibrary(Path.first, Path.second))\n\t\t\t\t{\n\t\t\t\t\tVI_ERR(\"external %s <%s> cannot be loaded\", Path.second ? \"addon\" : \"clibrary\", Path.first.c_str());\n\t\t\t\t\treturn false;\n\t\t\t\t}\n\t\t\t}\n\n\t\t\tfor (auto& Data : Config.Functions)\n\t\t\t{\n\t\t\t\tif (!VM->ImportCFunction({ Data.first }, Data.second.first, Data.second.second))\n\t\t\t\t{\n\t\t\t\t\tVI_ERR(\"clibrary function <%s> from <%s> cannot be loaded\", Data.second.first.c_str(), Data.first.c_str());\n\t\t\t\t\treturn false;\n\t\t\t\t}\n\t\t\t}\n\n\t\t\tauto* Macro = ThisCompiler->GetProcessor();\n\t\t\tMacro->AddDefaultDefinitions();\n\n\t\t\tEnv.ThisCompiler = ThisCompiler;\n\t\t\tBindings::Tags::BindSyntax(VM, Config.Tags, &Runtime::ProcessTags);\n\t\t\tEnvironmentConfig::Get(&Env);\n\n\t\t\tVM->ImportSystemAddon(\"ctypes\");\n\t\t\tVM->BeginNamespace(\"this_process\");\n\t\t\tVM->SetFunctionDef(\"void exit_event(int)\");\n\t\t\tVM->SetFunct";
-		dc_executable_runtime_hpp += "ion(\"void before_exit(exit_event@)\", &Runtime::ApplyContextExit);\n\t\t\tVM->SetFunction(\"uptr@ get_compiler()\", &Runtime::GetCompiler);\n\t\t\tVM->EndNamespace();\n\t\t\treturn true;\n\t\t}\n\t\tstatic bool TryContextExit(EnvironmentConfig& Env, int Value)\n\t\t{\n\t\t\tif (!Env.AtExit.IsValid())\n\t\t\t\treturn false;\n\n\t\t\tauto Status = Env.AtExit([Value](ImmediateContext* Context)\n\t\t\t{\n\t\t\t\tContext->SetArg32(0, Value);\n\t\t\t}).Get();\n\t\t\tEnv.AtExit.Release();\n\t\t\tVirtualMachine::CleanupThisThread();\n\t\t\treturn !!Status;\n\t\t}\n\t\tstatic void ApplyContextExit(asIScriptFunction* Callback)\n\t\t{\n\t\t\tauto& Env = EnvironmentConfig::Get();\n\t\t\tUPtr<ImmediateContext> Context = Callback ? Env.ThisCompiler->GetVM()->RequestContext() : nullptr;\n\t\t\tEnv.AtExit = FunctionDelegate(Callback, *Context);\n\t\t}\n\t\tstatic void AwaitContext(std::mutex& Mutex, EventLoop* Loop, VirtualMachine* VM, ImmediateContext* Context)\n\t\t{\n\t\t\tEventLoop::Set(Loop);\n\t\t\twhile (Loop->PollExtended(Context, 1000))\n\t\t\t{\n\t\t\t\tVM->PerformPeriodicGarbageCollection(60000);\n\t\t\t\tLoop->Dequeue(VM);\n\t\t\t}\n\n\t\t\tUMutex<std::mutex> Unique(Mutex);\n\t\t\tif (Schedule::HasInstance())\n\t\t\t{\n\t\t\t\tauto* Queue = Schedule::Get();\n\t\t\t\twhile (!Queue->CanEnqueue() && Queue->HasAnyTasks())\n\t\t\t\t\tQueue->Dispatch();\n\t\t\t}\n\n\t\t\tEventLoop::Set(nullptr);\n\t\t\tContext->Reset();\n\t\t\tVM->PerformFullGarbageCollection();\n\t\t\tApplyContextExit(nullptr);\n\t\t}\n\t\tstatic Function GetEntrypoint(EnvironmentConfig& Env, ProgramEntrypoint& Entrypoint, Compiler* Unit, bool Silent = false)\n\t\t{\n\t\t\tFunction MainReturnsWithArgs = Unit->GetModule().GetFunctionByDecl(Entrypoint.ReturnsWithArgs);\n\t\t\tFunction MainReturns = Unit->GetModule().GetFunctionByDecl(Entrypoint.Returns);\n\t\t\tFunction MainSimple = Unit->GetModule().GetFunctionByDecl(Entrypoint.Simple);\n\t\t\tif (MainReturnsWithArgs.IsValid() || MainReturns.IsValid() || MainSimple.IsValid())\n\t\t\t\treturn MainReturnsWithArgs.IsValid() ? MainReturnsWithArgs : (MainReturns.IsValid() ? MainReturns : MainSimple);\n\n\t\t\tif (!Silent)\n\t\t\t\tVI_ERR(\"module %s must contain either: <%s>, <%s> or <%s>\", Env.Module, Entrypoint.ReturnsWithArgs, Entrypoint.Returns, Entrypoint.Simple);\n\t\t\treturn Function(nullptr);\n\t\t}\n\t\tstatic Compiler* GetCompiler()\n\t\t{\n\t\t\treturn EnvironmentConfig::Get().ThisCompiler;\n\t\t}\n\n\tprivate:\n\t\tstatic void ProcessTags(VirtualMachine* VM, Bindings::Tags::TagInfo&& Info)\n\t\t{\n\t\t\tauto& Env = EnvironmentConfig::Get();\n\t\t\tfor (auto& Tag : Info)\n\t\t\t{\n\t\t\t\tif (Tag.Name != \"main\")\n\t\t\t\t\tcontinue;\n\n\t\t\t\tfor (auto& Directive : Tag.Directives)\n\t\t\t\t{\n\t\t\t\t\tif (Directive.Name == \"#schedule::main\")\n\t\t\t\t\t{\n\t\t\t\t\t\tauto Threads = Directive.Args.find(\"threads\");\n\t\t\t\t\t\tif (Threads != Directive.Args.end())\n\t\t\t\t\t\t\tEnv.AutoSchedule = FromString<uint8_t>(Threads->second).Or(0);\n\t\t\t\t\t\telse\n\t\t\t\t\t\t\tEnv.AutoSchedule = 0;\n\n\t\t\t\t\t\tauto Stop = Directive.Args.find(\"stop\");\n\t\t\t\t\t\tif (Stop != Directive.Args.end())\n\t\t\t\t\t\t{\n\t\t\t\t\t\t\tStringify::ToLower(Threads->second);\n\t\t\t\t\t\t\tauto Value = FromString<uint8_t>(Threads->second);\n\t\t\t\t\t\t\tif (!Value)\n\t\t\t\t\t\t\t\tEnv.AutoStop = (Threads->second == \"on\" || Threads->second == \"true\" || Threads->second == \"yes\");\n\t\t\t\t\t\t\telse\n\t\t\t\t\t\t\t\tEnv.AutoStop = *Value > 0;\n\t\t\t\t\t\t}\n\t\t\t\t\t}\n\t\t\t\t\telse if (Directive.Name == \"#console::main\")\n\t\t\t\t\t\tEnv.AutoConsole = true;\n\t\t\t\t}\n\t\t\t}\n\t\t}\n\t};\n}\n#endif";
+		dc_executable_runtime_hpp.reserve(11546);
+		dc_executable_runtime_hpp += "#ifndef RUNTIME_H\n#define RUNTIME_H\n#include <vengeance/bindings.h>\n#include <vengeance/vengeance.h>\n#ifdef __linux__\n#include <unistd.h>\n#endif\n#define RUNTIME_DEQUEUE_PASSES 64\n\nusing namespace Vitex::Core;\nusing namespace Vitex::Compute;\nusing namespace Vitex::Scripting;\n\nnamespace ASX\n{\n\tenum class ExitStatus\n\t{\n\t\tContinue = 0x00fffff - 1,\n\t\tOK = 0,\n\t\tRuntimeError,\n\t\tPrepareError,\n\t\tLoadingError,\n\t\tSavingError,\n\t\tCompilerError,\n\t\tEntrypointError,\n\t\tInputError,\n\t\tInvalidCommand,\n\t\tInvalidDeclaration,\n\t\tCommandError,\n\t\tKill\n\t};\n\n\tstruct ProgramEntrypoint\n\t{\n\t\tconst char* ReturnsWithArgs = \"int main(array<string>@)\";\n\t\tconst char* Returns = \"int main()\";\n\t\tconst char* Simple = \"void main()\";\n\t};\n\n\tstruct EnvironmentConfig\n\t{\n\t\tInlineArgs Commandline;\n\t\tUnorderedSet<String> Addons;\n\t\tFunctionDelegate AtExit;\n\t\tFileEntry File;\n\t\tString Name;\n\t\tString Path;\n\t\tString Program;\n\t\tString Registry;\n\t\tString Mode;\n\t\tString Output;\n\t\tString Addon;\n\t\tCompiler* ThisCompiler;\n\t\tconst char* Module;\n\t\tint32_t AutoSchedule;\n\t\tbool AutoConsole;\n\t\tbool AutoStop;\n\t\tbool Inline;\n\n\t\tEnvironmentConfig() : ThisCompiler(nullptr), Module(\"__anonymous__\"), AutoSchedule(-1), AutoConsole(false), AutoStop(false), Inline(true)\n\t\t{\n\t\t}\n\t\tvoid Parse(int ArgsCount, char** ArgsData, const UnorderedSet<String>& Flags = { })\n\t\t{\n\t\t\tCommandline = OS::Process::ParseArgs(ArgsCount, ArgsData, (size_t)ArgsFormat::KeyValue | (size_t)ArgsFormat::FlagValue | (size_t)ArgsFormat::StopIfNoMatch, Flags);\n\t\t}\n\t\tstatic EnvironmentConfig& Get(EnvironmentConfig* Other = nullptr)\n\t\t{\n\t\t\tstatic EnvironmentConfig* Base = Other;\n\t\t\tVI_ASSERT(Base != nullptr, \"env was not set\");\n\t\t\treturn *Base;\n\t\t}\n\t};\n\n\tstruct MemoryBudget\n\t{\n\t\tstd::atomic<size_t> Limit = 0;\n\t\tstd::atomic<size_t> Usage = 0;\n\t\tstd::atomic<size_t> Peak = 0;\n\t\tsize_t (*Measure)() = nullptr;\n\t};\n\n\tstruct SystemConfig\n\t{\n\t\tUnorderedMap<String, std::pair<String, String>> Functions;\n\t\tUnorderedMap<AccessOption, bool> Permissions;\n\t\tVector<std::pair<String, bool>> Libraries;\n\t\tVector<std::pair<String, int32_t>> Settings;\n\t\tVector<String> SystemAddons;\n\t\tbool TsImports = true;\n\t\tbool Tags = true;\n\t\tbool Debug = false;\n\t\tbool Interactive = false;\n\t\tbool EssentialsOnly = true;\n\t\tbool PrettyProgress = true;\n\t\tbool LoadByteCode = false;\n\t\tbool SaveByteCode = false;\n\t\tbool SaveSourceCode = false;\n\t\tbool Dependencies = false;\n\t\tbool Install = false;\n\t\tbool IncrementalGC = false;\n\t\tbool AllocatorStats = false;\n\t\tbool Watch = false;\n\t\tbool TraceStartup = false;\n\t\tbool VerbatimIncludes = false;\n\t\tbool Lazy = false;\n\t\tbool Check = false;\n\t\tbool Shake = false;\n\t\tsize_t Installed = 0;\n\t\tsize_t Contexts = 0;\n\t\tsize_t MemoryLimit = 0;\n\t\tsize_t Cluster = 0;\n\t};\n\n\tclass Modules\n\t{\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\t\tstatic void Cleanup();\n\t\tstatic uint64_t Update(uint64_t Timeout);\n\t\tstatic void Cancel(EventLoop* Loop);\n\t};\n\n\tclass Runtime\n\t{\n\tpublic:\n\t\tstatic void StartupEnvironment(EnvironmentConfig& Env)\n\t\t{\n\t\t\tif (Env.AutoSchedule >= 0)\n\t\t\t\tSchedule::Get()->Start(Env.AutoSchedule > 0 ? Schedule::Desc((size_t)Env.AutoSchedule) : Schedule::Desc());\n\n\t\t\tif (Env.AutoConsole)\n\t\t\t\tConsole::Get()->Attach();\n\t\t}\n\t\tstatic void ShutdownEnvironment(EnvironmentConfig& Env)\n\t\t{\n\t\t\tif (Env.AutoStop)\n\t\t\t\tSchedule::Get()->Stop();\n\t\t}\n\t\tstatic void ConfigureSystem(SystemConfig& Config)\n\t\t{\n\t\t\tfor (auto& Option : Config.Permissions)\n\t\t\t\tOS::Control::Set(Option.first, Option.second);\n\t\t}\n\t\tstatic bool ConfigureContext(SystemConfig& Config, EnvironmentConfig& Env, VirtualMachine* VM, Compiler* ThisCompiler)\n\t\t{\n\t\t\tVM->SetTsImports(Config.TsImports);\n\t\t\tVM->SetModuleDirectory(OS::Path::GetDirectory(Env.Path.c_str()));\n\t\t\tVM->SetPreserveSourceCode(Config.SaveSourceCode);\n\n\t\t\tfor (auto& Name : Config.SystemAddons)\n\t\t\t{\n\t\t\t\tif (!VM->ImportSystemAddon(Name))\n\t\t\t\t{\n\t\t\t\t\tVI_ERR(\"system addon <%s> cannot be loaded\", Name.c_str());\n\t\t\t\t\treturn false;\n\t\t\t\t}\n\t\t\t}\n\n\t\t\tfor (auto& Path : Config.Libraries)\n\t\t\t{\n\t\t\t\tif (!VM->ImportCLibrary(Path.first, Path.second))\n\t\t\t\t{\n\t\t\t\t\tVI_ERR(\"external %s <%s> cannot be loaded\", Path.second ? \"addon\" :";
+		dc_executable_runtime_hpp += " \"clibrary\", Path.first.c_str());\n\t\t\t\t\treturn false;\n\t\t\t\t}\n\t\t\t}\n\n\t\t\tfor (auto& Data : Config.Functions)\n\t\t\t{\n\t\t\t\tif (!VM->ImportCFunction({ Data.first }, Data.second.first, Data.second.second))\n\t\t\t\t{\n\t\t\t\t\tVI_ERR(\"clibrary function <%s> from <%s> cannot be loaded\", Data.second.first.c_str(), Data.first.c_str());\n\t\t\t\t\treturn false;\n\t\t\t\t}\n\t\t\t}\n\n\t\t\tauto* Macro = ThisCompiler->GetProcessor();\n\t\t\tMacro->AddDefaultDefinitions();\n\n\t\t\tEnv.ThisCompiler = ThisCompiler;\n\t\t\tBindings::Tags::BindSyntax(VM, Config.Tags, &Runtime::ProcessTags);\n\t\t\tEnvironmentConfig::Get(&Env);\n\n\t\t\tVM->ImportSystemAddon(\"ctypes\");\n\t\t\tVM->BeginNamespace(\"this_process\");\n\t\t\tVM->SetFunctionDef(\"void exit_event(int)\");\n\t\t\tVM->SetFunction(\"void before_exit(exit_event@)\", &Runtime::ApplyContextExit);\n\t\t\tVM->SetFunction(\"uptr@ get_compiler()\", &Runtime::GetCompiler);\n\t\t\tVM->SetFunction(\"usize get_memory_usage()\", &Runtime::UpdateMemoryUsage);\n\t\t\tVM->SetFunction(\"usize get_memory_peak()\", &Runtime::GetMemoryPeak);\n\t\t\tVM->SetFunction(\"usize get_memory_limit()\", &Runtime::GetMemoryLimit);\n\t\t\tVM->EndNamespace();\n\t\t\tModules::BindSyntax(VM);\n\t\t\treturn true;\n\t\t}\n\t\tstatic void PrepareContexts(SystemConfig& Config, VirtualMachine* VM)\n\t\t{\n\t\t\tif (!Config.Contexts)\n\t\t\t\treturn;\n\n\t\t\tVector<ImmediateContext*> Contexts;\n\t\t\tContexts.reserve(Config.Contexts);\n\t\t\tfor (size_t i = 0; i < Config.Contexts; i++)\n\t\t\t\tContexts.push_back(VM->RequestContext());\n\n\t\t\tfor (auto* Next : Contexts)\n\t\t\t\tVM->ReturnContext(Next);\n\t\t}\n\t\tstatic void PrepareMemoryLimit(SystemConfig& Config)\n\t\t{\n\t\t\tGetMemoryBudget().Limit = Config.MemoryLimit;\n\t\t}\n\t\tstatic void ApplyMemoryLimit(size_t Usage)\n\t\t{\n\t\t\tsize_t Limit = GetMemoryBudget().Limit;\n\t\t\tif (!Limit || StoreMemoryUsage(Usage) <= Limit)\n\t\t\t\treturn;\n\n\t\t\tImmediateContext* Context = ImmediateContext::Get();\n\t\t\tif (Context != nullptr && Context->GetState() == Execution::Active)\n\t\t\t\tContext->SetException(\"memory limit exceeded\");\n\t\t}\n\t\tstatic bool ApplyMemoryPressure(VirtualMachine* VM)\n\t\t{\n\t\t\tauto& Budget = GetMemoryBudget();\n\t\t\tsize_t Limit = Budget.Limit;\n\t\t\tif (!Limit)\n\t\t\t\treturn false;\n\n\t\t\tsize_t Usage = UpdateMemoryUsage();\n\t\t\tif (Usage < Limit - Limit / 5)\n\t\t\t\treturn false;\n\n\t\t\tVM->GarbageCollect((size_t)GarbageCollector::ONE_STEP | (size_t)GarbageCollector::DETECT_GARBAGE | (size_t)GarbageCollector::DESTROY_GARBAGE, 256);\n\t\t\treturn UpdateMemoryUsage() > Limit;\n\t\t}\n\t\tstatic size_t UpdateMemoryUsage()\n\t\t{\n\t\t\tauto& Budget = GetMemoryBudget();\n\t\t\treturn StoreMemoryUsage(Budget.Measure ? Budget.Measure() : GetResidentMemory());\n\t\t}\n\t\tstatic size_t StoreMemoryUsage(size_t Usage)\n\t\t{\n\t\t\tauto& Budget = GetMemoryBudget();\n\t\t\tsize_t Peak = Budget.Peak;\n\t\t\tBudget.Usage = Usage;\n\t\t\twhile (Usage > Peak && !Budget.Peak.compare_exchange_weak(Peak, Usage))\n\t\t\t\tcontinue;\n\t\t\treturn Usage;\n\t\t}\n\t\tstatic size_t GetResidentMemory()\n\t\t{\n#ifdef __linux__\n\t\t\tFILE* Stream = fopen(\"/proc/self/statm\", \"r\");\n\t\t\tif (!Stream)\n\t\t\t\treturn 0;\n\n\t\t\tunsigned long long Size = 0, Resident = 0;\n\t\t\tint Count = fscanf(Stream, \"%llu %llu\", &Size, &Resident);\n\t\t\tfclose(Stream);\n\t\t\treturn Count == 2 ? (size_t)Resident * (size_t)sysconf(_SC_PAGESIZE) : 0;\n#else\n\t\t\treturn 0;\n#endif\n\t\t}\n\t\tstatic size_t GetMemoryPeak()\n\t\t{\n\t\t\treturn GetMemoryBudget().Peak;\n\t\t}\n\t\tstatic size_t GetMemoryLimit()\n\t\t{\n\t\t\treturn GetMemoryBudget().Limit;\n\t\t}\n\t\tstatic MemoryBudget& GetMemoryBudget()\n\t\t{\n\t\t\tstatic MemoryBudget Base;\n\t\t\treturn Base;\n\t\t}\n\t\tstatic bool TryContextExit(EnvironmentConfig& Env, int Value)\n\t\t{\n\t\t\tif (!Env.AtExit.IsValid())\n\t\t\t\treturn false;\n\n\t\t\tauto Status = Env.AtExit([Value](ImmediateContext* Context)\n\t\t\t{\n\t\t\t\tContext->SetArg32(0, Value);\n\t\t\t}).Get();\n\t\t\tEnv.AtExit.Release();\n\t\t\tVirtualMachine::CleanupThisThread();\n\t\t\treturn !!Status;\n\t\t}\n\t\tstatic void ApplyContextExit(asIScriptFunction* Callback)\n\t\t{\n\t\t\tauto& Env = EnvironmentConfig::Get();\n\t\t\tUPtr<ImmediateContext> Context = Callback ? Env.ThisCompiler->GetVM()->RequestContext() : nullptr;\n\t\t\tEnv.AtExit = FunctionDelegate(Callback, *Context);\n\t\t}\n\t\tstatic void AwaitContext(SystemConfig& Config, std::mutex& Mutex, EventLoop* Loop, VirtualMach";
+		dc_executable_runtime_hpp += "ine* VM, ImmediateContext* Context)\n\t\t{\n\t\t\tAwaitLoop(Config, Loop, VM, Context);\n\t\t\tUMutex<std::mutex> Unique(Mutex);\n\t\t\tif (Schedule::HasInstance())\n\t\t\t{\n\t\t\t\tauto* Queue = Schedule::Get();\n\t\t\t\twhile (!Queue->CanEnqueue() && Queue->HasAnyTasks())\n\t\t\t\t\tQueue->Dispatch();\n\t\t\t}\n\n\t\t\tEventLoop::Set(nullptr);\n\t\t\tContext->Reset();\n\t\t\tVM->PerformFullGarbageCollection();\n\t\t\tApplyContextExit(nullptr);\n\t\t}\n\t\tstatic void AwaitLoop(SystemConfig& Config, EventLoop* Loop, VirtualMachine* VM, ImmediateContext* Context)\n\t\t{\n\t\t\tuint64_t Timeout = 1000;\n\t\t\tEventLoop::Set(Loop);\n\t\t\twhile (Loop->PollExtended(Context, Timeout))\n\t\t\t{\n\t\t\t\tif (Config.MemoryLimit > 0)\n\t\t\t\t\tApplyMemoryPressure(VM);\n\n\t\t\t\tif (Config.IncrementalGC)\n\t\t\t\t{\n\t\t\t\t\tPerformIncrementalGarbageCollection(VM);\n\t\t\t\t\tVM->PerformPeriodicGarbageCollection(600000);\n\t\t\t\t}\n\t\t\t\telse\n\t\t\t\t\tVM->PerformPeriodicGarbageCollection(60000);\n\n\t\t\t\tTimeout = Modules::Update(1000);\n\t\t\t\tfor (size_t Passes = 0; Passes < RUNTIME_DEQUEUE_PASSES; Passes++)\n\t\t\t\t{\n\t\t\t\t\tif (!Loop->Dequeue(VM))\n\t\t\t\t\t\tbreak;\n\t\t\t\t}\n\t\t\t}\n\t\t\tModules::Cancel(Loop);\n\t\t}\n\t\tstatic void PerformIncrementalGarbageCollection(VirtualMachine* VM)\n\t\t{\n\t\t\tunsigned int NewObjects = 0;\n\t\t\tVM->GetStatistics(nullptr, nullptr, nullptr, &NewObjects, nullptr);\n\t\t\tif (NewObjects > 0)\n\t\t\t\tVM->GarbageCollect((size_t)GarbageCollector::ONE_STEP | (size_t)GarbageCollector::DETECT_GARBAGE | (size_t)GarbageCollector::DESTROY_GARBAGE, std::min<size_t>(NewObjects, 1024));\n\t\t}\n\t\tstatic Function GetEntrypoint(EnvironmentConfig& Env, ProgramEntrypoint& Entrypoint, Compiler* Unit, bool Silent = false)\n\t\t{\n\t\t\tFunction MainReturnsWithArgs = Unit->GetModule().GetFunctionByDecl(Entrypoint.ReturnsWithArgs);\n\t\t\tFunction MainReturns = Unit->GetModule().GetFunctionByDecl(Entrypoint.Returns);\n\t\t\tFunction MainSimple = Unit->GetModule().GetFunctionByDecl(Entrypoint.Simple);\n\t\t\tif (MainReturnsWithArgs.IsValid() || MainReturns.IsValid() || MainSimple.IsValid())\n\t\t\t\treturn MainReturnsWithArgs.IsValid() ? MainReturnsWithArgs : (MainReturns.IsValid() ? MainReturns : MainSimple);\n\n\t\t\tif (!Silent)\n\t\t\t\tVI_ERR(\"module %s must contain either: <%s>, <%s> or <%s>\", Env.Module, Entrypoint.ReturnsWithArgs, Entrypoint.Returns, Entrypoint.Simple);\n\t\t\treturn Function(nullptr);\n\t\t}\n\t\tstatic Compiler* GetCompiler()\n\t\t{\n\t\t\treturn EnvironmentConfig::Get().ThisCompiler;\n\t\t}\n\n\tprivate:\n\t\tstatic void ProcessTags(VirtualMachine* VM, Bindings::Tags::TagInfo&& Info)\n\t\t{\n\t\t\tauto& Env = EnvironmentConfig::Get();\n\t\t\tfor (auto& Tag : Info)\n\t\t\t{\n\t\t\t\tif (Tag.Name != \"main\")\n\t\t\t\t\tcontinue;\n\n\t\t\t\tfor (auto& Directive : Tag.Directives)\n\t\t\t\t{\n\t\t\t\t\tif (Directive.Name == \"#schedule::main\")\n\t\t\t\t\t{\n\t\t\t\t\t\tauto Threads = Directive.Args.find(\"threads\");\n\t\t\t\t\t\tif (Threads != Directive.Args.end())\n\t\t\t\t\t\t\tEnv.AutoSchedule = FromString<uint8_t>(Threads->second).Or(0);\n\t\t\t\t\t\telse\n\t\t\t\t\t\t\tEnv.AutoSchedule = 0;\n\n\t\t\t\t\t\tauto Stop = Directive.Args.find(\"stop\");\n\t\t\t\t\t\tif (Stop != Directive.Args.end())\n\t\t\t\t\t\t{\n\t\t\t\t\t\t\tStringify::ToLower(Threads->second);\n\t\t\t\t\t\t\tauto Value = FromString<uint8_t>(Threads->second);\n\t\t\t\t\t\t\tif (!Value)\n\t\t\t\t\t\t\t\tEnv.AutoStop = (Threads->second == \"on\" || Threads->second == \"true\" || Threads->second == \"yes\");\n\t\t\t\t\t\t\telse\n\t\t\t\t\t\t\t\tEnv.AutoStop = *Value > 0;\n\t\t\t\t\t\t}\n\t\t\t\t\t}\n\t\t\t\t\telse if (Directive.Name == \"#console::main\")\n\t\t\t\t\t\tEnv.AutoConsole = true;\n\t\t\t\t}\n\t\t\t}\n\t\t}\n\t};\n}\n#endif";
 		callback(context, "executable/runtime.hpp", dc_executable_runtime_hpp.c_str(), (unsigned int)dc_executable_runtime_hpp.size());
 
+		std::string dc_executable_sources_cpp;
+		dc_executable_sources_cpp.reserve(8573);
+		dc_executable_sources_cpp += "#include \"sources.h\"\n\nnamespace ASX\n{\n\tstatic bool IsSourceIdentifier(char V)\n\t{\n\t\treturn (V >= 'a' && V <= 'z') || (V >= 'A' && V <= 'Z') || (V >= '0' && V <= '9') || V == '_' || (uint8_t)V > 127;\n\t}\n\tstatic std::string_view GetSourceWord(std::string_view& Line)\n\t{\n\t\twhile (!Line.empty() && (Line.front() == ' ' || Line.front() == '\\t'))\n\t\t\tLine.remove_prefix(1);\n\n\t\tsize_t Size = 0;\n\t\twhile (Size < Line.size() && IsSourceIdentifier(Line[Size]))\n\t\t\t++Size;\n\n\t\tstd::string_view Word = Line.substr(0, Size);\n\t\tLine.remove_prefix(Size);\n\t\treturn Word;\n\t}\n\tstatic std::string_view GetSourceQuote(std::string_view& Line)\n\t{\n\t\twhile (!Line.empty() && (Line.front() == ' ' || Line.front() == '\\t'))\n\t\t\tLine.remove_prefix(1);\n\t\tif (Line.empty() || (Line.front() != '\"' && Line.front() != '\\''))\n\t\t\treturn std::string_view();\n\n\t\tsize_t Quote = Line.find(Line.front(), 1);\n\t\treturn Quote != std::string::npos && Quote > 1 ? Line.substr(1, Quote - 1) : std::string_view();\n\t}\n\n\tSourceCache::SourceCache() : Processor(nullptr), Fingerprint(0), Hits(0), Misses(0), Verbatims(0), Verbatim(false), Modified(false)\n\t{\n\t}\n\tvoid SourceCache::SetVerbatim(bool Enabled)\n\t{\n\t\tVerbatim = Enabled;\n\t}\n\tvoid SourceCache::SetProcessor(Preprocessor* Base)\n\t{\n\t\tProcessor = Base;\n\t}\n\tvoid SourceCache::Load(const String& Path)\n\t{\n\t\tauto Data = OS::File::ReadAsString(Path);\n\t\tif (!Data)\n\t\t\treturn;\n\n\t\tstd::string_view Text = *Data;\n\t\twhile (!Text.empty())\n\t\t{\n\t\t\tsize_t End = Text.find('\\n');\n\t\t\tstd::string_view Line = Text.substr(0, End);\n\t\t\tText = End == std::string::npos ? std::string_view() : Text.substr(End + 1);\n\n\t\t\tsize_t First = Line.find(' ');\n\t\t\tsize_t Second = First == std::string::npos ? First : Line.find(' ', First + 1);\n\t\t\tsize_t Third = Second == std::string::npos ? Second : Line.find(' ', Second + 1);\n\t\t\tif (Third == std::string::npos || Third + 1 >= Line.size())\n\t\t\t\tcontinue;\n\n\t\t\tauto Hash = FromString<uint64_t>(Line.substr(0, First));\n\t\t\tauto Definitions = FromString<uint64_t>(Line.substr(First + 1, Second - First - 1));\n\t\t\tif (!Hash || !Definitions)\n\t\t\t\tcontinue;\n\n\t\t\tSourceEntry& Entry = Entries[String(Line.substr(Third + 1))];\n\t\t\tEntry.Hash = *Hash;\n\t\t\tEntry.Definitions = *Definitions;\n\t\t\tEntry.Verbatim = Line.substr(Second + 1, Third - Second - 1) == \"1\";\n\t\t}\n\t}\n\tvoid SourceCache::Save(const String& Path)\n\t{\n\t\tif (!Modified)\n\t\t\treturn;\n\n\t\tString Data;\n\t\tfor (auto& Next : Entries)\n\t\t{\n\t\t\tData += ToString(Next.second.Hash);\n\t\t\tData += ' ';\n\t\t\tData += ToString(Next.second.Definitions);\n\t\t\tData += Next.second.Verbatim ? \" 1 \" : \" 0 \";\n\t\t\tData += Next.first;\n\t\t\tData += '\\n';\n\t\t}\n\n\t\tif (OS::File::Write(Path, (uint8_t*)Data.data(), Data.size()))\n\t\t\tModified = false;\n\t\telse\n\t\t\tVI_WARN(\"cannot save preprocessor cache to <%s>\", Path.c_str());\n\t}\n\tvoid SourceCache::AddSource(const std::string_view& Data)\n\t{\n\t\tif (!Verbatim)\n\t\t\treturn;\n\n\t\tSourceFile File;\n\t\tScanSource(File, Data);\n\t\tAddDefinitions(File.Defines);\n\t}\n\tvoid SourceCache::Prefetch(const String& Path, const std::string_view& Data)\n\t{\n\t\tUnorderedSet<String> Visited = { Path };\n\t\tVector<SourceFile> Wave(1);\n\t\tWave.front().Path = Path;\n\t\tScanSource(Wave.front(), Data);\n\t\tResolveSource(Wave.front());\n\t\tif (Verbatim)\n\t\t\tAddDefinitions(Wave.front().Defines);\n\n\t\twhile (!Wave.empty())\n\t\t{\n\t\t\tVector<SourceFile> Next;\n\t\t\tfor (auto& File : Wave)\n\t\t\t{\n\n\t\t\t\tfor (auto& Name : File.Addons)\n\t\t\t\t{\n\t\t\t\t\tif (Visited.insert(Name).second)\n\t\t\t\t\t\tAddons.push_back(Name);\n\t\t\t\t}\n\n\t\t\t\tfor (auto& Include : File.Includes)\n\t\t\t\t{\n\t\t\t\t\tif (!Visited.insert(Include).second)\n\t\t\t\t\t\tcontinue;\n\n\t\t\t\t\tNext.emplace_back();\n\t\t\t\t\tNext.back().Path = Include;\n\t\t\t\t}\n\n\t\t\t\tif (File.Exists)\n\t\t\t\t{\n\t\t\t\t\tFile.Includes.clear();\n\t\t\t\t\tFile.Addons.clear();\n\t\t\t\t\tFile.Names.clear();\n\t\t\t\t\tPrefetched[File.Path] = std::move(File);\n\t\t\t\t}\n\t\t\t}\n\n\t\t\tif (Next.size() > 1)\n\t\t\t\tParallel::Get()->Distribute(Next.size(), [&Next](size_t Index) { ReadSource(Next[Index]); });\n\t\t\telse if (!Next.empty())\n\t\t\t\tReadSource(Next.front());\n\t\t\tWave = std::move(Next);\n\t\t}\n\t}\n\tIncludeType SourceCache::Resolve(const String& Path, String& Output)\n\t{\n\t\tif (Served.count(Path) > 0)\n\t\t{\n\t\t";
+		dc_executable_sources_cpp += "\tOutput.clear();\n\t\t\treturn IncludeType::Virtual;\n\t\t}\n\n\t\tSourceFile File;\n\t\tauto It = Prefetched.find(Path);\n\t\tif (It != Prefetched.end())\n\t\t{\n\t\t\tFile = std::move(It->second);\n\t\t\tPrefetched.erase(It);\n\t\t}\n\t\telse\n\t\t{\n\t\t\tauto Data = OS::File::ReadAsString(Path);\n\t\t\tif (!Data)\n\t\t\t\treturn IncludeType::Unchanged;\n\n\t\t\tFile.Path = Path;\n\t\t\tFile.Data = std::move(*Data);\n\t\t\tFile.Hash = GetHash(File.Data);\n\t\t\tif (Verbatim)\n\t\t\t\tScanSource(File, File.Data);\n\t\t}\n\n\t\tDependencies[Path] = File.Hash;\n\t\tif (!Verbatim)\n\t\t{\n\t\t\tOutput = std::move(File.Data);\n\t\t\treturn IncludeType::Preprocess;\n\t\t}\n\n\t\tSourceEntry& Entry = Entries[Path];\n\t\tif (Entry.Hash == File.Hash && Entry.Definitions == Fingerprint)\n\t\t\t++Hits;\n\t\telse\n\t\t{\n\t\t\tEntry.Hash = File.Hash;\n\t\t\tEntry.Definitions = Fingerprint;\n\t\t\tEntry.Verbatim = !File.Directives && IsVerbatim(File.Data);\n\t\t\tModified = true;\n\t\t\t++Misses;\n\t\t}\n\n\t\tOutput = std::move(File.Data);\n\t\tif (!Entry.Verbatim)\n\t\t{\n\t\t\tAddDefinitions(File.Defines);\n\t\t\treturn IncludeType::Preprocess;\n\t\t}\n\n\t\t++Verbatims;\n\t\tServed.insert(Path);\n\t\treturn IncludeType::Virtual;\n\t}\n\tsize_t SourceCache::GetHits() const\n\t{\n\t\treturn Hits;\n\t}\n\tsize_t SourceCache::GetMisses() const\n\t{\n\t\treturn Misses;\n\t}\n\tsize_t SourceCache::GetVerbatims() const\n\t{\n\t\treturn Verbatims;\n\t}\n\tconst Vector<String>& SourceCache::GetAddons() const\n\t{\n\t\treturn Addons;\n\t}\n\tconst UnorderedMap<String, uint64_t>& SourceCache::GetDependencies() const\n\t{\n\t\treturn Dependencies;\n\t}\n\tuint64_t SourceCache::GetHash(const std::string_view& Data)\n\t{\n\t\tuint64_t Hash = 14695981039346656037ull;\n\t\tfor (char V : Data)\n\t\t{\n\t\t\tHash ^= (uint8_t)V;\n\t\t\tHash *= 1099511628211ull;\n\t\t}\n\t\treturn Hash;\n\t}\n\tbool SourceCache::IsVerbatim(const std::string_view& Data)\n\t{\n\t\tsize_t Offset = 0;\n\t\twhile (Offset < Data.size())\n\t\t{\n\t\t\tchar V = Data[Offset];\n\t\t\tif (V == '#')\n\t\t\t\treturn false;\n\t\t\telse if (!IsSourceIdentifier(V))\n\t\t\t{\n\t\t\t\t++Offset;\n\t\t\t\tcontinue;\n\t\t\t}\n\n\t\t\tsize_t Start = Offset;\n\t\t\twhile (Offset < Data.size() && IsSourceIdentifier(Data[Offset]))\n\t\t\t\t++Offset;\n\t\t\tif (V >= '0' && V <= '9')\n\t\t\t\tcontinue;\n\n\t\t\tstd::string_view Name = Data.substr(Start, Offset - Start);\n\t\t\tif (Name == \"import\" || (!Definitions.empty() && Definitions.count(String(Name)) > 0))\n\t\t\t\treturn false;\n\t\t\telse if (Processor != nullptr && Processor->IsDefined(Name))\n\t\t\t\treturn false;\n\t\t}\n\n\t\treturn true;\n\t}\n\tvoid SourceCache::AddDefinitions(const Vector<String>& Names)\n\t{\n\t\tfor (auto& Name : Names)\n\t\t{\n\t\t\tif (Definitions.insert(Name).second)\n\t\t\t\tFingerprint += GetHash(Name);\n\t\t}\n\t}\n\tvoid SourceCache::ReadSource(SourceFile& File)\n\t{\n\t\tauto Data = OS::File::ReadAsString(File.Path);\n\t\tif (!Data)\n\t\t\treturn;\n\n\t\tFile.Data = std::move(*Data);\n\t\tFile.Hash = GetHash(File.Data);\n\t\tFile.Exists = true;\n\t\tScanSource(File, File.Data);\n\t\tResolveSource(File);\n\t}\n\tvoid SourceCache::ScanSource(SourceFile& File, const std::string_view& Data)\n\t{\n\t\tsize_t Offset = 0;\n\t\twhile (Offset < Data.size())\n\t\t{\n\t\t\tsize_t End = Data.find('\\n', Offset);\n\t\t\tif (End == std::string::npos)\n\t\t\t\tEnd = Data.size();\n\n\t\t\tstd::string_view Line = Data.substr(Offset, End - Offset);\n\t\t\tOffset = End + 1;\n\t\t\twhile (!Line.empty() && (Line.front() == ' ' || Line.front() == '\\t'))\n\t\t\t\tLine.remove_prefix(1);\n\n\t\t\tif (!Line.empty() && Line.front() == '#')\n\t\t\t{\n\t\t\t\tFile.Directives = true;\n\t\t\t\tLine.remove_prefix(1);\n\t\t\t\tstd::string_view Directive = GetSourceWord(Line);\n\t\t\t\tif (Directive == \"define\")\n\t\t\t\t{\n\t\t\t\t\tstd::string_view Name = GetSourceWord(Line);\n\t\t\t\t\tif (!Name.empty())\n\t\t\t\t\t\tFile.Defines.emplace_back(Name);\n\t\t\t\t\tcontinue;\n\t\t\t\t}\n\t\t\t\telse if (Directive != \"include\")\n\t\t\t\t\tcontinue;\n\t\t\t}\n\t\t\telse if (GetSourceWord(Line) == \"import\")\n\t\t\t{\n\t\t\t\tFile.Directives = true;\n\t\t\t\tif (GetSourceWord(Line) != \"from\")\n\t\t\t\t\tcontinue;\n\t\t\t}\n\t\t\telse\n\t\t\t\tcontinue;\n\n\t\t\tstd::string_view Name = GetSourceQuote(Line);\n\t\t\tif (!Name.empty())\n\t\t\t\tFile.Names.emplace_back(Name);\n\t\t}\n\t}\n\tvoid SourceCache::ResolveSource(SourceFile& File)\n\t{\n\t\tString Directory = OS::Path::GetDirectory(File.Path.c_str());\n\t\tfor (auto& Name : File.Names)\n\t\t{\n\t\t\tif (Name.front() == '@')\n\t\t\t{\n\t\t\t\tFile.Addons.push_back(std::move(Name))";
+		dc_executable_sources_cpp += ";\n\t\t\t\tcontinue;\n\t\t\t}\n\t\t\telse if (Name.find(\"://\") != std::string::npos)\n\t\t\t\tcontinue;\n\n\t\t\tfor (auto& Candidate : { Name, Name + \".as\" })\n\t\t\t{\n\t\t\t\tFileEntry Entry;\n\t\t\t\tauto Target = OS::Path::Resolve(Candidate, Directory, true);\n\t\t\t\tif (Target && OS::File::GetState(*Target, &Entry) && !Entry.IsDirectory)\n\t\t\t\t{\n\t\t\t\t\tFile.Includes.push_back(*Target);\n\t\t\t\t\tbreak;\n\t\t\t\t}\n\t\t\t}\n\t\t}\n\t}\n}";
+		callback(context, "executable/sources.cpp", dc_executable_sources_cpp.c_str(), (unsigned int)dc_executable_sources_cpp.size());
+
+		const char* sc_executable_sources_h = "#ifndef SOURCES_H\n#define SOURCES_H\n#include \"runtime.hpp\"\n#include \"parallel.h\"\n#include <vengeance/vengeance.h>\n#define SOURCES_FILE \".sources\"\n\nnamespace ASX\n{\n\tstruct SourceEntry\n\t{\n\t\tuint64_t Hash = 0;\n\t\tuint64_t Definitions = 0;\n\t\tbool Verbatim = false;\n\t};\n\n\tstruct SourceFile\n\t{\n\t\tVector<String> Includes;\n\t\tVector<String> Addons;\n\t\tVector<String> Names;\n\t\tVector<String> Defines;\n\t\tString Path;\n\t\tString Data;\n\t\tuint64_t Hash = 0;\n\t\tbool Directives = false;\n\t\tbool Exists = false;\n\t};\n\n\tclass SourceCache\n\t{\n\tprivate:\n\t\tUnorderedMap<String, SourceFile> Prefetched;\n\t\tUnorderedMap<String, SourceEntry> Entries;\n\t\tUnorderedMap<String, uint64_t> Dependencies;\n\t\tUnorderedSet<String> Definitions;\n\t\tUnorderedSet<String> Served;\n\t\tVector<String> Addons;\n\t\tPreprocessor* Processor;\n\t\tuint64_t Fingerprint;\n\t\tsize_t Hits;\n\t\tsize_t Misses;\n\t\tsize_t Verbatims;\n\t\tbool Verbatim;\n\t\tbool Modified;\n\n\tpublic:\n\t\tSourceCache();\n\t\tvoid SetVerbatim(bool Enabled);\n\t\tvoid SetProcessor(Preprocessor* Base);\n\t\tvoid Load(const String& Path);\n\t\tvoid Save(const String& Path);\n\t\tvoid AddSource(const std::string_view& Data);\n\t\tvoid Prefetch(const String& Path, const std::string_view& Data);\n\t\tIncludeType Resolve(const String& Path, String& Output);\n\t\tsize_t GetHits() const;\n\t\tsize_t GetMisses() const;\n\t\tsize_t GetVerbatims() const;\n\t\tconst Vector<String>& GetAddons() const;\n\t\tconst UnorderedMap<String, uint64_t>& GetDependencies() const;\n\n\tpublic:\n\t\tstatic uint64_t GetHash(const std::string_view& Data);\n\n\tprivate:\n\t\tbool IsVerbatim(const std::string_view& Data);\n\t\tvoid AddDefinitions(const Vector<String>& Names);\n\t\tstatic void ReadSource(SourceFile& File);\n\t\tstatic void ScanSource(SourceFile& File, const std::string_view& Data);\n\t\tstatic void ResolveSource(SourceFile& File);\n\t};\n}\n#endif";
+		callback(context, "executable/sources.h", sc_executable_sources_h, 1786);
+
+		std::string dc_executable_sync_cpp;
+		dc_executable_sync_cpp.reserve(13338);
+		dc_executable_sync_cpp += "#include \"sync.h\"\n#include <angelscript.h>\n\nnamespace ASX\n{\n\tstatic std::memory_order GetOrder(int Order)\n\t{\n\t\tswitch (Order)\n\t\t{\n\t\t\tcase 0:\n\t\t\t\treturn std::memory_order_relaxed;\n\t\t\tcase 1:\n\t\t\t\treturn std::memory_order_acquire;\n\t\t\tcase 2:\n\t\t\t\treturn std::memory_order_release;\n\t\t\tcase 3:\n\t\t\t\treturn std::memory_order_acq_rel;\n\t\t\tdefault:\n\t\t\t\treturn std::memory_order_seq_cst;\n\t\t}\n\t}\n\tstatic std::memory_order GetLoadOrder(int Order)\n\t{\n\t\tauto Result = GetOrder(Order);\n\t\tif (Result == std::memory_order_release || Result == std::memory_order_acq_rel)\n\t\t\treturn std::memory_order_acquire;\n\t\treturn Result;\n\t}\n\tstatic std::memory_order GetStoreOrder(int Order)\n\t{\n\t\tauto Result = GetOrder(Order);\n\t\tif (Result == std::memory_order_acquire || Result == std::memory_order_acq_rel)\n\t\t\treturn std::memory_order_release;\n\t\treturn Result;\n\t}\n\tstatic size_t GetCapacity(size_t Capacity)\n\t{\n\t\tsize_t Size = 2;\n\t\twhile (Size < Capacity)\n\t\t\tSize <<= 1;\n\t\treturn Size;\n\t}\n\tstatic size_t GetPrimitiveSize(int Type)\n\t{\n\t\tswitch ((TypeId)Type)\n\t\t{\n\t\t\tcase TypeId::BOOL:\n\t\t\tcase TypeId::INT8:\n\t\t\tcase TypeId::UINT8:\n\t\t\t\treturn 1;\n\t\t\tcase TypeId::INT16:\n\t\t\tcase TypeId::UINT16:\n\t\t\t\treturn 2;\n\t\t\tcase TypeId::INT64:\n\t\t\tcase TypeId::UINT64:\n\t\t\tcase TypeId::DOUBLE:\n\t\t\t\treturn 8;\n\t\t\tdefault:\n\t\t\t\treturn 4;\n\t\t}\n\t}\n\tstatic bool HasDefaultConstructor(asITypeInfo* Type)\n\t{\n\t\tasDWORD Flags = Type->GetFlags();\n\t\tif (Flags & asOBJ_POD)\n\t\t\treturn true;\n\n\t\tif (Flags & asOBJ_VALUE)\n\t\t{\n\t\t\tfor (asUINT i = 0; i < Type->GetBehaviourCount(); i++)\n\t\t\t{\n\t\t\t\tasEBehaviours Behaviour;\n\t\t\t\tasIScriptFunction* Function = Type->GetBehaviourByIndex(i, &Behaviour);\n\t\t\t\tif (Behaviour == asBEHAVE_CONSTRUCT && Function->GetParamCount() == 0)\n\t\t\t\t\treturn true;\n\t\t\t}\n\t\t\treturn false;\n\t\t}\n\n\t\tfor (asUINT i = 0; i < Type->GetFactoryCount(); i++)\n\t\t{\n\t\t\tif (Type->GetFactoryByIndex(i)->GetParamCount() == 0)\n\t\t\t\treturn true;\n\t\t}\n\t\treturn false;\n\t}\n\tstatic bool HasCopyOperation(asITypeInfo* Type)\n\t{\n\t\tasDWORD Flags = Type->GetFlags();\n\t\tif (Flags & asOBJ_NOCOPY)\n\t\t\treturn false;\n\t\telse if (Flags & asOBJ_POD)\n\t\t\treturn true;\n\n\t\tfor (asUINT i = 0; i < Type->GetBehaviourCount(); i++)\n\t\t{\n\t\t\tasEBehaviours Behaviour;\n\t\t\tType->GetBehaviourByIndex(i, &Behaviour);\n\t\t\tif (Behaviour == asBEHAVE_COPYCONSTRUCT)\n\t\t\t\treturn true;\n\t\t}\n\t\treturn Type->GetMethodByName(\"opAssign\") != nullptr;\n\t}\n\tstatic bool ChannelTemplateCallback(asITypeInfo* Info, bool& DontGarbageCollect)\n\t{\n\t\tDontGarbageCollect = true;\n\t\tint SubTypeId = Info->GetSubTypeId();\n\t\tif (SubTypeId == asTYPEID_VOID)\n\t\t\treturn false;\n\t\telse if (!(SubTypeId & asTYPEID_MASK_OBJECT) || (SubTypeId & asTYPEID_OBJHANDLE))\n\t\t\treturn true;\n\n\t\tasIScriptEngine* Engine = Info->GetEngine();\n\t\tasITypeInfo* SubType = Engine->GetTypeInfoById(SubTypeId);\n\t\tif (!SubType || (SubType->GetFlags() & asOBJ_TEMPLATE_SUBTYPE))\n\t\t\treturn true;\n\n\t\tif (!HasDefaultConstructor(SubType))\n\t\t{\n\t\t\tEngine->WriteMessage(\"channel\", 0, 0, asMSGTYPE_ERROR, Stringify::Text(\"channel<%s> requires a default constructible value type, use a handle instead\", SubType->GetName()).c_str());\n\t\t\treturn false;\n\t\t}\n\t\telse if (!HasCopyOperation(SubType))\n\t\t{\n\t\t\tEngine->WriteMessage(\"channel\", 0, 0, asMSGTYPE_ERROR, Stringify::Text(\"channel<%s> requires a copyable value type, use a handle instead\", SubType->GetName()).c_str());\n\t\t\treturn false;\n\t\t}\n\t\treturn true;\n\t}\n\n\tAtomic::Atomic(int64_t NewValue) : Value(NewValue)\n\t{\n\t}\n\tint64_t Atomic::Load(int Order)\n\t{\n\t\treturn Value.load(GetLoadOrder(Order));\n\t}\n\tvoid Atomic::Store(int64_t NewValue, int Order)\n\t{\n\t\tValue.store(NewValue, GetStoreOrder(Order));\n\t}\n\tint64_t Atomic::Exchange(int64_t NewValue, int Order)\n\t{\n\t\treturn Value.exchange(NewValue, GetOrder(Order));\n\t}\n\tint64_t Atomic::FetchAdd(int64_t NewValue, int Order)\n\t{\n\t\treturn Value.fetch_add(NewValue, GetOrder(Order));\n\t}\n\tint64_t Atomic::FetchSub(int64_t NewValue, int Order)\n\t{\n\t\treturn Value.fetch_sub(NewValue, GetOrder(Order));\n\t}\n\tint64_t Atomic::FetchAnd(int64_t NewValue, int Order)\n\t{\n\t\treturn Value.fetch_and(NewValue, GetOrder(Order));\n\t}\n\tint64_t Atomic::FetchOr(int64_t NewValue, int Order)\n\t{\n\t\tr";
+		dc_executable_sync_cpp += "eturn Value.fetch_or(NewValue, GetOrder(Order));\n\t}\n\tbool Atomic::CompareExchange(int64_t& Expected, int64_t NewValue, int Order)\n\t{\n\t\treturn Value.compare_exchange_strong(Expected, NewValue, GetOrder(Order), GetLoadOrder(Order));\n\t}\n\n\tRingChannel::RingChannel(asITypeInfo* Info, size_t Capacity) : Cells(GetCapacity(Capacity)), Head(0), Tail(0), Waiters(0), Closed(false), VM(VirtualMachine::Get()), ElementType(nullptr), PromiseType(nullptr), ElementSize(0), Mask(Cells.size() - 1), ElementTypeId(0)\n\t{\n\t\tfor (size_t i = 0; i < Cells.size(); i++)\n\t\t\tCells[i].Sequence.store(i, std::memory_order_relaxed);\n\n\t\tElementTypeId = TypeInfo(Info).GetSubTypeId();\n\t\tElementType = VM->GetTypeInfoById(ElementTypeId);\n\t\tPromiseType = VM->GetTypeInfoByDecl((\"promise<\" + String(VM->GetTypeIdDecl(ElementTypeId)) + \">\").c_str());\n\t\tif (!(ElementTypeId & (int)TypeId::MASK_OBJECT))\n\t\t\tElementSize = GetPrimitiveSize(ElementTypeId);\n\t}\n\tRingChannel::~RingChannel()\n\t{\n\t\tClose();\n\t\tMessage Value;\n\t\twhile (Dequeue(Value))\n\t\t\tFree(Value);\n\t}\n\tbool RingChannel::Send(void* Ref)\n\t{\n\t\tMessage Value;\n\t\tif (!Compose(Value, Ref))\n\t\t\treturn false;\n\n\t\tbool Success = Enqueue(Value);\n\t\twhile (!Success && !Closed)\n\t\t{\n\t\t\tstd::unique_lock<std::mutex> Unique(Mutex);\n\t\t\t++Waiters;\n\t\t\tstd::atomic_thread_fence(std::memory_order_seq_cst);\n\t\t\tSuccess = Enqueue(Value);\n\t\t\tif (!Success && !Closed)\n\t\t\t\tCondition.wait(Unique);\n\t\t\t--Waiters;\n\t\t}\n\n\t\tif (!Success)\n\t\t{\n\t\t\tFree(Value);\n\t\t\treturn false;\n\t\t}\n\n\t\tNotify();\n\t\treturn true;\n\t}\n\tbool RingChannel::TrySend(void* Ref)\n\t{\n\t\tMessage Value;\n\t\tif (!Compose(Value, Ref))\n\t\t\treturn false;\n\n\t\tif (!Enqueue(Value))\n\t\t{\n\t\t\tFree(Value);\n\t\t\treturn false;\n\t\t}\n\n\t\tNotify();\n\t\treturn true;\n\t}\n\tbool RingChannel::Receive(void* Ref)\n\t{\n\t\tMessage Value;\n\t\tbool Success = Dequeue(Value);\n\t\twhile (!Success)\n\t\t{\n\t\t\tstd::unique_lock<std::mutex> Unique(Mutex);\n\t\t\t++Waiters;\n\t\t\tstd::atomic_thread_fence(std::memory_order_seq_cst);\n\t\t\tSuccess = Dequeue(Value);\n\t\t\tif (!Success && Closed)\n\t\t\t{\n\t\t\t\t--Waiters;\n\t\t\t\treturn false;\n\t\t\t}\n\t\t\telse if (!Success)\n\t\t\t\tCondition.wait(Unique);\n\t\t\t--Waiters;\n\t\t}\n\n\t\tNotify();\n\t\tExtract(Value, Ref);\n\t\treturn true;\n\t}\n\tbool RingChannel::TryReceive(void* Ref)\n\t{\n\t\tMessage Value;\n\t\tif (!Dequeue(Value))\n\t\t\treturn false;\n\n\t\tNotify();\n\t\tExtract(Value, Ref);\n\t\treturn true;\n\t}\n\tBindings::Promise* RingChannel::ReceiveAsync()\n\t{\n\t\tBindings::Promise* Future = Bindings::Promise::CreateFactoryType(PromiseType.GetTypeInfo());\n\t\tMessage Value;\n\t\tbool Success = Dequeue(Value);\n\t\tif (!Success)\n\t\t{\n\t\t\tUMutex<std::mutex> Unique(Mutex);\n\t\t\t++Waiters;\n\t\t\tstd::atomic_thread_fence(std::memory_order_seq_cst);\n\t\t\tSuccess = Dequeue(Value);\n\t\t\tif (!Success && !Closed)\n\t\t\t{\n\t\t\t\tFuture->AddRef();\n\t\t\t\tPending.push(Future);\n\t\t\t\treturn Future;\n\t\t\t}\n\t\t\t--Waiters;\n\t\t}\n\n\t\tif (!Success)\n\t\t{\n\t\t\tFuture->StoreException(Bindings::Exception::Pointer(\"channel\", \"channel is closed\"));\n\t\t\treturn Future;\n\t\t}\n\n\t\tNotify();\n\t\tSettle(Future, Value);\n\t\treturn Future;\n\t}\n\tvoid RingChannel::Close()\n\t{\n\t\tSingleQueue<Bindings::Promise*> Rejected;\n\t\tClosed = true;\n\t\t{\n\t\t\tUMutex<std::mutex> Unique(Mutex);\n\t\t\tWaiters -= Pending.size();\n\t\t\tRejected.swap(Pending);\n\t\t\tCondition.notify_all();\n\t\t}\n\n\t\twhile (!Rejected.empty())\n\t\t{\n\t\t\tBindings::Promise* Future = Rejected.front();\n\t\t\tFuture->StoreException(Bindings::Exception::Pointer(\"channel\", \"channel is closed\"));\n\t\t\tFuture->Release();\n\t\t\tRejected.pop();\n\t\t}\n\t}\n\tbool RingChannel::IsClosed()\n\t{\n\t\treturn Closed;\n\t}\n\tbool RingChannel::Enqueue(Message& Value)\n\t{\n\t\tif (Closed)\n\t\t\treturn false;\n\n\t\tsize_t Position = Tail.load(std::memory_order_relaxed);\n\t\twhile (true)\n\t\t{\n\t\t\tCell& Next = Cells[Position & Mask];\n\t\t\tsize_t Sequence = Next.Sequence.load(std::memory_order_acquire);\n\t\t\tintptr_t Difference = (intptr_t)Sequence - (intptr_t)Position;\n\t\t\tif (Difference == 0)\n\t\t\t{\n\t\t\t\tif (!Tail.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))\n\t\t\t\t\tcontinue;\n\n\t\t\t\tNext.Value = Value;\n\t\t\t\tNext.Sequence.store(Position + 1, std::memory_order_release);\n\t\t\t\treturn true;\n\t\t\t}\n\t\t\telse if (Difference < 0)\n\t\t\t\treturn false;\n\n\t\t\tPosit";
+		dc_executable_sync_cpp += "ion = Tail.load(std::memory_order_relaxed);\n\t\t}\n\t}\n\tbool RingChannel::Dequeue(Message& Value)\n\t{\n\t\tsize_t Position = Head.load(std::memory_order_relaxed);\n\t\twhile (true)\n\t\t{\n\t\t\tCell& Next = Cells[Position & Mask];\n\t\t\tsize_t Sequence = Next.Sequence.load(std::memory_order_acquire);\n\t\t\tintptr_t Difference = (intptr_t)Sequence - (intptr_t)(Position + 1);\n\t\t\tif (Difference == 0)\n\t\t\t{\n\t\t\t\tif (!Head.compare_exchange_weak(Position, Position + 1, std::memory_order_relaxed))\n\t\t\t\t\tcontinue;\n\n\t\t\t\tValue = Next.Value;\n\t\t\t\tNext.Value.Primitive = 0;\n\t\t\t\tNext.Sequence.store(Position + Mask + 1, std::memory_order_release);\n\t\t\t\treturn true;\n\t\t\t}\n\t\t\telse if (Difference < 0)\n\t\t\t\treturn false;\n\n\t\t\tPosition = Head.load(std::memory_order_relaxed);\n\t\t}\n\t}\n\tvoid RingChannel::Notify()\n\t{\n\t\tstd::atomic_thread_fence(std::memory_order_seq_cst);\n\t\tif (!Waiters.load(std::memory_order_relaxed))\n\t\t\treturn;\n\n\t\tVector<std::pair<Bindings::Promise*, Message>> Ready;\n\t\t{\n\t\t\tUMutex<std::mutex> Unique(Mutex);\n\t\t\twhile (!Pending.empty())\n\t\t\t{\n\t\t\t\tMessage Value;\n\t\t\t\tif (!Dequeue(Value))\n\t\t\t\t\tbreak;\n\n\t\t\t\tReady.emplace_back(Pending.front(), Value);\n\t\t\t\tPending.pop();\n\t\t\t\t--Waiters;\n\t\t\t}\n\t\t\tCondition.notify_all();\n\t\t}\n\n\t\tfor (auto& Next : Ready)\n\t\t{\n\t\t\tSettle(Next.first, Next.second);\n\t\t\tNext.first->Release();\n\t\t}\n\t}\n\tvoid RingChannel::Settle(Bindings::Promise* Future, Message& Value)\n\t{\n\t\tif (ElementTypeId & (int)TypeId::OBJHANDLE)\n\t\t\tFuture->Store(&Value.Object, ElementTypeId);\n\t\telse if (ElementTypeId & (int)TypeId::MASK_OBJECT)\n\t\t\tFuture->Store(Value.Object, ElementTypeId);\n\t\telse\n\t\t\tFuture->Store(&Value.Primitive, ElementTypeId);\n\t\tFree(Value);\n\t}\n\tbool RingChannel::Compose(Message& Value, void* Ref)\n\t{\n\t\tValue.Primitive = 0;\n\t\tif (ElementTypeId & (int)TypeId::OBJHANDLE)\n\t\t{\n\t\t\tValue.Object = *(void**)Ref;\n\t\t\tif (Value.Object != nullptr)\n\t\t\t\tVM->AddRefObject(Value.Object, ElementType);\n\t\t}\n\t\telse if (ElementTypeId & (int)TypeId::MASK_OBJECT)\n\t\t{\n\t\t\tValue.Object = VM->CreateObjectCopy(Ref, ElementType);\n\t\t\tif (!Value.Object)\n\t\t\t{\n\t\t\t\tImmediateContext::Get()->SetException(Stringify::Text(\"channel cannot copy a value of type %s\", String(VM->GetTypeIdDecl(ElementTypeId)).c_str()).c_str());\n\t\t\t\treturn false;\n\t\t\t}\n\t\t}\n\t\telse\n\t\t\tmemcpy(&Value.Primitive, Ref, ElementSize);\n\t\treturn true;\n\t}\n\tvoid RingChannel::Extract(Message& Value, void* Ref)\n\t{\n\t\tif (ElementTypeId & (int)TypeId::OBJHANDLE)\n\t\t{\n\t\t\tvoid** Target = (void**)Ref;\n\t\t\tif (*Target != nullptr)\n\t\t\t\tVM->ReleaseObject(*Target, ElementType);\n\t\t\t*Target = Value.Object;\n\t\t}\n\t\telse if (ElementTypeId & (int)TypeId::MASK_OBJECT)\n\t\t{\n\t\t\tif (Value.Object != nullptr)\n\t\t\t{\n\t\t\t\tVM->AssignObject(Ref, Value.Object, ElementType);\n\t\t\t\tVM->ReleaseObject(Value.Object, ElementType);\n\t\t\t}\n\t\t}\n\t\telse\n\t\t\tmemcpy(Ref, &Value.Primitive, ElementSize);\n\t}\n\tvoid RingChannel::Free(Message& Value)\n\t{\n\t\tif ((ElementTypeId & (int)TypeId::MASK_OBJECT) && Value.Object != nullptr)\n\t\t\tVM->ReleaseObject(Value.Object, ElementType);\n\t\tValue.Primitive = 0;\n\t}\n\n\tvoid Sync::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->ImportSystemAddon(\"ctypes\");\n\t\tVM->ImportSystemAddon(\"promise\");\n\t\tauto VOrder = VM->SetEnum(\"memory_order\");\n\t\tVOrder->SetValue(\"relaxed\", 0);\n\t\tVOrder->SetValue(\"acquire\", 1);\n\t\tVOrder->SetValue(\"release\", 2);\n\t\tVOrder->SetValue(\"acq_rel\", 3);\n\t\tVOrder->SetValue(\"seq_cst\", 4);\n\n\t\tauto VAtomic = VM->SetClass<Atomic>(\"atomic\", false);\n\t\tVAtomic->SetConstructor<Atomic, int64_t>(\"atomic@ f(int64 = 0)\");\n\t\tVAtomic->SetMethod(\"int64 load(memory_order = memory_order::seq_cst)\", &Atomic::Load);\n\t\tVAtomic->SetMethod(\"void store(int64, memory_order = memory_order::seq_cst)\", &Atomic::Store);\n\t\tVAtomic->SetMethod(\"int64 exchange(int64, memory_order = memory_order::seq_cst)\", &Atomic::Exchange);\n\t\tVAtomic->SetMethod(\"int64 fetch_add(int64, memory_order = memory_order::seq_cst)\", &Atomic::FetchAdd);\n\t\tVAtomic->SetMethod(\"int64 fetch_sub(int64, memory_order = memory_order::seq_cst)\", &Atomic::FetchSub);\n\t\tVAtomic->SetMethod(\"int64 fetch_and(int64, memory_order = memory_order::seq_cst)\", &Atomic::FetchAnd);\n\t\tVAtomic->SetMethod(\"int64 fetch_or(int64, memo";
+		dc_executable_sync_cpp += "ry_order = memory_order::seq_cst)\", &Atomic::FetchOr);\n\t\tVAtomic->SetMethod(\"bool compare_exchange(int64&inout, int64, memory_order = memory_order::seq_cst)\", &Atomic::CompareExchange);\n\n\t\tauto VChannel = VM->SetTemplateClass<RingChannel>(\"channel<class T>\", \"channel<T>\", false);\n\t\tVChannel->SetConstructor<RingChannel, asITypeInfo*, size_t>(\"channel<T>@ f(int&in, usize = 1024)\");\n\t\tVM->GetEngine()->RegisterObjectBehaviour(\"channel<T>\", asBEHAVE_TEMPLATE_CALLBACK, \"bool f(int&in, bool&out)\", asFUNCTION(ChannelTemplateCallback), asCALL_CDECL);\n\t\tVChannel->SetMethod(\"bool send(const T&in)\", &RingChannel::Send);\n\t\tVChannel->SetMethod(\"bool try_send(const T&in)\", &RingChannel::TrySend);\n\t\tVChannel->SetMethod(\"bool receive(T&out)\", &RingChannel::Receive);\n\t\tVChannel->SetMethod(\"bool try_receive(T&out)\", &RingChannel::TryReceive);\n\t\tVChannel->SetMethod(\"promise<T>@ receive_async()\", &RingChannel::ReceiveAsync);\n\t\tVChannel->SetMethod(\"void close()\", &RingChannel::Close);\n\t\tVChannel->SetMethod(\"bool is_closed()\", &RingChannel::IsClosed);\n\t}\n}\n";
+		callback(context, "executable/sync.cpp", dc_executable_sync_cpp.c_str(), (unsigned int)dc_executable_sync_cpp.size());
+
+		const char* sc_executable_sync_h = "#ifndef SYNC_H\n#define SYNC_H\n#include \"runtime.hpp\"\n#include <vengeance/vengeance.h>\n\nnamespace ASX\n{\n\tclass Atomic : public Reference<Atomic>\n\t{\n\tprivate:\n\t\tstd::atomic<int64_t> Value;\n\n\tpublic:\n\t\tAtomic(int64_t NewValue);\n\t\tint64_t Load(int Order);\n\t\tvoid Store(int64_t NewValue, int Order);\n\t\tint64_t Exchange(int64_t NewValue, int Order);\n\t\tint64_t FetchAdd(int64_t NewValue, int Order);\n\t\tint64_t FetchSub(int64_t NewValue, int Order);\n\t\tint64_t FetchAnd(int64_t NewValue, int Order);\n\t\tint64_t FetchOr(int64_t NewValue, int Order);\n\t\tbool CompareExchange(int64_t& Expected, int64_t NewValue, int Order);\n\t};\n\n\tclass RingChannel : public Reference<RingChannel>\n\t{\n\tprivate:\n\t\tunion Message\n\t\t{\n\t\t\tuint64_t Primitive;\n\t\t\tvoid* Object;\n\t\t};\n\n\t\tstruct Cell\n\t\t{\n\t\t\tstd::atomic<size_t> Sequence;\n\t\t\tMessage Value;\n\t\t};\n\n\tprivate:\n\t\tVector<Cell> Cells;\n\t\tSingleQueue<Bindings::Promise*> Pending;\n\t\tstd::atomic<size_t> Head;\n\t\tstd::atomic<size_t> Tail;\n\t\tstd::atomic<size_t> Waiters;\n\t\tstd::atomic<bool> Closed;\n\t\tstd::condition_variable Condition;\n\t\tstd::mutex Mutex;\n\t\tVirtualMachine* VM;\n\t\tTypeInfo ElementType;\n\t\tTypeInfo PromiseType;\n\t\tsize_t ElementSize;\n\t\tsize_t Mask;\n\t\tint ElementTypeId;\n\n\tpublic:\n\t\tRingChannel(asITypeInfo* Info, size_t Capacity);\n\t\t~RingChannel();\n\t\tbool Send(void* Ref);\n\t\tbool TrySend(void* Ref);\n\t\tbool Receive(void* Ref);\n\t\tbool TryReceive(void* Ref);\n\t\tBindings::Promise* ReceiveAsync();\n\t\tvoid Close();\n\t\tbool IsClosed();\n\n\tprivate:\n\t\tbool Enqueue(Message& Value);\n\t\tbool Dequeue(Message& Value);\n\t\tvoid Notify();\n\t\tvoid Settle(Bindings::Promise* Future, Message& Value);\n\t\tbool Compose(Message& Value, void* Ref);\n\t\tvoid Extract(Message& Value, void* Ref);\n\t\tvoid Free(Message& Value);\n\t};\n\n\tclass Sync\n\t{\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\t};\n}\n#endif\n";
+		callback(context, "executable/sync.h", sc_executable_sync_h, 1808);
+
+		std::string dc_executable_text_cpp;
+		dc_executable_text_cpp.reserve(22416);
+		dc_executable_text_cpp += "#include \"text.h\"\n#if defined(__x86_64__) || defined(_M_X64)\n#include <emmintrin.h>\n#define TEXT_SSE2\n#if defined(__GNUC__) || defined(__clang__)\n#include <immintrin.h>\n#define TEXT_AVX2\n#define TEXT_TARGET_AVX2 __attribute__((target(\"avx2\")))\n#endif\n#endif\n#ifdef _MSC_VER\n#include <intrin.h>\n#endif\n\nnamespace ASX\n{\n\tstatic const char HexAlphabet[] = \"0123456789abcdef\";\n\tstatic const char Base64Alphabet[] = \"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/\";\n\n\tstatic inline uint32_t CountTrailingZeros(uint32_t Value)\n\t{\n#ifdef _MSC_VER\n\t\tunsigned long Index = 0;\n\t\t_BitScanForward(&Index, Value);\n\t\treturn (uint32_t)Index;\n#else\n\t\treturn (uint32_t)__builtin_ctz(Value);\n#endif\n\t}\n\tstatic inline bool IsWhitespace(char Value)\n\t{\n\t\treturn Value == ' ' || Value == '\\t' || Value == '\\n' || Value == '\\r' || Value == '\\f' || Value == '\\v';\n\t}\n\tstatic inline int GetHexValue(char Value)\n\t{\n\t\tif (Value >= '0' && Value <= '9')\n\t\t\treturn Value - '0';\n\t\telse if (Value >= 'a' && Value <= 'f')\n\t\t\treturn Value - 'a' + 10;\n\t\telse if (Value >= 'A' && Value <= 'F')\n\t\t\treturn Value - 'A' + 10;\n\t\treturn -1;\n\t}\n\tstatic inline int GetBase64Value(char Value)\n\t{\n\t\tif (Value >= 'A' && Value <= 'Z')\n\t\t\treturn Value - 'A';\n\t\telse if (Value >= 'a' && Value <= 'z')\n\t\t\treturn Value - 'a' + 26;\n\t\telse if (Value >= '0' && Value <= '9')\n\t\t\treturn Value - '0' + 52;\n\t\telse if (Value == '+')\n\t\t\treturn 62;\n\t\telse if (Value == '/')\n\t\t\treturn 63;\n\t\treturn -1;\n\t}\n\tstatic size_t GetUTF8Sequence(const uint8_t* Data, size_t Size, size_t Offset)\n\t{\n\t\tuint8_t Value = Data[Offset];\n\t\tif (Value < 0x80)\n\t\t\treturn 1;\n\n\t\tsize_t Length = 0;\n\t\tuint32_t Code = 0;\n\t\tif ((Value & 0xE0) == 0xC0)\n\t\t{\n\t\t\tLength = 2;\n\t\t\tCode = Value & 0x1F;\n\t\t}\n\t\telse if ((Value & 0xF0) == 0xE0)\n\t\t{\n\t\t\tLength = 3;\n\t\t\tCode = Value & 0x0F;\n\t\t}\n\t\telse if ((Value & 0xF8) == 0xF0)\n\t\t{\n\t\t\tLength = 4;\n\t\t\tCode = Value & 0x07;\n\t\t}\n\t\telse\n\t\t\treturn 0;\n\n\t\tif (Offset + Length > Size)\n\t\t\treturn 0;\n\n\t\tfor (size_t i = 1; i < Length; i++)\n\t\t{\n\t\t\tuint8_t Next = Data[Offset + i];\n\t\t\tif ((Next & 0xC0) != 0x80)\n\t\t\t\treturn 0;\n\t\t\tCode = (Code << 6) | (Next & 0x3F);\n\t\t}\n\n\t\tif ((Length == 2 && Code < 0x80) || (Length == 3 && Code < 0x800) || (Length == 4 && Code < 0x10000))\n\t\t\treturn 0;\n\t\telse if (Code > 0x10FFFF || (Code >= 0xD800 && Code <= 0xDFFF))\n\t\t\treturn 0;\n\t\treturn Length;\n\t}\n\tstatic bool IsValidHex(const std::string_view& Data)\n\t{\n\t\tif (Data.size() % 2 != 0)\n\t\t\treturn false;\n\n\t\tfor (char Next : Data)\n\t\t{\n\t\t\tif (GetHexValue(Next) < 0)\n\t\t\t\treturn false;\n\t\t}\n\t\treturn true;\n\t}\n\tstatic bool IsValidBase64(const std::string_view& Data, bool& Whitespace)\n\t{\n\t\tsize_t Digits = 0, Padding = 0;\n\t\tWhitespace = false;\n\t\tfor (char Next : Data)\n\t\t{\n\t\t\tif (IsWhitespace(Next))\n\t\t\t\tWhitespace = true;\n\t\t\telse if (Next == '=')\n\t\t\t\t++Padding;\n\t\t\telse if (Padding > 0 || GetBase64Value(Next) < 0)\n\t\t\t\treturn false;\n\t\t\telse\n\t\t\t\t++Digits;\n\t\t}\n\n\t\tif (Padding > 2 || Digits % 4 == 1)\n\t\t\treturn false;\n\t\treturn !Padding || (Digits + Padding) % 4 == 0;\n\t}\n\tstatic size_t FindScalar(const char* Data, size_t Size, const char* Needle, size_t NeedleSize, size_t Offset)\n\t{\n\t\tsize_t Index = std::string_view(Data, Size).find(std::string_view(Needle, NeedleSize), Offset);\n\t\treturn Index == std::string_view::npos ? Size : Index;\n\t}\n\tstatic size_t FindAnyOfScalar(const char* Data, size_t Size, const char* Set, size_t SetSize, size_t Offset)\n\t{\n\t\tbool Table[256] = { false };\n\t\tfor (size_t i = 0; i < SetSize; i++)\n\t\t\tTable[(uint8_t)Set[i]] = true;\n\n\t\tfor (size_t i = Offset; i < Size; i++)\n\t\t{\n\t\t\tif (Table[(uint8_t)Data[i]])\n\t\t\t\treturn i;\n\t\t}\n\t\treturn Size;\n\t}\n\tstatic void ToCaseScalar(char* Data, size_t Size, char From, char To)\n\t{\n\t\tfor (size_t i = 0; i < Size; i++)\n\t\t{\n\t\t\tif (Data[i] >= From && Data[i] <= To)\n\t\t\t\tData[i] ^= 0x20;\n\t\t}\n\t}\n\tstatic bool IsUTF8Scalar(const uint8_t* Data, size_t Size, size_t Offset)\n\t{\n\t\twhile (Offset < Size)\n\t\t{\n\t\t\tsize_t Length = GetUTF8Sequence(Data, Size, Offset);\n\t\t\tif (!Length)\n\t\t\t\treturn false;\n\t\t\tOffset += Length;\n\t\t}\n\t\treturn true;\n\t}\n#ifdef TEXT_SSE2\n\tstatic size_t FindSSE2(const char* Data, size_t Size,";
+		dc_executable_text_cpp += " const char* Needle, size_t NeedleSize, size_t Offset)\n\t{\n\t\tconst __m128i First = _mm_set1_epi8(Needle[0]);\n\t\tconst __m128i Last = _mm_set1_epi8(Needle[NeedleSize - 1]);\n\t\tsize_t Index = Offset;\n\t\tfor (; Index + NeedleSize + 15 <= Size; Index += 16)\n\t\t{\n\t\t\t__m128i BlockFirst = _mm_loadu_si128((const __m128i*)(Data + Index));\n\t\t\t__m128i BlockLast = _mm_loadu_si128((const __m128i*)(Data + Index + NeedleSize - 1));\n\t\t\tuint32_t Mask = (uint32_t)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(First, BlockFirst), _mm_cmpeq_epi8(Last, BlockLast)));\n\t\t\twhile (Mask != 0)\n\t\t\t{\n\t\t\t\tuint32_t Bit = CountTrailingZeros(Mask);\n\t\t\t\tif (NeedleSize <= 2 || !memcmp(Data + Index + Bit + 1, Needle + 1, NeedleSize - 2))\n\t\t\t\t\treturn Index + Bit;\n\t\t\t\tMask &= Mask - 1;\n\t\t\t}\n\t\t}\n\t\treturn FindScalar(Data, Size, Needle, NeedleSize, Index);\n\t}\n\tstatic size_t FindAnyOfSSE2(const char* Data, size_t Size, const char* Set, size_t SetSize, size_t Offset)\n\t{\n\t\t__m128i Needles[16];\n\t\tfor (size_t i = 0; i < SetSize; i++)\n\t\t\tNeedles[i] = _mm_set1_epi8(Set[i]);\n\n\t\tsize_t Index = Offset;\n\t\tfor (; Index + 16 <= Size; Index += 16)\n\t\t{\n\t\t\t__m128i Block = _mm_loadu_si128((const __m128i*)(Data + Index));\n\t\t\t__m128i Match = _mm_setzero_si128();\n\t\t\tfor (size_t i = 0; i < SetSize; i++)\n\t\t\t\tMatch = _mm_or_si128(Match, _mm_cmpeq_epi8(Block, Needles[i]));\n\n\t\t\tuint32_t Mask = (uint32_t)_mm_movemask_epi8(Match);\n\t\t\tif (Mask != 0)\n\t\t\t\treturn Index + CountTrailingZeros(Mask);\n\t\t}\n\t\treturn FindAnyOfScalar(Data, Size, Set, SetSize, Index);\n\t}\n\tstatic void ToCaseSSE2(char* Data, size_t Size, char From, char To)\n\t{\n\t\tconst __m128i Low = _mm_set1_epi8(From - 1);\n\t\tconst __m128i High = _mm_set1_epi8(To + 1);\n\t\tconst __m128i Flip = _mm_set1_epi8(0x20);\n\t\tsize_t Index = 0;\n\t\tfor (; Index + 16 <= Size; Index += 16)\n\t\t{\n\t\t\t__m128i Block = _mm_loadu_si128((const __m128i*)(Data + Index));\n\t\t\t__m128i Range = _mm_and_si128(_mm_cmpgt_epi8(Block, Low), _mm_cmplt_epi8(Block, High));\n\t\t\t_mm_storeu_si128((__m128i*)(Data + Index), _mm_xor_si128(Block, _mm_and_si128(Range, Flip)));\n\t\t}\n\t\tToCaseScalar(Data + Index, Size - Index, From, To);\n\t}\n\tstatic bool IsUTF8SSE2(const uint8_t* Data, size_t Size)\n\t{\n\t\tsize_t Index = 0;\n\t\twhile (Index < Size)\n\t\t{\n\t\t\tif (Index + 16 <= Size && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(Data + Index))))\n\t\t\t{\n\t\t\t\tIndex += 16;\n\t\t\t\tcontinue;\n\t\t\t}\n\n\t\t\tsize_t Length = GetUTF8Sequence(Data, Size, Index);\n\t\t\tif (!Length)\n\t\t\t\treturn false;\n\t\t\tIndex += Length;\n\t\t}\n\t\treturn true;\n\t}\n#endif\n#ifdef TEXT_AVX2\n\tTEXT_TARGET_AVX2 static size_t FindAVX2(const char* Data, size_t Size, const char* Needle, size_t NeedleSize, size_t Offset)\n\t{\n\t\tconst __m256i First = _mm256_set1_epi8(Needle[0]);\n\t\tconst __m256i Last = _mm256_set1_epi8(Needle[NeedleSize - 1]);\n\t\tsize_t Index = Offset;\n\t\tfor (; Index + NeedleSize + 31 <= Size; Index += 32)\n\t\t{\n\t\t\t__m256i BlockFirst = _mm256_loadu_si256((const __m256i*)(Data + Index));\n\t\t\t__m256i BlockLast = _mm256_loadu_si256((const __m256i*)(Data + Index + NeedleSize - 1));\n\t\t\tuint32_t Mask = (uint32_t)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(First, BlockFirst), _mm256_cmpeq_epi8(Last, BlockLast)));\n\t\t\twhile (Mask != 0)\n\t\t\t{\n\t\t\t\tuint32_t Bit = CountTrailingZeros(Mask);\n\t\t\t\tif (NeedleSize <= 2 || !memcmp(Data + Index + Bit + 1, Needle + 1, NeedleSize - 2))\n\t\t\t\t\treturn Index + Bit;\n\t\t\t\tMask &= Mask - 1;\n\t\t\t}\n\t\t}\n\t\treturn FindSSE2(Data, Size, Needle, NeedleSize, Index);\n\t}\n\tTEXT_TARGET_AVX2 static size_t FindAnyOfAVX2(const char* Data, size_t Size, const char* Set, size_t SetSize, size_t Offset)\n\t{\n\t\t__m256i Needles[16];\n\t\tfor (size_t i = 0; i < SetSize; i++)\n\t\t\tNeedles[i] = _mm256_set1_epi8(Set[i]);\n\n\t\tsize_t Index = Offset;\n\t\tfor (; Index + 32 <= Size; Index += 32)\n\t\t{\n\t\t\t__m256i Block = _mm256_loadu_si256((const __m256i*)(Data + Index));\n\t\t\t__m256i Match = _mm256_setzero_si256();\n\t\t\tfor (size_t i = 0; i < SetSize; i++)\n\t\t\t\tMatch = _mm256_or_si256(Match, _mm256_cmpeq_epi8(Block, Needles[i]));\n\n\t\t\tuint32_t Mask = (uint32_t)_mm256_movemask_epi8(Match);\n\t\t\tif (Mask != 0)\n\t\t\t\treturn Index + CountTrailingZeros(Mask);\n\t\t}\n\t\treturn FindAn";
+		dc_executable_text_cpp += "yOfSSE2(Data, Size, Set, SetSize, Index);\n\t}\n\tTEXT_TARGET_AVX2 static void ToCaseAVX2(char* Data, size_t Size, char From, char To)\n\t{\n\t\tconst __m256i Low = _mm256_set1_epi8(From - 1);\n\t\tconst __m256i High = _mm256_set1_epi8(To + 1);\n\t\tconst __m256i Flip = _mm256_set1_epi8(0x20);\n\t\tsize_t Index = 0;\n\t\tfor (; Index + 32 <= Size; Index += 32)\n\t\t{\n\t\t\t__m256i Block = _mm256_loadu_si256((const __m256i*)(Data + Index));\n\t\t\t__m256i Range = _mm256_and_si256(_mm256_cmpgt_epi8(Block, Low), _mm256_cmpgt_epi8(High, Block));\n\t\t\t_mm256_storeu_si256((__m256i*)(Data + Index), _mm256_xor_si256(Block, _mm256_and_si256(Range, Flip)));\n\t\t}\n\t\tToCaseSSE2(Data + Index, Size - Index, From, To);\n\t}\n\tTEXT_TARGET_AVX2 static bool IsUTF8AVX2(const uint8_t* Data, size_t Size)\n\t{\n\t\tsize_t Index = 0;\n\t\twhile (Index < Size)\n\t\t{\n\t\t\tif (Index + 32 <= Size && !_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(Data + Index))))\n\t\t\t{\n\t\t\t\tIndex += 32;\n\t\t\t\tcontinue;\n\t\t\t}\n\n\t\t\tsize_t Length = GetUTF8Sequence(Data, Size, Index);\n\t\t\tif (!Length)\n\t\t\t\treturn false;\n\t\t\tIndex += Length;\n\t\t}\n\t\treturn true;\n\t}\n#endif\n\tstatic TextAcceleration DetectAcceleration()\n\t{\n#ifdef TEXT_AVX2\n\t\t__builtin_cpu_init();\n\t\tif (__builtin_cpu_supports(\"avx2\"))\n\t\t\treturn TextAcceleration::AVX2;\n#endif\n#ifdef TEXT_SSE2\n\t\treturn TextAcceleration::SSE2;\n#else\n\t\treturn TextAcceleration::Scalar;\n#endif\n\t}\n\tstatic void ToCase(char* Data, size_t Size, char From, char To, TextAcceleration Level)\n\t{\n\t\tswitch (Level)\n\t\t{\n#ifdef TEXT_AVX2\n\t\t\tcase TextAcceleration::AVX2:\n\t\t\t\treturn ToCaseAVX2(Data, Size, From, To);\n#endif\n#ifdef TEXT_SSE2\n\t\t\tcase TextAcceleration::SSE2:\n\t\t\t\treturn ToCaseSSE2(Data, Size, From, To);\n#endif\n\t\t\tdefault:\n\t\t\t\treturn ToCaseScalar(Data, Size, From, To);\n\t\t}\n\t}\n\n\tStringBuffer::StringBuffer(size_t Capacity)\n\t{\n\t\tif (Capacity > 0)\n\t\t\tData.reserve(Capacity);\n\t}\n\tvoid StringBuffer::Append(const std::string_view& Value)\n\t{\n\t\tif (Data.size() + Value.size() > Data.capacity())\n\t\t\tData.reserve(std::max(Data.capacity() * 2, Data.size() + Value.size()));\n\t\tData.append(Value);\n\t}\n\tvoid StringBuffer::AppendString(const String& Value)\n\t{\n\t\tAppend(Value);\n\t}\n\tvoid StringBuffer::AppendInteger(int64_t Value)\n\t{\n\t\tchar Buffer[32];\n\t\tauto Result = std::to_chars(Buffer, Buffer + sizeof(Buffer), Value);\n\t\tAppend(std::string_view(Buffer, Result.ptr - Buffer));\n\t}\n\tvoid StringBuffer::AppendNumber(double Value)\n\t{\n\t\tAppend(Vitex::Core::ToString(Value));\n\t}\n\tvoid StringBuffer::AppendLine()\n\t{\n\t\tAppend(\"\\n\");\n\t}\n\tvoid StringBuffer::Reserve(size_t Capacity)\n\t{\n\t\tData.reserve(Capacity);\n\t}\n\tvoid StringBuffer::Clear()\n\t{\n\t\tData.clear();\n\t}\n\tvoid StringBuffer::Write()\n\t{\n\t\tif (!Data.empty())\n\t\t\tConsole::Get()->Write(Data);\n\t}\n\tString StringBuffer::Take()\n\t{\n\t\tString Result = std::move(Data);\n\t\tData.clear();\n\t\treturn Result;\n\t}\n\tString StringBuffer::ToString() const\n\t{\n\t\treturn Data;\n\t}\n\tsize_t StringBuffer::GetSize() const\n\t{\n\t\treturn Data.size();\n\t}\n\tString& StringBuffer::GetData()\n\t{\n\t\treturn Data;\n\t}\n\tvoid StringBuffer::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->ImportSystemAddon(\"string\");\n\t\tauto VBuilder = VM->SetClass<StringBuffer>(\"string_builder\", false);\n\t\tVBuilder->SetConstructor<StringBuffer, size_t>(\"string_builder@ f(usize = 0)\");\n\t\tVBuilder->SetMethod(\"void append(const string&in)\", &StringBuffer::AppendString);\n\t\tVBuilder->SetMethod(\"void append_int(int64)\", &StringBuffer::AppendInteger);\n\t\tVBuilder->SetMethod(\"void append_float(double)\", &StringBuffer::AppendNumber);\n\t\tVBuilder->SetMethod(\"void append_line()\", &StringBuffer::AppendLine);\n\t\tVBuilder->SetMethod(\"void reserve(usize)\", &StringBuffer::Reserve);\n\t\tVBuilder->SetMethod(\"void clear()\", &StringBuffer::Clear);\n\t\tVBuilder->SetMethod(\"void write()\", &StringBuffer::Write);\n\t\tVBuilder->SetMethod(\"string take()\", &StringBuffer::Take);\n\t\tVBuilder->SetMethod(\"string to_string() const\", &StringBuffer::ToString);\n\t\tVBuilder->SetMethod(\"usize size() const\", &StringBuffer::GetSize);\n\t}\n\n\tsize_t Text::Find(const std::string_view& Data, const std::string_view& Needle, size_t Offset)\n\t{\n\t\tsize_t Index = Data.size();\n\t\tif (Offset >= Data.size() ";
+		dc_executable_text_cpp += "|| Needle.empty() || !Accelerated)\n\t\t\treturn Data.find(Needle, Offset);\n\n\t\tswitch (Level)\n\t\t{\n#ifdef TEXT_AVX2\n\t\t\tcase TextAcceleration::AVX2:\n\t\t\t\tIndex = FindAVX2(Data.data(), Data.size(), Needle.data(), Needle.size(), Offset);\n\t\t\t\tbreak;\n#endif\n#ifdef TEXT_SSE2\n\t\t\tcase TextAcceleration::SSE2:\n\t\t\t\tIndex = FindSSE2(Data.data(), Data.size(), Needle.data(), Needle.size(), Offset);\n\t\t\t\tbreak;\n#endif\n\t\t\tdefault:\n\t\t\t\tIndex = FindScalar(Data.data(), Data.size(), Needle.data(), Needle.size(), Offset);\n\t\t\t\tbreak;\n\t\t}\n\t\treturn Index < Data.size() ? Index : std::string_view::npos;\n\t}\n\tsize_t Text::FindAnyOf(const std::string_view& Data, const std::string_view& Set, size_t Offset)\n\t{\n\t\tsize_t Index = Data.size();\n\t\tif (Offset >= Data.size() || Set.empty() || !Accelerated)\n\t\t\treturn Data.find_first_of(Set, Offset);\n\n\t\tif (Set.size() > 16)\n\t\t\tIndex = FindAnyOfScalar(Data.data(), Data.size(), Set.data(), Set.size(), Offset);\n\t\telse\n\t\t{\n\t\t\tswitch (Level)\n\t\t\t{\n#ifdef TEXT_AVX2\n\t\t\t\tcase TextAcceleration::AVX2:\n\t\t\t\t\tIndex = FindAnyOfAVX2(Data.data(), Data.size(), Set.data(), Set.size(), Offset);\n\t\t\t\t\tbreak;\n#endif\n#ifdef TEXT_SSE2\n\t\t\t\tcase TextAcceleration::SSE2:\n\t\t\t\t\tIndex = FindAnyOfSSE2(Data.data(), Data.size(), Set.data(), Set.size(), Offset);\n\t\t\t\t\tbreak;\n#endif\n\t\t\t\tdefault:\n\t\t\t\t\tIndex = FindAnyOfScalar(Data.data(), Data.size(), Set.data(), Set.size(), Offset);\n\t\t\t\t\tbreak;\n\t\t\t}\n\t\t}\n\t\treturn Index < Data.size() ? Index : std::string_view::npos;\n\t}\n\tVector<String> Text::Split(const std::string_view& Data, const std::string_view& Separator)\n\t{\n\t\tif (!Accelerated)\n\t\t\treturn Stringify::Split(Data, Separator);\n\n\t\tVector<String> Result;\n\t\tif (Separator.empty())\n\t\t{\n\t\t\tResult.emplace_back(Data);\n\t\t\treturn Result;\n\t\t}\n\n\t\tsize_t Offset = 0;\n\t\twhile (Offset <= Data.size())\n\t\t{\n\t\t\tsize_t Index = Find(Data, Separator, Offset);\n\t\t\tif (Index == std::string_view::npos)\n\t\t\t{\n\t\t\t\tResult.emplace_back(Data.substr(Offset));\n\t\t\t\tbreak;\n\t\t\t}\n\n\t\t\tResult.emplace_back(Data.substr(Offset, Index - Offset));\n\t\t\tOffset = Index + Separator.size();\n\t\t}\n\t\treturn Result;\n\t}\n\tString Text::ReplaceAll(const std::string_view& Data, const std::string_view& From, const std::string_view& To)\n\t{\n\t\tif (!Accelerated)\n\t\t{\n\t\t\tString Result = String(Data);\n\t\t\tStringify::Replace(Result, From, To);\n\t\t\treturn Result;\n\t\t}\n\n\t\tif (From.empty())\n\t\t\treturn String(Data);\n\n\t\tString Result;\n\t\tResult.reserve(Data.size());\n\t\tsize_t Offset = 0;\n\t\twhile (Offset < Data.size())\n\t\t{\n\t\t\tsize_t Index = Find(Data, From, Offset);\n\t\t\tif (Index == std::string_view::npos)\n\t\t\t{\n\t\t\t\tResult.append(Data.data() + Offset, Data.size() - Offset);\n\t\t\t\treturn Result;\n\t\t\t}\n\n\t\t\tResult.append(Data.data() + Offset, Index - Offset);\n\t\t\tResult.append(To);\n\t\t\tOffset = Index + From.size();\n\t\t}\n\t\treturn Result;\n\t}\n\tString Text::Trim(const std::string_view& Data)\n\t{\n\t\tif (!Accelerated)\n\t\t{\n\t\t\tString Result = String(Data);\n\t\t\tStringify::Trim(Result);\n\t\t\treturn Result;\n\t\t}\n\n\t\tsize_t Start = 0, End = Data.size();\n\t\twhile (Start < End && IsWhitespace(Data[Start]))\n\t\t\t++Start;\n\t\twhile (End > Start && IsWhitespace(Data[End - 1]))\n\t\t\t--End;\n\t\treturn String(Data.substr(Start, End - Start));\n\t}\n\tString Text::ToLower(const std::string_view& Data)\n\t{\n\t\tString Result = String(Data);\n\t\tif (!Accelerated)\n\t\t\tStringify::ToLower(Result);\n\t\telse\n\t\t\tToCase((char*)Result.data(), Result.size(), 'A', 'Z', Level);\n\t\treturn Result;\n\t}\n\tString Text::ToUpper(const std::string_view& Data)\n\t{\n\t\tString Result = String(Data);\n\t\tif (!Accelerated)\n\t\t\tStringify::ToUpper(Result);\n\t\telse\n\t\t\tToCase((char*)Result.data(), Result.size(), 'a', 'z', Level);\n\t\treturn Result;\n\t}\n\tbool Text::IsUTF8(const std::string_view& Data)\n\t{\n\t\tconst uint8_t* Buffer = (const uint8_t*)Data.data();\n\t\tif (!Accelerated)\n\t\t\treturn IsUTF8Scalar(Buffer, Data.size(), 0);\n\n\t\tswitch (Level)\n\t\t{\n#ifdef TEXT_AVX2\n\t\t\tcase TextAcceleration::AVX2:\n\t\t\t\treturn IsUTF8AVX2(Buffer, Data.size());\n#endif\n#ifdef TEXT_SSE2\n\t\t\tcase TextAcceleration::SSE2:\n\t\t\t\treturn IsUTF8SSE2(Buffer, Data.size());\n#endif\n\t\t\tdefault:\n\t\t\t\treturn IsUTF8Scalar(Buffer, Data.size(), 0);\n\t\t}\n\t}\n\tString Text::HexEncode(const st";
+		dc_executable_text_cpp += "d::string_view& Data)\n\t{\n\t\tif (!Accelerated)\n\t\t\treturn Codec::HexEncode(Data);\n\n\t\tString Result;\n\t\tResult.resize(Data.size() * 2);\n\t\tchar* Output = (char*)Result.data();\n\t\tfor (size_t i = 0; i < Data.size(); i++)\n\t\t{\n\t\t\tuint8_t Value = (uint8_t)Data[i];\n\t\t\tOutput[i * 2 + 0] = HexAlphabet[Value >> 4];\n\t\t\tOutput[i * 2 + 1] = HexAlphabet[Value & 0x0F];\n\t\t}\n\t\treturn Result;\n\t}\n\tString Text::HexDecode(const std::string_view& Data)\n\t{\n\t\tif (!IsValidHex(Data))\n\t\t\treturn String();\n\t\telse if (!Accelerated)\n\t\t\treturn Codec::HexDecode(Data);\n\n\t\tString Result;\n\t\tResult.resize(Data.size() / 2);\n\t\tchar* Output = (char*)Result.data();\n\t\tfor (size_t i = 0; i < Result.size(); i++)\n\t\t\tOutput[i] = (char)((GetHexValue(Data[i * 2 + 0]) << 4) | GetHexValue(Data[i * 2 + 1]));\n\t\treturn Result;\n\t}\n\tString Text::Base64Encode(const std::string_view& Data)\n\t{\n\t\tif (!Accelerated)\n\t\t\treturn Codec::Base64Encode(Data);\n\n\t\tString Result;\n\t\tResult.resize((Data.size() + 2) / 3 * 4);\n\t\tconst uint8_t* Input = (const uint8_t*)Data.data();\n\t\tchar* Output = (char*)Result.data();\n\t\tsize_t Index = 0, Offset = 0;\n\t\tfor (; Index + 3 <= Data.size(); Index += 3, Offset += 4)\n\t\t{\n\t\t\tuint32_t Value = ((uint32_t)Input[Index] << 16) | ((uint32_t)Input[Index + 1] << 8) | (uint32_t)Input[Index + 2];\n\t\t\tOutput[Offset + 0] = Base64Alphabet[(Value >> 18) & 0x3F];\n\t\t\tOutput[Offset + 1] = Base64Alphabet[(Value >> 12) & 0x3F];\n\t\t\tOutput[Offset + 2] = Base64Alphabet[(Value >> 6) & 0x3F];\n\t\t\tOutput[Offset + 3] = Base64Alphabet[Value & 0x3F];\n\t\t}\n\n\t\tsize_t Remainder = Data.size() - Index;\n\t\tif (Remainder > 0)\n\t\t{\n\t\t\tuint32_t Value = (uint32_t)Input[Index] << 16;\n\t\t\tif (Remainder > 1)\n\t\t\t\tValue |= (uint32_t)Input[Index + 1] << 8;\n\t\t\tOutput[Offset + 0] = Base64Alphabet[(Value >> 18) & 0x3F];\n\t\t\tOutput[Offset + 1] = Base64Alphabet[(Value >> 12) & 0x3F];\n\t\t\tOutput[Offset + 2] = Remainder > 1 ? Base64Alphabet[(Value >> 6) & 0x3F] : '=';\n\t\t\tOutput[Offset + 3] = '=';\n\t\t}\n\t\treturn Result;\n\t}\n\tString Text::Base64Decode(const std::string_view& Data)\n\t{\n\t\tbool Whitespace = false;\n\t\tif (!IsValidBase64(Data, Whitespace))\n\t\t\treturn String();\n\n\t\tif (!Accelerated)\n\t\t{\n\t\t\tif (!Whitespace)\n\t\t\t\treturn Codec::Base64Decode(Data);\n\n\t\t\tString Compact;\n\t\t\tCompact.reserve(Data.size());\n\t\t\tfor (char Next : Data)\n\t\t\t{\n\t\t\t\tif (!IsWhitespace(Next))\n\t\t\t\t\tCompact.push_back(Next);\n\t\t\t}\n\t\t\treturn Codec::Base64Decode(Compact);\n\t\t}\n\n\t\tString Result;\n\t\tResult.reserve(Data.size() / 4 * 3);\n\t\tuint32_t Value = 0;\n\t\tsize_t Bits = 0;\n\t\tfor (char Next : Data)\n\t\t{\n\t\t\tif (Next == '=' || IsWhitespace(Next))\n\t\t\t\tcontinue;\n\n\t\t\tValue = (Value << 6) | (uint32_t)GetBase64Value(Next);\n\t\t\tBits += 6;\n\t\t\tif (Bits >= 8)\n\t\t\t{\n\t\t\t\tBits -= 8;\n\t\t\t\tResult.push_back((char)((Value >> Bits) & 0xFF));\n\t\t\t}\n\t\t}\n\t\treturn Result;\n\t}\n\tTextAcceleration Text::GetAcceleration()\n\t{\n\t\treturn Accelerated ? Level : TextAcceleration::Scalar;\n\t}\n\tvoid Text::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->ImportSystemAddon(\"array\");\n\t\tVM->ImportSystemAddon(\"string\");\n\t\tVM->BeginNamespace(\"text\");\n\t\tVM->SetProperty(\"const usize npos\", &Text::NotFound);\n\t\tVM->SetFunction(\"usize find(const string&in, const string&in, usize = 0)\", &Text::ScriptFind);\n\t\tVM->SetFunction(\"usize find_any_of(const string&in, const string&in, usize = 0)\", &Text::ScriptFindAnyOf);\n\t\tVM->SetFunction(\"array<string>@ split(const string&in, const string&in)\", &Text::ScriptSplit);\n\t\tVM->SetFunction(\"string replace_all(const string&in, const string&in, const string&in)\", &Text::ScriptReplaceAll);\n\t\tVM->SetFunction(\"string trim(const string&in)\", &Text::ScriptTrim);\n\t\tVM->SetFunction(\"string to_lower(const string&in)\", &Text::ScriptToLower);\n\t\tVM->SetFunction(\"string to_upper(const string&in)\", &Text::ScriptToUpper);\n\t\tVM->SetFunction(\"bool is_utf8(const string&in)\", &Text::ScriptIsUTF8);\n\t\tVM->SetFunction(\"string hex_encode(const string&in)\", &Text::ScriptHexEncode);\n\t\tVM->SetFunction(\"string hex_decode(const string&in)\", &Text::ScriptHexDecode);\n\t\tVM->SetFunction(\"string base64_encode(const string&in)\", &Text::ScriptBase64Encode);\n\t\tVM->SetFunction(\"string base64_decode(const string&in)\", &Text::S";
+		dc_executable_text_cpp += "criptBase64Decode);\n\t\tVM->SetFunction(\"void set_accelerated(bool)\", &Text::SetAccelerated);\n\t\tVM->SetFunction(\"string get_acceleration()\", &Text::GetAccelerationName);\n\t\tVM->EndNamespace();\n\t}\n\tsize_t Text::ScriptFind(const String& Data, const String& Needle, size_t Offset)\n\t{\n\t\treturn Find(Data, Needle, Offset);\n\t}\n\tsize_t Text::ScriptFindAnyOf(const String& Data, const String& Set, size_t Offset)\n\t{\n\t\treturn FindAnyOf(Data, Set, Offset);\n\t}\n\tBindings::Array* Text::ScriptSplit(const String& Data, const String& Separator)\n\t{\n\t\tauto* VM = ImmediateContext::Get()->GetVM();\n\t\tTypeInfo Type = VM->GetTypeInfoByDecl(\"array<string>@\");\n\t\treturn Bindings::Array::Compose<String>(Type.GetTypeInfo(), Split(Data, Separator));\n\t}\n\tString Text::ScriptReplaceAll(const String& Data, const String& From, const String& To)\n\t{\n\t\treturn ReplaceAll(Data, From, To);\n\t}\n\tString Text::ScriptTrim(const String& Data)\n\t{\n\t\treturn Trim(Data);\n\t}\n\tString Text::ScriptToLower(const String& Data)\n\t{\n\t\treturn ToLower(Data);\n\t}\n\tString Text::ScriptToUpper(const String& Data)\n\t{\n\t\treturn ToUpper(Data);\n\t}\n\tbool Text::ScriptIsUTF8(const String& Data)\n\t{\n\t\treturn IsUTF8(Data);\n\t}\n\tString Text::ScriptHexEncode(const String& Data)\n\t{\n\t\treturn HexEncode(Data);\n\t}\n\tString Text::ScriptHexDecode(const String& Data)\n\t{\n\t\treturn HexDecode(Data);\n\t}\n\tString Text::ScriptBase64Encode(const String& Data)\n\t{\n\t\treturn Base64Encode(Data);\n\t}\n\tString Text::ScriptBase64Decode(const String& Data)\n\t{\n\t\treturn Base64Decode(Data);\n\t}\n\tvoid Text::SetAccelerated(bool Enabled)\n\t{\n\t\tAccelerated = Enabled;\n\t}\n\tString Text::GetAccelerationName()\n\t{\n\t\tswitch (GetAcceleration())\n\t\t{\n\t\t\tcase TextAcceleration::AVX2:\n\t\t\t\treturn \"avx2\";\n\t\t\tcase TextAcceleration::SSE2:\n\t\t\t\treturn \"sse2\";\n\t\t\tdefault:\n\t\t\t\treturn \"scalar\";\n\t\t}\n\t}\n\tTextAcceleration Text::Level = DetectAcceleration();\n\tstd::atomic<bool> Text::Accelerated = true;\n\tsize_t Text::NotFound = std::string_view::npos;\n}";
+		callback(context, "executable/text.cpp", dc_executable_text_cpp.c_str(), (unsigned int)dc_executable_text_cpp.size());
+
+		const char* sc_executable_text_h = "#ifndef TEXT_H\n#define TEXT_H\n#include \"runtime.hpp\"\n#include <vengeance/vengeance.h>\n#include <charconv>\n\nnamespace ASX\n{\n\tenum class TextAcceleration\n\t{\n\t\tScalar,\n\t\tSSE2,\n\t\tAVX2\n\t};\n\n\tclass StringBuffer : public Reference<StringBuffer>\n\t{\n\tprivate:\n\t\tString Data;\n\n\tpublic:\n\t\tStringBuffer(size_t Capacity);\n\t\tvoid Append(const std::string_view& Value);\n\t\tvoid AppendString(const String& Value);\n\t\tvoid AppendInteger(int64_t Value);\n\t\tvoid AppendNumber(double Value);\n\t\tvoid AppendLine();\n\t\tvoid Reserve(size_t Capacity);\n\t\tvoid Clear();\n\t\tvoid Write();\n\t\tString Take();\n\t\tString ToString() const;\n\t\tsize_t GetSize() const;\n\t\tString& GetData();\n\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\t};\n\n\tclass Text\n\t{\n\tprivate:\n\t\tstatic TextAcceleration Level;\n\t\tstatic std::atomic<bool> Accelerated;\n\t\tstatic size_t NotFound;\n\n\tpublic:\n\t\tstatic size_t Find(const std::string_view& Data, const std::string_view& Needle, size_t Offset = 0);\n\t\tstatic size_t FindAnyOf(const std::string_view& Data, const std::string_view& Set, size_t Offset = 0);\n\t\tstatic Vector<String> Split(const std::string_view& Data, const std::string_view& Separator);\n\t\tstatic String ReplaceAll(const std::string_view& Data, const std::string_view& From, const std::string_view& To);\n\t\tstatic String Trim(const std::string_view& Data);\n\t\tstatic String ToLower(const std::string_view& Data);\n\t\tstatic String ToUpper(const std::string_view& Data);\n\t\tstatic bool IsUTF8(const std::string_view& Data);\n\t\tstatic String HexEncode(const std::string_view& Data);\n\t\tstatic String HexDecode(const std::string_view& Data);\n\t\tstatic String Base64Encode(const std::string_view& Data);\n\t\tstatic String Base64Decode(const std::string_view& Data);\n\t\tstatic TextAcceleration GetAcceleration();\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\n\tprivate:\n\t\tstatic size_t ScriptFind(const String& Data, const String& Needle, size_t Offset);\n\t\tstatic size_t ScriptFindAnyOf(const String& Data, const String& Set, size_t Offset);\n\t\tstatic Bindings::Array* ScriptSplit(const String& Data, const String& Separator);\n\t\tstatic String ScriptReplaceAll(const String& Data, const String& From, const String& To);\n\t\tstatic String ScriptTrim(const String& Data);\n\t\tstatic String ScriptToLower(const String& Data);\n\t\tstatic String ScriptToUpper(const String& Data);\n\t\tstatic bool ScriptIsUTF8(const String& Data);\n\t\tstatic String ScriptHexEncode(const String& Data);\n\t\tstatic String ScriptHexDecode(const String& Data);\n\t\tstatic String ScriptBase64Encode(const String& Data);\n\t\tstatic String ScriptBase64Decode(const String& Data);\n\t\tstatic void SetAccelerated(bool Enabled);\n\t\tstatic String GetAccelerationName();\n\t};\n}\n#endif";
+		callback(context, "executable/text.h", sc_executable_text_h, 2670);
+
+		std::string dc_executable_timers_cpp;
+		dc_executable_timers_cpp.reserve(8806);
+		dc_executable_timers_cpp += "#include \"timers.h\"\n#ifdef _MSC_VER\n#include <intrin.h>\n#endif\n\nnamespace ASX\n{\n\tstatic inline uint64_t CountTrailingZeros(uint64_t Value)\n\t{\n#ifdef _MSC_VER\n\t\tunsigned long Index = 0;\n\t\t_BitScanForward64(&Index, Value);\n\t\treturn (uint64_t)Index;\n#else\n\t\treturn (uint64_t)__builtin_ctzll(Value);\n#endif\n\t}\n\tstatic inline uint64_t RotateRight(uint64_t Value, uint64_t Shift)\n\t{\n\t\treturn Shift ? (Value >> Shift) | (Value << (64 - Shift)) : Value;\n\t}\n\n\tTimerWheel::TimerWheel() : Epoch(std::chrono::steady_clock::now()), Elapsed(0), Slack(1), Free(TIMERS_NONE), Pending(0)\n\t{\n\t\tfor (size_t i = 0; i < TIMERS_LEVELS; i++)\n\t\t{\n\t\t\tfor (size_t j = 0; j < TIMERS_SLOTS; j++)\n\t\t\t\tSlots[i][j] = TIMERS_NONE;\n\t\t\tOccupied[i] = 0;\n\t\t}\n\t}\n\tTimerWheel::~TimerWheel()\n\t{\n\t\tfor (auto& Next : Nodes)\n\t\t{\n\t\t\tif (Next.Active)\n\t\t\t\tNext.Callback.Release();\n\t\t}\n\t\tfor (auto& Next : Expired)\n\t\t\tNext.Callback.Release();\n\t}\n\tuint64_t TimerWheel::SetTimeout(uint64_t Timeout, FunctionDelegate&& Callback, EventLoop* Loop)\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tuint32_t Index = Free;\n\t\tif (Index != TIMERS_NONE)\n\t\t\tFree = Nodes[Index].Next;\n\t\telse\n\t\t{\n\t\t\tIndex = (uint32_t)Nodes.size();\n\t\t\tNodes.emplace_back();\n\t\t}\n\n\t\tNode& Next = Nodes[Index];\n\t\tNext.Callback = std::move(Callback);\n\t\tNext.Loop = Loop;\n\t\tNext.Deadline = GetTime() + Timeout;\n\t\tNext.Active = true;\n\t\tInsert(Index);\n\t\t++Pending;\n\t\treturn ((uint64_t)Next.Generation << 32) | (uint64_t)(Index + 1);\n\t}\n\tbool TimerWheel::ClearTimeout(uint64_t Id)\n\t{\n\t\tuint32_t Index = (uint32_t)(Id & 0xffffffff);\n\t\tif (!Index--)\n\t\t\treturn false;\n\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tif (Index >= Nodes.size())\n\t\t\treturn false;\n\n\t\tNode& Next = Nodes[Index];\n\t\tif (!Next.Active || Next.Generation != (uint32_t)(Id >> 32))\n\t\t\treturn false;\n\n\t\tUnlink(Index);\n\t\tNext.Callback.Release();\n\t\tNext.Loop = nullptr;\n\t\tNext.Active = false;\n\t\t++Next.Generation;\n\t\tNext.Next = Free;\n\t\tFree = Index;\n\t\t--Pending;\n\t\treturn true;\n\t}\n\tsize_t TimerWheel::Cancel(EventLoop* Loop)\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tsize_t Count = 0;\n\t\tfor (uint32_t i = 0; i < (uint32_t)Nodes.size(); i++)\n\t\t{\n\t\t\tNode& Next = Nodes[i];\n\t\t\tif (!Next.Active || Next.Loop != Loop)\n\t\t\t\tcontinue;\n\n\t\t\tUnlink(i);\n\t\t\tNext.Callback.Release();\n\t\t\tNext.Loop = nullptr;\n\t\t\tNext.Active = false;\n\t\t\t++Next.Generation;\n\t\t\tNext.Next = Free;\n\t\t\tFree = i;\n\t\t\t--Pending;\n\t\t\t++Count;\n\t\t}\n\n\t\tfor (auto It = Expired.begin(); It != Expired.end();)\n\t\t{\n\t\t\tif (It->Loop == Loop)\n\t\t\t{\n\t\t\t\tIt->Callback.Release();\n\t\t\t\tIt = Expired.erase(It);\n\t\t\t\t++Count;\n\t\t\t}\n\t\t\telse\n\t\t\t\t++It;\n\t\t}\n\t\treturn Count;\n\t}\n\tuint64_t TimerWheel::Update(uint64_t Timeout)\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tuint64_t Time = GetTime();\n\t\tAdvance(Time / Slack);\n\t\tfor (auto& Next : Expired)\n\t\t\tNext.Loop->Enqueue(std::move(Next.Callback), [](ImmediateContext*) { }, [](ImmediateContext*) { });\n\t\tExpired.clear();\n\n\t\tuint64_t Tick = GetNextTick();\n\t\tif (Tick != std::numeric_limits<uint64_t>::max())\n\t\t\tTimeout = std::min(Timeout, Tick * Slack > Time ? Tick * Slack - Time : 0);\n\t\treturn Timeout;\n\t}\n\tvoid TimerWheel::SetSlack(uint64_t Milliseconds)\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\tMilliseconds = std::max<uint64_t>(1, Milliseconds);\n\t\tif (Milliseconds == Slack)\n\t\t\treturn;\n\n\t\tfor (size_t i = 0; i < TIMERS_LEVELS; i++)\n\t\t{\n\t\t\tfor (size_t j = 0; j < TIMERS_SLOTS; j++)\n\t\t\t\tSlots[i][j] = TIMERS_NONE;\n\t\t\tOccupied[i] = 0;\n\t\t}\n\n\t\tElapsed = Elapsed * Slack / Milliseconds;\n\t\tSlack = Milliseconds;\n\t\tfor (uint32_t i = 0; i < (uint32_t)Nodes.size(); i++)\n\t\t{\n\t\t\tif (Nodes[i].Active)\n\t\t\t\tInsert(i);\n\t\t}\n\t}\n\tuint64_t TimerWheel::GetSlack()\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\treturn Slack;\n\t}\n\tsize_t TimerWheel::GetPending()\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\treturn Pending;\n\t}\n\tsize_t TimerWheel::GetMemoryUsage()\n\t{\n\t\tUMutex<std::mutex> Unique(Mutex);\n\t\treturn sizeof(TimerWheel) + Nodes.capacity() * sizeof(Node) + Expired.capacity() * sizeof(Expiry);\n\t}\n\tvoid TimerWheel::Insert(uint32_t Index)\n\t{\n\t\tNode& Next = Nodes[Index];\n\t\tuint64_t Tick = (Next.Deadline + Slack - 1) / Slack;\n\t\tif (Tick <= Elapsed)\n\t\t\tTick = Elapsed + 1;\n\n";
+		dc_executable_timers_cpp += "\t\tuint8_t Level = 0;\n\t\twhile (Level + 1 < TIMERS_LEVELS && (Tick >> (TIMERS_BITS * Level)) - (Elapsed >> (TIMERS_BITS * Level)) > TIMERS_SLOTS)\n\t\t\t++Level;\n\n\t\tuint64_t Shift = TIMERS_BITS * Level;\n\t\tif ((Tick >> Shift) - (Elapsed >> Shift) > TIMERS_SLOTS)\n\t\t\tTick = ((Elapsed >> Shift) + TIMERS_SLOTS) << Shift;\n\n\t\tuint8_t Slot = (uint8_t)((Tick >> (TIMERS_BITS * Level)) & (TIMERS_SLOTS - 1));\n\t\tuint32_t& Head = Slots[Level][Slot];\n\t\tNext.Level = Level;\n\t\tNext.Slot = Slot;\n\t\tNext.Prev = TIMERS_NONE;\n\t\tNext.Next = Head;\n\t\tif (Head != TIMERS_NONE)\n\t\t\tNodes[Head].Prev = Index;\n\t\tHead = Index;\n\t\tOccupied[Level] |= 1ull << Slot;\n\t}\n\tvoid TimerWheel::Unlink(uint32_t Index)\n\t{\n\t\tNode& Next = Nodes[Index];\n\t\tif (Next.Prev != TIMERS_NONE)\n\t\t\tNodes[Next.Prev].Next = Next.Next;\n\t\telse\n\t\t\tSlots[Next.Level][Next.Slot] = Next.Next;\n\n\t\tif (Next.Next != TIMERS_NONE)\n\t\t\tNodes[Next.Next].Prev = Next.Prev;\n\n\t\tif (Slots[Next.Level][Next.Slot] == TIMERS_NONE)\n\t\t\tOccupied[Next.Level] &= ~(1ull << Next.Slot);\n\t\tNext.Prev = Next.Next = TIMERS_NONE;\n\t}\n\tvoid TimerWheel::Cascade(uint8_t Level, uint8_t Slot)\n\t{\n\t\tuint32_t Index = Slots[Level][Slot];\n\t\tSlots[Level][Slot] = TIMERS_NONE;\n\t\tOccupied[Level] &= ~(1ull << Slot);\n\t\twhile (Index != TIMERS_NONE)\n\t\t{\n\t\t\tuint32_t Next = Nodes[Index].Next;\n\t\t\tInsert(Index);\n\t\t\tIndex = Next;\n\t\t}\n\t}\n\tvoid TimerWheel::Expire(uint8_t Slot)\n\t{\n\t\tuint32_t Index = Slots[0][Slot];\n\t\tSlots[0][Slot] = TIMERS_NONE;\n\t\tOccupied[0] &= ~(1ull << Slot);\n\t\twhile (Index != TIMERS_NONE)\n\t\t{\n\t\t\tNode& Next = Nodes[Index];\n\t\t\tuint32_t Following = Next.Next;\n\t\t\tExpired.push_back({ std::move(Next.Callback), Next.Loop });\n\t\t\tNext.Loop = nullptr;\n\t\t\tNext.Active = false;\n\t\t\tNext.Prev = TIMERS_NONE;\n\t\t\tNext.Next = Free;\n\t\t\t++Next.Generation;\n\t\t\tFree = Index;\n\t\t\t--Pending;\n\t\t\tIndex = Following;\n\t\t}\n\t}\n\tvoid TimerWheel::Advance(uint64_t Tick)\n\t{\n\t\twhile (Elapsed < Tick)\n\t\t{\n\t\t\tuint64_t Next = GetNextTick();\n\t\t\tif (Next > Tick)\n\t\t\t{\n\t\t\t\tElapsed = Tick;\n\t\t\t\tbreak;\n\t\t\t}\n\n\t\t\tElapsed = Next - 1;\n\t\t\tuint8_t Level = 0;\n\t\t\twhile (Level + 1 < TIMERS_LEVELS && !(Next & ((1ull << (TIMERS_BITS * (Level + 1))) - 1)))\n\t\t\t\t++Level;\n\n\t\t\tfor (; Level > 0; Level--)\n\t\t\t\tCascade(Level, (uint8_t)((Next >> (TIMERS_BITS * Level)) & (TIMERS_SLOTS - 1)));\n\n\t\t\tElapsed = Next;\n\t\t\tExpire((uint8_t)(Next & (TIMERS_SLOTS - 1)));\n\t\t}\n\t}\n\tuint64_t TimerWheel::GetNextTick()\n\t{\n\t\tuint64_t Result = std::numeric_limits<uint64_t>::max();\n\t\tif (Occupied[0] != 0)\n\t\t{\n\t\t\tuint64_t From = (Elapsed + 1) & (TIMERS_SLOTS - 1);\n\t\t\tResult = Elapsed + 1 + CountTrailingZeros(RotateRight(Occupied[0], From));\n\t\t}\n\n\t\tfor (size_t i = 1; i < TIMERS_LEVELS; i++)\n\t\t{\n\t\t\tif (Occupied[i] != 0)\n\t\t\t\treturn std::min(Result, (Elapsed | (TIMERS_SLOTS - 1)) + 1);\n\t\t}\n\n\t\treturn Result;\n\t}\n\tuint64_t TimerWheel::GetTime()\n\t{\n\t\treturn (uint64_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - Epoch).count();\n\t}\n\tvoid TimerWheel::BindSyntax(VirtualMachine* VM)\n\t{\n\t\tVM->BeginNamespace(\"timers\");\n\t\tVM->SetFunctionDef(\"void timeout_event()\");\n\t\tVM->SetFunction(\"uint64 set_timeout(uint64, timeout_event@)\", &TimerWheel::ScriptSetTimeout);\n\t\tVM->SetFunction(\"bool clear_timeout(uint64)\", &TimerWheel::ScriptClearTimeout);\n\t\tVM->SetFunction(\"void set_slack(uint64)\", &TimerWheel::ScriptSetSlack);\n\t\tVM->SetFunction(\"uint64 get_slack()\", &TimerWheel::ScriptGetSlack);\n\t\tVM->SetFunction(\"usize get_pending()\", &TimerWheel::ScriptGetPending);\n\t\tVM->SetFunction(\"usize get_memory_usage()\", &TimerWheel::ScriptGetMemoryUsage);\n\t\tVM->EndNamespace();\n\t}\n\tvoid TimerWheel::Cleanup()\n\t{\n\t\tMemory::Delete(Instance);\n\t}\n\tbool TimerWheel::HasInstance()\n\t{\n\t\treturn Instance != nullptr;\n\t}\n\tTimerWheel* TimerWheel::Get()\n\t{\n\t\tstatic std::mutex Initialization;\n\t\tUMutex<std::mutex> Unique(Initialization);\n\t\tif (!Instance)\n\t\t\tInstance = Memory::New<TimerWheel>();\n\t\treturn Instance;\n\t}\n\tuint64_t TimerWheel::ScriptSetTimeout(uint64_t Timeout, asIScriptFunction* Callback)\n\t{\n\t\tif (!Callback)\n\t\t\treturn 0;\n\n\t\tauto* Loop = EventLoop::Get();\n\t\tif (!Loop)\n\t\t{\n\t\t\tFunction(Callback).Release();\n\t\t\tImmediateContext::";
+		dc_executable_timers_cpp += "Get()->SetException(\"timers require an active event loop\");\n\t\t\treturn 0;\n\t\t}\n\n\t\treturn Get()->SetTimeout(Timeout, FunctionDelegate(Callback), Loop);\n\t}\n\tbool TimerWheel::ScriptClearTimeout(uint64_t Id)\n\t{\n\t\treturn Get()->ClearTimeout(Id);\n\t}\n\tvoid TimerWheel::ScriptSetSlack(uint64_t Milliseconds)\n\t{\n\t\tGet()->SetSlack(Milliseconds);\n\t}\n\tuint64_t TimerWheel::ScriptGetSlack()\n\t{\n\t\treturn Get()->GetSlack();\n\t}\n\tsize_t TimerWheel::ScriptGetPending()\n\t{\n\t\treturn Get()->GetPending();\n\t}\n\tsize_t TimerWheel::ScriptGetMemoryUsage()\n\t{\n\t\treturn Get()->GetMemoryUsage();\n\t}\n\tTimerWheel* TimerWheel::Instance = nullptr;\n}";
+		callback(context, "executable/timers.cpp", dc_executable_timers_cpp.c_str(), (unsigned int)dc_executable_timers_cpp.size());
+
+		const char* sc_executable_timers_h = "#ifndef TIMERS_H\n#define TIMERS_H\n#include \"runtime.hpp\"\n#include <vengeance/vengeance.h>\n#define TIMERS_LEVELS 6\n#define TIMERS_SLOTS 64\n#define TIMERS_BITS 6\n#define TIMERS_NONE 0xffffffff\n\nnamespace ASX\n{\n\tclass TimerWheel\n\t{\n\tprivate:\n\t\tstruct Node\n\t\t{\n\t\t\tFunctionDelegate Callback;\n\t\t\tEventLoop* Loop = nullptr;\n\t\t\tuint64_t Deadline = 0;\n\t\t\tuint32_t Prev = TIMERS_NONE;\n\t\t\tuint32_t Next = TIMERS_NONE;\n\t\t\tuint32_t Generation = 0;\n\t\t\tuint8_t Level = 0;\n\t\t\tuint8_t Slot = 0;\n\t\t\tbool Active = false;\n\t\t};\n\n\t\tstruct Expiry\n\t\t{\n\t\t\tFunctionDelegate Callback;\n\t\t\tEventLoop* Loop;\n\t\t};\n\n\tprivate:\n\t\tstatic TimerWheel* Instance;\n\n\tprivate:\n\t\tVector<Node> Nodes;\n\t\tVector<Expiry> Expired;\n\t\tuint32_t Slots[TIMERS_LEVELS][TIMERS_SLOTS];\n\t\tuint64_t Occupied[TIMERS_LEVELS];\n\t\tstd::chrono::steady_clock::time_point Epoch;\n\t\tstd::mutex Mutex;\n\t\tuint64_t Elapsed;\n\t\tuint64_t Slack;\n\t\tuint32_t Free;\n\t\tsize_t Pending;\n\n\tpublic:\n\t\tTimerWheel();\n\t\t~TimerWheel();\n\t\tuint64_t SetTimeout(uint64_t Timeout, FunctionDelegate&& Callback, EventLoop* Loop);\n\t\tbool ClearTimeout(uint64_t Id);\n\t\tsize_t Cancel(EventLoop* Loop);\n\t\tuint64_t Update(uint64_t Timeout);\n\t\tvoid SetSlack(uint64_t Milliseconds);\n\t\tuint64_t GetSlack();\n\t\tsize_t GetPending();\n\t\tsize_t GetMemoryUsage();\n\n\tpublic:\n\t\tstatic void BindSyntax(VirtualMachine* VM);\n\t\tstatic void Cleanup();\n\t\tstatic bool HasInstance();\n\t\tstatic TimerWheel* Get();\n\n\tprivate:\n\t\tvoid Insert(uint32_t Index);\n\t\tvoid Unlink(uint32_t Index);\n\t\tvoid Cascade(uint8_t Level, uint8_t Slot);\n\t\tvoid Expire(uint8_t Slot);\n\t\tvoid Advance(uint64_t Tick);\n\t\tuint64_t GetNextTick();\n\t\tuint64_t GetTime();\n\t\tstatic uint64_t ScriptSetTimeout(uint64_t Timeout, asIScriptFunction* Callback);\n\t\tstatic bool ScriptClearTimeout(uint64_t Id);\n\t\tstatic void ScriptSetSlack(uint64_t Milliseconds);\n\t\tstatic uint64_t ScriptGetSlack();\n\t\tstatic size_t ScriptGetPending();\n\t\tstatic size_t ScriptGetMemoryUsage();\n\t};\n}\n#endif";
+		callback(context, "executable/timers.h", sc_executable_timers_h, 1926);
+
 		const char* sc_executable_vcpkg_json = "{\n    \"name\": \"{{BUILDER_OUTPUT}}\",\n    \"description\": \"Program: {{BUILDER_OUTPUT}}\",\n    \"version\": \"1.0.0\",\n    \"builtin-baseline\": \"e038ef04796ee67814f36af7c235ae50bbdf4303\",\n    \"dependencies\": {{BUILDER_CONFIG_INSTALL}}\n}";
 		callback(context, "executable/vcpkg.json", sc_executable_vcpkg_json, 226);
 	}
@@ -0,0 +1,167 @@
+#include "image.h"
+
+namespace ASX
+{
+	bool ProgramImage::Load(SystemConfig& Config, EnvironmentConfig& Env, VirtualMachine* VM, Compiler* Unit, const String& Path)
+	{
+		auto Data = OS::File::ReadAsString(Path);
+		if (!Data)
+			return false;
+
+		UPtr<Schema> Image = Pack::Decode(*Data, PackFormat::MessagePack);
+		if (!Image || Image->GetVar("version").GetBlob() != GetOptions(Config, VM))
+			return false;
+
+		Schema* Sources = Image->Get("sources");
+		Schema* Addons = Image->Get("addons");
+		Schema* Code = Image->Get("code");
+		if (!Sources || !Addons || !Code)
+			return false;
+
+		auto Bytes = Code->Value.GetString();
+		if (Image->GetVar("checksum").GetBlob() != ToString(SourceCache::GetHash(Bytes)))
+			return false;
+
+		auto& Files = Sources->GetChilds();
+		std::atomic<bool> Valid(true);
+		auto Validate = [&Env, &Files, &Valid](size_t Index)
+		{
+			if (!Valid)
+				return;
+
+			Schema* File = Files[Index];
+			auto Hash = FromString<uint64_t>(File->Value.GetBlob());
+			if (!Hash)
+			{
+				Valid = false;
+				return;
+			}
+			else if (File->Key == Env.Path)
+			{
+				if (SourceCache::GetHash(Env.Program) != *Hash)
+					Valid = false;
+				return;
+			}
+
+			auto Source = OS::File::ReadAsString(File->Key);
+			if (!Source || SourceCache::GetHash(*Source) != *Hash)
+				Valid = false;
+		};
+		if (Files.size() > 1)
+			Parallel::Get()->Distribute(Files.size(), Validate);
+		else if (!Files.empty())
+			Validate(0);
+		if (!Valid)
+			return false;
+
+		UnorderedSet<String> Exposed;
+		for (auto& Item : VM->GetSystemAddons())
+		{
+			if (Item.second.Exposed)
+				Exposed.insert(Item.first);
+		}
+
+		String Imported;
+		for (auto* Addon : Addons->GetChilds())
+		{
+			String Name = Addon->Value.GetBlob();
+			if (Exposed.count(Name) > 0)
+				continue;
+			else if (!VM->ImportSystemAddon(Name))
+				return false;
+			Imported += (Imported.empty() ? "" : ", ") + Name;
+		}
+
+		ByteCodeInfo Info;
+		Info.Debug = true;
+		Runtime::ConfigureSystem(Config);
+		Info.Data.insert(Info.Data.begin(), Bytes.begin(), Bytes.end());
+		if (!Unit->LoadByteCode(&Info).Get())
+		{
+			OS::File::Remove(Path);
+			if (!Imported.empty())
+				VI_WARN("cannot load <%s> program image: recompiling with system addons imported from the image (%s), image is removed so next run starts clean", Env.Module, Imported.c_str());
+			else
+				VI_WARN("cannot load <%s> program image: recompiling", Env.Module);
+			Unit->Prepare(Env.Module);
+			return false;
+		}
+
+		Env.AutoSchedule = (int32_t)Image->GetVar("schedule").GetInteger();
+		Env.AutoConsole = Image->GetVar("console").GetBoolean();
+		Env.AutoStop = Image->GetVar("stop").GetBoolean();
+		return true;
+	}
+	bool ProgramImage::Save(SystemConfig& Config, EnvironmentConfig& Env, VirtualMachine* VM, Compiler* Unit, const SourceCache& Sources, const String& Path)
+	{
+		if (!VM->GetCLibraries().empty())
+		{
+			VI_DEBUG("program image of <%s> is not saved: external libraries cannot be restored", Env.Module);
+			return false;
+		}
+
+		ByteCodeInfo Info;
+		Info.Debug = true;
+		if (!Unit->SaveByteCode(&Info))
+			return false;
+
+		UnorderedMap<String, uint64_t> Files = Sources.GetDependencies();
+		Files[Env.Path] = SourceCache::GetHash(Env.Program);
+		for (auto& Name : Env.Addons)
+		{
+			for (auto& File : Builder::GetAddonFiles(Env, Name))
+			{
+				auto Data = OS::File::ReadAsString(File);
+				if (Data)
+					Files[File] = SourceCache::GetHash(*Data);
+			}
+		}
+
+		Vector<String> Addons;
+		for (auto& Item : VM->GetSystemAddons())
+		{
+			if (Item.second.Exposed)
+				Addons.push_back(Item.first);
+		}
+
+		String Data;
+		PackEncoder Encoder(Data, PackFormat::MessagePack);
+		auto Bytes = std::string_view((char*)Info.Data.data(), Info.Data.size());
+		Encoder.BeginMap(8);
+		Encoder.WriteString("version");
+		Encoder.WriteString(GetOptions(Config, VM));
+		Encoder.WriteString("checksum");
+		Encoder.WriteString(ToString(SourceCache::GetHash(Bytes)));
+		Encoder.WriteString("schedule");
+		Encoder.WriteInteger(Env.AutoSchedule);
+		Encoder.WriteString("console");
+		Encoder.WriteBoolean(Env.AutoConsole);
+		Encoder.WriteString("stop");
+		Encoder.WriteBoolean(Env.AutoStop);
+		Encoder.WriteString("addons");
+		Encoder.BeginArray(Addons.size());
+		for (auto& Name : Addons)
+			Encoder.WriteString(Name);
+		Encoder.WriteString("sources");
+		Encoder.BeginMap(Files.size());
+		for (auto& File : Files)
+		{
+			Encoder.WriteString(File.first);
+			Encoder.WriteString(ToString(File.second));
+		}
+		Encoder.WriteString("code");
+		Encoder.WriteBinary(Bytes);
+		if (OS::File::Write(Path, (uint8_t*)Data.data(), Data.size()))
+			return true;
+
+		VI_WARN("cannot save <%s> program image to <%s>", Env.Module, Path.c_str());
+		return false;
+	}
+	String ProgramImage::GetOptions(SystemConfig& Config, VirtualMachine* VM)
+	{
+		uint64_t Settings = 0;
+		for (auto& Item : Builder::GetDefaultSettings())
+			Settings += SourceCache::GetHash(Item.first + "=" + ToString(VM->GetProperty((Features)Item.second)));
+		return Stringify::Text("%s:%i:%i:%" PRIu64, Builder::GetSystemVersion().c_str(), (int)Config.TsImports, (int)Config.Tags, Settings);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,22 @@
+#ifndef IMAGE_H
+#define IMAGE_H
+#include "runtime.hpp"
+#include "builder.h"
+#include "pack.h"
+#include "sources.h"
+#include <vengeance/vengeance.h>
+#define SOURCES_IMAGE ".image"
+
+namespace ASX
+{
+	class ProgramImage
+	{
+	public:
+		static bool Load(SystemConfig& Config, EnvironmentConfig& Env, VirtualMachine* VM, Compiler* Unit, const String& Path);
+		static bool Save(SystemConfig& Config, EnvironmentConfig& Env, VirtualMachine* VM, Compiler* Unit, const SourceCache& Sources, const String& Path);
+
+	private:
+		static String GetOptions(SystemConfig& Config, VirtualMachine* VM);
+	};
+}
+#endif
\ No newline at end of file
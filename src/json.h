@@ -0,0 +1,110 @@
+#ifndef JSON_H
+#define JSON_H
+#include "runtime.hpp"
+#include <vengeance/vengeance.h>
+
+namespace ASX
+{
+	enum class JsonEvent
+	{
+		Need,
+		BeginObject,
+		EndObject,
+		BeginArray,
+		EndArray,
+		Key,
+		String,
+		Number,
+		Boolean,
+		Null,
+		End,
+		Error
+	};
+
+	class JsonReader : public Reference<JsonReader>
+	{
+	private:
+		enum class Expectation
+		{
+			Value,
+			ValueOrEnd,
+			KeyOrEnd,
+			Key,
+			Colon,
+			CommaOrEnd,
+			Done
+		};
+
+	private:
+		Vector<char> Scopes;
+		String Buffer;
+		String Unescaped;
+		std::string_view Value;
+		std::string_view Source;
+		Expectation State;
+		size_t Offset;
+		double Number;
+		bool Boolean;
+		bool Finished;
+		bool Failed;
+		bool Empty;
+
+	public:
+		JsonReader();
+		void Feed(const String& Data);
+		void Finish();
+		JsonEvent Next();
+		const std::string_view& GetValue() const;
+		const std::string_view& GetSource() const;
+		String GetString() const;
+		String GetRaw() const;
+		double GetNumber() const;
+		bool GetBoolean() const;
+		size_t GetDepth() const;
+
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+
+	private:
+		JsonEvent ReadValue();
+		JsonEvent ReadString(JsonEvent Event);
+		JsonEvent ReadNumber();
+		JsonEvent ReadLiteral(const std::string_view& Literal, JsonEvent Event);
+		JsonEvent CloseScope(char Scope);
+		JsonEvent AfterValue(JsonEvent Event);
+		JsonEvent Fail();
+		bool Unescape(const std::string_view& Data);
+	};
+
+	class JsonWriter : public Reference<JsonWriter>
+	{
+	private:
+		Vector<bool> Scopes;
+		String Buffer;
+		bool Pending;
+
+	public:
+		JsonWriter();
+		void BeginObject();
+		void EndObject();
+		void BeginArray();
+		void EndArray();
+		void Key(const String& Name);
+		void WriteString(const String& Data);
+		void WriteNumber(double Data);
+		void WriteInteger(int64_t Data);
+		void WriteBoolean(bool Data);
+		void WriteNull();
+		void WriteRaw(const String& Data);
+		String Flush();
+		size_t GetSize() const;
+
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+
+	private:
+		void Separate();
+		void Escape(const std::string_view& Data);
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,515 @@
+#include "parallel.h"
+#include "buffers.h"
+
+namespace ASX
+{
+	template <typename T>
+	struct ParallelValue;
+
+	template <>
+	struct ParallelValue<int32_t>
+	{
+		static void SetArg(ImmediateContext* Context, size_t Index, int32_t Value)
+		{
+			Context->SetArg32(Index, Value);
+		}
+		static int32_t GetReturn(ImmediateContext* Context)
+		{
+			return (int32_t)Context->GetReturnDWord();
+		}
+	};
+
+	template <>
+	struct ParallelValue<int64_t>
+	{
+		static void SetArg(ImmediateContext* Context, size_t Index, int64_t Value)
+		{
+			Context->SetArg64(Index, Value);
+		}
+		static int64_t GetReturn(ImmediateContext* Context)
+		{
+			return (int64_t)Context->GetReturnQWord();
+		}
+	};
+
+	template <>
+	struct ParallelValue<float>
+	{
+		static void SetArg(ImmediateContext* Context, size_t Index, float Value)
+		{
+			Context->SetArgFloat(Index, Value);
+		}
+		static float GetReturn(ImmediateContext* Context)
+		{
+			return Context->GetReturnFloat();
+		}
+	};
+
+	template <>
+	struct ParallelValue<double>
+	{
+		static void SetArg(ImmediateContext* Context, size_t Index, double Value)
+		{
+			Context->SetArgDouble(Index, Value);
+		}
+		static double GetReturn(ImmediateContext* Context)
+		{
+			return Context->GetReturnDouble();
+		}
+	};
+
+	template <typename T>
+	static void SortBuffer(Parallel* Pool, T* Buffer, size_t Size)
+	{
+		size_t Chunks = std::min(Pool->GetThreads() + 1, std::max<size_t>(1, Size / 4096));
+		size_t Step = (Size + Chunks - 1) / Chunks;
+		Pool->Distribute(Chunks, [Buffer, Size, Step](size_t Index)
+		{
+			size_t From = std::min(Size, Index * Step), To = std::min(Size, From + Step);
+			std::sort(Buffer + From, Buffer + To, &IsOrdered<T>);
+		});
+
+		for (size_t Width = Step; Width > 0 && Width < Size; Width *= 2)
+		{
+			size_t Merges = (Size + Width * 2 - 1) / (Width * 2);
+			Pool->Distribute(Merges, [Buffer, Size, Width](size_t Index)
+			{
+				size_t From = Index * Width * 2, Middle = std::min(Size, From + Width), To = std::min(Size, Middle + Width);
+				if (Middle < To)
+					std::inplace_merge(Buffer + From, Buffer + Middle, Buffer + To, &IsOrdered<T>);
+			});
+		}
+	}
+
+	ParallelBatch::ParallelBatch(size_t NewChunks, const ChunkCallback* NewCallback) : Callback(NewCallback), Chunks(NewChunks), Next(0), Done(0)
+	{
+	}
+	void ParallelBatch::Execute()
+	{
+		size_t Index = Next++;
+		while (Index < Chunks)
+		{
+			(*Callback)(Index);
+			++Done;
+			Index = Next++;
+		}
+	}
+
+	ParallelJob::ParallelJob(asIScriptFunction* NewCallback) : Callback(NewCallback), Finished(false), Success(false)
+	{
+	}
+	ParallelJob::~ParallelJob()
+	{
+		Function(Callback).Release();
+	}
+	void ParallelJob::Execute()
+	{
+		bool Result = Parallel::ExecuteCallback(Callback, [](ImmediateContext*) { }) == Execution::Finished;
+		{
+			UMutex<std::mutex> Unique(Mutex);
+			Success = Result;
+			Finished = true;
+		}
+		Parallel::Get()->Notify();
+	}
+	bool ParallelJob::Join()
+	{
+		Parallel::Get()->Await([this]() { return IsFinished(); });
+		UMutex<std::mutex> Unique(Mutex);
+		return Success;
+	}
+	bool ParallelJob::IsFinished()
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		return Finished;
+	}
+
+	Parallel::Parallel(size_t Count) : Active(true)
+	{
+		Threads.reserve(Count);
+		for (size_t i = 0; i < Count; i++)
+		{
+			Threads.emplace_back([this]()
+			{
+				std::function<void()> Task;
+				while (Dequeue(Task))
+					Task();
+				VirtualMachine::CleanupThisThread();
+			});
+		}
+	}
+	Parallel::~Parallel()
+	{
+		{
+			UMutex<std::mutex> Unique(Mutex);
+			Active = false;
+			Condition.notify_all();
+		}
+		for (auto& Thread : Threads)
+			Thread.join();
+	}
+	void Parallel::Distribute(size_t Chunks, const ChunkCallback& Callback)
+	{
+		if (Chunks <= 1 || Threads.empty())
+		{
+			for (size_t i = 0; i < Chunks; i++)
+				Callback(i);
+			return;
+		}
+
+		ParallelBatch* Batch = new ParallelBatch(Chunks, &Callback);
+		size_t Helpers = std::min(Threads.size(), Chunks - 1);
+		for (size_t i = 0; i < Helpers; i++)
+		{
+			Batch->AddRef();
+			Enqueue([Batch]()
+			{
+				Batch->Execute();
+				Batch->Release();
+			});
+		}
+
+		Batch->Execute();
+		while (Batch->Done < Chunks)
+			std::this_thread::yield();
+		Batch->Release();
+	}
+	void Parallel::Partition(size_t Count, size_t Grain, const RangeCallback& Callback)
+	{
+		size_t Workers = Threads.size() + 1;
+		size_t Minimum = Grain > 0 ? Grain : std::max<size_t>(1, Count / (Workers * PARALLEL_GRAIN_FACTOR));
+		if (Count <= Minimum || Threads.empty())
+		{
+			Callback(0, Count);
+			return;
+		}
+
+		std::atomic<size_t> Cursor(0);
+		std::atomic<bool> Stop(false);
+		Distribute(std::min(Workers, (Count + Minimum - 1) / Minimum), [&Cursor, &Stop, &Callback, Count, Minimum, Workers](size_t)
+		{
+			size_t From = Cursor.load(std::memory_order_relaxed), To = 0;
+			while (!Stop.load(std::memory_order_relaxed))
+			{
+				do
+				{
+					if (From >= Count)
+						return;
+
+					To = std::min(Count, From + std::max(Minimum, (Count - From) / (Workers * 2)));
+				} while (!Cursor.compare_exchange_weak(From, To, std::memory_order_relaxed));
+
+				if (!Callback(From, To))
+					Stop = true;
+				From = Cursor.load(std::memory_order_relaxed);
+			}
+		});
+	}
+	void Parallel::Enqueue(std::function<void()>&& Callback)
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		Tasks.push(std::move(Callback));
+		Condition.notify_one();
+	}
+	bool Parallel::Dequeue(std::function<void()>& Callback)
+	{
+		std::unique_lock<std::mutex> Unique(Mutex);
+		Condition.wait(Unique, [this]() { return !Tasks.empty() || !Active; });
+
+		if (Tasks.empty())
+			return false;
+
+		Callback = std::move(Tasks.front());
+		Tasks.pop();
+		return true;
+	}
+	void Parallel::Await(const std::function<bool()>& Ready)
+	{
+		std::function<void()> Task;
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> Unique(Mutex);
+				Condition.wait(Unique, [this, &Ready]() { return !Tasks.empty() || Ready(); });
+				if (Ready())
+					return;
+
+				Task = std::move(Tasks.front());
+				Tasks.pop();
+			}
+			Task();
+		}
+	}
+	void Parallel::Notify()
+	{
+		UMutex<std::mutex> Unique(Mutex);
+		Condition.notify_all();
+	}
+	size_t Parallel::GetThreads() const
+	{
+		return Threads.size();
+	}
+	void Parallel::BindSyntax(VirtualMachine* VM)
+	{
+		VM->ImportSystemAddon("array");
+		VM->BeginNamespace("parallel");
+		VM->SetFunctionDef("void range_event(usize, usize)");
+		VM->SetFunctionDef("void job_event()");
+		VM->SetFunctionDef("int32 map_int32_event(int32)");
+		VM->SetFunctionDef("int64 map_int64_event(int64)");
+		VM->SetFunctionDef("float map_float_event(float)");
+		VM->SetFunctionDef("double map_double_event(double)");
+		VM->SetFunctionDef("int32 reduce_int32_event(int32, int32)");
+		VM->SetFunctionDef("int64 reduce_int64_event(int64, int64)");
+		VM->SetFunctionDef("float reduce_float_event(float, float)");
+		VM->SetFunctionDef("double reduce_double_event(double, double)");
+		VM->SetFunction("void for_range(usize, usize, range_event@, usize = 0)", &Parallel::ForRange);
+		auto VJob = VM->SetClass<ParallelJob>("job", false);
+		VJob->SetMethod("bool join()", &ParallelJob::Join);
+		VJob->SetMethod("bool is_finished()", &ParallelJob::IsFinished);
+		VM->SetFunction("job@ spawn(job_event@)", &Parallel::Spawn);
+		VM->SetFunction("void sort(array<int8>@+)", &Parallel::Sort);
+		VM->SetFunction("void sort(array<int16>@+)", &Parallel::Sort);
+		VM->SetFunction("void sort(array<int32>@+)", &Parallel::Sort);
+		VM->SetFunction("void sort(array<int64>@+)", &Parallel::Sort);
+		VM->SetFunction("void sort(array<uint8>@+)", &Parallel::Sort);
+		VM->SetFunction("void sort(array<uint16>@+)", &Parallel::Sort);
+		VM->SetFunction("void sort(array<uint32>@+)", &Parallel::Sort);
+		VM->SetFunction("void sort(array<uint64>@+)", &Parallel::Sort);
+		VM->SetFunction("void sort(array<float>@+)", &Parallel::Sort);
+		VM->SetFunction("void sort(array<double>@+)", &Parallel::Sort);
+		VM->SetFunction("array<int32>@ map(array<int32>@+, map_int32_event@)", &Parallel::Map<int32_t>);
+		VM->SetFunction("array<int64>@ map(array<int64>@+, map_int64_event@)", &Parallel::Map<int64_t>);
+		VM->SetFunction("array<float>@ map(array<float>@+, map_float_event@)", &Parallel::Map<float>);
+		VM->SetFunction("array<double>@ map(array<double>@+, map_double_event@)", &Parallel::Map<double>);
+		VM->SetFunction("int32 reduce(array<int32>@+, reduce_int32_event@, int32 = 0)", &Parallel::Reduce<int32_t>);
+		VM->SetFunction("int64 reduce(array<int64>@+, reduce_int64_event@, int64 = 0)", &Parallel::Reduce<int64_t>);
+		VM->SetFunction("float reduce(array<float>@+, reduce_float_event@, float = 0)", &Parallel::Reduce<float>);
+		VM->SetFunction("double reduce(array<double>@+, reduce_double_event@, double = 0)", &Parallel::Reduce<double>);
+		VM->EndNamespace();
+	}
+	void Parallel::Cleanup()
+	{
+		Memory::Delete(Instance);
+	}
+	Parallel* Parallel::Get()
+	{
+		static std::mutex Initialization;
+		UMutex<std::mutex> Unique(Initialization);
+		if (!Instance)
+			Instance = Memory::New<Parallel>(std::max<size_t>(1, std::thread::hardware_concurrency()) - 1);
+		return Instance;
+	}
+	Execution Parallel::ExecuteCallback(asIScriptFunction* Callback, ArgsCallback&& OnArgs, ArgsCallback&& OnReturn)
+	{
+		auto* Context = ImmediateContext::Get();
+		if (Context != nullptr)
+		{
+			auto Status = Context->ExecuteSubcall(Callback, std::move(OnArgs), std::move(OnReturn));
+			return Status ? *Status : Execution::Aborted;
+		}
+
+		auto* VM = Function(Callback).GetVM();
+		auto* Next = VM->RequestContext();
+		auto Status = Next->ExecuteInlineCall(Function(Callback), std::move(OnArgs));
+		Execution Result = Status ? *Status : Execution::Aborted;
+		if (Result == Execution::Suspended)
+			Next->Abort();
+		else if (Result == Execution::Finished && OnReturn)
+			OnReturn(Next);
+		VM->ReturnContext(Next);
+		return Result;
+	}
+	void Parallel::ThrowCallback(Execution Status)
+	{
+		auto* Context = ImmediateContext::Get();
+		if (!Context)
+			return;
+
+		if (Status == Execution::Suspended)
+			Context->SetException("parallel callback cannot suspend: co_await is not allowed on worker threads");
+		else
+			Context->SetException("parallel callback has failed");
+	}
+	ParallelJob* Parallel::Spawn(asIScriptFunction* Callback)
+	{
+		if (!Callback)
+			return nullptr;
+
+		auto* Pool = Get();
+		ParallelJob* Job = new ParallelJob(Callback);
+		if (!Pool->GetThreads())
+		{
+			Job->Execute();
+			return Job;
+		}
+
+		Job->AddRef();
+		Pool->Enqueue([Job]()
+		{
+			Job->Execute();
+			Job->Release();
+		});
+		return Job;
+	}
+	void Parallel::ForRange(size_t Begin, size_t End, asIScriptFunction* Callback, size_t Grain)
+	{
+		if (!Callback)
+			return;
+
+		if (End > Begin)
+		{
+			std::atomic<Execution> Status(Execution::Finished);
+			Get()->Partition(End - Begin, Grain, [Begin, Callback, &Status](size_t From, size_t To)
+			{
+				Execution Result = ExecuteCallback(Callback, [Begin, From, To](ImmediateContext* Context)
+				{
+					Context->SetArg64(0, (int64_t)(Begin + From));
+					Context->SetArg64(1, (int64_t)(Begin + To));
+				});
+				if (Result == Execution::Finished)
+					return true;
+
+				Status = Result;
+				return false;
+			});
+
+			if (Status != Execution::Finished)
+				ThrowCallback(Status);
+		}
+
+		Function(Callback).Release();
+	}
+	void Parallel::Sort(Bindings::Array* Data)
+	{
+		if (!Data || Data->Size() < 2)
+			return;
+
+		auto* Pool = Get();
+		size_t Size = Data->Size();
+		void* Buffer = Data->GetBuffer();
+		switch ((TypeId)Data->GetElementTypeId())
+		{
+			case TypeId::INT8:
+				return SortBuffer(Pool, (int8_t*)Buffer, Size);
+			case TypeId::INT16:
+				return SortBuffer(Pool, (int16_t*)Buffer, Size);
+			case TypeId::INT32:
+				return SortBuffer(Pool, (int32_t*)Buffer, Size);
+			case TypeId::INT64:
+				return SortBuffer(Pool, (int64_t*)Buffer, Size);
+			case TypeId::UINT8:
+				return SortBuffer(Pool, (uint8_t*)Buffer, Size);
+			case TypeId::UINT16:
+				return SortBuffer(Pool, (uint16_t*)Buffer, Size);
+			case TypeId::UINT32:
+				return SortBuffer(Pool, (uint32_t*)Buffer, Size);
+			case TypeId::UINT64:
+				return SortBuffer(Pool, (uint64_t*)Buffer, Size);
+			case TypeId::FLOAT:
+				return SortBuffer(Pool, (float*)Buffer, Size);
+			case TypeId::DOUBLE:
+				return SortBuffer(Pool, (double*)Buffer, Size);
+			default:
+				break;
+		}
+	}
+	template <typename T>
+	Bindings::Array* Parallel::Map(Bindings::Array* Data, asIScriptFunction* Callback)
+	{
+		Bindings::Array* Result = nullptr;
+		if (Data != nullptr && Callback != nullptr)
+		{
+			size_t Size = Data->Size();
+			Result = Bindings::Array::Create(Data->GetArrayObjectType(), Size);
+			T* Input = (T*)Data->GetBuffer();
+			T* Output = (T*)Result->GetBuffer();
+			std::atomic<Execution> Status(Execution::Finished);
+			Get()->Partition(Size, 0, [Input, Output, Callback, &Status](size_t From, size_t To)
+			{
+				for (size_t i = From; i < To; i++)
+				{
+					Execution Next = ExecuteCallback(Callback, [Input, i](ImmediateContext* Context)
+					{
+						ParallelValue<T>::SetArg(Context, 0, Input[i]);
+					}, [Output, i](ImmediateContext* Context)
+					{
+						Output[i] = ParallelValue<T>::GetReturn(Context);
+					});
+					if (Next != Execution::Finished)
+					{
+						Status = Next;
+						return false;
+					}
+				}
+				return true;
+			});
+
+			if (Status != Execution::Finished)
+				ThrowCallback(Status);
+		}
+
+		if (Callback != nullptr)
+			Function(Callback).Release();
+		return Result;
+	}
+	template <typename T>
+	T Parallel::Reduce(Bindings::Array* Data, asIScriptFunction* Callback, T Initial)
+	{
+		T Result = Initial;
+		if (Data != nullptr && Callback != nullptr && Data->Size() > 0)
+		{
+			Vector<std::pair<size_t, T>> Partials;
+			std::atomic<Execution> Status(Execution::Finished);
+			std::mutex Mutex;
+			T* Input = (T*)Data->GetBuffer();
+			auto Combine = [Callback](T Left, T Right, T& Value)
+			{
+				return ExecuteCallback(Callback, [Left, Right](ImmediateContext* Context)
+				{
+					ParallelValue<T>::SetArg(Context, 0, Left);
+					ParallelValue<T>::SetArg(Context, 1, Right);
+				}, [&Value](ImmediateContext* Context)
+				{
+					Value = ParallelValue<T>::GetReturn(Context);
+				});
+			};
+			Get()->Partition(Data->Size(), 0, [Input, &Combine, &Partials, &Status, &Mutex](size_t From, size_t To)
+			{
+				T Value = Input[From];
+				for (size_t i = From + 1; i < To; i++)
+				{
+					Execution Next = Combine(Value, Input[i], Value);
+					if (Next != Execution::Finished)
+					{
+						Status = Next;
+						return false;
+					}
+				}
+
+				UMutex<std::mutex> Unique(Mutex);
+				Partials.emplace_back(From, Value);
+				return true;
+			});
+
+			std::sort(Partials.begin(), Partials.end(), [](const std::pair<size_t, T>& A, const std::pair<size_t, T>& B) { return A.first < B.first; });
+			for (auto& Next : Partials)
+			{
+				if (Status != Execution::Finished)
+					break;
+
+				Execution Combined = Combine(Result, Next.second, Result);
+				if (Combined != Execution::Finished)
+					Status = Combined;
+			}
+
+			if (Status != Execution::Finished)
+				ThrowCallback(Status);
+		}
+
+		if (Callback != nullptr)
+			Function(Callback).Release();
+		return Result;
+	}
+	Parallel* Parallel::Instance = nullptr;
+}
\ No newline at end of file
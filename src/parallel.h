@@ -0,0 +1,81 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+#include "runtime.hpp"
+#include <vengeance/vengeance.h>
+#define PARALLEL_GRAIN_FACTOR 64
+
+namespace ASX
+{
+	typedef std::function<void(size_t)> ChunkCallback;
+	typedef std::function<bool(size_t, size_t)> RangeCallback;
+
+	class ParallelBatch : public Reference<ParallelBatch>
+	{
+	public:
+		const ChunkCallback* Callback;
+		size_t Chunks;
+		std::atomic<size_t> Next;
+		std::atomic<size_t> Done;
+
+	public:
+		ParallelBatch(size_t NewChunks, const ChunkCallback* NewCallback);
+		void Execute();
+	};
+
+	class ParallelJob : public Reference<ParallelJob>
+	{
+	private:
+		std::mutex Mutex;
+		asIScriptFunction* Callback;
+		bool Finished;
+		bool Success;
+
+	public:
+		ParallelJob(asIScriptFunction* NewCallback);
+		~ParallelJob();
+		void Execute();
+		bool Join();
+		bool IsFinished();
+	};
+
+	class Parallel
+	{
+	private:
+		static Parallel* Instance;
+
+	private:
+		Vector<std::thread> Threads;
+		SingleQueue<std::function<void()>> Tasks;
+		std::condition_variable Condition;
+		std::mutex Mutex;
+		bool Active;
+
+	public:
+		Parallel(size_t Count);
+		~Parallel();
+		void Distribute(size_t Chunks, const ChunkCallback& Callback);
+		void Partition(size_t Count, size_t Grain, const RangeCallback& Callback);
+		void Await(const std::function<bool()>& Ready);
+		void Notify();
+		size_t GetThreads() const;
+
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+		static void Cleanup();
+		static Parallel* Get();
+		static Execution ExecuteCallback(asIScriptFunction* Callback, ArgsCallback&& OnArgs, ArgsCallback&& OnReturn = nullptr);
+
+	private:
+		void Enqueue(std::function<void()>&& Callback);
+		bool Dequeue(std::function<void()>& Callback);
+		static void ThrowCallback(Execution Status);
+		static ParallelJob* Spawn(asIScriptFunction* Callback);
+		static void ForRange(size_t Begin, size_t End, asIScriptFunction* Callback, size_t Grain);
+		static void Sort(Bindings::Array* Data);
+		template <typename T>
+		static Bindings::Array* Map(Bindings::Array* Data, asIScriptFunction* Callback);
+		template <typename T>
+		static T Reduce(Bindings::Array* Data, asIScriptFunction* Callback, T Initial);
+	};
+}
+#endif
\ No newline at end of file
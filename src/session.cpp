@@ -0,0 +1,209 @@
+#include "session.h"
+#include <angelscript.h>
+
+namespace ASX
+{
+	InteractiveSession::InteractiveSession(VirtualMachine* NewVM, Compiler* NewUnit, const String& NewPath) : VM(NewVM), Unit(NewUnit), Path(NewPath), Sections(0), Last(std::string::npos)
+	{
+	}
+	InteractiveSession::~InteractiveSession()
+	{
+		for (auto* Value : Results)
+			Value->Release();
+	}
+	void InteractiveSession::AddSection(const String& Name, const String& Code)
+	{
+		Declarations.emplace_back(Name, Code);
+	}
+	bool InteractiveSession::Use(const String& Name)
+	{
+		if (Addons.count(Name) > 0)
+			return true;
+
+		if (!VM->ImportSystemAddon(Name))
+			return false;
+
+		Addons.insert(Name);
+		return true;
+	}
+	bool InteractiveSession::Declare(const String& Code)
+	{
+		String Section = Path + ":" + ToString(++Sections);
+		Module Base = Unit->GetModule();
+		switch (GetDeclarationType(Code))
+		{
+			case DeclarationType::Function:
+				if (!Base.CompileFunction(Section, Code, 0, (size_t)asCOMP_ADD_TO_MODULE, nullptr))
+					return false;
+				break;
+			case DeclarationType::Variable:
+				if (!Base.CompileGlobalVar(Section, Code, 0))
+					return false;
+				break;
+			default:
+				Declarations.emplace_back(Section, Code);
+				if (Build())
+					return true;
+
+				Declarations.pop_back();
+				if (!Build())
+					VI_ERR("cannot restore previous declarations of interactive session");
+				return false;
+		}
+
+		Declarations.emplace_back(Section, Code);
+		return true;
+	}
+	Function InteractiveSession::Evaluate(const String& Code)
+	{
+		auto It = Snippets.find(Code);
+		if (It != Snippets.end())
+			return It->second;
+
+		auto Result = Unit->CompileFunction(Code, "any@").Get();
+		if (!Result)
+			return Function(nullptr);
+
+		if (Snippets.size() >= SESSION_SNIPPETS)
+			Snippets.clear();
+		Snippets[Code] = *Result;
+		return *Result;
+	}
+	size_t InteractiveSession::Keep(Bindings::Any* Value)
+	{
+		if (!Value)
+			return 0;
+
+		size_t Index = std::string::npos;
+		Value->AddRef();
+		Results.push_back(Value);
+		Assign("_" + ToString(Results.size()), Index, Value);
+		Assign("_", Last, Value);
+		return Results.size();
+	}
+	bool InteractiveSession::Build()
+	{
+		Snippets.clear();
+		Last = std::string::npos;
+		for (auto& Next : Declarations)
+		{
+			if (!Unit->LoadCode(Next.first, Next.second))
+				return false;
+		}
+
+		if (!Unit->Compile().Get())
+			return false;
+
+		for (size_t i = 0; i < Results.size(); i++)
+		{
+			size_t Index = std::string::npos;
+			Assign("_" + ToString(i + 1), Index, Results[i]);
+		}
+
+		if (!Results.empty())
+			Assign("_", Last, Results.back());
+		return true;
+	}
+	bool InteractiveSession::Assign(const String& Name, size_t& Index, Bindings::Any* Value)
+	{
+		Module Base = Unit->GetModule();
+		if (Index == std::string::npos)
+		{
+			size_t Count = Base.GetPropertiesCount();
+			if (!Base.CompileGlobalVar(Path + ":" + Name, "any@ " + Name + ";", 0))
+				return false;
+			Index = Count;
+		}
+
+		PropertyInfo Info;
+		if (!Base.GetProperty(Index, &Info) || !Info.Pointer || Name != Info.Name)
+		{
+			Index = std::string::npos;
+			return false;
+		}
+
+		Bindings::Any*& Slot = *(Bindings::Any**)Info.Pointer;
+		if (Slot != nullptr)
+			Slot->Release();
+		Value->AddRef();
+		Slot = Value;
+		return true;
+	}
+	DeclarationType InteractiveSession::GetDeclarationType(const std::string_view& Code)
+	{
+		static const char* Keywords[] = { "class", "interface", "enum", "namespace", "funcdef", "typedef", "shared", "abstract", "final", "mixin", "external", "import", "private", "protected" };
+		size_t Start = 0;
+		while (Start < Code.size() && isspace((uint8_t)Code[Start]))
+			++Start;
+
+		size_t End = Start;
+		while (End < Code.size() && (isalnum((uint8_t)Code[End]) || Code[End] == '_'))
+			++End;
+
+		std::string_view First = Code.substr(Start, End - Start);
+		for (auto* Keyword : Keywords)
+		{
+			if (First == Keyword)
+				return DeclarationType::Module;
+		}
+
+		size_t Depth = 0, Items = 0, Call = std::string::npos, Assignment = std::string::npos;
+		char Terminator = '\0';
+		for (size_t i = Start; i < Code.size(); i++)
+		{
+			char V = Code[i];
+			if (V == '#')
+				return DeclarationType::Module;
+			else if (V == '"' || V == '\'')
+			{
+				for (++i; i < Code.size() && Code[i] != V; i++)
+				{
+					if (Code[i] == '\\')
+						++i;
+				}
+			}
+			else if (V == '/' && i + 1 < Code.size() && Code[i + 1] == '/')
+			{
+				while (i < Code.size() && Code[i] != '\n')
+					++i;
+			}
+			else if (V == '/' && i + 1 < Code.size() && Code[i + 1] == '*')
+			{
+				size_t Close = Code.find("*/", i + 2);
+				i = Close == std::string::npos ? Code.size() : Close + 1;
+			}
+			else if (V == '(' || V == '[' || V == '{')
+			{
+				if (!Depth && V == '(' && Call == std::string::npos)
+					Call = i;
+				++Depth;
+			}
+			else if (V == ')' || V == ']' || V == '}')
+			{
+				if (!Depth)
+					return DeclarationType::Module;
+				else if (!--Depth && V == '}')
+				{
+					Terminator = V;
+					++Items;
+				}
+			}
+			else if (!Depth && V == '=' && Assignment == std::string::npos)
+				Assignment = i;
+			else if (!Depth && V == ';')
+			{
+				Terminator = V;
+				++Items;
+			}
+		}
+
+		if (Depth > 0 || Items != 1)
+			return DeclarationType::Module;
+		else if (Terminator == '}' && Call != std::string::npos && (Assignment == std::string::npos || Call < Assignment))
+			return DeclarationType::Function;
+		else if (Terminator == ';')
+			return DeclarationType::Variable;
+
+		return DeclarationType::Module;
+	}
+}
\ No newline at end of file
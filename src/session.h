@@ -0,0 +1,45 @@
+#ifndef SESSION_H
+#define SESSION_H
+#include "runtime.hpp"
+#include <vengeance/vengeance.h>
+#include <vengeance/bindings.h>
+#define SESSION_SNIPPETS 16384
+
+namespace ASX
+{
+	enum class DeclarationType
+	{
+		Function,
+		Variable,
+		Module
+	};
+
+	class InteractiveSession
+	{
+	private:
+		Vector<std::pair<String, String>> Declarations;
+		Vector<Bindings::Any*> Results;
+		UnorderedMap<String, Function> Snippets;
+		UnorderedSet<String> Addons;
+		VirtualMachine* VM;
+		Compiler* Unit;
+		String Path;
+		size_t Sections;
+		size_t Last;
+
+	public:
+		InteractiveSession(VirtualMachine* NewVM, Compiler* NewUnit, const String& NewPath);
+		~InteractiveSession();
+		void AddSection(const String& Name, const String& Code);
+		bool Use(const String& Name);
+		bool Declare(const String& Code);
+		Function Evaluate(const String& Code);
+		size_t Keep(Bindings::Any* Value);
+
+	private:
+		bool Build();
+		bool Assign(const String& Name, size_t& Index, Bindings::Any* Value);
+		static DeclarationType GetDeclarationType(const std::string_view& Code);
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,422 @@
+#include "shaker.h"
+#include <angelscript.h>
+
+namespace ASX
+{
+	TreeShaker::TreeShaker(VirtualMachine* NewVM) : VM(NewVM), FunctionsCount(0), RemovedCount(0), AddonsCount(0), CodeSize(0), Shaken(false)
+	{
+	}
+	bool TreeShaker::Shake(SystemConfig& Config, EnvironmentConfig& Env, const UnorderedMap<String, uint32_t>& Settings)
+	{
+		ByteCodeInfo Full;
+		Full.Debug = Config.Debug;
+		if (!Env.ThisCompiler->SaveByteCode(&Full))
+			return false;
+
+		for (auto& Item : VM->GetSystemAddons())
+		{
+			if (Item.second.Exposed)
+				++AddonsCount;
+		}
+
+		Compiler* Unit = VM->CreateCompiler();
+		ByteCodeInfo Info = Full;
+		bool Success = Unit->Prepare(String(Env.Module) + ".shake") && Unit->LoadByteCode(&Info).Get() && Analyze(Env, Unit);
+		if (Success)
+		{
+			RemovedCount = Strip(Unit);
+			Code.Debug = Config.Debug;
+			if (!Unit->SaveByteCode(&Code))
+				Success = false;
+		}
+
+		Memory::Release(Unit);
+		if (!Success)
+			return false;
+
+		CodeSize = Full.Data.size();
+		Vector<String> Roots = GetRoots();
+		if (Verify(Config, Env, Settings, Code, Roots))
+		{
+			Shaken = true;
+			return true;
+		}
+
+		VI_DEBUG("stripped bytecode of <%s> cannot be loaded: keeping all script functions", Env.Module);
+		if (!Verify(Config, Env, Settings, Full, Roots))
+			return false;
+
+		Code = std::move(Full);
+		RemovedCount = 0;
+		Shaken = true;
+		return true;
+	}
+	bool TreeShaker::IsReferenced(const std::string_view& Declaration) const
+	{
+		asIScriptFunction* Target = VM->GetEngine()->GetGlobalFunctionByDecl(String(Declaration).c_str());
+		return Target != nullptr && Functions.count(Target) > 0;
+	}
+	bool TreeShaker::IsShaken() const
+	{
+		return Shaken;
+	}
+	const ByteCodeInfo& TreeShaker::GetByteCode() const
+	{
+		return Code;
+	}
+	const Vector<String>& TreeShaker::GetAddons() const
+	{
+		return Addons;
+	}
+	String TreeShaker::GetReport() const
+	{
+		return Stringify::Text("functions: %" PRIu64 " of %" PRIu64 " kept, bytecode: %" PRIu64 " of %" PRIu64 " bytes, addons: %" PRIu64 " of %" PRIu64 " kept",
+			(uint64_t)(FunctionsCount - RemovedCount), (uint64_t)FunctionsCount,
+			(uint64_t)Code.Data.size(), (uint64_t)CodeSize,
+			(uint64_t)Addons.size(), (uint64_t)AddonsCount);
+	}
+	bool TreeShaker::Analyze(EnvironmentConfig& Env, Compiler* Unit)
+	{
+		ProgramEntrypoint Entrypoint;
+		Function Main = Runtime::GetEntrypoint(Env, Entrypoint, Unit, true);
+		if (!Main.IsValid())
+			return false;
+
+		asIScriptEngine* Engine = VM->GetEngine();
+		for (asUINT i = 0; i < Engine->GetGlobalPropertyCount(); i++)
+		{
+			const char* Name = nullptr, *Namespace = nullptr;
+			void* Pointer = nullptr;
+			if (Engine->GetGlobalPropertyByIndex(i, &Name, &Namespace, nullptr, nullptr, nullptr, &Pointer) >= 0 && Pointer != nullptr)
+				Properties[Pointer] = GetPropertyKey(Namespace, Name);
+		}
+
+		asIScriptModule* Base = Unit->GetModule().GetModule();
+		for (asUINT i = 0; i < Base->GetGlobalVarCount(); i++)
+			Globals.insert(Base->GetAddressOfGlobalVar(i));
+
+		VisitFunction(Main.GetFunction());
+		for (asUINT i = 0; i < Base->GetObjectTypeCount(); i++)
+			VisitType(Base->GetObjectTypeByIndex(i));
+		for (asUINT i = 0; i < Base->GetEnumCount(); i++)
+			VisitType(Base->GetEnumByIndex(i));
+		for (asUINT i = 0; i < Base->GetFuncdefCount(); i++)
+			VisitType(Base->GetFuncdefByIndex(i));
+		for (asUINT i = 0; i < Base->GetGlobalVarCount(); i++)
+		{
+			int TypeId = 0;
+			if (Base->GetGlobalVar(i, nullptr, nullptr, &TypeId) >= 0)
+				VisitTypeId(TypeId);
+		}
+
+		size_t Count = 0;
+		do
+		{
+			Count = Functions.size();
+			for (asUINT i = 0; i < Base->GetFunctionCount(); i++)
+			{
+				asIScriptFunction* Target = Base->GetFunctionByIndex(i);
+				if (Functions.count(Target) == 0 && IsNamed(Target))
+					VisitFunction(Target);
+			}
+		} while (Count != Functions.size());
+		return true;
+	}
+	bool TreeShaker::Verify(SystemConfig& Config, EnvironmentConfig& Env, const UnorderedMap<String, uint32_t>& Settings, const ByteCodeInfo& Info, const Vector<String>& Roots)
+	{
+		SystemConfig Target = Config;
+		Target.SystemAddons = Roots;
+		for (auto It = Target.Functions.begin(); It != Target.Functions.end();)
+		{
+			if (!IsReferenced(It->second.second))
+				It = Target.Functions.erase(It);
+			else
+				++It;
+		}
+
+		EnvironmentConfig Sandbox = Env;
+		VirtualMachine* Checker = new VirtualMachine();
+		Bindings::HeavyRegistry().BindAddons(Checker);
+		Compiler* Unit = Checker->CreateCompiler();
+		for (auto& Item : Settings)
+			Checker->SetProperty((Features)Item.second, VM->GetProperty((Features)Item.second));
+
+		ByteCodeInfo Copy = Info;
+		bool Success = Runtime::ConfigureContext(Target, Sandbox, Checker, Unit) && Unit->Prepare(Env.Module) && Unit->LoadByteCode(&Copy).Get();
+		if (Success)
+		{
+			Addons.clear();
+			for (auto& Item : Checker->GetSystemAddons())
+			{
+				if (Item.second.Exposed)
+					Addons.push_back(Item.first);
+			}
+		}
+
+		Memory::Release(Unit);
+		Memory::Release(Checker);
+		return Success;
+	}
+	size_t TreeShaker::Strip(Compiler* Unit)
+	{
+		Vector<asIScriptFunction*> Unused;
+		asIScriptModule* Base = Unit->GetModule().GetModule();
+		FunctionsCount = Base->GetFunctionCount();
+		for (asUINT i = 0; i < Base->GetFunctionCount(); i++)
+		{
+			asIScriptFunction* Target = Base->GetFunctionByIndex(i);
+			if (Functions.count(Target) == 0)
+				Unused.push_back(Target);
+		}
+
+		for (auto* Target : Unused)
+			Base->RemoveFunction(Target);
+		return Unused.size();
+	}
+	void TreeShaker::VisitFunction(asIScriptFunction* Target)
+	{
+		if (!Target || !Functions.insert(Target).second)
+			return;
+
+		VisitTypeId(Target->GetReturnTypeId());
+		for (asUINT i = 0; i < Target->GetParamCount(); i++)
+		{
+			int TypeId = 0;
+			if (Target->GetParam(i, &TypeId) >= 0)
+				VisitTypeId(TypeId);
+		}
+
+		switch (Target->GetFuncType())
+		{
+			case asFUNC_SYSTEM:
+				if (Target->GetObjectType() != nullptr)
+					VisitType(Target->GetObjectType());
+				else
+					Symbols.insert(GetFunctionKey(Target));
+				return;
+			case asFUNC_DELEGATE:
+				VisitType(Target->GetDelegateObjectType());
+				VisitFunction(Target->GetDelegateFunction());
+				return;
+			case asFUNC_SCRIPT:
+				break;
+			default:
+				VisitType(Target->GetObjectType());
+				return;
+		}
+
+		VisitType(Target->GetObjectType());
+		for (asUINT i = 0; i < Target->GetVarCount(); i++)
+		{
+			int TypeId = 0;
+			if (Target->GetVar(i, nullptr, &TypeId) >= 0)
+				VisitTypeId(TypeId);
+		}
+
+		asUINT Length = 0;
+		asDWORD* ByteCode = Target->GetByteCode(&Length);
+		asIScriptEngine* Engine = VM->GetEngine();
+		for (asUINT Offset = 0; ByteCode != nullptr && Offset < Length;)
+		{
+			asDWORD* Next = ByteCode + Offset;
+			asEBCInstr Instruction = (asEBCInstr)*(asBYTE*)Next;
+			switch (Instruction)
+			{
+				case asBC_CALL:
+				case asBC_CALLSYS:
+				case asBC_CALLINTF:
+				case asBC_Thiscall1:
+					VisitFunction(Engine->GetFunctionById(asBC_INTARG(Next)));
+					break;
+				case asBC_ALLOC:
+					VisitType((asITypeInfo*)asBC_PTRARG(Next));
+					if (asBC_INTARG(Next + AS_PTR_SIZE) != 0)
+						VisitFunction(Engine->GetFunctionById(asBC_INTARG(Next + AS_PTR_SIZE)));
+					break;
+				case asBC_FuncPtr:
+					VisitFunction((asIScriptFunction*)asBC_PTRARG(Next));
+					break;
+				case asBC_OBJTYPE:
+				case asBC_REFCPY:
+				case asBC_RefCpyV:
+				case asBC_FREE:
+					VisitType((asITypeInfo*)asBC_PTRARG(Next));
+					break;
+				case asBC_TYPEID:
+				case asBC_Cast:
+					VisitTypeId(asBC_INTARG(Next));
+					break;
+				case asBC_PGA:
+				case asBC_PshGPtr:
+				case asBC_LDG:
+				case asBC_PshG4:
+				case asBC_SetG4:
+				case asBC_LdGRdR4:
+				case asBC_CpyVtoG4:
+				case asBC_CpyGtoV4:
+				{
+					void* Pointer = (void*)asBC_PTRARG(Next);
+					auto It = Properties.find(Pointer);
+					if (It != Properties.end())
+						Symbols.insert(It->second);
+					else if (Instruction == asBC_PGA && Globals.count(Pointer) == 0)
+						VisitConstant(Pointer);
+					break;
+				}
+				default:
+					break;
+			}
+
+			asUINT Size = (asUINT)asBCTypeSize[asBCInfo[Instruction].type];
+			if (!Size)
+				break;
+
+			Offset += Size;
+		}
+	}
+	void TreeShaker::VisitType(asITypeInfo* Type)
+	{
+		if (!Type || !Types.insert(Type).second)
+			return;
+
+		Symbols.insert(GetTypeKey(Type));
+		for (asUINT i = 0; i < Type->GetSubTypeCount(); i++)
+			VisitType(Type->GetSubType(i));
+		for (asUINT i = 0; i < Type->GetInterfaceCount(); i++)
+			VisitType(Type->GetInterface(i));
+
+		VisitType(Type->GetBaseType());
+		asIScriptFunction* Signature = Type->GetFuncdefSignature();
+		if (Signature != nullptr)
+		{
+			VisitTypeId(Signature->GetReturnTypeId());
+			for (asUINT i = 0; i < Signature->GetParamCount(); i++)
+			{
+				int TypeId = 0;
+				if (Signature->GetParam(i, &TypeId) >= 0)
+					VisitTypeId(TypeId);
+			}
+		}
+
+		if (!(Type->GetFlags() & asOBJ_SCRIPT_OBJECT))
+			return;
+
+		for (asUINT i = 0; i < Type->GetPropertyCount(); i++)
+		{
+			int TypeId = 0;
+			if (Type->GetProperty(i, nullptr, &TypeId) >= 0)
+				VisitTypeId(TypeId);
+		}
+		for (asUINT i = 0; i < Type->GetFactoryCount(); i++)
+			VisitFunction(Type->GetFactoryByIndex(i));
+		for (asUINT i = 0; i < Type->GetBehaviourCount(); i++)
+			VisitFunction(Type->GetBehaviourByIndex(i, nullptr));
+		for (asUINT i = 0; i < Type->GetMethodCount(); i++)
+			VisitFunction(Type->GetMethodByIndex(i, false));
+	}
+	void TreeShaker::VisitTypeId(int Id)
+	{
+		if (Id > (int)TypeId::DOUBLE)
+			VisitType(VM->GetEngine()->GetTypeInfoById(Id));
+	}
+	void TreeShaker::VisitConstant(void* Pointer)
+	{
+		asIStringFactory* Factory = VM->GetEngine()->GetStringFactory();
+		asUINT Length = 0;
+		if (!Factory || Factory->GetRawStringData(Pointer, nullptr, &Length) < 0)
+			return;
+
+		String Data(Length, '\0');
+		if (Factory->GetRawStringData(Pointer, (char*)Data.data(), &Length) >= 0)
+			Constants.insert(std::move(Data));
+	}
+	bool TreeShaker::IsNamed(asIScriptFunction* Target) const
+	{
+		if (Constants.empty())
+			return false;
+
+		return Constants.count(Target->GetName()) > 0 || Constants.count(Target->GetDeclaration(true, false, false)) > 0 || Constants.count(Target->GetDeclaration(true, true, false)) > 0;
+	}
+	Vector<String> TreeShaker::GetRoots()
+	{
+		UnorderedMap<String, String> Owners;
+		UnorderedSet<String> Imported;
+		VirtualMachine* Registry = new VirtualMachine();
+		Bindings::HeavyRegistry().BindAddons(Registry);
+		for (auto& Item : VM->GetSystemAddons())
+		{
+			if (Item.second.Exposed)
+				Attribute(Registry, Item.first, Imported, Owners);
+		}
+		Memory::Release(Registry);
+
+		UnorderedSet<String> Names;
+		for (auto& Symbol : Symbols)
+		{
+			auto It = Owners.find(Symbol);
+			if (It != Owners.end())
+				Names.insert(It->second);
+		}
+
+		return Vector<String>(Names.begin(), Names.end());
+	}
+	void TreeShaker::Attribute(VirtualMachine* Registry, const String& Name, UnorderedSet<String>& Imported, UnorderedMap<String, String>& Owners)
+	{
+		if (!Imported.insert(Name).second)
+			return;
+
+		auto& Addons = Registry->GetSystemAddons();
+		auto It = Addons.find(Name);
+		if (It == Addons.end())
+			return;
+
+		for (auto& Dependency : It->second.Dependencies)
+			Attribute(Registry, Dependency, Imported, Owners);
+
+		asIScriptEngine* Engine = Registry->GetEngine();
+		asUINT Functions = Engine->GetGlobalFunctionCount();
+		asUINT ObjectTypes = Engine->GetObjectTypeCount();
+		asUINT Enums = Engine->GetEnumCount();
+		asUINT Funcdefs = Engine->GetFuncdefCount();
+		asUINT Typedefs = Engine->GetTypedefCount();
+		asUINT Properties = Engine->GetGlobalPropertyCount();
+		if (!Registry->ImportSystemAddon(Name))
+			return;
+
+		for (asUINT i = Functions; i < Engine->GetGlobalFunctionCount(); i++)
+			Owners[GetFunctionKey(Engine->GetGlobalFunctionByIndex(i))] = Name;
+		for (asUINT i = ObjectTypes; i < Engine->GetObjectTypeCount(); i++)
+			Owners[GetTypeKey(Engine->GetObjectTypeByIndex(i))] = Name;
+		for (asUINT i = Enums; i < Engine->GetEnumCount(); i++)
+			Owners[GetTypeKey(Engine->GetEnumByIndex(i))] = Name;
+		for (asUINT i = Funcdefs; i < Engine->GetFuncdefCount(); i++)
+			Owners[GetTypeKey(Engine->GetFuncdefByIndex(i))] = Name;
+		for (asUINT i = Typedefs; i < Engine->GetTypedefCount(); i++)
+			Owners[GetTypeKey(Engine->GetTypedefByIndex(i))] = Name;
+		for (asUINT i = Properties; i < Engine->GetGlobalPropertyCount(); i++)
+		{
+			const char* Property = nullptr, *Namespace = nullptr;
+			if (Engine->GetGlobalPropertyByIndex(i, &Property, &Namespace) >= 0)
+				Owners[GetPropertyKey(Namespace, Property)] = Name;
+		}
+	}
+	String TreeShaker::GetFunctionKey(asIScriptFunction* Target)
+	{
+		if (Target->GetObjectType() != nullptr)
+			return GetTypeKey(Target->GetObjectType());
+
+		return "function:" + String(Target->GetDeclaration(true, true, false));
+	}
+	String TreeShaker::GetTypeKey(asITypeInfo* Type)
+	{
+		while (Type->GetParentType() != nullptr)
+			Type = Type->GetParentType();
+
+		const char* Namespace = Type->GetNamespace();
+		return "type:" + String(Namespace ? Namespace : "") + "::" + String(Type->GetName());
+	}
+	String TreeShaker::GetPropertyKey(const char* Namespace, const char* Name)
+	{
+		return "property:" + String(Namespace ? Namespace : "") + "::" + String(Name ? Name : "");
+	}
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#ifndef SHAKER_H
+#define SHAKER_H
+#include "runtime.hpp"
+#include <vengeance/vengeance.h>
+#include <vengeance/bindings.h>
+
+namespace ASX
+{
+	class TreeShaker
+	{
+	private:
+		UnorderedMap<void*, String> Properties;
+		UnorderedSet<asIScriptFunction*> Functions;
+		UnorderedSet<asITypeInfo*> Types;
+		UnorderedSet<String> Symbols;
+		UnorderedSet<String> Constants;
+		UnorderedSet<void*> Globals;
+		Vector<String> Addons;
+		ByteCodeInfo Code;
+		VirtualMachine* VM;
+		size_t FunctionsCount;
+		size_t RemovedCount;
+		size_t AddonsCount;
+		size_t CodeSize;
+		bool Shaken;
+
+	public:
+		TreeShaker(VirtualMachine* NewVM);
+		bool Shake(SystemConfig& Config, EnvironmentConfig& Env, const UnorderedMap<String, uint32_t>& Settings);
+		bool IsReferenced(const std::string_view& Declaration) const;
+		bool IsShaken() const;
+		const ByteCodeInfo& GetByteCode() const;
+		const Vector<String>& GetAddons() const;
+		String GetReport() const;
+
+	private:
+		bool Analyze(EnvironmentConfig& Env, Compiler* Unit);
+		bool Verify(SystemConfig& Config, EnvironmentConfig& Env, const UnorderedMap<String, uint32_t>& Settings, const ByteCodeInfo& Info, const Vector<String>& Roots);
+		size_t Strip(Compiler* Unit);
+		void VisitFunction(asIScriptFunction* Target);
+		void VisitType(asITypeInfo* Type);
+		void VisitTypeId(int Id);
+		void VisitConstant(void* Pointer);
+		bool IsNamed(asIScriptFunction* Target) const;
+		Vector<String> GetRoots();
+		static void Attribute(VirtualMachine* Registry, const String& Name, UnorderedSet<String>& Imported, UnorderedMap<String, String>& Owners);
+		static String GetFunctionKey(asIScriptFunction* Target);
+		static String GetTypeKey(asITypeInfo* Type);
+		static String GetPropertyKey(const char* Namespace, const char* Name);
+	};
+}
+#endif
\ No newline at end of file
@@ -0,0 +1,356 @@
+#include "sources.h"
+
+namespace ASX
+{
+	static bool IsSourceIdentifier(char V)
+	{
+		return (V >= 'a' && V <= 'z') || (V >= 'A' && V <= 'Z') || (V >= '0' && V <= '9') || V == '_' || (uint8_t)V > 127;
+	}
+	static std::string_view GetSourceWord(std::string_view& Line)
+	{
+		while (!Line.empty() && (Line.front() == ' ' || Line.front() == '\t'))
+			Line.remove_prefix(1);
+
+		size_t Size = 0;
+		while (Size < Line.size() && IsSourceIdentifier(Line[Size]))
+			++Size;
+
+		std::string_view Word = Line.substr(0, Size);
+		Line.remove_prefix(Size);
+		return Word;
+	}
+	static std::string_view GetSourceQuote(std::string_view& Line)
+	{
+		while (!Line.empty() && (Line.front() == ' ' || Line.front() == '\t'))
+			Line.remove_prefix(1);
+		if (Line.empty() || (Line.front() != '"' && Line.front() != '\''))
+			return std::string_view();
+
+		size_t Quote = Line.find(Line.front(), 1);
+		return Quote != std::string::npos && Quote > 1 ? Line.substr(1, Quote - 1) : std::string_view();
+	}
+
+	SourceCache::SourceCache() : Processor(nullptr), Fingerprint(0), Hits(0), Misses(0), Verbatims(0), Verbatim(false), Modified(false)
+	{
+	}
+	void SourceCache::SetVerbatim(bool Enabled)
+	{
+		Verbatim = Enabled;
+	}
+	void SourceCache::SetProcessor(Preprocessor* Base)
+	{
+		Processor = Base;
+	}
+	void SourceCache::Load(const String& Path)
+	{
+		auto Data = OS::File::ReadAsString(Path);
+		if (!Data)
+			return;
+
+		std::string_view Text = *Data;
+		while (!Text.empty())
+		{
+			size_t End = Text.find('\n');
+			std::string_view Line = Text.substr(0, End);
+			Text = End == std::string::npos ? std::string_view() : Text.substr(End + 1);
+
+			size_t First = Line.find(' ');
+			size_t Second = First == std::string::npos ? First : Line.find(' ', First + 1);
+			size_t Third = Second == std::string::npos ? Second : Line.find(' ', Second + 1);
+			if (Third == std::string::npos || Third + 1 >= Line.size())
+				continue;
+
+			auto Hash = FromString<uint64_t>(Line.substr(0, First));
+			auto Definitions = FromString<uint64_t>(Line.substr(First + 1, Second - First - 1));
+			if (!Hash || !Definitions)
+				continue;
+
+			SourceEntry& Entry = Entries[String(Line.substr(Third + 1))];
+			Entry.Hash = *Hash;
+			Entry.Definitions = *Definitions;
+			Entry.Verbatim = Line.substr(Second + 1, Third - Second - 1) == "1";
+		}
+	}
+	void SourceCache::Save(const String& Path)
+	{
+		if (!Modified)
+			return;
+
+		String Data;
+		for (auto& Next : Entries)
+		{
+			Data += ToString(Next.second.Hash);
+			Data += ' ';
+			Data += ToString(Next.second.Definitions);
+			Data += Next.second.Verbatim ? " 1 " : " 0 ";
+			Data += Next.first;
+			Data += '\n';
+		}
+
+		if (OS::File::Write(Path, (uint8_t*)Data.data(), Data.size()))
+			Modified = false;
+		else
+			VI_WARN("cannot save preprocessor cache to <%s>", Path.c_str());
+	}
+	void SourceCache::AddSource(const std::string_view& Data)
+	{
+		if (!Verbatim)
+			return;
+
+		SourceFile File;
+		ScanSource(File, Data);
+		AddDefinitions(File.Defines);
+	}
+	void SourceCache::Prefetch(const String& Path, const std::string_view& Data)
+	{
+		UnorderedSet<String> Visited = { Path };
+		Vector<SourceFile> Wave(1);
+		Wave.front().Path = Path;
+		ScanSource(Wave.front(), Data);
+		ResolveSource(Wave.front());
+		if (Verbatim)
+			AddDefinitions(Wave.front().Defines);
+
+		while (!Wave.empty())
+		{
+			Vector<SourceFile> Next;
+			for (auto& File : Wave)
+			{
+
+				for (auto& Name : File.Addons)
+				{
+					if (Visited.insert(Name).second)
+						Addons.push_back(Name);
+				}
+
+				for (auto& Include : File.Includes)
+				{
+					if (!Visited.insert(Include).second)
+						continue;
+
+					Next.emplace_back();
+					Next.back().Path = Include;
+				}
+
+				if (File.Exists)
+				{
+					File.Includes.clear();
+					File.Addons.clear();
+					File.Names.clear();
+					Prefetched[File.Path] = std::move(File);
+				}
+			}
+
+			if (Next.size() > 1)
+				Parallel::Get()->Distribute(Next.size(), [&Next](size_t Index) { ReadSource(Next[Index]); });
+			else if (!Next.empty())
+				ReadSource(Next.front());
+			Wave = std::move(Next);
+		}
+	}
+	IncludeType SourceCache::Resolve(const String& Path, String& Output)
+	{
+		if (Served.count(Path) > 0)
+		{
+			Output.clear();
+			return IncludeType::Virtual;
+		}
+
+		SourceFile File;
+		auto It = Prefetched.find(Path);
+		if (It != Prefetched.end())
+		{
+			File = std::move(It->second);
+			Prefetched.erase(It);
+		}
+		else
+		{
+			auto Data = OS::File::ReadAsString(Path);
+			if (!Data)
+				return IncludeType::Unchanged;
+
+			File.Path = Path;
+			File.Data = std::move(*Data);
+			File.Hash = GetHash(File.Data);
+			if (Verbatim)
+				ScanSource(File, File.Data);
+		}
+
+		Dependencies[Path] = File.Hash;
+		if (!Verbatim)
+		{
+			Output = std::move(File.Data);
+			return IncludeType::Preprocess;
+		}
+
+		SourceEntry& Entry = Entries[Path];
+		if (Entry.Hash == File.Hash && Entry.Definitions == Fingerprint)
+			++Hits;
+		else
+		{
+			Entry.Hash = File.Hash;
+			Entry.Definitions = Fingerprint;
+			Entry.Verbatim = !File.Directives && IsVerbatim(File.Data);
+			Modified = true;
+			++Misses;
+		}
+
+		Output = std::move(File.Data);
+		if (!Entry.Verbatim)
+		{
+			AddDefinitions(File.Defines);
+			return IncludeType::Preprocess;
+		}
+
+		++Verbatims;
+		Served.insert(Path);
+		return IncludeType::Virtual;
+	}
+	size_t SourceCache::GetHits() const
+	{
+		return Hits;
+	}
+	size_t SourceCache::GetMisses() const
+	{
+		return Misses;
+	}
+	size_t SourceCache::GetVerbatims() const
+	{
+		return Verbatims;
+	}
+	const Vector<String>& SourceCache::GetAddons() const
+	{
+		return Addons;
+	}
+	const UnorderedMap<String, uint64_t>& SourceCache::GetDependencies() const
+	{
+		return Dependencies;
+	}
+	uint64_t SourceCache::GetHash(const std::string_view& Data)
+	{
+		uint64_t Hash = 14695981039346656037ull;
+		for (char V : Data)
+		{
+			Hash ^= (uint8_t)V;
+			Hash *= 1099511628211ull;
+		}
+		return Hash;
+	}
+	bool SourceCache::IsVerbatim(const std::string_view& Data)
+	{
+		size_t Offset = 0;
+		while (Offset < Data.size())
+		{
+			char V = Data[Offset];
+			if (V == '#')
+				return false;
+			else if (!IsSourceIdentifier(V))
+			{
+				++Offset;
+				continue;
+			}
+
+			size_t Start = Offset;
+			while (Offset < Data.size() && IsSourceIdentifier(Data[Offset]))
+				++Offset;
+			if (V >= '0' && V <= '9')
+				continue;
+
+			std::string_view Name = Data.substr(Start, Offset - Start);
+			if (Name == "import" || (!Definitions.empty() && Definitions.count(String(Name)) > 0))
+				return false;
+			else if (Processor != nullptr && Processor->IsDefined(Name))
+				return false;
+		}
+
+		return true;
+	}
+	void SourceCache::AddDefinitions(const Vector<String>& Names)
+	{
+		for (auto& Name : Names)
+		{
+			if (Definitions.insert(Name).second)
+				Fingerprint += GetHash(Name);
+		}
+	}
+	void SourceCache::ReadSource(SourceFile& File)
+	{
+		auto Data = OS::File::ReadAsString(File.Path);
+		if (!Data)
+			return;
+
+		File.Data = std::move(*Data);
+		File.Hash = GetHash(File.Data);
+		File.Exists = true;
+		ScanSource(File, File.Data);
+		ResolveSource(File);
+	}
+	void SourceCache::ScanSource(SourceFile& File, const std::string_view& Data)
+	{
+		size_t Offset = 0;
+		while (Offset < Data.size())
+		{
+			size_t End = Data.find('\n', Offset);
+			if (End == std::string::npos)
+				End = Data.size();
+
+			std::string_view Line = Data.substr(Offset, End - Offset);
+			Offset = End + 1;
+			while (!Line.empty() && (Line.front() == ' ' || Line.front() == '\t'))
+				Line.remove_prefix(1);
+
+			if (!Line.empty() && Line.front() == '#')
+			{
+				File.Directives = true;
+				Line.remove_prefix(1);
+				std::string_view Directive = GetSourceWord(Line);
+				if (Directive == "define")
+				{
+					std::string_view Name = GetSourceWord(Line);
+					if (!Name.empty())
+						File.Defines.emplace_back(Name);
+					continue;
+				}
+				else if (Directive != "include")
+					continue;
+			}
+			else if (GetSourceWord(Line) == "import")
+			{
+				File.Directives = true;
+				if (GetSourceWord(Line) != "from")
+					continue;
+			}
+			else
+				continue;
+
+			std::string_view Name = GetSourceQuote(Line);
+			if (!Name.empty())
+				File.Names.emplace_back(Name);
+		}
+	}
+	void SourceCache::ResolveSource(SourceFile& File)
+	{
+		String Directory = OS::Path::GetDirectory(File.Path.c_str());
+		for (auto& Name : File.Names)
+		{
+			if (Name.front() == '@')
+			{
+				File.Addons.push_back(std::move(Name));
+				continue;
+			}
+			else if (Name.find("://") != std::string::npos)
+				continue;
+
+			for (auto& Candidate : { Name, Name + ".as" })
+			{
+				FileEntry Entry;
+				auto Target = OS::Path::Resolve(Candidate, Directory, true);
+				if (Target && OS::File::GetState(*Target, &Entry) && !Entry.IsDirectory)
+				{
+					File.Includes.push_back(*Target);
+					break;
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#ifndef SOURCES_H
+#define SOURCES_H
+#include "runtime.hpp"
+#include "parallel.h"
+#include <vengeance/vengeance.h>
+#define SOURCES_FILE ".sources"
+
+namespace ASX
+{
+	struct SourceEntry
+	{
+		uint64_t Hash = 0;
+		uint64_t Definitions = 0;
+		bool Verbatim = false;
+	};
+
+	struct SourceFile
+	{
+		Vector<String> Includes;
+		Vector<String> Addons;
+		Vector<String> Names;
+		Vector<String> Defines;
+		String Path;
+		String Data;
+		uint64_t Hash = 0;
+		bool Directives = false;
+		bool Exists = false;
+	};
+
+	class SourceCache
+	{
+	private:
+		UnorderedMap<String, SourceFile> Prefetched;
+		UnorderedMap<String, SourceEntry> Entries;
+		UnorderedMap<String, uint64_t> Dependencies;
+		UnorderedSet<String> Definitions;
+		UnorderedSet<String> Served;
+		Vector<String> Addons;
+		Preprocessor* Processor;
+		uint64_t Fingerprint;
+		size_t Hits;
+		size_t Misses;
+		size_t Verbatims;
+		bool Verbatim;
+		bool Modified;
+
+	public:
+		SourceCache();
+		void SetVerbatim(bool Enabled);
+		void SetProcessor(Preprocessor* Base);
+		void Load(const String& Path);
+		void Save(const String& Path);
+		void AddSource(const std::string_view& Data);
+		void Prefetch(const String& Path, const std::string_view& Data);
+		IncludeType Resolve(const String& Path, String& Output);
+		size_t GetHits() const;
+		size_t GetMisses() const;
+		size_t GetVerbatims() const;
+		const Vector<String>& GetAddons() const;
+		const UnorderedMap<String, uint64_t>& GetDependencies() const;
+
+	public:
+		static uint64_t GetHash(const std::string_view& Data);
+
+	private:
+		bool IsVerbatim(const std::string_view& Data);
+		void AddDefinitions(const Vector<String>& Names);
+		static void ReadSource(SourceFile& File);
+		static void ScanSource(SourceFile& File, const std::string_view& Data);
+		static void ResolveSource(SourceFile& File);
+	};
+}
+#endif
\ No newline at end of file
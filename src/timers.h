@@ -0,0 +1,83 @@
+#ifndef TIMERS_H
+#define TIMERS_H
+#include "runtime.hpp"
+#include <vengeance/vengeance.h>
+#define TIMERS_LEVELS 6
+#define TIMERS_SLOTS 64
+#define TIMERS_BITS 6
+#define TIMERS_NONE 0xffffffff
+
+namespace ASX
+{
+	class TimerWheel
+	{
+	private:
+		struct Node
+		{
+			FunctionDelegate Callback;
+			EventLoop* Loop = nullptr;
+			uint64_t Deadline = 0;
+			uint32_t Prev = TIMERS_NONE;
+			uint32_t Next = TIMERS_NONE;
+			uint32_t Generation = 0;
+			uint8_t Level = 0;
+			uint8_t Slot = 0;
+			bool Active = false;
+		};
+
+		struct Expiry
+		{
+			FunctionDelegate Callback;
+			EventLoop* Loop;
+		};
+
+	private:
+		static TimerWheel* Instance;
+
+	private:
+		Vector<Node> Nodes;
+		Vector<Expiry> Expired;
+		uint32_t Slots[TIMERS_LEVELS][TIMERS_SLOTS];
+		uint64_t Occupied[TIMERS_LEVELS];
+		std::chrono::steady_clock::time_point Epoch;
+		std::mutex Mutex;
+		uint64_t Elapsed;
+		uint64_t Slack;
+		uint32_t Free;
+		size_t Pending;
+
+	public:
+		TimerWheel();
+		~TimerWheel();
+		uint64_t SetTimeout(uint64_t Timeout, FunctionDelegate&& Callback, EventLoop* Loop);
+		bool ClearTimeout(uint64_t Id);
+		size_t Cancel(EventLoop* Loop);
+		uint64_t Update(uint64_t Timeout);
+		void SetSlack(uint64_t Milliseconds);
+		uint64_t GetSlack();
+		size_t GetPending();
+		size_t GetMemoryUsage();
+
+	public:
+		static void BindSyntax(VirtualMachine* VM);
+		static void Cleanup();
+		static bool HasInstance();
+		static TimerWheel* Get();
+
+	private:
+		void Insert(uint32_t Index);
+		void Unlink(uint32_t Index);
+		void Cascade(uint8_t Level, uint8_t Slot);
+		void Expire(uint8_t Slot);
+		void Advance(uint64_t Tick);
+		uint64_t GetNextTick();
+		uint64_t GetTime();
+		static uint64_t ScriptSetTimeout(uint64_t Timeout, asIScriptFunction* Callback);
+		static bool ScriptClearTimeout(uint64_t Id);
+		static void ScriptSetSlack(uint64_t Milliseconds);
+		static uint64_t ScriptGetSlack();
+		static size_t ScriptGetPending();
+		static size_t ScriptGetMemoryUsage();
+	};
+}
+#endif
\ No newline at end of file